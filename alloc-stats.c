@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#ifndef _WIN32
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+/* Enough for every source file in whence; allocations from any
+ * further files are lumped into the last slot. */
+#define MAX_FILES 64
+
+typedef struct AllocCounter {
+    const char *file;           /* basename of __FILE__ */
+    unsigned long long allocs;
+    unsigned long long reallocs;
+    unsigned long long bytes;
+} AllocCounter;
+
+typedef struct Subsystem {
+    const char *file;
+    const char *subsystem;
+} Subsystem;
+
+/* Which subsystem each source file belongs to, for the purpose of the
+ * report.  Files not listed here are reported as "other".
+ */
+static const Subsystem subsystems[] = {
+    { "getattr.c",    "getattr"   },
+    { "xdg.c",        "getattr"   },
+    { "macos.c",      "getattr"   },
+    { "windows.c",    "getattr"   },
+    { "database.c",   "getattr"   },
+    { "registry.c",   "getattr"   },
+    { "props.c",      "parsers"   },
+    { "ndjson.c",     "parsers"   },
+    { "split.c",      "parsers"   },
+    { "where.c",      "parsers"   },
+    { "format.c",     "printers"  },
+    { "blocklist.c",  "parsers"   },
+    { "attributes.c", "printers"  },
+    { "date.c",       "printers"  },
+    { "str-buf.c",    "printers"  },
+    { "scan.c",       "scan"      },
+    { "os-unix.c",    "scan"      },
+    { "os-win32.c",   "scan"      },
+    { "inode-set.c",  "scan"      },
+    { "spill.c",      "scan"      },
+    { "sort.c",       "scan"      },
+    { "prober.c",     "scan"      },
+    { "du.c",         "scan"      },
+    { "sample.c",     "summary"   },
+    { "tally.c",      "summary"   },
+    { "summary.c",    "summary"   },
+    { "sketch.c",     "summary"   },
+    { "top.c",        "summary"   },
+    { "array-list.c", "ArrayList" },
+    { "utf-iconv.c",  "unicode"   },
+    { "utf-win32.c",  "unicode"   },
+    { "win-err.c",    "unicode"   },
+    { NULL,           NULL        }
+};
+
+bool allocStatsEnabled = false;
+
+static AllocCounter counters[MAX_FILES];
+static size_t nCounters = 0;
+static pthread_mutex_t countersLock = PTHREAD_MUTEX_INITIALIZER;
+
+static const char *subsystem_of (const char *file) {
+    const Subsystem *s;
+
+    for (s = subsystems; s->file != NULL; s++) {
+        if (0 == strcmp (s->file, file)) {
+            return s->subsystem;
+        }
+    }
+
+    return "other";
+}
+
+static AllocCounter *find_counter (const char *file) {
+    size_t i;
+
+    for (i = 0; i < nCounters; i++) {
+        if (0 == strcmp (counters[i].file, file)) {
+            return &counters[i];
+        }
+    }
+
+    if (nCounters < MAX_FILES) {
+        counters[nCounters].file = file;
+        return &counters[nCounters++];
+    } else {
+        return &counters[MAX_FILES - 1];
+    }
+}
+
+void Alloc_note (const char *file, size_t size, bool isRealloc) {
+    pthread_mutex_lock (&countersLock);
+
+    AllocCounter *c = find_counter (my_basename (file));
+
+    if (isRealloc) {
+        c->reallocs++;
+    } else {
+        c->allocs++;
+    }
+
+    c->bytes += size;
+
+    pthread_mutex_unlock (&countersLock);
+}
+
+static void print_row (const char *name,
+                       const char *subsystem,
+                       const AllocCounter *c) {
+    fprintf (stderr, "  %-14s %-10s %10llu %10llu %14llu\n",
+             name, subsystem, c->allocs, c->reallocs, c->bytes);
+}
+
+void Alloc_report (void) {
+    AllocCounter total;
+    size_t i, j;
+
+    memset (&total, 0, sizeof (total));
+    fflush (stdout);            /* keep the report after the results */
+
+    fprintf (stderr, "\nAllocations by file:\n");
+    fprintf (stderr, "  %-14s %-10s %10s %10s %14s\n",
+             "File", "Subsystem", "Allocs", "Reallocs", "Bytes");
+
+    for (i = 0; i < nCounters; i++) {
+        const AllocCounter *c = &counters[i];
+        print_row (c->file, subsystem_of (c->file), c);
+        total.allocs += c->allocs;
+        total.reallocs += c->reallocs;
+        total.bytes += c->bytes;
+    }
+
+    fprintf (stderr, "\nAllocations by subsystem:\n");
+
+    for (i = 0; i < nCounters; i++) {
+        const char *sub = subsystem_of (counters[i].file);
+        AllocCounter sum;
+
+        /* only print each subsystem once, at its first file */
+        for (j = 0; j < i; j++) {
+            if (0 == strcmp (sub, subsystem_of (counters[j].file))) {
+                break;
+            }
+        }
+
+        if (j < i) {
+            continue;
+        }
+
+        memset (&sum, 0, sizeof (sum));
+        for (j = i; j < nCounters; j++) {
+            if (0 == strcmp (sub, subsystem_of (counters[j].file))) {
+                sum.allocs += counters[j].allocs;
+                sum.reallocs += counters[j].reallocs;
+                sum.bytes += counters[j].bytes;
+            }
+        }
+
+        print_row ("", sub, &sum);
+    }
+
+    print_row ("total", "", &total);
+
+#ifndef _WIN32
+    struct rusage ru;
+    if (0 == getrusage (RUSAGE_SELF, &ru)) {
+        long maxrss = ru.ru_maxrss;
+#ifdef __APPLE__
+        maxrss /= 1024;         /* MacOS reports bytes, not kilobytes */
+#endif
+        /* This is the most memory the process ever had resident,
+         * which includes code and stacks, and not the peak of the
+         * heap; frees aren't tracked, so that isn't known. */
+        fprintf (stderr, "\nMaximum resident set size: %ld KiB\n",
+                 maxrss);
+    }
+#endif
+}
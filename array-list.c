@@ -43,8 +43,7 @@ void AL_add_nocopy (ArrayList *al, char *str) {
         if (newCap < MIN_CAP) {
             newCap = MIN_CAP;
         }
-        al->strings = realloc (al->strings, newCap * sizeof (char *));
-        CHECK_NULL (al->strings);
+        al->strings = MY_REALLOC (al->strings, newCap * sizeof (char *));
 	al->capacity = newCap;
     }
 
@@ -75,8 +74,7 @@ char *AL_join (const ArrayList *al) {
         len += strlen (al->strings[i]);
     }
 
-    char *s = malloc (len);
-    CHECK_NULL (s);
+    char *s = MY_MALLOC (len);
 
     len = 0;
     for (i = 0; i < al->size; i++) {
@@ -36,7 +36,12 @@ typedef struct PrCtx {
     bool empty;
     bool colorize;
     bool firstField;
-    bool lastFile;
+    StrBuf *out;
+    const Format *format;       /* for AS_FORMAT */
+    uint32_t fields;            /* the columns, for AS_CSV and AS_TSV */
+    char delim;                 /* between them */
+    const char *values[FV_NVALUES];
+    const char *error;
 } PrCtx;
 
 typedef struct Printer {
@@ -47,55 +52,51 @@ typedef struct Printer {
     void (*print_end) (PrCtx *ctx);
 } Printer;
 
-static void PrCtx_init (PrCtx *ctx) {
+static void PrCtx_init (PrCtx *ctx, StrBuf *out) {
     memset (ctx, 0, sizeof (*ctx));
     ctx->firstField = true;
+    ctx->out = out;
 }
 
-static void print_limited (const char *s, bool useColor) {
+static void print_limited (StrBuf *out, const char *s, bool useColor) {
     const size_t len = strlen (s);
 
     if (len <= TRUNCATION_LIMIT) {
-        writeUTF8 (stdout, s);
-        printf ("\n");
+        SB_add_len (out, s, len);
+        SB_add_char (out, '\n');
     } else {
-        char buf[TRUNCATION_LIMIT + 1];
-
-        memcpy (buf, s, TRUNCATION_LIMIT);
-        buf[TRUNCATION_LIMIT] = 0;
-
-        writeUTF8 (stdout, buf);
-        setColor (stdout, useColor, COLOR_RED);
-        printf ("... (%lu bytes)", (unsigned long) len);
-        setColor (stdout, useColor, COLOR_OFF);
-        printf ("\n");
+        SB_add_len (out, s, TRUNCATION_LIMIT);
+        SB_color (out, useColor, COLOR_RED);
+        SB_printf (out, "... (%lu bytes)", (unsigned long) len);
+        SB_color (out, useColor, COLOR_OFF);
+        SB_add_char (out, '\n');
     }
 }
 
 static void human_print_fname (const char *fname, PrCtx *ctx) {
     if (! ctx->empty) {
-        setColor (stdout, ctx->colorize, COLOR_MAGENTA);
-        writeUTF8 (stdout, fname);
-        setColor (stdout, ctx->colorize, COLOR_OFF);
-        printf (":\n");
+        SB_color (ctx->out, ctx->colorize, COLOR_MAGENTA);
+        SB_add (ctx->out, fname);
+        SB_color (ctx->out, ctx->colorize, COLOR_OFF);
+        SB_add (ctx->out, ":\n");
     }
 }
 
 static void human_print_field (const char *field,
                                const char *value,
                                PrCtx *ctx) {
-    setColor (stdout, ctx->colorize, COLOR_GREEN);
-    printf ("  %-11s ", field);
-    setColor (stdout, ctx->colorize, COLOR_OFF);
-    print_limited (value, ctx->colorize);
+    SB_color (ctx->out, ctx->colorize, COLOR_GREEN);
+    SB_printf (ctx->out, "  %-11s ", field);
+    SB_color (ctx->out, ctx->colorize, COLOR_OFF);
+    print_limited (ctx->out, value, ctx->colorize);
 }
 
 static void human_print_end (PrCtx *ctx) {
     /* do nothing */
 }
 
-static void print_string (const char *s, bool forceLC) {
-    putchar ('"');
+static void print_string (StrBuf *out, const char *s, bool forceLC) {
+    SB_add_char (out, '"');
 
     char c;
     while (0 != (c = *(s++))) {
@@ -106,26 +107,26 @@ static void print_string (const char *s, bool forceLC) {
         const unsigned char uc = (unsigned char) c;
 
         if (c == '"') {
-            printf ("\\\"");
+            SB_add (out, "\\\"");
         } else if (c == '\\') {
-            printf ("\\\\");
+            SB_add (out, "\\\\");
         } else if (uc < 0x20 || uc == 0x7f) {
-            printf ("\\u%04X", c);
+            SB_printf (out, "\\u%04X", c);
         } else if (uc >= 0x80) {
             s--;
-            s += print_escaped_unicode (s);
+            s += print_escaped_unicode (out, s);
         } else {
-            putchar (c);
+            SB_add_char (out, c);
         }
     }
 
-    putchar ('"');
+    SB_add_char (out, '"');
 }
 
 static void json_print_fname (const char *fname, PrCtx *ctx) {
-    printf ("  ");
-    print_string (fname, false);
-    printf (": {");
+    SB_add (ctx->out, "  ");
+    print_string (ctx->out, fname, false);
+    SB_add (ctx->out, ": {");
 }
 
 static void json_print_field (const char *field,
@@ -134,24 +135,124 @@ static void json_print_field (const char *field,
     if (ctx->firstField == true) {
         ctx->firstField = false;
     } else {
-        printf (",");
+        SB_add_char (ctx->out, ',');
     }
 
-    printf ("\n    ");
-    print_string (field, true);
-    printf (": ");
-    print_string (value, false);
+    SB_add (ctx->out, "\n    ");
+    print_string (ctx->out, field, true);
+    SB_add (ctx->out, ": ");
+    print_string (ctx->out, value, false);
 }
 
+/* The comma or newline which follows the closing brace is printed by
+ * the caller (see output.c), since only the caller knows whether
+ * another file is going to follow this one.
+ */
 static void json_print_end (PrCtx *ctx) {
-    printf ("\n  }");
-    if (ctx->lastFile) {
-        printf ("\n");
-    } else {
-        printf (",\n");
+    SB_add (ctx->out, "\n  }");
+}
+
+static void ndjson_print_fname (const char *fname, PrCtx *ctx) {
+    SB_add (ctx->out, "{\"path\":");
+    print_string (ctx->out, fname, false);
+}
+
+static void ndjson_print_field (const char *field,
+                                const char *value,
+                                PrCtx *ctx) {
+    SB_add_char (ctx->out, ',');
+    print_string (ctx->out, field, true);
+    SB_add_char (ctx->out, ':');
+    print_string (ctx->out, value, false);
+}
+
+static void ndjson_print_end (PrCtx *ctx) {
+    SB_add (ctx->out, "}\n");
+}
+
+static void paths_print_fname (const char *fname, PrCtx *ctx) {
+    SB_add_len (ctx->out, fname, strlen (fname) + 1);   /* with the NUL */
+}
+
+static void paths_print_field (const char *field,
+                               const char *value,
+                               PrCtx *ctx) {
+    /* do nothing */
+}
+
+static void paths_print_end (PrCtx *ctx) {
+    /* do nothing */
+}
+
+/* The AS_FORMAT, AS_CSV, and AS_TSV printers just collect the values,
+ * and print them all at the end, in an order of their own. */
+static void collect_fname (const char *fname, PrCtx *ctx) {
+    ctx->values[FV_PATH] = fname;
+}
+
+/* The printed name, the CSV column name, and the AF_* bit (or 0 if it
+ * is always printed) of each value, in the order of the FV_* values. */
+static const struct {
+    const char *field;
+    const char *column;
+    uint32_t bit;
+} valueInfo[FV_NVALUES] = {
+    { NULL,          "path",        0              },
+    { "URL",         "url",         AF_URL         },
+    { "Domain",      "domain",      AF_DOMAIN      },
+    { "Referrer",    "referrer",    AF_REFERRER    },
+    { "From",        "from",        AF_FROM        },
+    { "Subject",     "subject",     AF_SUBJECT     },
+    { "Message-ID",  "message-id",  AF_MESSAGE_ID  },
+    { "Application", "application", AF_APPLICATION },
+    { "Date",        "date",        AF_DATE        },
+    { "Zone",        "zone",        AF_ZONE        },
+    { "Same-As",     "same-as",     0              }
+};
+
+static void collect_field (const char *field,
+                           const char *value,
+                           PrCtx *ctx) {
+    int i;
+
+    for (i = FV_PATH + 1; i < FV_NVALUES; i++) {
+        if (0 == strcmp (field, valueInfo[i].field)) {
+            ctx->values[i] = value;
+            return;
+        }
+    }
+
+    if (0 == strcmp (field, "Error")) {
+        ctx->error = value;
+    }
+}
+
+static void format_print_end (PrCtx *ctx) {
+    if (! ctx->empty) {
+        Format_run (ctx->format, ctx->values, ctx->out);
     }
 }
 
+/* Every file gets a row, with an empty cell for each missing value, so
+ * that the columns are the same for every row. */
+static void table_print_end (PrCtx *ctx) {
+    int i;
+
+    for (i = 0; i < FV_NVALUES; i++) {
+        if (valueInfo[i].bit == 0 || (ctx->fields & valueInfo[i].bit)) {
+            if (ctx->values[i] != NULL) {
+                Attr_csvString (ctx->out, ctx->values[i], ctx->delim);
+            }
+            SB_add_char (ctx->out, ctx->delim);
+        }
+    }
+
+    if (ctx->error != NULL) {
+        Attr_csvString (ctx->out, ctx->error, ctx->delim);
+    }
+    SB_add_char (ctx->out, '\n');
+}
+
 static const Printer printer_human = {
     human_print_fname,
     human_print_field,
@@ -164,11 +265,44 @@ static const Printer printer_json = {
     json_print_end
 };
 
+static const Printer printer_ndjson = {
+    ndjson_print_fname,
+    ndjson_print_field,
+    ndjson_print_end
+};
+
+static const Printer printer_paths = {
+    paths_print_fname,
+    paths_print_field,
+    paths_print_end
+};
+
+static const Printer printer_format = {
+    collect_fname,
+    collect_field,
+    format_print_end
+};
+
+static const Printer printer_table = {
+    collect_fname,
+    collect_field,
+    table_print_end
+};
+
 static const Printer *get_printer (AttrStyle style) {
     switch (style) {
     case AS_HUMAN:
     case AS_HUMAN_COLOR:
         return &printer_human;
+    case AS_NDJSON:
+        return &printer_ndjson;
+    case AS_PATHS:
+        return &printer_paths;
+    case AS_FORMAT:
+        return &printer_format;
+    case AS_CSV:
+    case AS_TSV:
+        return &printer_table;
     default:
         return &printer_json;
     }
@@ -176,43 +310,132 @@ static const Printer *get_printer (AttrStyle style) {
 
 static bool is_json (AttrStyle style) {
     switch (style) {
-    case AS_JSON_NOTLAST:
-    case AS_JSON_LAST:
+    case AS_JSON:
+    case AS_NDJSON:
         return true;
     default:
         return false;
     }
 }
 
-static bool isEmpty (const Attributes *attrs) {
-    const unsigned char *p = (unsigned char *) attrs;
-    size_t i;
+static bool is_table (AttrStyle style) {
+    return (style == AS_CSV || style == AS_TSV);
+}
+
+void Attr_init (Attributes *attrs) {
+    memset (attrs, 0, sizeof (*attrs));
+}
 
-    for (i = 0; i < sizeof (*attrs); i++) {
-        if (p[i] != 0) {
+/* The names accepted by --fields, which are the JSON names of the
+ * fields (the printed names, in lower case). */
+static const struct {
+    const char *name;
+    uint32_t bit;
+} fieldNames[] = {
+    { "url",         AF_URL         },
+    { "referrer",    AF_REFERRER    },
+    { "from",        AF_FROM        },
+    { "subject",     AF_SUBJECT     },
+    { "message-id",  AF_MESSAGE_ID  },
+    { "application", AF_APPLICATION },
+    { "date",        AF_DATE        },
+    { "zone",        AF_ZONE        },
+    { "domain",      AF_DOMAIN      },
+    { NULL,          0              }
+};
+
+bool Attr_parseFields (const char *s, uint32_t *fields) {
+    *fields = 0;
+
+    while (true) {
+        const char *comma = strchr (s, ',');
+        const size_t len = (comma == NULL ? strlen (s) : (size_t) (comma - s));
+        size_t i;
+
+        for (i = 0; fieldNames[i].name != NULL; i++) {
+            if (strlen (fieldNames[i].name) == len &&
+                0 == strncmp (fieldNames[i].name, s, len)) {
+                break;
+            }
+        }
+
+        if (fieldNames[i].name == NULL) {
             return false;
         }
+
+        *fields |= fieldNames[i].bit;
+
+        if (comma == NULL) {
+            return true;
+        }
+
+        s = comma + 1;
+    }
+}
+
+const char *Attr_domain (const char *url, char *buf, size_t size) {
+    const char *host, *domain;
+    size_t hostLen, len, i;
+
+    if (! Url_host (url, &host, &hostLen) ||
+        ! Url_domain (host, hostLen, &domain, &len) ||
+        len >= size) {
+        return NULL;
     }
 
-    return true;
+    for (i = 0; i < len; i++) {
+        buf[i] = (char) tolower ((unsigned char) domain[i]);
+    }
+
+    buf[len] = 0;
+    return buf;
 }
 
-void Attr_init (Attributes *attrs) {
-    memset (attrs, 0, sizeof (*attrs));
+void Attr_present (const Attributes *attrs, StrBuf *out) {
+    const bool present[] = {
+        attrs->url != NULL,
+        attrs->referrer != NULL,
+        attrs->from != NULL,
+        attrs->subject != NULL,
+        attrs->message_id != NULL,
+        attrs->application != NULL,
+        attrs->date.secondsValid,
+        attrs->zone != NULL
+    };
+    size_t i;
+
+    /* in the same order as fieldNames */
+    for (i = 0; i < sizeof (present) / sizeof (present[0]); i++) {
+        if (present[i]) {
+            if (out->len > 0) {
+                SB_add_char (out, ',');
+            }
+            SB_add (out, fieldNames[i].name);
+        }
+    }
 }
 
-#define PR(field, value) \
-    if (value) p->print_field (field, value, &ctx)
+/* Whether a field is to be printed. */
+#define HAVE(bit, value) ((fields & (bit)) && (value) != NULL)
+
+#define PR(field, bit, value) \
+    if (HAVE(bit, value)) p->print_field (field, value, &ctx)
 
-void Attr_print (const Attributes *attrs, const char *fname, AttrStyle style) {
+void Attr_print (const Attributes *attrs,
+                 const char *fname,
+                 AttrStyle style,
+                 uint32_t fields,
+                 const Format *format,
+                 StrBuf *out) {
     const Printer *p = get_printer (style);
-    const bool lastFile = (style == AS_JSON_LAST);
 
     PrCtx ctx;
-    PrCtx_init (&ctx);
-    ctx.lastFile = lastFile;
+    PrCtx_init (&ctx, out);
+    ctx.format = format;
+    ctx.fields = fields;
+    ctx.delim = (style == AS_TSV ? '\t' : ',');
 
-    if (attrs->error != NULL && !is_json (style)) {
+    if (attrs->error != NULL && !is_json (style) && !is_table (style)) {
         err_printf ("%s: %s", fname, attrs->error);
         return;
     }
@@ -221,8 +444,8 @@ void Attr_print (const Attributes *attrs, const char *fname, AttrStyle style) {
 
     /* only MacOS records the date that the file was downloaded */
 #ifdef __APPLE__
-    if (attrs->date.secondsValid) {
-        if (is_json (style)) {
+    if (attrs->date.secondsValid && (fields & AF_DATE)) {
+        if (style != AS_HUMAN && style != AS_HUMAN_COLOR) {
             date = MyDate_format_iso8601 (&attrs->date);
         } else {
             date = MyDate_format_human (&attrs->date);
@@ -230,25 +453,124 @@ void Attr_print (const Attributes *attrs, const char *fname, AttrStyle style) {
     }
 #endif
 
-    ctx.empty = isEmpty (attrs);
+    /* the domain is derived from the URL, and is short enough (by the
+     * rules of DNS) to not need allocating */
+    char domainBuf[256];
+    const char *domain = NULL;
+    if ((fields & AF_DOMAIN) && attrs->url != NULL) {
+        domain = Attr_domain (attrs->url, domainBuf, sizeof (domainBuf));
+    }
+
+    ctx.empty = ! (HAVE(AF_URL, attrs->url) ||
+                   HAVE(AF_DOMAIN, domain) ||
+                   HAVE(AF_REFERRER, attrs->referrer) ||
+                   HAVE(AF_FROM, attrs->from) ||
+                   HAVE(AF_SUBJECT, attrs->subject) ||
+                   HAVE(AF_MESSAGE_ID, attrs->message_id) ||
+                   HAVE(AF_APPLICATION, attrs->application) ||
+                   HAVE(AF_DATE, date) ||
+                   HAVE(AF_ZONE, attrs->zone) ||
+                   attrs->same_as != NULL ||
+                   attrs->error != NULL);
     ctx.colorize = (style == AS_HUMAN_COLOR);
 
     p->print_fname (fname, &ctx);
-    PR("URL", attrs->url);
-    PR("Referrer", attrs->referrer);
-    PR("From", attrs->from);
-    PR("Subject", attrs->subject);
-    PR("Message-ID", attrs->message_id);
-    PR("Application", attrs->application);
-    PR("Date", date);
-    PR("Zone", attrs->zone);
-    PR("Error", attrs->error);
+    PR("URL", AF_URL, attrs->url);
+    PR("Domain", AF_DOMAIN, domain);
+    PR("Referrer", AF_REFERRER, attrs->referrer);
+    PR("From", AF_FROM, attrs->from);
+    PR("Subject", AF_SUBJECT, attrs->subject);
+    PR("Message-ID", AF_MESSAGE_ID, attrs->message_id);
+    PR("Application", AF_APPLICATION, attrs->application);
+    PR("Date", AF_DATE, date);
+    PR("Zone", AF_ZONE, attrs->zone);
+
+    /* these are always printed */
+    if (attrs->same_as) {
+        p->print_field ("Same-As", attrs->same_as, &ctx);
+    }
+    if (attrs->error) {
+        p->print_field ("Error", attrs->error, &ctx);
+    }
+
     p->print_end (&ctx);
 
     free (date);
 }
 
 #undef PR
+#undef HAVE
+
+void Attr_header (AttrStyle style, uint32_t fields, StrBuf *out) {
+    const char delim = (style == AS_TSV ? '\t' : ',');
+    int i;
+
+    if (! is_table (style)) {
+        return;
+    }
+
+    for (i = 0; i < FV_NVALUES; i++) {
+        if (valueInfo[i].bit == 0 || (fields & valueInfo[i].bit)) {
+            SB_add (out, valueInfo[i].column);
+            SB_add_char (out, delim);
+        }
+    }
+
+    SB_add (out, "error\n");
+}
+
+void Attr_jsonString (StrBuf *out, const char *s) {
+    print_string (out, s, false);
+}
+
+void Attr_csvString (StrBuf *out, const char *s, char delim) {
+    const char special[] = { '"', delim, '\n', '\r', 0 };
+    const size_t clean = strcspn (s, special);
+
+    /* most values need no quoting, so copy them in one go */
+    if (s[clean] == 0) {
+        SB_add_len (out, s, clean);
+        return;
+    }
+
+    SB_add_char (out, '"');
+    SB_add_len (out, s, clean);
+    s += clean;
+
+    const char *q;
+    while (NULL != (q = strchr (s, '"'))) {
+        SB_add_len (out, s, q + 1 - s);
+        SB_add_char (out, '"');
+        s = q + 1;
+    }
+
+    SB_add (out, s);
+    SB_add_char (out, '"');
+}
+
+#define MOVE(field)                     \
+    if (dest->field == NULL) {          \
+        dest->field = src->field;       \
+        src->field = NULL;              \
+    }
+
+void Attr_merge (Attributes *dest, Attributes *src) {
+    MOVE(url);
+    MOVE(referrer);
+    MOVE(from);
+    MOVE(subject);
+    MOVE(message_id);
+    MOVE(application);
+    MOVE(zone);
+    MOVE(same_as);
+    MOVE(error);
+
+    if (! dest->date.secondsValid) {
+        dest->date = src->date;
+    }
+
+    Attr_cleanup (src);
+}
 
 void Attr_cleanup (Attributes *attrs) {
     free (attrs->url);
@@ -258,6 +580,7 @@ void Attr_cleanup (Attributes *attrs) {
     free (attrs->message_id);
     free (attrs->application);
     free (attrs->zone);
+    free (attrs->same_as);
     free (attrs->error);
     Attr_init (attrs);
 }
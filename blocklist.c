@@ -0,0 +1,846 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/* A --blocklist is kept as a single block of memory (an "image"),
+ * which is either mapped straight from a file written by "whence
+ * compile-blocklist", or built in memory from a list of domains and
+ * URL prefixes.  The image is:
+ *
+ *     BlHeader
+ *     the Bloom filter, as (1 << bloomShift) bits
+ *     BlNode[nNodes]
+ *     BlPath[nPaths]
+ *     the pool of labels and paths (not NUL terminated)
+ *
+ * The nodes form a trie of the labels of the blocked hosts, from right
+ * to left (so "www.example.com" is com -> example -> www), laid out
+ * breadth first, so the children of each node are together, sorted
+ * by label, and can be binary searched.  Looking up a host takes one
+ * search per label, however long the list is.  Before the trie is
+ * touched at all, each suffix of the host is looked up in the Bloom
+ * filter, which keeps most lookups (which don't match) within a few
+ * cache lines, even when the list is too big to stay in memory.
+ *
+ * Nothing in the image is checked when it is mapped, except that the
+ * sizes add up; indices are checked as they are used, so a damaged
+ * file gives wrong answers, but doesn't crash.
+ */
+
+#define BL_MAGIC "whenceBL"
+#define BL_VERSION 1
+#define BL_BYTE_ORDER 0x01020304 /* reads differently on the wrong CPU */
+
+#define BLOOM_HASHES 4          /* bits set per host */
+#define BLOOM_BITS_PER_HOST 16  /* about 0.25% false positives */
+
+#define BL_BLOCKED 0x80000000   /* in BlNode.flags: the whole domain */
+#define BL_LEN_MASK 0xffff      /* in BlNode.flags: length of label */
+
+typedef struct BlHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t bloomShift;        /* log2 of bits in the Bloom filter */
+    uint32_t nNodes;            /* including the root, which is first */
+    uint32_t nPaths;
+    uint32_t poolSize;
+} BlHeader;
+
+typedef struct BlNode {
+    uint32_t label;             /* offset of label in pool */
+    uint32_t flags;             /* BL_BLOCKED, and the label length */
+    uint32_t firstChild;
+    uint32_t nChildren;
+    uint32_t firstPath;         /* URL prefixes on exactly this host */
+    uint32_t nPaths;
+} BlNode;
+
+typedef struct BlPath {
+    uint32_t offset;            /* in pool; starts with "/", "?", etc. */
+    uint32_t len;
+} BlPath;
+
+struct Blocklist {
+    const void *data;           /* the image */
+    size_t size;
+    bool mapped;                /* data came from mapFile() */
+    const BlHeader *hdr;
+    const uint64_t *bloom;
+    const BlNode *nodes;
+    const BlPath *paths;
+    const char *pool;
+};
+
+/* FNV-1a, like hashString(), but of a host in any case. */
+static uint64_t hash_host (const char *host, size_t len) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        h ^= (unsigned char) tolower ((unsigned char) host[i]);
+        h *= 0x100000001b3ULL;
+    }
+
+    return h;
+}
+
+/* The "i"th bit for "h" in a Bloom filter of (1 << shift) bits, made
+ * by double hashing, and mixed so that the top bits are good. */
+static uint64_t bloom_bit (uint64_t h, int i, uint32_t shift) {
+    const uint64_t x = (h + (uint64_t) i * ((h >> 32) | 1)) *
+        0x9e3779b97f4a7c15ULL;
+    return x >> (64 - shift);
+}
+
+/* Builder ------------------------------------------------------------ */
+
+typedef struct Range {
+    size_t lo, hi;              /* keys below this node */
+    size_t offset;              /* where the rest of each key starts */
+} Range;
+
+typedef struct Builder {
+    char **keys;
+    uint64_t *hashes;           /* hash_host() of each key's host */
+    size_t nKeys;
+    size_t capacity;
+    BlNode *nodes;
+    Range *ranges;
+    size_t nNodes;
+    size_t nodeCapacity;
+    BlPath *paths;
+    size_t nPaths;
+    size_t pathCapacity;
+    StrBuf pool;
+} Builder;
+
+/* Turns an entry from a list ("example.com", "*.example.com", or
+ * "https://example.com/bad/") into a key which sorts the way the trie
+ * is laid out: the labels of the host from right to left, each
+ * followed by \1, and then (for a URL prefix) \2 and the path, so
+ * "http://www.example.com/x" is "com\1example\1www\1\2/x".  The scheme
+ * and port are ignored.  Returns false if there is no host.
+ */
+static bool make_key (const char *entry, StrBuf *key, uint64_t *hash) {
+    const char *host = entry;
+    const char *path = NULL;
+    size_t len;
+
+    if (strstr (entry, "://") != NULL) {
+        if (! Url_host (entry, &host, &len)) {
+            return false;
+        }
+        path = host + len;
+        path += strcspn (path, "/?#");  /* skip the port */
+    } else {
+        while (*host == '*' || *host == '.') {
+            host++;
+        }
+        len = strcspn (host, "/");
+        if (host[len] != 0) {
+            path = host + len;
+        }
+    }
+
+    while (len > 0 && host[len - 1] == '.') {
+        len--;
+    }
+
+    if (len == 0) {
+        return false;
+    }
+
+    SB_clear (key);
+
+    size_t end = len;
+    while (true) {
+        size_t start = end;
+        while (start > 0 && host[start - 1] != '.') {
+            start--;
+        }
+
+        if (start < end) {
+            SB_add_len (key, host + start, end - start);
+            SB_add_char (key, '\1');
+        }
+
+        if (start == 0) {
+            break;
+        }
+
+        end = start - 1;
+    }
+
+    if (path != NULL) {
+        SB_add_char (key, '\2');
+        SB_add (key, path);
+    }
+
+    *hash = hash_host (host, len);
+    return true;
+}
+
+/* Finds the entry on a line of a list, which is the first word, or the
+ * second word of a hosts file line such as "0.0.0.0 example.com".
+ * Comments start with "#" or "!" (as in Adblock lists).  Writes the
+ * entry in lower case to "entry", and returns false if there isn't
+ * one.
+ */
+static bool parse_line (const char *line, size_t len, StrBuf *entry) {
+    const char *p = line;
+    const char *end = line + len;
+
+    SB_clear (entry);
+
+    while (true) {
+        while (p < end && isspace ((unsigned char) *p)) {
+            p++;
+        }
+
+        if (p == end || *p == '#' || *p == '!') {
+            return false;
+        }
+
+        const char *word = p;
+        while (p < end && ! isspace ((unsigned char) *p)) {
+            p++;
+        }
+
+        const size_t wordLen = p - word;
+        if ((wordLen == 7 && 0 == memcmp (word, "0.0.0.0", 7)) ||
+            (wordLen == 9 && 0 == memcmp (word, "127.0.0.1", 9))) {
+            continue;
+        }
+
+        size_t i;
+        for (i = 0; i < wordLen; i++) {
+            SB_add_char (entry, (char) tolower ((unsigned char) word[i]));
+        }
+        return true;
+    }
+}
+
+static void add_key (Builder *b, const StrBuf *key, uint64_t hash) {
+    if (b->nKeys == b->capacity) {
+        b->capacity = (b->capacity == 0 ? 1024 : b->capacity * 2);
+        b->keys = MY_REALLOC (b->keys, b->capacity * sizeof (char *));
+        b->hashes = MY_REALLOC (b->hashes, b->capacity * sizeof (uint64_t));
+    }
+
+    b->keys[b->nKeys] = MY_STRDUP (key->buf);
+    b->hashes[b->nKeys] = hash;
+    b->nKeys++;
+}
+
+static uint32_t add_to_pool (Builder *b, const char *s, size_t len) {
+    const uint32_t offset = (uint32_t) b->pool.len;
+
+    SB_add_len (&b->pool, s, len);
+    return offset;
+}
+
+static size_t add_node (Builder *b, const char *label, size_t len,
+                        size_t lo, size_t hi, size_t offset) {
+    if (b->nNodes == b->nodeCapacity) {
+        b->nodeCapacity = (b->nodeCapacity == 0 ? 1024 : b->nodeCapacity * 2);
+        b->nodes = MY_REALLOC (b->nodes, b->nodeCapacity * sizeof (BlNode));
+        b->ranges = MY_REALLOC (b->ranges, b->nodeCapacity * sizeof (Range));
+    }
+
+    BlNode *n = &b->nodes[b->nNodes];
+    memset (n, 0, sizeof (*n));
+    n->label = add_to_pool (b, label, len);
+    n->flags = (uint32_t) len;
+    b->ranges[b->nNodes].lo = lo;
+    b->ranges[b->nNodes].hi = hi;
+    b->ranges[b->nNodes].offset = offset;
+    return b->nNodes++;
+}
+
+static void add_path (Builder *b, const char *path) {
+    if (b->nPaths == b->pathCapacity) {
+        b->pathCapacity = (b->pathCapacity == 0 ? 64 : b->pathCapacity * 2);
+        b->paths = MY_REALLOC (b->paths, b->pathCapacity * sizeof (BlPath));
+    }
+
+    const size_t len = strlen (path);
+    b->paths[b->nPaths].offset = add_to_pool (b, path, len);
+    b->paths[b->nPaths].len = (uint32_t) len;
+    b->nPaths++;
+}
+
+static int compare_keys (const void *a, const void *b) {
+    return strcmp (*(char *const *) a, *(char *const *) b);
+}
+
+/* Lays out the trie, breadth first.  Since the keys are sorted, the
+ * keys below each node are a range of them, and the children of a node
+ * are runs within its range which share the next label. */
+static void build_trie (Builder *b) {
+    size_t i, j;
+
+    if (b->nKeys > 1) {
+        qsort (b->keys, b->nKeys, sizeof (char *), compare_keys);
+    }
+
+    /* remove duplicates */
+    for (i = j = 0; i < b->nKeys; i++) {
+        if (j > 0 && 0 == strcmp (b->keys[j - 1], b->keys[i])) {
+            free (b->keys[i]);
+        } else {
+            b->keys[j++] = b->keys[i];
+        }
+    }
+    b->nKeys = j;
+
+    add_node (b, "", 0, 0, b->nKeys, 0);
+
+    for (i = 0; i < b->nNodes; i++) {
+        const Range r = b->ranges[i];
+        size_t k = r.lo;
+
+        if (k < r.hi && b->keys[k][r.offset] == 0) {
+            b->nodes[i].flags |= BL_BLOCKED;
+            k++;
+        }
+
+        b->nodes[i].firstPath = (uint32_t) b->nPaths;
+        for ( ; k < r.hi && b->keys[k][r.offset] == '\2'; k++) {
+            add_path (b, b->keys[k] + r.offset + 1);
+        }
+        b->nodes[i].nPaths = (uint32_t) (b->nPaths - b->nodes[i].firstPath);
+
+        const size_t firstChild = b->nNodes;
+        while (k < r.hi) {
+            const char *label = b->keys[k] + r.offset;
+            const size_t len = strcspn (label, "\1");
+
+            /* the label and its \1 must match */
+            for (j = k + 1; j < r.hi; j++) {
+                if (0 != strncmp (b->keys[j] + r.offset, label, len + 1)) {
+                    break;
+                }
+            }
+
+            add_node (b, label, len, k, j, r.offset + len + 1);
+            k = j;
+        }
+
+        b->nodes[i].firstChild = (uint32_t) firstChild;
+        b->nodes[i].nChildren = (uint32_t) (b->nNodes - firstChild);
+    }
+}
+
+static void Builder_cleanup (Builder *b) {
+    size_t i;
+
+    for (i = 0; i < b->nKeys; i++) {
+        free (b->keys[i]);
+    }
+
+    free (b->keys);
+    free (b->hashes);
+    free (b->nodes);
+    free (b->ranges);
+    free (b->paths);
+    SB_cleanup (&b->pool);
+}
+
+/* Builds an image from the list "text", and writes its malloced
+ * address and size to "*image" and "*size". */
+static ErrorCode build_image (const char *fname,
+                              const char *text,
+                              size_t textLen,
+                              void **image,
+                              size_t *size) {
+    Builder b;
+    StrBuf entry, key;
+    const char *p = text;
+    const char *end = text + textLen;
+    uint64_t hash;
+    size_t i;
+    int h;
+
+    memset (&b, 0, sizeof (b));
+    SB_init (&b.pool);
+    SB_init (&entry);
+    SB_init (&key);
+
+    while (p < end) {
+        const char *nl = memchr (p, '\n', end - p);
+        const size_t len = (nl == NULL ? end : nl) - p;
+
+        if (parse_line (p, len, &entry) && make_key (entry.buf, &key, &hash)) {
+            add_key (&b, &key, hash);
+        }
+
+        p += len + 1;
+    }
+
+    SB_cleanup (&entry);
+    SB_cleanup (&key);
+
+    /* The Bloom filter is sized before duplicates are removed, so it
+     * may be a bit bigger than needed. */
+    const uint64_t bits = (uint64_t) b.nKeys * BLOOM_BITS_PER_HOST;
+    uint32_t shift = 6;
+    while (((uint64_t) 1 << shift) < bits && shift < 40) {
+        shift++;
+    }
+
+    const size_t bloomBytes = ((size_t) 1 << shift) / 8;
+    uint64_t *bloom = MY_MALLOC (bloomBytes);
+    memset (bloom, 0, bloomBytes);
+
+    for (i = 0; i < b.nKeys; i++) {
+        for (h = 0; h < BLOOM_HASHES; h++) {
+            const uint64_t bit = bloom_bit (b.hashes[i], h, shift);
+            bloom[bit / 64] |= (uint64_t) 1 << (bit % 64);
+        }
+    }
+
+    build_trie (&b);
+
+    if (b.nNodes > UINT32_MAX || b.pool.len > UINT32_MAX) {
+        err_printf ("%s: Too many entries", fname);
+        free (bloom);
+        Builder_cleanup (&b);
+        return EC_OTHER;
+    }
+
+    BlHeader hdr;
+    memset (&hdr, 0, sizeof (hdr));
+    memcpy (hdr.magic, BL_MAGIC, sizeof (hdr.magic));
+    hdr.version = BL_VERSION;
+    hdr.byteOrder = BL_BYTE_ORDER;
+    hdr.bloomShift = shift;
+    hdr.nNodes = (uint32_t) b.nNodes;
+    hdr.nPaths = (uint32_t) b.nPaths;
+    hdr.poolSize = (uint32_t) b.pool.len;
+
+    const size_t nodeBytes = b.nNodes * sizeof (BlNode);
+    const size_t pathBytes = b.nPaths * sizeof (BlPath);
+
+    *size = sizeof (hdr) + bloomBytes + nodeBytes + pathBytes + b.pool.len;
+    char *out = MY_MALLOC (*size);
+    char *q = out;
+
+    memcpy (q, &hdr, sizeof (hdr));
+    q += sizeof (hdr);
+    memcpy (q, bloom, bloomBytes);
+    q += bloomBytes;
+    memcpy (q, b.nodes, nodeBytes);
+    q += nodeBytes;
+    if (pathBytes > 0) {
+        memcpy (q, b.paths, pathBytes);
+        q += pathBytes;
+    }
+    if (b.pool.len > 0) {
+        memcpy (q, b.pool.buf, b.pool.len);
+    }
+
+    free (bloom);
+    Builder_cleanup (&b);
+    *image = out;
+    return EC_OK;
+}
+
+/* Loading ------------------------------------------------------------ */
+
+static bool is_image (const void *data, size_t size) {
+    return size >= sizeof (BlHeader) &&
+        0 == memcmp (data, BL_MAGIC, strlen (BL_MAGIC));
+}
+
+/* Checks that the sizes in the header of the image add up, and makes a
+ * Blocklist of it.  Takes ownership of the image. */
+static Blocklist *open_image (const char *fname,
+                              const void *data,
+                              size_t size,
+                              bool mapped) {
+    const BlHeader *hdr = data;
+    uint64_t expected = 0;
+
+    if (hdr->byteOrder == BL_BYTE_ORDER && hdr->version == BL_VERSION &&
+        hdr->bloomShift >= 6 && hdr->bloomShift <= 40 && hdr->nNodes > 0) {
+        expected = sizeof (BlHeader) +
+            ((uint64_t) 1 << hdr->bloomShift) / 8 +
+            (uint64_t) hdr->nNodes * sizeof (BlNode) +
+            (uint64_t) hdr->nPaths * sizeof (BlPath) +
+            hdr->poolSize;
+    }
+
+    if (expected != size) {
+        if (hdr->byteOrder != BL_BYTE_ORDER) {
+            err_printf ("%s: Compiled on a machine with a different "
+                        "byte order", fname);
+        } else {
+            err_printf ("%s: Not a valid compiled blocklist", fname);
+        }
+
+        if (mapped) {
+            unmapFile (data, size);
+        } else {
+            free ((void *) data);
+        }
+        return NULL;
+    }
+
+    Blocklist *bl = MY_MALLOC (sizeof (*bl));
+    const char *p = data;
+
+    bl->data = data;
+    bl->size = size;
+    bl->mapped = mapped;
+    bl->hdr = hdr;
+    p += sizeof (BlHeader);
+    bl->bloom = (const uint64_t *) p;
+    p += ((size_t) 1 << hdr->bloomShift) / 8;
+    bl->nodes = (const BlNode *) p;
+    p += hdr->nNodes * sizeof (BlNode);
+    bl->paths = (const BlPath *) p;
+    p += hdr->nPaths * sizeof (BlPath);
+    bl->pool = p;
+    return bl;
+}
+
+Blocklist *Blocklist_load (const char *fname) {
+    const void *data;
+    size_t size;
+    char *errmsg = NULL;
+
+    ErrorCode ec = mapFile (fname, &data, &size, &errmsg);
+    if (ec != EC_OK) {
+        err_printf ("%s: %s", fname, errmsg);
+        free (errmsg);
+        return NULL;
+    }
+
+    if (is_image (data, size)) {
+        return open_image (fname, data, size, true);
+    }
+
+    void *image = NULL;
+    size_t imageSize = 0;
+
+    ec = build_image (fname, data, size, &image, &imageSize);
+    unmapFile (data, size);
+
+    if (ec != EC_OK) {
+        return NULL;
+    }
+
+    return open_image (fname, image, imageSize, false);
+}
+
+typedef struct Image {
+    const void *data;
+    size_t size;
+} Image;
+
+static void write_image (FILE *f, const void *ctx) {
+    const Image *im = ctx;
+
+    fwrite (im->data, 1, im->size, f);
+}
+
+ErrorCode Blocklist_compile (const char *in, const char *out) {
+    const void *data;
+    size_t size;
+    char *errmsg = NULL;
+    Image im;
+
+    ErrorCode ec = mapFile (in, &data, &size, &errmsg);
+    if (ec != EC_OK) {
+        err_printf ("%s: %s", in, errmsg);
+        free (errmsg);
+        return ec;
+    }
+
+    if (is_image (data, size)) {
+        err_printf ("%s: Already compiled", in);
+        unmapFile (data, size);
+        return EC_OTHER;
+    }
+
+    void *image = NULL;
+    ec = build_image (in, data, size, &image, &im.size);
+    unmapFile (data, size);
+
+    if (ec == EC_OK) {
+        im.data = image;
+        ec = saveFile (out, write_image, &im);
+        free (image);
+    }
+
+    return ec;
+}
+
+void Blocklist_free (Blocklist *bl) {
+    if (bl == NULL) {
+        return;
+    }
+
+    if (bl->mapped) {
+        unmapFile (bl->data, bl->size);
+    } else {
+        free ((void *) bl->data);
+    }
+
+    free (bl);
+}
+
+/* Matching ----------------------------------------------------------- */
+
+/* Whether any suffix of "host" which starts at a label might be in the
+ * list. */
+static bool bloom_maybe (const Blocklist *bl, const char *host, size_t len) {
+    const uint32_t shift = bl->hdr->bloomShift;
+    size_t start = 0;
+    int h;
+
+    while (start < len) {
+        const uint64_t hash = hash_host (host + start, len - start);
+
+        for (h = 0; h < BLOOM_HASHES; h++) {
+            const uint64_t bit = bloom_bit (hash, h, shift);
+            if (! (bl->bloom[bit / 64] & ((uint64_t) 1 << (bit % 64)))) {
+                break;
+            }
+        }
+
+        if (h == BLOOM_HASHES) {
+            return true;
+        }
+
+        const char *dot = memchr (host + start, '.', len - start);
+        if (dot == NULL) {
+            break;
+        }
+        start = dot - host + 1;
+    }
+
+    return false;
+}
+
+static int compare_label (const Blocklist *bl,
+                          const BlNode *n,
+                          const char *label,
+                          size_t len) {
+    const size_t nlen = n->flags & BL_LEN_MASK;
+    size_t i;
+
+    if ((uint64_t) n->label + nlen > bl->hdr->poolSize) {
+        return 1;               /* damaged; just don't match */
+    }
+
+    const char *s = bl->pool + n->label;
+    for (i = 0; i < nlen && i < len; i++) {
+        const int c1 = (unsigned char) s[i];
+        const int c2 = tolower ((unsigned char) label[i]);
+        if (c1 != c2) {
+            return c1 - c2;
+        }
+    }
+
+    return (nlen < len ? -1 : (nlen > len ? 1 : 0));
+}
+
+static const BlNode *find_child (const Blocklist *bl,
+                                 const BlNode *parent,
+                                 const char *label,
+                                 size_t len) {
+    uint64_t lo = parent->firstChild;
+    uint64_t hi = lo + parent->nChildren;
+
+    if (hi > bl->hdr->nNodes) {
+        return NULL;
+    }
+
+    while (lo < hi) {
+        const uint64_t mid = lo + (hi - lo) / 2;
+        const int cmp = compare_label (bl, &bl->nodes[mid], label, len);
+
+        if (cmp == 0) {
+            return &bl->nodes[mid];
+        } else if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return NULL;
+}
+
+static void add_lower (StrBuf *out, const char *s, size_t len) {
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        SB_add_char (out, (char) tolower ((unsigned char) s[i]));
+    }
+}
+
+/* Looks up "host", whose URL continues with "rest" (or which isn't
+ * from a URL, if "rest" is NULL).  If it is blocked, appends the entry
+ * which blocked it to "entry", and returns true. */
+static bool lookup (const Blocklist *bl,
+                    const char *host,
+                    size_t len,
+                    const char *rest,
+                    StrBuf *entry) {
+    while (len > 0 && host[len - 1] == '.') {
+        len--;
+    }
+
+    if (len == 0 || ! bloom_maybe (bl, host, len)) {
+        return false;
+    }
+
+    const BlNode *node = &bl->nodes[0];
+    size_t end = len;
+
+    while (true) {
+        size_t start = end;
+        while (start > 0 && host[start - 1] != '.') {
+            start--;
+        }
+
+        if (start < end) {
+            node = find_child (bl, node, host + start, end - start);
+            if (node == NULL) {
+                return false;
+            } else if (node->flags & BL_BLOCKED) {
+                add_lower (entry, host + start, len - start);
+                return true;
+            }
+        }
+
+        if (start == 0) {
+            break;
+        }
+
+        end = start - 1;
+    }
+
+    uint64_t i;
+    const uint64_t last = (uint64_t) node->firstPath + node->nPaths;
+
+    if (rest == NULL || last > bl->hdr->nPaths) {
+        return false;
+    }
+
+    for (i = node->firstPath; i < last; i++) {
+        const BlPath *p = &bl->paths[i];
+        if ((uint64_t) p->offset + p->len <= bl->hdr->poolSize &&
+            0 == strncmp (rest, bl->pool + p->offset, p->len)) {
+            add_lower (entry, host, len);
+            SB_add_len (entry, bl->pool + p->offset, p->len);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static size_t report (const char *path,
+                      const char *field,
+                      const char *value,
+                      const StrBuf *entry,
+                      StrBuf *out) {
+    SB_add (out, "{\"path\":");
+    Attr_jsonString (out, path);
+    SB_add (out, ",\"field\":");
+    Attr_jsonString (out, field);
+    SB_add (out, ",\"value\":");
+    Attr_jsonString (out, value);
+    SB_add (out, ",\"match\":");
+    Attr_jsonString (out, entry->buf);
+    SB_add (out, "}\n");
+    return 1;
+}
+
+static size_t check_url (const Blocklist *bl,
+                         const char *path,
+                         const char *field,
+                         const char *url,
+                         StrBuf *out) {
+    const char *host;
+    size_t len;
+    StrBuf entry;
+    size_t n = 0;
+
+    if (url == NULL || ! Url_host (url, &host, &len)) {
+        return 0;
+    }
+
+    const char *rest = host + len;
+    rest += strcspn (rest, "/?#");      /* skip the port */
+
+    SB_init (&entry);
+    if (lookup (bl, host, len, rest, &entry)) {
+        n = report (path, field, url, &entry, out);
+    }
+    SB_cleanup (&entry);
+    return n;
+}
+
+/* "from" is an address such as "Someone <someone@example.com>". */
+static size_t check_email (const Blocklist *bl,
+                           const char *path,
+                           const char *field,
+                           const char *from,
+                           StrBuf *out) {
+    StrBuf entry;
+    size_t n = 0;
+    const char *at = (from == NULL ? NULL : strrchr (from, '@'));
+
+    if (at == NULL) {
+        return 0;
+    }
+
+    const char *host = at + 1;
+    const size_t len = strcspn (host, "> \t");
+
+    SB_init (&entry);
+    if (lookup (bl, host, len, NULL, &entry)) {
+        n = report (path, field, from, &entry, out);
+    }
+    SB_cleanup (&entry);
+    return n;
+}
+
+size_t Blocklist_check (const Blocklist *bl,
+                        const char *path,
+                        const Attributes *attrs,
+                        StrBuf *out) {
+    return check_url (bl, path, "url", attrs->url, out) +
+        check_url (bl, path, "referrer", attrs->referrer, out) +
+        check_email (bl, path, "from", attrs->from, out);
+}
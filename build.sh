@@ -9,8 +9,8 @@ case $OS in
                  -liconv \
 		 -mmacosx-version-min=10.6 \
 		 -Wall -O3 *.c;;
-    FreeBSD) exec clang -o whence -Wall -O3 *.c;;
-    Linux)   exec gcc   -o whence -Wall -O3 *.c;;
-    Windows) exec gcc   -o whence -municode -Wall -O3 *.c;;
+    FreeBSD) exec clang -o whence -pthread -Wall -O3 *.c -lm;;
+    Linux)   exec gcc   -o whence -pthread -Wall -O3 *.c -lm;;
+    Windows) exec gcc   -o whence -municode -pthread -Wall -O3 *.c -lm;;
     *)       echo \"$OS\" is not a supported OS. && exit 1;;
 esac
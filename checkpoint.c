@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+
+/* A checkpoint file is text, except that paths are stored as a length
+ * followed by the raw bytes, since a path may contain a newline:
+ *
+ *   whence-checkpoint 1
+ *   output 12345            (or "output -" if stdout wasn't a file)
+ *   done 100 2000           (directories and files finished)
+ *   D 2049 11               (a directory, its root device, path length)
+ *   /home/alice
+ *   D 2049 15 300           (one cut short, with 300 entries done)
+ *   /home/alice/big
+ *   F 0 9                   (a file named on the command line)
+ *   notes.pdf
+ *   end
+ *
+ * The "end" line shows that the file wasn't cut short.
+ */
+
+#define MAGIC "whence-checkpoint 1"
+
+void Checkpoint_init (Checkpoint *cp) {
+    memset (cp, 0, sizeof (*cp));
+}
+
+void Checkpoint_cleanup (Checkpoint *cp) {
+    size_t i;
+
+    for (i = 0; i < cp->nJobs; i++) {
+        free (cp->jobs[i].path);
+    }
+
+    free (cp->jobs);
+    Checkpoint_init (cp);
+}
+
+void Checkpoint_add (Checkpoint *cp,
+                     const char *path,
+                     bool isDir,
+                     uint64_t rootDevice,
+                     uint64_t skip) {
+    if (cp->nJobs >= cp->capacity) {
+        cp->capacity = (cp->capacity < 64 ? 64 : cp->capacity * 2);
+        cp->jobs = MY_REALLOC (cp->jobs, cp->capacity * sizeof (cp->jobs[0]));
+    }
+
+    FrontierJob *job = &cp->jobs[cp->nJobs++];
+    job->path = MY_STRDUP (path);
+    job->isDir = isDir;
+    job->rootDevice = rootDevice;
+    job->skip = skip;
+}
+
+static void write_checkpoint (FILE *f, const void *ctx) {
+    const Checkpoint *cp = (const Checkpoint *) ctx;
+    size_t i;
+
+    fprintf (f, MAGIC "\n");
+
+    if (cp->haveOffset) {
+        fprintf (f, "output %" PRIu64 "\n", cp->offset);
+    } else {
+        fprintf (f, "output -\n");
+    }
+
+    fprintf (f, "done %" PRIu64 " %" PRIu64 "\n", cp->nDirs, cp->nFiles);
+
+    for (i = 0; i < cp->nJobs; i++) {
+        const FrontierJob *job = &cp->jobs[i];
+        fprintf (f, "%c %" PRIu64 " %lu",
+                 (job->isDir ? 'D' : 'F'),
+                 job->rootDevice,
+                 (unsigned long) strlen (job->path));
+        if (job->skip > 0) {
+            fprintf (f, " %" PRIu64, job->skip);
+        }
+        fputc ('\n', f);
+        fputs (job->path, f);
+        fputc ('\n', f);
+    }
+
+    fprintf (f, "end\n");
+}
+
+ErrorCode Checkpoint_save (const Checkpoint *cp, const char *fname) {
+    return saveFile (fname, write_checkpoint, cp);
+}
+
+static bool read_checkpoint (Checkpoint *cp, FILE *f) {
+    StrBuf line;
+    bool ok = false;
+
+    SB_init (&line);
+
+    if (! SB_getline (&line, f) || 0 != strcmp (line.buf, MAGIC)) {
+        goto done;
+    }
+
+    if (! SB_getline (&line, f)) {
+        goto done;
+    } else if (0 == strcmp (line.buf, "output -")) {
+        cp->haveOffset = false;
+    } else if (1 == sscanf (line.buf, "output %" SCNu64, &cp->offset)) {
+        cp->haveOffset = true;
+    } else {
+        goto done;
+    }
+
+    if (! SB_getline (&line, f) ||
+        2 != sscanf (line.buf, "done %" SCNu64 " %" SCNu64,
+                     &cp->nDirs, &cp->nFiles)) {
+        goto done;
+    }
+
+    while (SB_getline (&line, f)) {
+        char type;
+        uint64_t rootDevice;
+        uint64_t skip = 0;
+        unsigned long len;
+
+        if (0 == strcmp (line.buf, "end")) {
+            ok = true;
+            break;
+        }
+
+        if (3 > sscanf (line.buf, "%c %" SCNu64 " %lu %" SCNu64,
+                        &type, &rootDevice, &len, &skip) ||
+            (type != 'D' && type != 'F')) {
+            break;
+        }
+
+        char *path = MY_MALLOC (len + 2);
+        if (fread (path, 1, len + 1, f) != len + 1 || path[len] != '\n' ||
+            memchr (path, 0, len) != NULL) {
+            free (path);
+            break;
+        }
+
+        path[len] = 0;
+        Checkpoint_add (cp, path, (type == 'D'), rootDevice, skip);
+        free (path);
+    }
+
+ done:
+    SB_cleanup (&line);
+    return ok;
+}
+
+ErrorCode Checkpoint_load (Checkpoint *cp, const char *fname) {
+    Checkpoint_init (cp);
+
+    FILE *f = openFile (fname, "rb");
+    if (f == NULL) {
+        const int errnum = errno;
+        err_printf ("%s: %s", fname, strerror (errnum));
+        return (errnum == ENOENT ? EC_NOFILE : EC_OTHER);
+    }
+
+    const bool ok = read_checkpoint (cp, f);
+    fclose (f);
+
+    if (! ok) {
+        err_printf ("%s: Not a valid checkpoint file", fname);
+        Checkpoint_cleanup (cp);
+        return EC_OTHER;
+    }
+
+    return EC_OK;
+}
@@ -52,17 +52,19 @@ void MyDate_set_fractional (MyDate *date, double t) {
 
 char *MyDate_format_human (const MyDate *date) {
     const time_t t = date->seconds;
+    struct tm tm;
     char buf[40];
 
-    strftime (buf, sizeof (buf), "%+", localtime (&t));
+    strftime (buf, sizeof (buf), "%+", localtime_r (&t, &tm));
     return MY_STRDUP (buf);
 }
 
 char *MyDate_format_iso8601 (const MyDate *date) {
     const time_t t = date->seconds;
+    struct tm tm;
     char buf1[40], buf2[40];
 
-    strftime (buf1, sizeof (buf1), "%Y-%m-%dT%H:%M:%S", gmtime (&t));
+    strftime (buf1, sizeof (buf1), "%Y-%m-%dT%H:%M:%S", gmtime_r (&t, &tm));
     if (date->millisValid) {
         snprintf (buf2, sizeof (buf2),
                   "%s.%03uZ", buf1, (unsigned int) date->milliseconds);
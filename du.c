@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+/* "whence du" totals up the files with provenance under each
+ * directory, like du(1).  The tree is walked depth first, one
+ * directory at a time, and a directory's row is printed once
+ * everything under it is done (post-order), after which its totals
+ * are added to its parent's.  Each directory is read in one go when it
+ * is reached: its files are counted then, and the names of its
+ * subdirectories are kept, so its DirReader is closed before anything
+ * under it is opened.  So only one directory is open at a time, and
+ * what is held in memory is the directories on the path from the root
+ * to the current one, with the subdirectories each has left to visit,
+ * rather than the whole tree.  The origins of each directory are
+ * counted in a small Sketch, so they take a fixed amount of memory too.
+ */
+
+#define DU_ORIGINS 3            /* origins printed for each directory */
+#define DU_SKETCH 32            /* origins counted for each directory */
+
+typedef struct DuFrame {
+    char *path;
+    ArrayList subdirs;          /* names of the subdirectories */
+    size_t next;                /* index in subdirs of the next to visit */
+    uint64_t device;
+    unsigned long depth;        /* 0 for the directory named */
+    uint64_t nFiles;            /* files with provenance, in the subtree */
+    uint64_t nBytes;            /* the sum of their sizes */
+    Sketch *origins;            /* domains of their URLs (or referrers) */
+} DuFrame;
+
+typedef struct Du {
+    DuFrame *stack;
+    size_t depth;               /* number of frames in use */
+    size_t capacity;
+    unsigned long maxDepth;     /* deepest directory to print */
+    bool json;
+    Cache cache;
+    StrBuf out;
+    ErrorCode ec;
+} Du;
+
+static void report (Du *du, const char *path, ErrorCode ec, char *errmsg) {
+    err_printf ("%s: %s", path, (errmsg != NULL ? errmsg : "error"));
+    free (errmsg);
+    du->ec = combineErrors (du->ec, ec);
+}
+
+/* Counts the file "path" in the directory "f", if it has provenance.
+ * Most files don't, so that is checked first, without reading
+ * anything; only then are the URLs read, and the size looked up. */
+static void add_file (Du *du, DuFrame *f, const char *path) {
+    AttrQuery query;
+    Attributes attrs;
+    uint64_t size = 0;
+    char *errmsg = NULL;
+    char buf[256];
+
+    query.device = f->device;
+    query.presenceOnly = true;
+    query.fields = AF_DEFAULT;
+    Attr_init (&attrs);
+
+    ErrorCode ec = getAttributes (path, &query, &attrs, &du->cache);
+    if (ec == EC_OK) {
+        Attr_cleanup (&attrs);
+        Attr_init (&attrs);
+        query.presenceOnly = false;
+        query.fields = AF_URL | AF_REFERRER;
+        ec = combineErrors (EC_OK, getAttributes (path, &query, &attrs,
+                                                   &du->cache));
+    }
+
+    if (ec == EC_OK) {
+        ec = getFileSize (path, &size, &errmsg);
+    }
+
+    if (ec == EC_OK) {
+        const char *url = (attrs.url != NULL ? attrs.url : attrs.referrer);
+        const char *domain = NULL;
+        if (url != NULL) {
+            domain = Attr_domain (url, buf, sizeof (buf));
+        }
+        if (domain != NULL) {
+            Sketch_add (f->origins, domain);
+        }
+
+        f->nFiles++;
+        f->nBytes += size;
+        du->ec = combineErrors (du->ec, EC_OK);
+    } else if (ec != EC_NOATTR) {
+        if (errmsg == NULL && attrs.error != NULL) {
+            errmsg = attrs.error;       /* transfer ownership */
+            attrs.error = NULL;
+        }
+        report (du, path, ec, errmsg);
+    }
+
+    Attr_cleanup (&attrs);
+}
+
+/* Reads the directory "path" (which is malloced, and is taken over)
+ * and pushes it on the stack, counting the files in it and noting its
+ * subdirectories, which are visited later. */
+static void push_dir (Du *du, char *path, unsigned long depth) {
+    DirReader *dr = NULL;
+    DirEntry ent;
+    char *errmsg = NULL;
+    DuFrame *f;
+
+    ErrorCode ec = Dir_open (path, &dr, &errmsg);
+    if (ec != EC_OK) {
+        report (du, path, ec, errmsg);
+        free (path);
+        return;
+    }
+
+    if (du->depth >= du->capacity) {
+        du->capacity = (du->capacity < 16 ? 16 : du->capacity * 2);
+        du->stack = MY_REALLOC (du->stack, du->capacity * sizeof (DuFrame));
+    }
+
+    f = &du->stack[du->depth++];
+    memset (f, 0, sizeof (*f));
+    f->path = path;
+    AL_init (&f->subdirs);
+    f->device = Dir_device (dr);
+    f->depth = depth;
+    f->origins = Sketch_new (DU_SKETCH);
+
+    while (Dir_read (dr, &ent)) {
+        char *child = joinPath (path, ent.name);
+        FileType type = ent.type;
+
+        if (type == FT_UNKNOWN) {
+            FileInfo info;
+            ec = getFileInfo (child, false, &info, &errmsg);
+            if (ec != EC_OK) {
+                report (du, child, ec, errmsg);
+                errmsg = NULL;
+                free (child);
+                continue;
+            }
+            type = info.type;
+        }
+
+        if (type == FT_DIR) {
+            AL_add (&f->subdirs, ent.name);
+        } else if (type == FT_FILE) {
+            add_file (du, f, child);
+        }
+        free (child);
+    }
+
+    ec = Dir_close (dr, &errmsg);
+    if (ec != EC_OK) {
+        report (du, path, ec, errmsg);
+    }
+}
+
+static void print_row (Du *du, const DuFrame *f) {
+    const SketchEntry **sorted = Sketch_sorted (f->origins);
+    StrBuf *out = &du->out;
+    size_t i;
+
+    SB_clear (out);
+
+    if (du->json) {
+        SB_add (out, "{\"path\":");
+        Attr_jsonString (out, f->path);
+        SB_printf (out, ",\"files\":%llu,\"bytes\":%llu,\"origins\":{",
+                   (unsigned long long) f->nFiles,
+                   (unsigned long long) f->nBytes);
+        for (i = 0; i < DU_ORIGINS && sorted[i] != NULL; i++) {
+            if (i > 0) {
+                SB_add_char (out, ',');
+            }
+            Attr_jsonString (out, sorted[i]->key);
+            SB_printf (out, ":%llu", (unsigned long long) sorted[i]->count);
+        }
+        SB_add (out, "}}\n");
+    } else {
+        SB_printf (out, "%llu\t%llu\t%s\t",
+                   (unsigned long long) f->nFiles,
+                   (unsigned long long) f->nBytes, f->path);
+        for (i = 0; i < DU_ORIGINS && sorted[i] != NULL; i++) {
+            SB_add (out, (i > 0 ? ", " : ""));
+            SB_add (out, sorted[i]->key);
+        }
+        SB_add_char (out, '\n');
+    }
+
+    writeUTF8 (stdout, out->buf);
+    free (sorted);
+}
+
+/* Finishes the directory on top of the stack: prints it, and adds its
+ * totals to its parent's. */
+static void pop_dir (Du *du) {
+    DuFrame *f = &du->stack[du->depth - 1];
+
+    if (f->depth <= du->maxDepth) {
+        print_row (du, f);
+    }
+
+    if (du->depth > 1) {
+        DuFrame *parent = f - 1;
+        parent->nFiles += f->nFiles;
+        parent->nBytes += f->nBytes;
+        Sketch_merge (parent->origins, f->origins);
+    }
+
+    Sketch_free (f->origins);
+    AL_cleanup (&f->subdirs);
+    free (f->path);
+    du->depth--;
+}
+
+static void du_tree (Du *du, const char *root) {
+    push_dir (du, MY_STRDUP (root), 0);
+
+    while (du->depth > 0) {
+        DuFrame *f = &du->stack[du->depth - 1];
+
+        if (f->next >= f->subdirs.size) {
+            pop_dir (du);
+        } else {
+            /* the new frame takes ownership of the path */
+            push_dir (du, joinPath (f->path, f->subdirs.strings[f->next++]),
+                      f->depth + 1);
+        }
+    }
+}
+
+ErrorCode duFiles (char *const *dirs,
+                   size_t nDirs,
+                   unsigned long maxDepth,
+                   bool json) {
+    Du du;
+    size_t i;
+
+    memset (&du, 0, sizeof (du));
+    du.maxDepth = maxDepth;
+    du.json = json;
+    du.ec = EC_NOATTR;
+    Cache_init (&du.cache);
+    SB_init (&du.out);
+
+    for (i = 0; i < nDirs; i++) {
+        du_tree (&du, dirs[i]);
+    }
+
+    fflush (stdout);
+    SB_cleanup (&du.out);
+    Cache_cleanup (&du.cache);
+    free (du.stack);
+
+    /* Finding no provenance is not a failure here. */
+    return (du.ec == EC_NOATTR ? EC_OK : du.ec);
+}
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* A --format template is compiled once, into a list of ops, each of
+ * which either copies a piece of literal text or prints one of the
+ * values of the record, escaped in one of several ways.  Format_run()
+ * just walks the list.
+ */
+
+typedef enum FormatEscape {
+    FE_RAW,                     /* as it is */
+    FE_SHELL,                   /* quoted for a POSIX shell, if need be */
+    FE_JSON,                    /* a JSON string, or null if missing */
+    FE_CSV                      /* quoted as in RFC 4180, if need be */
+} FormatEscape;
+
+typedef struct FormatOp {
+    int value;                  /* FV_* index, or -1 for literal text */
+    FormatEscape escape;
+    size_t offset;              /* of literal text in "literals" */
+    size_t len;
+} FormatOp;
+
+struct Format {
+    FormatOp *ops;
+    size_t nOps;
+    StrBuf literals;
+    uint32_t fields;            /* AF_* bits of the values used */
+};
+
+static const struct {
+    const char *name;
+    int value;
+    uint32_t bit;
+} valueNames[] = {
+    { "path",        FV_PATH,        0              },
+    { "url",         FV_URL,         AF_URL         },
+    { "domain",      FV_DOMAIN,      AF_DOMAIN      },
+    { "referrer",    FV_REFERRER,    AF_REFERRER    },
+    { "from",        FV_FROM,        AF_FROM        },
+    { "subject",     FV_SUBJECT,     AF_SUBJECT     },
+    { "message-id",  FV_MESSAGE_ID,  AF_MESSAGE_ID  },
+    { "application", FV_APPLICATION, AF_APPLICATION },
+    { "date",        FV_DATE,        AF_DATE        },
+    { "zone",        FV_ZONE,        AF_ZONE        },
+    { "same-as",     FV_SAME_AS,     0              },
+    { NULL,          0,              0              }
+};
+
+static const char *const escapeNames[] = { "raw", "shell", "json", "csv" };
+
+static void format_error (const char *src, const char *p, const char *what) {
+    if (*p == 0) {
+        err_printf (CMD_NAME ": --format: %s at end of '%s'", what, src);
+    } else {
+        err_printf (CMD_NAME ": --format: %s at character %lu of '%s'",
+                    what, (unsigned long) (p - src + 1), src);
+    }
+}
+
+static FormatOp *add_op (Format *f, size_t *capacity) {
+    if (f->nOps >= *capacity) {
+        *capacity = (*capacity < 8 ? 8 : *capacity * 2);
+        f->ops = MY_REALLOC (f->ops, *capacity * sizeof (FormatOp));
+    }
+
+    FormatOp *op = &f->ops[f->nOps++];
+    memset (op, 0, sizeof (*op));
+    return op;
+}
+
+/* Adds "c" to the literal text, extending the previous op if it is
+ * literal text too. */
+static void add_literal (Format *f, size_t *capacity, char c) {
+    FormatOp *op = (f->nOps > 0 ? &f->ops[f->nOps - 1] : NULL);
+
+    if (op == NULL || op->value >= 0) {
+        op = add_op (f, capacity);
+        op->value = -1;
+        op->offset = f->literals.len;
+    }
+
+    SB_add_char (&f->literals, c);
+    op->len++;
+}
+
+/* Parses "name" or "name:escape", which is "len" bytes at "p". */
+static bool parse_value (Format *f, FormatOp *op, const char *p, size_t len) {
+    const char *colon = memchr (p, ':', len);
+    const size_t nameLen = (colon != NULL ? (size_t) (colon - p) : len);
+    size_t i;
+
+    for (i = 0; valueNames[i].name != NULL; i++) {
+        if (strlen (valueNames[i].name) == nameLen &&
+            0 == strncmp (valueNames[i].name, p, nameLen)) {
+            break;
+        }
+    }
+
+    if (valueNames[i].name == NULL) {
+        return false;
+    }
+
+    op->value = valueNames[i].value;
+    f->fields |= valueNames[i].bit;
+
+    if (colon == NULL) {
+        op->escape = FE_RAW;
+        return true;
+    }
+
+    const size_t escLen = len - nameLen - 1;
+    for (i = 0; i < sizeof (escapeNames) / sizeof (escapeNames[0]); i++) {
+        if (strlen (escapeNames[i]) == escLen &&
+            0 == strncmp (escapeNames[i], colon + 1, escLen)) {
+            op->escape = (FormatEscape) i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Format *Format_compile (const char *s) {
+    Format *f = MY_MALLOC (sizeof (*f));
+    size_t capacity = 0;
+    const char *p = s;
+
+    memset (f, 0, sizeof (*f));
+    SB_init (&f->literals);
+
+    while (*p != 0) {
+        const char *start = p;
+
+        if (*p == '\\') {
+            switch (p[1]) {
+            case 'n':  add_literal (f, &capacity, '\n'); break;
+            case 't':  add_literal (f, &capacity, '\t'); break;
+            case 'r':  add_literal (f, &capacity, '\r'); break;
+            case '0':  add_literal (f, &capacity, 0);    break;
+            case '\\': add_literal (f, &capacity, '\\'); break;
+            default:
+                format_error (s, start, "unknown escape");
+                Format_free (f);
+                return NULL;
+            }
+            p += 2;
+        } else if (*p != '%') {
+            add_literal (f, &capacity, *(p++));
+        } else if (p[1] == '%') {
+            add_literal (f, &capacity, '%');
+            p += 2;
+        } else if (p[1] == 'p') {
+            FormatOp *op = add_op (f, &capacity);
+            op->value = FV_PATH;
+            op->escape = FE_RAW;
+            p += 2;
+        } else if (p[1] == '{') {
+            const char *end = strchr (p + 2, '}');
+            if (end == NULL) {
+                format_error (s, start, "missing '}'");
+                Format_free (f);
+                return NULL;
+            }
+
+            FormatOp *op = add_op (f, &capacity);
+            if (! parse_value (f, op, p + 2, end - (p + 2))) {
+                format_error (s, start, "unknown field or escape");
+                Format_free (f);
+                return NULL;
+            }
+            p = end + 1;
+        } else {
+            format_error (s, start, "expected '%p', '%{', or '%%'");
+            Format_free (f);
+            return NULL;
+        }
+    }
+
+    return f;
+}
+
+uint32_t Format_fields (const Format *f) {
+    return f->fields;
+}
+
+/* Appends "s" quoted for a POSIX shell: as it is, if it only has
+ * characters which are never special, or else in single quotes. */
+static void add_shell (StrBuf *out, const char *s) {
+    const char *p;
+
+    if (*s != 0 && s[strspn (s, "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                             "abcdefghijklmnopqrstuvwxyz"
+                             "0123456789@%+=:,./_-")] == 0) {
+        SB_add (out, s);
+        return;
+    }
+
+    SB_add_char (out, '\'');
+    for (p = s; *p != 0; p++) {
+        if (*p == '\'') {
+            SB_add (out, "'\\''");
+        } else {
+            SB_add_char (out, *p);
+        }
+    }
+    SB_add_char (out, '\'');
+}
+
+void Format_run (const Format *f, const char *const *values, StrBuf *out) {
+    size_t i;
+
+    for (i = 0; i < f->nOps; i++) {
+        const FormatOp *op = &f->ops[i];
+
+        if (op->value < 0) {
+            SB_add_len (out, f->literals.buf + op->offset, op->len);
+            continue;
+        }
+
+        const char *v = values[op->value];
+
+        switch (op->escape) {
+        case FE_RAW:
+            if (v != NULL) {
+                SB_add (out, v);
+            }
+            break;
+        case FE_SHELL:
+            add_shell (out, (v != NULL ? v : ""));
+            break;
+        case FE_JSON:
+            if (v != NULL) {
+                Attr_jsonString (out, v);
+            } else {
+                SB_add (out, "null");
+            }
+            break;
+        case FE_CSV:
+            if (v != NULL) {
+                Attr_csvString (out, v, ',');
+            }
+            break;
+        }
+    }
+}
+
+void Format_free (Format *f) {
+    if (f != NULL) {
+        SB_cleanup (&f->literals);
+        free (f->ops);
+        free (f);
+    }
+}
@@ -28,6 +28,8 @@
 #include <string.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
 
 #ifdef __APPLE__
 #include <sys/xattr.h>
@@ -55,6 +57,91 @@ static ssize_t call_getxattr (const char *path,
 #endif
 }
 
+/* Lists the names of the user extended attributes of "path" into
+ * "buf", each followed by a NUL, as listxattr() does.  Returns the
+ * number of bytes used, or -1 with errno set (to ERANGE if "size" isn't
+ * enough).  With a "size" of 0, just returns the number of bytes needed.
+ */
+static ssize_t call_listxattr (const char *path, char *buf, size_t size) {
+#ifdef __APPLE__
+    return listxattr (path, (size == 0 ? NULL : buf), size, 0);
+#elif defined(__FreeBSD__)
+    /* FreeBSD truncates instead of failing, and gives each name a
+     * length byte in front instead of a NUL after, so shift the names
+     * down a byte each. */
+    const ssize_t len = extattr_list_file (path, EXTATTR_NAMESPACE_USER,
+                                           (size == 0 ? NULL : buf), size);
+    ssize_t i = 0;
+
+    if (len < 0 || size == 0) {
+        return len;
+    } else if ((size_t) len == size) {
+        errno = ERANGE;         /* maybe truncated; ask for the size */
+        return -1;
+    }
+
+    while (i < len) {
+        const size_t n = (unsigned char) buf[i];
+        memmove (buf + i, buf + i + 1, n);
+        buf[i + n] = 0;
+        i += n + 1;
+    }
+
+    return len;
+#elif defined (__linux__)
+    return listxattr (path, (size == 0 ? NULL : buf), size);
+#endif
+}
+
+/* Devices on which getxattr() has failed with ENOTSUP.  Some
+ * filesystems (vfat, procfs, some NFS exports) don't support user
+ * extended attributes at all, and once we know that, it is pointless
+ * to keep asking for each attribute of each file.
+ *
+ * We key this on the device, rather than on the filesystem type from
+ * statfs(), because support can differ between two mounts of the same
+ * type (e.g. two NFS servers).  There are only ever a handful of such
+ * devices, so the list is append-only, and a fixed size.  That lets
+ * xattrsUnsupported() read it without taking a lock: each slot is
+ * written before nNoXattr is incremented to include it.
+ */
+#define MAX_NOXATTR 64
+
+static _Atomic uint64_t noXattr[MAX_NOXATTR];
+static atomic_size_t nNoXattr;
+static pthread_mutex_t noXattrLock = PTHREAD_MUTEX_INITIALIZER;
+
+bool xattrsUnsupported (const AttrQuery *query) {
+    const uint64_t device = query->device;
+
+    if (device != 0) {
+        const size_t n = atomic_load (&nNoXattr);
+        size_t i;
+
+        for (i = 0; i < n; i++) {
+            if (atomic_load (&noXattr[i]) == device) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+static void markUnsupported (const AttrQuery *query) {
+    if (query->device != 0) {
+        pthread_mutex_lock (&noXattrLock);
+
+        const size_t n = atomic_load (&nNoXattr);
+        if (n < MAX_NOXATTR && ! xattrsUnsupported (query)) {
+            atomic_store (&noXattr[n], query->device);
+            atomic_store (&nNoXattr, n + 1);
+        }
+
+        pthread_mutex_unlock (&noXattrLock);
+    }
+}
+
 static ErrorCode errnum2ec (int errnum) {
     switch (errnum) {
 #ifdef ENOATTR
@@ -78,6 +165,7 @@ static ErrorCode errnum2ec (int errnum) {
 
 ErrorCode getAttribute (const char *fname,
                         const char *attr,
+                        const AttrQuery *query,
                         char **result,
                         size_t *length) {
     *result = NULL;
@@ -87,14 +175,17 @@ ErrorCode getAttribute (const char *fname,
     ssize_t ret2 = ret1;
 
     if (ret1 >= 0) {
-        *result = malloc (ret1 + 1); /* leave room for NUL terminator */
-        CHECK_NULL (*result);
+        *result = MY_MALLOC (ret1 + 1); /* leave room for NUL terminator */
         ret2 = call_getxattr (fname, attr, *result, ret1 + 1);
     }
 
     if (ret2 < 0) {
         const int errnum = errno;
         const char *errmsg = strerror (errnum);
+        if (errnum == ENOTSUP) {
+            markUnsupported (query);
+        }
+
         free (*result);
         *result = MY_STRDUP (errmsg);
         *length = strlen (*result);
@@ -116,6 +207,68 @@ ErrorCode getAttribute (const char *fname,
     return EC_OK;
 }
 
+ErrorCode probeAttributes (const char *fname,
+                           const AttrName *names,
+                           const AttrQuery *query,
+                           char **errmsg) {
+    char stackBuf[1024];
+    char *buf = stackBuf;
+    ssize_t len;
+    ErrorCode ec = EC_NOATTR;
+
+    *errmsg = NULL;
+
+    if (xattrsUnsupported (query)) {
+        return EC_NOATTR;
+    }
+
+    /* Most files have no attributes, or a few, so one call is usually
+     * enough. */
+    len = call_listxattr (fname, buf, sizeof (stackBuf));
+    if (len < 0 && errno == ERANGE) {
+        len = call_listxattr (fname, NULL, 0);
+        if (len >= 0) {
+            buf = MY_MALLOC (len + 1);
+            len = call_listxattr (fname, buf, len + 1);
+        }
+    }
+
+    if (len < 0) {
+        const int errnum = errno;
+        if (errnum == ENOTSUP) {
+            markUnsupported (query);
+        }
+
+        *errmsg = MY_STRDUP (strerror (errnum));
+        ec = errnum2ec (errnum);
+    } else {
+        const char *p = buf;
+        const char *const end = buf + len;
+
+        while (p < end && ec != EC_OK) {
+            const size_t n = strnlen (p, end - p);
+            size_t i;
+
+            for (i = 0; names[i].name != NULL; i++) {
+                if ((names[i].fields & query->fields) != 0 &&
+                    strlen (names[i].name) == n &&
+                    0 == memcmp (p, names[i].name, n)) {
+                    ec = EC_OK;
+                    break;
+                }
+            }
+
+            p += n + 1;
+        }
+    }
+
+    if (buf != stackBuf) {
+        free (buf);
+    }
+
+    return ec;
+}
+
 /* This function only does anything on Windows (see windows.c).
  * On UNIX, all we have to do is copy the filename, so it can
  * be freed later.
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+/* A hash set of (device, inode) pairs, used by --dedup to notice when
+ * the scan reaches a file it has already seen, through another hard
+ * link or a bind mount.  For each pair, the path it was first seen
+ * under is kept, so that repeats can be reported as aliases.
+ *
+ * The set is split into shards, each with its own lock and its own
+ * open-addressed table, so that the scanning threads rarely contend.
+ */
+
+#define NUM_SHARDS 64           /* must be a power of 2 */
+#define MIN_CAP 64              /* must be a power of 2 */
+
+typedef struct InodeEntry {
+    uint64_t device;
+    uint64_t inode;
+    char *path;                 /* malloced; NULL if slot is empty */
+} InodeEntry;
+
+typedef struct InodeShard {
+    pthread_mutex_t lock;
+    InodeEntry *entries;        /* "capacity" slots */
+    size_t size;                /* number of slots in use */
+    size_t capacity;            /* a power of 2, or 0 */
+} InodeShard;
+
+struct InodeSet {
+    InodeShard shards[NUM_SHARDS];
+};
+
+/* The finalizer from SplitMix64, to spread inode numbers (which are
+ * often sequential) evenly over the table. */
+static uint64_t mix (uint64_t device, uint64_t inode) {
+    uint64_t z = inode ^ (device * 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+InodeSet *InodeSet_new (void) {
+    InodeSet *set = MY_MALLOC (sizeof (*set));
+    size_t i;
+
+    memset (set, 0, sizeof (*set));
+    for (i = 0; i < NUM_SHARDS; i++) {
+        pthread_mutex_init (&set->shards[i].lock, NULL);
+    }
+
+    return set;
+}
+
+void InodeSet_free (InodeSet *set) {
+    size_t i, j;
+
+    for (i = 0; i < NUM_SHARDS; i++) {
+        InodeShard *sh = &set->shards[i];
+        for (j = 0; j < sh->capacity; j++) {
+            free (sh->entries[j].path);
+        }
+        free (sh->entries);
+        pthread_mutex_destroy (&sh->lock);
+    }
+
+    free (set);
+}
+
+/* Returns the slot where (device, inode) is, or where it should go. */
+static InodeEntry *find_slot (InodeEntry *entries,
+                              size_t capacity,
+                              uint64_t h,
+                              uint64_t device,
+                              uint64_t inode) {
+    const size_t mask = capacity - 1;
+    size_t i = (size_t) h & mask;
+
+    for ( ; ; i = (i + 1) & mask) {
+        InodeEntry *e = &entries[i];
+        if (e->path == NULL || (e->inode == inode && e->device == device)) {
+            return e;
+        }
+    }
+}
+
+static void grow (InodeShard *sh) {
+    const size_t newCap = (sh->capacity == 0 ? MIN_CAP : sh->capacity * 2);
+    InodeEntry *newEntries = MY_MALLOC (newCap * sizeof (InodeEntry));
+    size_t i;
+
+    memset (newEntries, 0, newCap * sizeof (InodeEntry));
+
+    for (i = 0; i < sh->capacity; i++) {
+        const InodeEntry *e = &sh->entries[i];
+        if (e->path != NULL) {
+            const uint64_t h = mix (e->device, e->inode);
+            *find_slot (newEntries, newCap, h, e->device, e->inode) = *e;
+        }
+    }
+
+    free (sh->entries);
+    sh->entries = newEntries;
+    sh->capacity = newCap;
+}
+
+bool InodeSet_add (InodeSet *set,
+                   uint64_t device,
+                   uint64_t inode,
+                   const char *path,
+                   const char **firstPath) {
+    const uint64_t h = mix (device, inode);
+    InodeShard *sh = &set->shards[(h >> 58) & (NUM_SHARDS - 1)];
+    bool added = false;
+
+    pthread_mutex_lock (&sh->lock);
+
+    /* keep the load factor under 3/4 */
+    if (4 * (sh->size + 1) > 3 * sh->capacity) {
+        grow (sh);
+    }
+
+    InodeEntry *e = find_slot (sh->entries, sh->capacity, h, device, inode);
+    if (e->path == NULL) {
+        e->device = device;
+        e->inode = inode;
+        e->path = MY_STRDUP (path);
+        sh->size++;
+        added = true;
+    }
+
+    *firstPath = e->path;
+
+    pthread_mutex_unlock (&sh->lock);
+    return added;
+}
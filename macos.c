@@ -47,8 +47,7 @@ static int parse_hex (char c1, char c2) {
 
 static char *unescape (const char *s) {
     const size_t len = strlen (s);
-    char *u = malloc (len + 1);
-    CHECK_NULL (u);
+    char *u = MY_MALLOC (len + 1);
 
     size_t i, j = 0;
     for (i = 0; i < len; i++) {
@@ -69,6 +68,7 @@ static char *unescape (const char *s) {
 
 static ErrorCode parse_quarantine (Attributes *dest,
                                    const char *s,
+                                   uint32_t fields,
                                    DatabaseConnection *conn) {
     ArrayList al;
 
@@ -125,7 +125,10 @@ static ErrorCode parse_quarantine (Attributes *dest,
     }
 
     ErrorCode ret = EC_OK;
-    const bool have_urls = (dest->url != NULL && dest->referrer != NULL);
+    /* the database is only worth opening for fields that are wanted */
+    const bool have_urls = ((dest->url != NULL || !(fields & AF_URL)) &&
+                            (dest->referrer != NULL ||
+                             !(fields & AF_REFERRER)));
     if (uuid && *uuid && !have_urls) {
         ret = lookup_uuid (dest, uuid, conn);
     }
@@ -186,17 +189,49 @@ static ErrorCode parse_wherefroms (Attributes *dest,
     return ec;
 }
 
+#define WHEREFROMS_FIELDS \
+    (AF_URL | AF_REFERRER | AF_FROM | AF_SUBJECT | AF_MESSAGE_ID)
+#define QUARANTINE_FIELDS (AF_URL | AF_REFERRER | AF_APPLICATION | AF_DATE)
+#define XDG_FIELDS (WHEREFROMS_FIELDS | AF_APPLICATION)
+
+/* Everything read by getAttributes(), including by getAttributes_xdg(),
+ * for --has-provenance. */
+static const AttrName allNames[] = {
+    { "com.apple.metadata:kMDItemWhereFroms",     WHEREFROMS_FIELDS },
+    { "com.apple.metadata:kMDItemDownloadedDate", AF_DATE           },
+    { "com.apple.quarantine",                     QUARANTINE_FIELDS },
+    { "user.xdg.origin.url",                      AF_URL            },
+    { "user.xdg.referrer.url",                    AF_REFERRER       },
+    { "user.xdg.origin.email.from",               AF_FROM           },
+    { "user.xdg.origin.email.subject",            AF_SUBJECT        },
+    { "user.xdg.origin.email.message-id",         AF_MESSAGE_ID     },
+    { "user.xdg.publisher",                       AF_APPLICATION    },
+    { NULL,                                       0                 }
+};
+
 ErrorCode getAttributes (const char *fname,
+                         const AttrQuery *query,
                          Attributes *dest,
                          DatabaseConnection *conn) {
     Attr_init (dest);
 
+    if (xattrsUnsupported (query)) {
+        return EC_NOATTR;
+    }
+
+    if (query->presenceOnly) {
+        return probeAttributes (fname, allNames, query, &dest->error);
+    }
+
     char *result = NULL;
     size_t length = 0;
 
-    ErrorCode ec1 =
-        getAttribute (fname, "com.apple.metadata:kMDItemWhereFroms",
-                      &result, &length);
+    /* Each attribute is only read if it has a field that is wanted. */
+    ErrorCode ec1 = EC_NOATTR;
+    if (query->fields & WHEREFROMS_FIELDS) {
+        ec1 = getAttribute (fname, "com.apple.metadata:kMDItemWhereFroms",
+                            query, &result, &length);
+    }
     if (ec1 == EC_OK) {
         ec1 = parse_wherefroms (dest, result, length);
     } else if (ec1 != EC_NOATTR) {
@@ -207,10 +242,10 @@ ErrorCode getAttributes (const char *fname,
     free (result);
     result = NULL;
 
-    if (ec1 != EC_NOFILE) {
+    if (ec1 != EC_NOFILE && (query->fields & AF_DATE)) {
         ErrorCode ec2 =
             getAttribute (fname, "com.apple.metadata:kMDItemDownloadedDate",
-                          &result, &length);
+                          query, &result, &length);
         if (ec2 == EC_OK) {
             ec2 = props2time (result, length, &dest->date, &dest->error);
         } else if (ec2 != EC_NOATTR && dest->error == NULL) {
@@ -224,11 +259,11 @@ ErrorCode getAttributes (const char *fname,
         result = NULL;
     }
 
-    if (ec1 != EC_NOFILE) {
+    if (ec1 != EC_NOFILE && (query->fields & QUARANTINE_FIELDS)) {
         ErrorCode ec2 = getAttribute (fname, "com.apple.quarantine",
-                                      &result, &length);
+                                      query, &result, &length);
         if (ec2 == EC_OK) {
-            ec2 = parse_quarantine (dest, result, conn);
+            ec2 = parse_quarantine (dest, result, query->fields, conn);
         } else if (ec2 != EC_NOATTR && dest->error == NULL) {
             dest->error = result;   /* transfer ownership */
             result = NULL;
@@ -240,12 +275,12 @@ ErrorCode getAttributes (const char *fname,
         result = NULL;
     }
 
-    if (ec1 != EC_NOFILE) {
+    if (ec1 != EC_NOFILE && (query->fields & XDG_FIELDS)) {
         /* curl and wget use the attribute "user.xdg.origin.url" on
          * all platforms, including MacOS.  Therefore, check the
          * XDG attributes in addition to the MacOS ones we just
          * checked above. */
-        const ErrorCode ec2 = getAttributes_xdg (fname, dest);
+        const ErrorCode ec2 = getAttributes_xdg (fname, query, dest);
         ec1 = combineErrors (ec1, ec2);
     }
 
@@ -29,6 +29,13 @@
 #include <string.h>
 #include <locale.h>
 #include <errno.h>
+#include <ctype.h>
+#include <limits.h>
+
+/* bytes of output which may wait for the writer thread (see output.c) */
+#define DEFAULT_OUTPUT_QUEUE (4 * 1024 * 1024)
+#define DEFAULT_SORT_RUN (64 * 1024 * 1024)
+#define MIN_SORT_RUN (1024 * 1024)
 
 static const char moreinfo[] =
     "For more information see <https://github.com/ppelleti/whence>";
@@ -48,16 +55,107 @@ static void get_min_osx (int *major, int *minor) {
 #endif  /* __ENVIRONMENT_MAC_OS_X_VERSION_MIN_REQUIRED__ */
 
 static void print_usage (void) {
-    fprintf (stderr, "Usage: " CMD_NAME " [OPTIONS] FILE ...\n\n");
+    fprintf (stderr, "Usage: " CMD_NAME " [OPTIONS] FILE ...\n");
+    fprintf (stderr, "       " CMD_NAME " merge FILE ...\n");
+    fprintf (stderr, "       " CMD_NAME " compile-blocklist LIST OUT\n");
+    fprintf (stderr, "       " CMD_NAME " du [-j] [-d DEPTH] DIR ...\n");
+    fprintf (stderr, "       " CMD_NAME " diff [-j] OLD NEW\n\n");
     fprintf (stderr, "%-30s%s\n",
              "  -j, --json",
              "Print results in JSON format.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --ndjson",
+             "Print results as one JSON object per line.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --csv, --tsv",
+             "Print one row per file, with a header row.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --format TEMPLATE",
+             "Print each file as TEMPLATE says.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --fields F,...",
+             "Only read and print fields F (e.g. url,referrer).");
+    fprintf (stderr, "%-30s%s\n",
+             "      --where EXPR",
+             "Only print files whose attributes match EXPR.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --blocklist FILE",
+             "Report URLs on the domains or URLs in FILE.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --blocklist-out FILE",
+             "Write the --blocklist matches to FILE.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --summary",
+             "Count files by domain, application, and fields.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --top K",
+             "Print the K most common URLs, hosts, and referrers.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --approx",
+             "With --top, estimate the counts in fixed memory.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --sort path",
+             "With --ndjson, print the files in order of path.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --has-provenance",
+             "Only print the paths of files with attributes.");
+    fprintf (stderr, "%-30s%s\n",
+             "  -r, --recursive",
+             "Scan directories recursively.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --inode-order",
+             "Process each directory in inode order.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --xdev",
+             "Don't descend into other filesystems.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --dedup",
+             "Print hard links to the same file as aliases.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --shard I/N",
+             "Only process shard I (from 0) of N.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --sample RATE|COUNT",
+             "Only read a sample of the files, and estimate.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --changed-since TIME",
+             "Only process files changed since TIME.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --changed-since-file F",
+             "Like --changed-since, with the time kept in F.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --checkpoint FILE",
+             "Save the progress of the scan in FILE.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --resume",
+             "Continue the scan saved by --checkpoint.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --max-memory SIZE",
+             "Spill to disk to stay within SIZE (e.g. 256M).");
+    fprintf (stderr, "%-30s%s\n",
+             "      --output-queue SIZE",
+             "Let SIZE bytes wait to be written to stdout.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --file-timeout MS",
+             "Give up on a file after MS milliseconds.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --deadline MS",
+             "Stop after MS milliseconds, with partial results.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --background",
+             "Run at idle priority; back off when I/O is busy.");
+    fprintf (stderr, "%-30s%s\n",
+             "  -t, --threads N",
+             "Scan using N threads.");
     fprintf (stderr, "%-30s%s\n",
              "  -h, --help",
              "Print this message and exit.");
     fprintf (stderr, "%-30s%s\n",
              "  -v, --version",
              "Print the version number of " CMD_NAME " and exit.");
+    fprintf (stderr, "%-30s%s\n",
+             "      --alloc-stats",
+             "Print memory allocation statistics on exit.");
     fprintf (stderr, "\n%s\n", moreinfo);
 }
 
@@ -103,23 +201,481 @@ static bool is_option (const char *arg, const char *opt1, const char *opt2) {
     }
 }
 
-static int utf8_main (int argc, char **argv) {
-    bool json = false;
-    int arg1 = 1;
+/* For options which take a value.  If argv[*i] is "opt1" or "opt2",
+ * writes the value (the next argument) to "*value" and advances *i.
+ * The long form may also be given as "--option=value".  If the option
+ * matches but the value is missing, "*value" is set to NULL.
+ */
+static bool is_option_with_value (int argc,
+                                  char **argv,
+                                  int *i,
+                                  const char *opt1,
+                                  const char *opt2,
+                                  const char **value) {
+    const char *arg = argv[*i];
+    const size_t len2 = strlen (opt2);
 
-    if (arg1 < argc && is_option (argv[arg1], "-j", "--json")) {
-        json = true;
-        arg1++;
+    if (0 == strncmp (arg, opt2, len2) && arg[len2] == '=') {
+        *value = arg + len2 + 1;
+        return true;
+    } else if (is_option (arg, opt1, opt2)) {
+        if (*i + 1 < argc) {
+            *value = argv[++(*i)];
+        } else {
+            *value = NULL;
+        }
+        return true;
+    } else {
+        return false;
     }
+}
 
-    if (arg1 < argc && is_option (argv[arg1], "-h", "--help")) {
+/* Parses a non-negative integer.  Returns false if "s" is not one. */
+static bool parse_number (const char *s, unsigned long *n) {
+    char *endptr = NULL;
+
+    if (s == NULL || *s < '0' || *s > '9') {
+        return false;
+    }
+
+    errno = 0;
+    *n = strtoul (s, &endptr, 10);
+    return (errno == 0 && *endptr == 0);
+}
+
+/* Parses a positive integer.  Returns false if "s" is not one. */
+static bool parse_count (const char *s, unsigned long *n) {
+    return (parse_number (s, n) && *n > 0);
+}
+
+/* Parses a size such as "512K" or "2G", where the suffixes are powers
+ * of 1024. */
+static bool parse_size (const char *s, size_t *size) {
+    char *endptr = NULL;
+    unsigned long long n;
+    int shift = 0;
+
+    if (s == NULL || *s < '0' || *s > '9') {
+        return false;
+    }
+
+    errno = 0;
+    n = strtoull (s, &endptr, 10);
+    if (errno != 0) {
+        return false;
+    }
+
+    switch (toupper ((unsigned char) *endptr)) {
+    case 'K':
+        shift = 10;
+        break;
+    case 'M':
+        shift = 20;
+        break;
+    case 'G':
+        shift = 30;
+        break;
+    case 'T':
+        shift = 40;
+        break;
+    case 0:
+        break;
+    default:
+        return false;
+    }
+
+    if (shift > 0 && endptr[1] != 0) {
+        return false;
+    }
+
+    if (n > (SIZE_MAX >> shift)) {
+        return false;
+    }
+
+    *size = (size_t) n << shift;
+    return true;
+}
+
+/* Parses "I/N" for --shard, where 0 <= I < N. */
+static bool parse_shard (const char *s, uint32_t *index, uint32_t *count) {
+    char *endptr = NULL;
+    unsigned long i, n;
+
+    if (s == NULL || *s < '0' || *s > '9') {
+        return false;
+    }
+
+    errno = 0;
+    i = strtoul (s, &endptr, 10);
+    if (errno != 0 || *endptr != '/') {
+        return false;
+    }
+
+    if (! parse_count (endptr + 1, &n) || i >= n || n > UINT32_MAX) {
+        return false;
+    }
+
+    *index = (uint32_t) i;
+    *count = (uint32_t) n;
+    return true;
+}
+
+/* Parses the argument of --sample.  A RATE is a fraction (such as
+ * "0.01") or a percentage (such as "1%"); anything else is a COUNT. */
+static Sample *parse_sample (const char *s) {
+    char *endptr = NULL;
+    unsigned long n;
+
+    if (s == NULL) {
+        return NULL;
+    }
+
+    if (strchr (s, '.') == NULL && strchr (s, '%') == NULL) {
+        return (parse_count (s, &n) ? Sample_newCount (n) : NULL);
+    }
+
+    errno = 0;
+    double rate = strtod (s, &endptr);
+    if (errno != 0 || endptr == s ||
+        ((*s < '0' || *s > '9') && *s != '.')) {
+        return NULL;
+    }
+
+    if (*endptr == '%') {
+        rate /= 100.0;
+        endptr++;
+    }
+
+    if (*endptr != 0 || !(rate > 0.0 && rate <= 1.0)) {
+        return NULL;
+    }
+
+    return Sample_newRate (rate);
+}
+
+static int cmdline_error (const char *opt, const char *value) {
+    if (value == NULL) {
+        err_printf (CMD_NAME ": Option '%s' requires an argument", opt);
+    } else {
+        err_printf (CMD_NAME ": Invalid argument '%s' for option '%s'",
+                    value, opt);
+    }
+
+    print_usage ();
+    return EC_CMDLINE;
+}
+
+/* "whence compile-blocklist LIST OUT" */
+static int compile_main (int argc, char **argv) {
+    if (argc > 2 && is_option (argv[2], "-h", "--help")) {
         print_usage ();
         return EC_OK;
     }
 
-    if (arg1 < argc && is_option (argv[arg1], "-v", "--version")) {
-        print_version ();
+    if (argc != 4) {
+        err_printf (CMD_NAME ": compile-blocklist needs a list, "
+                    "and a file to write");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    return Blocklist_compile (argv[2], argv[3]);
+}
+
+/* "whence merge FILE ..." */
+static int merge_main (int argc, char **argv) {
+    int arg1 = 2;
+
+    if (arg1 < argc && is_option (argv[arg1], "-h", "--help")) {
+        print_usage ();
         return EC_OK;
+    } else if (arg1 < argc && 0 == strcmp (argv[arg1], "--")) {
+        arg1++;
+    }
+
+    if (arg1 >= argc) {
+        err_printf (CMD_NAME ": No files specified on command line");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    return mergeFiles (argv + arg1, argc - arg1);
+}
+
+/* "whence diff [-j] OLD NEW" */
+static int diff_main (int argc, char **argv) {
+    bool json = false;
+    int arg1;
+
+    for (arg1 = 2; arg1 < argc; arg1++) {
+        const char *arg = argv[arg1];
+
+        if (is_option (arg, "-h", "--help")) {
+            print_usage ();
+            return EC_OK;
+        } else if (is_option (arg, "-j", "--json")) {
+            json = true;
+        } else if (0 == strcmp (arg, "--")) {
+            arg1++;
+            break;
+        } else if (arg[0] == '-' && arg[1] != 0) {
+            err_printf (CMD_NAME ": Unknown option '%s'", arg);
+            print_usage ();
+            return EC_CMDLINE;
+        } else {
+            break;
+        }
+    }
+
+    if (argc - arg1 != 2) {
+        err_printf (CMD_NAME ": diff needs an old file and a new file");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    return diffFiles (argv[arg1], argv[arg1 + 1], json);
+}
+
+/* "whence du [-j] [-d DEPTH] DIR ..." */
+static int du_main (int argc, char **argv) {
+    unsigned long maxDepth = ULONG_MAX;
+    bool json = false;
+    int arg1;
+
+    for (arg1 = 2; arg1 < argc; arg1++) {
+        const char *arg = argv[arg1];
+        const char *value = NULL;
+
+        if (is_option (arg, "-h", "--help")) {
+            print_usage ();
+            return EC_OK;
+        } else if (is_option (arg, "-j", "--json")) {
+            json = true;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "-d", "--max-depth", &value)) {
+            if (! parse_number (value, &maxDepth)) {
+                return cmdline_error (arg, value);
+            }
+        } else if (0 == strcmp (arg, "--")) {
+            arg1++;
+            break;
+        } else if (arg[0] == '-' && arg[1] != 0) {
+            err_printf (CMD_NAME ": Unknown option '%s'", arg);
+            print_usage ();
+            return EC_CMDLINE;
+        } else {
+            break;
+        }
+    }
+
+    if (arg1 >= argc) {
+        err_printf (CMD_NAME ": No directories specified on command line");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    return duFiles (argv + arg1, argc - arg1, maxDepth, json);
+}
+
+/* The scan itself: "whence [OPTIONS] FILE ..." */
+static int scan_main (int argc, char **argv) {
+    bool json = false;
+    AttrStyle jsonStyle = AS_JSON;
+    ScanOptions opts;
+    bool resume = false;
+    const char *stampFile = NULL;
+    size_t outputQueue = DEFAULT_OUTPUT_QUEUE;
+    bool outputQueueSet = false;
+    unsigned long deadline = 0;
+    Where *where = NULL;
+    Format *format = NULL;
+    bool table = false;
+    AttrStyle tableStyle = AS_CSV;
+    bool fieldsSet = false;
+    const char *blocklist = NULL;
+    const char *blocklistOut = NULL;
+    bool summary = false;
+    unsigned long top = 0;
+    bool approx = false;
+    bool sortByPath = false;
+    Checkpoint cp;
+    int arg1;
+
+    memset (&opts, 0, sizeof (opts));
+    opts.fields = AF_DEFAULT;
+
+    for (arg1 = 1; arg1 < argc; arg1++) {
+        const char *arg = argv[arg1];
+        const char *value = NULL;
+        unsigned long n;
+
+        if (is_option (arg, "-j", "--json")) {
+            json = true;
+            jsonStyle = AS_JSON;
+        } else if (0 == strcmp (arg, "--ndjson")) {
+            json = true;
+            jsonStyle = AS_NDJSON;
+        } else if (0 == strcmp (arg, "--csv")) {
+            table = true;
+            tableStyle = AS_CSV;
+        } else if (0 == strcmp (arg, "--tsv")) {
+            table = true;
+            tableStyle = AS_TSV;
+        } else if (is_option (arg, "-r", "--recursive")) {
+            opts.recursive = true;
+        } else if (0 == strcmp (arg, "--inode-order")) {
+            opts.inodeOrder = true;
+        } else if (0 == strcmp (arg, "--xdev")) {
+            opts.xdev = true;
+        } else if (0 == strcmp (arg, "--dedup")) {
+            opts.dedup = true;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--shard", "--shard", &value)) {
+            if (! parse_shard (value, &opts.shardIndex, &opts.shardCount)) {
+                return cmdline_error (arg, value);
+            }
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--sample", "--sample", &value)) {
+            if (opts.sample != NULL) {
+                Sample_free (opts.sample);
+            }
+            opts.sample = parse_sample (value);
+            if (opts.sample == NULL) {
+                return cmdline_error (arg, value);
+            }
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--changed-since", "--changed-since",
+                                         &value)) {
+            if (value == NULL || ! Stamp_parse (value, &opts.changedSince)) {
+                return cmdline_error (arg, value);
+            }
+            opts.changedOnly = true;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--changed-since-file",
+                                         "--changed-since-file",
+                                         &value)) {
+            if (value == NULL) {
+                return cmdline_error (arg, value);
+            }
+            stampFile = value;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--checkpoint", "--checkpoint",
+                                         &value)) {
+            if (value == NULL) {
+                return cmdline_error (arg, value);
+            }
+            opts.checkpoint = value;
+        } else if (0 == strcmp (arg, "--resume")) {
+            resume = true;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--fields", "--fields", &value)) {
+            if (value == NULL || ! Attr_parseFields (value, &opts.fields)) {
+                return cmdline_error (arg, value);
+            }
+            fieldsSet = true;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--where", "--where", &value)) {
+            if (value == NULL) {
+                return cmdline_error (arg, value);
+            }
+            Where_free (where);
+            where = Where_compile (value);
+            if (where == NULL) {
+                return EC_CMDLINE;
+            }
+            opts.where = where;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--format", "--format", &value)) {
+            if (value == NULL) {
+                return cmdline_error (arg, value);
+            }
+            Format_free (format);
+            format = Format_compile (value);
+            if (format == NULL) {
+                return EC_CMDLINE;
+            }
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--blocklist", "--blocklist",
+                                         &value)) {
+            if (value == NULL) {
+                return cmdline_error (arg, value);
+            }
+            blocklist = value;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--blocklist-out", "--blocklist-out",
+                                         &value)) {
+            if (value == NULL) {
+                return cmdline_error (arg, value);
+            }
+            blocklistOut = value;
+        } else if (0 == strcmp (arg, "--has-provenance") ||
+                   0 == strcmp (arg, "--list-matching")) {
+            opts.presenceOnly = true;
+        } else if (0 == strcmp (arg, "--summary")) {
+            summary = true;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--top", "--top", &value)) {
+            if (! parse_count (value, &top)) {
+                return cmdline_error (arg, value);
+            }
+        } else if (0 == strcmp (arg, "--approx")) {
+            approx = true;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--sort", "--sort", &value)) {
+            if (value == NULL || 0 != strcmp (value, "path")) {
+                return cmdline_error (arg, value);
+            }
+            sortByPath = true;
+        } else if (0 == strcmp (arg, "--background")) {
+            opts.background = true;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--max-memory", "--max-memory",
+                                         &value)) {
+            if (! parse_size (value, &opts.maxMemory)) {
+                return cmdline_error (arg, value);
+            }
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--output-queue", "--output-queue",
+                                         &value)) {
+            if (! parse_size (value, &outputQueue)) {
+                return cmdline_error (arg, value);
+            }
+            outputQueueSet = true;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--file-timeout", "--file-timeout",
+                                         &value)) {
+            if (! parse_count (value, &n) || n > UINT32_MAX) {
+                return cmdline_error (arg, value);
+            }
+            opts.fileTimeout = (uint32_t) n;
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "--deadline", "--deadline",
+                                         &value)) {
+            if (! parse_count (value, &deadline) || deadline > UINT32_MAX) {
+                return cmdline_error (arg, value);
+            }
+        } else if (is_option_with_value (argc, argv, &arg1,
+                                         "-t", "--threads", &value)) {
+            if (! parse_count (value, &n) || n > 1024) {
+                return cmdline_error (arg, value);
+            }
+            opts.threads = (int) n;
+        } else if (is_option (arg, "-h", "--help")) {
+            print_usage ();
+            return EC_OK;
+        } else if (is_option (arg, "-v", "--version")) {
+            print_version ();
+            return EC_OK;
+        } else if (0 == strcmp (arg, "--")) {
+            arg1++;
+            break;
+        } else if (arg[0] == '-' && arg[1] != 0) {
+            err_printf (CMD_NAME ": Unknown option '%s'", arg);
+            print_usage ();
+            return EC_CMDLINE;
+        } else {
+            break;
+        }
     }
 
     const bool colorize = stdoutTerminal.supports_color && !json;
@@ -132,53 +688,252 @@ static int utf8_main (int argc, char **argv) {
 
     const int nFiles = argc - arg1;
 
-    if (!json && nFiles == 0) {
+    if (opts.checkpoint != NULL &&
+        ((json && jsonStyle == AS_JSON) || opts.sample != NULL)) {
+        err_printf (CMD_NAME ": --checkpoint can't be used with "
+                    "--json or --sample");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    if (opts.presenceOnly &&
+        (json || opts.dedup || opts.sample != NULL || blocklist != NULL)) {
+        err_printf (CMD_NAME ": --has-provenance can't be used with "
+                    "--json, --ndjson, --dedup, --sample, or --blocklist");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    /* --dedup prints a repeated inode without reading it again, so it
+     * wouldn't know whether the first path matched. */
+    if (where != NULL && opts.dedup) {
+        err_printf (CMD_NAME ": --where can't be used with --dedup");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    if (summary && (opts.checkpoint != NULL || opts.sample != NULL ||
+                    opts.presenceOnly)) {
+        err_printf (CMD_NAME ": --summary can't be used with "
+                    "--checkpoint, --sample, or --has-provenance");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    if (top > 0 && (summary || opts.checkpoint != NULL ||
+                    opts.sample != NULL || opts.presenceOnly)) {
+        err_printf (CMD_NAME ": --top can't be used with --summary, "
+                    "--checkpoint, --sample, or --has-provenance");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    if (sortByPath && (jsonStyle != AS_NDJSON || opts.checkpoint != NULL ||
+                       summary || top > 0)) {
+        err_printf (CMD_NAME ": --sort needs --ndjson, and can't be used "
+                    "with --checkpoint, --summary, or --top");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    if (format != NULL && (json || summary || top > 0 || opts.presenceOnly)) {
+        err_printf (CMD_NAME ": --format can't be used with --json, "
+                    "--ndjson, --summary, --top, or --has-provenance");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    if (table && (json || format != NULL || summary || top > 0 ||
+                  opts.presenceOnly || sortByPath)) {
+        err_printf (CMD_NAME ": --csv and --tsv can't be used with --json, "
+                    "--ndjson, --format, --summary, --top, "
+                    "--has-provenance, or --sort");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    if (approx && top == 0) {
+        err_printf (CMD_NAME ": --approx needs --top");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    if (resume && (opts.checkpoint == NULL || nFiles > 0)) {
+        err_printf (CMD_NAME ": --resume needs --checkpoint, and no files");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    /* The new stamp is the time the scan started, so a file changed
+     * during the scan is looked at again next time.  With --sample,
+     * the files which weren't drawn would never be looked at again. */
+    if (stampFile != NULL && (resume || opts.sample != NULL)) {
+        err_printf (CMD_NAME ": --changed-since-file can't be used "
+                    "with --resume or --sample");
+        print_usage ();
+        return EC_CMDLINE;
+    }
+
+    const int64_t startTime = currentTime ();
+
+    if (deadline > 0) {
+        opts.deadline = startTime + (int64_t) deadline * 1000000;
+    }
+
+    if (stampFile != NULL) {
+        const ErrorCode ec = Stamp_read (stampFile, &opts.changedSince);
+        if (ec == EC_OK) {
+            opts.changedOnly = true;
+        } else if (ec != EC_NOFILE) {
+            return ec;
+        }
+        /* else this is the first run, so look at everything */
+    }
+
+    if (!json && nFiles == 0 && !resume) {
         err_printf (CMD_NAME ": No files specified on command line");
         print_usage ();
         return EC_CMDLINE;
     }
 
-    Cache cache;
-    Cache_init (&cache);
+    if (summary || top > 0) {
+        opts.style = AS_NDJSON; /* which has no header or footer */
+    } else if (json) {
+        opts.style = jsonStyle;
+    } else if (opts.presenceOnly) {
+        opts.style = AS_PATHS;
+    } else if (table) {
+        opts.style = tableStyle;
+    } else if (format != NULL) {
+        opts.style = AS_FORMAT;
+        opts.format = format;
+        /* only read what the template prints, unless told otherwise */
+        if (! fieldsSet && Format_fields (format) != 0) {
+            opts.fields = Format_fields (format);
+        }
+    } else {
+        opts.style = (colorize ? AS_HUMAN_COLOR : AS_HUMAN);
+    }
 
-    Attributes attr;
-    Attr_init (&attr);
+    /* By default, only use multiple threads for recursive scans, so
+     * that files named on the command line are printed in order. */
+    if (opts.threads == 0) {
+        opts.threads = (opts.recursive ? numberOfCPUs () : 1);
+    }
+
+    if (summary) {
+        opts.summary = Summary_new (opts.threads < 1 ? 1 : opts.threads);
+    } else if (top > 0) {
+        opts.top = Top_new (opts.threads < 1 ? 1 : opts.threads,
+                            top, approx);
+    }
+
+    ArrayList fnames;
+    AL_init (&fnames);
 
-    bool first = true;
-    ErrorCode ec = EC_OK;
     int32_t drives = -1;        /* only used on Windows */
+    int i;
 
-    if (json) {
-        printf ("{\n");
+    for (i = arg1; i < argc; i++) {
+        AL_add_nocopy (&fnames, fixFilename (argv[i], &drives));
     }
 
-    for ( ; arg1 < argc; arg1++) {
-        char *fname = fixFilename (argv[arg1], &drives);
-        const ErrorCode ec2 = getAttributes (fname, &attr, &cache);
-        AttrStyle style = (colorize ? AS_HUMAN_COLOR : AS_HUMAN);
+    ErrorCode ec = EC_OK;
 
-        if (json) {
-            style = (argc == arg1 + 1 ? AS_JSON_LAST : AS_JSON_NOTLAST);
+    if (resume) {
+        ec = Checkpoint_load (&cp, opts.checkpoint);
+        if (ec == EC_OK) {
+            ec = Output_resume (&cp);
         }
+        if (ec != EC_OK) {
+            AL_cleanup (&fnames);
+            return ec;
+        }
+        opts.resume = &cp;
+    }
 
-        Attr_print (&attr, fname, style);
-        Attr_cleanup (&attr);
+    if (blocklist != NULL) {
+        opts.blocklist = Blocklist_load (blocklist);
+        opts.blocklistOut = stderr;
+        if (blocklistOut != NULL) {
+            opts.blocklistOut = openFile (blocklistOut, "w");
+            if (opts.blocklistOut == NULL) {
+                err_printf ("%s: %s", blocklistOut, strerror (errno));
+            }
+        }
 
-        if (first) {
-            ec = ec2;
-        } else {
-            ec = combineErrors (ec, ec2);
+        if (opts.blocklist == NULL || opts.blocklistOut == NULL) {
+            AL_cleanup (&fnames);
+            return EC_OTHER;
         }
+    }
+
+    if (opts.background && ! enterBackground ()) {
+        err_printf (CMD_NAME ": could not lower priority for --background");
+    }
+
+    if (opts.maxMemory > 0 && ! outputQueueSet) {
+        outputQueue = opts.maxMemory / 8;
+    }
 
-        first = false;
-        free (fname);
+    /* With --sort, the output queue's share of --max-memory holds the
+     * runs instead, since nothing is written until the end. */
+    if (sortByPath) {
+        size_t runSize = DEFAULT_SORT_RUN;
+        if (opts.maxMemory > 0) {
+            runSize = (opts.maxMemory / 8 < MIN_SORT_RUN ?
+                       MIN_SORT_RUN : opts.maxMemory / 8);
+        }
+        Output_sortByPath (runSize);
     }
 
-    if (json) {
-        printf ("}\n");
+    Output_begin (opts.style, outputQueue);
+
+    /* a resumed scan already wrote the header */
+    if (table && ! resume) {
+        StrBuf header;
+        SB_init (&header);
+        Attr_header (opts.style, opts.fields, &header);
+        Output_write (&header);
+        SB_cleanup (&header);
     }
 
-    if (ec == EC_NOATTR && !json) {
+    if (nFiles > 0 || resume) {
+        ec = scanFiles (&opts, fnames.strings, fnames.size);
+    }
+
+    if (resume) {
+        Checkpoint_cleanup (&cp);
+    }
+
+    /* If a file couldn't be read, don't move the stamp past it. */
+    if (stampFile != NULL && ec != EC_OTHER &&
+        EC_OK != Stamp_write (stampFile, startTime)) {
+        ec = EC_OTHER;
+    }
+
+    if (Output_end () != EC_OK) {
+        ec = EC_OTHER;
+    }
+    AL_cleanup (&fnames);
+
+    if (opts.sample != NULL) {
+        Sample_report (opts.sample);
+        Sample_free (opts.sample);
+    }
+
+    if (opts.summary != NULL) {
+        Summary_print (opts.summary, json, stdout);
+        Summary_free (opts.summary);
+    }
+
+    if (opts.top != NULL) {
+        Top_print (opts.top, json, stdout);
+        Top_free (opts.top);
+    }
+
+    if (ec == EC_NOATTR && !json && !opts.presenceOnly && where == NULL &&
+        !summary && top == 0 && format == NULL && !table) {
         setColor (stderr, stderrTerminal.supports_color, COLOR_RED);
         writeUTF8 (stderr, (nFiles == 1 ? argv[argc - 1] : CMD_NAME));
         fprintf (stderr, ": No attributes found");
@@ -186,10 +941,59 @@ static int utf8_main (int argc, char **argv) {
         fprintf (stderr, "\n");
     }
 
-    Cache_cleanup (&cache);
+    Where_free (where);
+    Format_free (format);
+
+    if (opts.blocklist != NULL) {
+        if (opts.blocklistOut != stderr && fclose (opts.blocklistOut) != 0) {
+            err_printf ("%s: %s", blocklistOut, strerror (errno));
+            ec = EC_OTHER;
+        }
+        Blocklist_free ((Blocklist *) opts.blocklist);
+    }
+
     return ec;
 }
 
+/* Takes --alloc-stats out of the arguments (up to any "--"), so that it
+ * can be given to the subcommands as well as to the scan, and reports
+ * on whichever of them ran, however it returned. */
+static int utf8_main (int argc, char **argv) {
+    int i, j, ret;
+
+    for (i = j = 0; i < argc; i++) {
+        if (0 == strcmp (argv[i], "--")) {
+            while (i < argc) {
+                argv[j++] = argv[i++];
+            }
+            break;
+        } else if (0 == strcmp (argv[i], "--alloc-stats")) {
+            allocStatsEnabled = true;
+        } else {
+            argv[j++] = argv[i];
+        }
+    }
+    argc = j;
+
+    if (argc > 1 && 0 == strcmp (argv[1], "merge")) {
+        ret = merge_main (argc, argv);
+    } else if (argc > 1 && 0 == strcmp (argv[1], "compile-blocklist")) {
+        ret = compile_main (argc, argv);
+    } else if (argc > 1 && 0 == strcmp (argv[1], "du")) {
+        ret = du_main (argc, argv);
+    } else if (argc > 1 && 0 == strcmp (argv[1], "diff")) {
+        ret = diff_main (argc, argv);
+    } else {
+        ret = scan_main (argc, argv);
+    }
+
+    if (allocStatsEnabled) {
+        Alloc_report ();
+    }
+
+    return ret;
+}
+
 #ifdef _WIN32
 
 int wmain (int argc, wchar_t **argv) {
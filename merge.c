@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+typedef struct MergeInput {
+    const char *name;           /* for error messages */
+    FILE *f;
+    StrBuf line;                /* current record, without the newline */
+    StrBuf path;                /* decoded path of the current record */
+    StrBuf prevPath;            /* decoded path of the previous record */
+    unsigned long lineNo;
+    unsigned long nRecords;
+} MergeInput;
+
+/* Compares two decoded paths bytewise.  (They may contain NUL bytes,
+ * if the JSON contained "\u0000", so strcmp() won't do.) */
+static int compare_paths (const StrBuf *a, const StrBuf *b) {
+    const size_t len = (a->len < b->len ? a->len : b->len);
+    const int c = memcmp (a->buf, b->buf, len);
+
+    if (c != 0) {
+        return c;
+    } else if (a->len < b->len) {
+        return -1;
+    } else if (a->len > b->len) {
+        return 1;
+    } else {
+        return 0;
+    }
+}
+
+/* Opens "fname" (or stdin, for "-") as "in", which must be zeroed.
+ * Errors are printed, and false is returned. */
+static bool open_input (MergeInput *in, const char *fname) {
+    if (0 == strcmp (fname, "-")) {
+        in->name = "(stdin)";
+        in->f = stdin;
+    } else {
+        in->name = fname;
+        in->f = openFile (fname, "r");
+        if (in->f == NULL) {
+            err_printf ("%s: %s", fname, strerror (errno));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void close_input (MergeInput *in) {
+    if (in->f != NULL && in->f != stdin) {
+        fclose (in->f);
+    }
+
+    SB_cleanup (&in->line);
+    SB_cleanup (&in->path);
+    SB_cleanup (&in->prevPath);
+}
+
+/* Reads the next record from "in".  Returns EC_OK if there is one,
+ * EC_NOATTR at end of file, or EC_OTHER on error.  Blank lines are
+ * skipped.
+ */
+static ErrorCode advance (MergeInput *in) {
+    StrBuf tmp = in->prevPath;
+    in->prevPath = in->path;
+    in->path = tmp;
+
+    do {
+        if (! SB_getline (&in->line, in->f)) {
+            if (ferror (in->f)) {
+                err_printf ("%s: %s", in->name, strerror (errno));
+                return EC_OTHER;
+            }
+            return EC_NOATTR;
+        }
+        in->lineNo++;
+    } while (in->line.len == 0);
+
+    if (! Json_path (in->line.buf, &in->path)) {
+        err_printf ("%s:%lu: Not a record printed by --ndjson",
+                    in->name, in->lineNo);
+        return EC_OTHER;
+    }
+
+    if (in->nRecords++ > 0 && compare_paths (&in->prevPath, &in->path) > 0) {
+        err_printf ("%s:%lu: Not sorted by path", in->name, in->lineNo);
+        return EC_OTHER;
+    }
+
+    return EC_OK;
+}
+
+/* Orders the heap by path, and then by position on the command line,
+ * so that records with the same path come out in the order the files
+ * were given.  If "byRecord", records with the same path are ordered
+ * by their bytes first, so that the order doesn't depend on which
+ * input each one came from. */
+static bool heap_less (MergeInput *const *heap,
+                       size_t i,
+                       size_t j,
+                       bool byRecord) {
+    int c = compare_paths (&heap[i]->path, &heap[j]->path);
+
+    if (c == 0 && byRecord) {
+        c = compare_paths (&heap[i]->line, &heap[j]->line);
+    }
+
+    return (c < 0 || (c == 0 && heap[i] < heap[j]));
+}
+
+static void sift_down (MergeInput **heap,
+                       size_t n,
+                       size_t i,
+                       bool byRecord) {
+    for ( ; ; ) {
+        const size_t left = 2 * i + 1;
+        const size_t right = left + 1;
+        size_t least = i;
+
+        if (left < n && heap_less (heap, left, least, byRecord)) {
+            least = left;
+        }
+
+        if (right < n && heap_less (heap, right, least, byRecord)) {
+            least = right;
+        }
+
+        if (least == i) {
+            return;
+        }
+
+        MergeInput *tmp = heap[i];
+        heap[i] = heap[least];
+        heap[least] = tmp;
+        i = least;
+    }
+}
+
+/* Merges the records of the "n" open inputs, and writes them to "out".
+ * Returns EC_OTHER if an input could not be read, was not valid
+ * NDJSON, or was not sorted. */
+static ErrorCode merge_inputs (MergeInput *inputs,
+                               size_t n,
+                               bool byRecord,
+                               FILE *out) {
+    MergeInput **heap = MY_MALLOC (n * sizeof (heap[0]));
+    size_t nHeap = 0;
+    ErrorCode ec = EC_OK;
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        const ErrorCode ec2 = advance (&inputs[i]);
+        if (ec2 == EC_OTHER) {
+            ec = ec2;
+            goto done;
+        } else if (ec2 == EC_OK) {
+            heap[nHeap++] = &inputs[i];
+        }
+    }
+
+    for (i = nHeap / 2; i-- > 0; ) {
+        sift_down (heap, nHeap, i, byRecord);
+    }
+
+    while (nHeap > 0) {
+        MergeInput *in = heap[0];
+
+        fwrite (in->line.buf, 1, in->line.len, out);
+        putc ('\n', out);
+
+        const ErrorCode ec2 = advance (in);
+        if (ec2 == EC_OTHER) {
+            ec = ec2;
+            goto done;
+        } else if (ec2 == EC_NOATTR) {
+            heap[0] = heap[--nHeap];
+        }
+
+        sift_down (heap, nHeap, 0, byRecord);
+    }
+
+ done:
+    free (heap);
+    return ec;
+}
+
+ErrorCode mergeFiles (char *const *files, size_t nFiles) {
+    MergeInput *inputs = MY_MALLOC (nFiles * sizeof (inputs[0]));
+    ErrorCode ec = EC_OK;
+    size_t i;
+
+    memset (inputs, 0, nFiles * sizeof (inputs[0]));
+
+    for (i = 0; i < nFiles && ec == EC_OK; i++) {
+        if (! open_input (&inputs[i], files[i])) {
+            ec = EC_OTHER;
+        }
+    }
+
+    if (ec == EC_OK) {
+        ec = merge_inputs (inputs, nFiles, false, stdout);
+    }
+
+    for (i = 0; i < nFiles; i++) {
+        close_input (&inputs[i]);
+    }
+
+    free (inputs);
+
+    if (fflush (stdout) != 0) {
+        err_printf ("(stdout): %s", strerror (errno));
+        ec = EC_OTHER;
+    }
+
+    return ec;
+}
+
+ErrorCode mergeRuns (FILE *const *runs, size_t nRuns, FILE *out) {
+    MergeInput *inputs = MY_MALLOC (nRuns * sizeof (inputs[0]));
+    ErrorCode ec;
+    size_t i;
+
+    memset (inputs, 0, nRuns * sizeof (inputs[0]));
+
+    for (i = 0; i < nRuns; i++) {
+        inputs[i].name = "(temporary file)";
+        inputs[i].f = runs[i];
+    }
+
+    ec = merge_inputs (inputs, nRuns, true, out);
+
+    for (i = 0; i < nRuns; i++) {
+        inputs[i].f = NULL;     /* the caller closes the runs */
+        close_input (&inputs[i]);
+    }
+
+    free (inputs);
+    return ec;
+}
+
+/* Appends the names of the members whose values differ between the
+ * records "old" and "new" (or which only one of them has) to "out",
+ * separated by commas. */
+static void changed_fields (const ArrayList *old,
+                            const ArrayList *new,
+                            StrBuf *out) {
+    const ArrayList *lists[2] = { old, new };
+    size_t i, j, k;
+
+    for (k = 0; k < 2; k++) {
+        const ArrayList *a = lists[k], *b = lists[1 - k];
+
+        for (i = 0; i < a->size; i += 2) {
+            const char *name = a->strings[i];
+            bool same = false, seen = false;
+
+            if (0 == strcmp (name, "path")) {
+                continue;
+            }
+
+            for (j = 0; j < b->size; j += 2) {
+                if (0 == strcmp (name, b->strings[j])) {
+                    seen = true;
+                    same = (0 == strcmp (a->strings[i + 1],
+                                         b->strings[j + 1]));
+                    break;
+                }
+            }
+
+            /* a member in both is only listed the first time around */
+            if ((k == 0 && ! same) || (k == 1 && ! seen)) {
+                SB_add (out, (out->len > 0 ? ", " : ""));
+                SB_add (out, name);
+            }
+        }
+    }
+}
+
+/* Prints one difference: "+" for added, "-" for removed, or "~" for
+ * changed.  "old" or "new" is NULL if the path isn't in that file, and
+ * "names" lists the members that changed. */
+static void print_change (StrBuf *out,
+                          bool json,
+                          const MergeInput *old,
+                          const MergeInput *new,
+                          const char *names) {
+    const MergeInput *in = (new != NULL ? new : old);
+
+    SB_clear (out);
+
+    if (json) {
+        SB_add (out, "{\"path\":");
+        Attr_jsonString (out, in->path.buf);
+        SB_printf (out, ",\"change\":\"%s\"",
+                   (old == NULL ? "added" :
+                    new == NULL ? "removed" : "changed"));
+        if (old != NULL) {
+            SB_add (out, ",\"old\":");
+            SB_add_len (out, old->line.buf, old->line.len);
+        }
+        if (new != NULL) {
+            SB_add (out, ",\"new\":");
+            SB_add_len (out, new->line.buf, new->line.len);
+        }
+        SB_add (out, "}\n");
+    } else {
+        SB_add (out, (old == NULL ? "+ " : new == NULL ? "- " : "~ "));
+        SB_add (out, in->path.buf);
+        if (names != NULL && names[0] != '\0') {
+            SB_printf (out, " (%s)", names);
+        }
+        SB_add_char (out, '\n');
+    }
+
+    writeUTF8 (stdout, out->buf);
+}
+
+/* Compares two records with the same path member by member, so that the
+ * order they were written in doesn't matter, and puts the names of the
+ * members that differ in "names".  Returns true if they differ.  Records
+ * which aren't flat JSON objects are compared byte for byte. */
+static bool records_differ (const MergeInput *old,
+                            const MergeInput *new,
+                            StrBuf *names) {
+    ArrayList oldFields, newFields;
+    bool differ;
+
+    AL_init (&oldFields);
+    AL_init (&newFields);
+    SB_clear (names);
+
+    if (Json_fields (old->line.buf, &oldFields) &&
+        Json_fields (new->line.buf, &newFields)) {
+        changed_fields (&oldFields, &newFields, names);
+        differ = (names->len > 0);
+    } else {
+        differ = (0 != strcmp (old->line.buf, new->line.buf));
+    }
+
+    AL_cleanup (&oldFields);
+    AL_cleanup (&newFields);
+    return differ;
+}
+
+ErrorCode diffFiles (const char *oldFile, const char *newFile, bool json) {
+    MergeInput old, new;
+    ErrorCode ecOld = EC_NOATTR, ecNew = EC_NOATTR;
+    ErrorCode ec = EC_OK;
+    StrBuf out, names;
+
+    memset (&old, 0, sizeof (old));
+    memset (&new, 0, sizeof (new));
+    SB_init (&out);
+    SB_init (&names);
+
+    if (! open_input (&old, oldFile) || ! open_input (&new, newFile)) {
+        ec = EC_OTHER;
+        goto done;
+    }
+
+    ecOld = advance (&old);
+    ecNew = advance (&new);
+
+    /* A merge join: whichever side has the smaller path is behind, so
+     * its record isn't in the other file. */
+    while (ecOld == EC_OK || ecNew == EC_OK) {
+        int c;
+
+        if (ecOld == EC_OTHER || ecNew == EC_OTHER) {
+            break;
+        } else if (ecOld != EC_OK) {
+            c = 1;
+        } else if (ecNew != EC_OK) {
+            c = -1;
+        } else {
+            c = compare_paths (&old.path, &new.path);
+        }
+
+        if (c < 0) {
+            print_change (&out, json, &old, NULL, NULL);
+            ec = EC_NOATTR;
+            ecOld = advance (&old);
+        } else if (c > 0) {
+            print_change (&out, json, NULL, &new, NULL);
+            ec = EC_NOATTR;
+            ecNew = advance (&new);
+        } else {
+            if (records_differ (&old, &new, &names)) {
+                print_change (&out, json, &old, &new, names.buf);
+                ec = EC_NOATTR;
+            }
+            ecOld = advance (&old);
+            ecNew = advance (&new);
+        }
+    }
+
+    if (ecOld == EC_OTHER || ecNew == EC_OTHER) {
+        ec = EC_OTHER;
+    }
+
+ done:
+    close_input (&old);
+    close_input (&new);
+    SB_cleanup (&out);
+    SB_cleanup (&names);
+
+    if (fflush (stdout) != 0) {
+        err_printf ("(stdout): %s", strerror (errno));
+        ec = EC_OTHER;
+    }
+
+    return ec;
+}
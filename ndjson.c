@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Parses exactly four hex digits.  Returns -1 if they aren't. */
+static long parse_hex4 (const char *p) {
+    long n = 0;
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        const char c = p[i];
+        n <<= 4;
+
+        if (c >= '0' && c <= '9') {
+            n |= c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            n |= c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            n |= c - 'A' + 10;
+        } else {
+            return -1;
+        }
+    }
+
+    return n;
+}
+
+static void add_utf8 (StrBuf *out, unsigned long cp) {
+    if (cp < 0x80) {
+        SB_add_char (out, (char) cp);
+    } else if (cp < 0x800) {
+        SB_add_char (out, (char) (0xc0 | (cp >> 6)));
+        SB_add_char (out, (char) (0x80 | (cp & 0x3f)));
+    } else if (cp < 0x10000) {
+        SB_add_char (out, (char) (0xe0 | (cp >> 12)));
+        SB_add_char (out, (char) (0x80 | ((cp >> 6) & 0x3f)));
+        SB_add_char (out, (char) (0x80 | (cp & 0x3f)));
+    } else {
+        SB_add_char (out, (char) (0xf0 | (cp >> 18)));
+        SB_add_char (out, (char) (0x80 | ((cp >> 12) & 0x3f)));
+        SB_add_char (out, (char) (0x80 | ((cp >> 6) & 0x3f)));
+        SB_add_char (out, (char) (0x80 | (cp & 0x3f)));
+    }
+}
+
+/* Decodes the "\uXXXX" escape at "p" (just after the backslash and
+ * "u"), including the second half of a surrogate pair if there is one.
+ * A lone surrogate is passed through as-is, since print_string() in
+ * attributes.c can produce one from a filename which isn't valid UTF-16.
+ */
+static const char *decode_unicode (const char *p, StrBuf *out) {
+    const long hi = parse_hex4 (p);
+    if (hi < 0) {
+        return NULL;
+    }
+
+    p += 4;
+
+    if (hi >= 0xd800 && hi < 0xdc00 && p[0] == '\\' && p[1] == 'u') {
+        const long lo = parse_hex4 (p + 2);
+        if (lo >= 0xdc00 && lo < 0xe000) {
+            add_utf8 (out, 0x10000 + ((hi - 0xd800) << 10) + (lo - 0xdc00));
+            return p + 6;
+        }
+    }
+
+    add_utf8 (out, hi);
+    return p;
+}
+
+const char *Json_string (const char *p, StrBuf *out) {
+    if (*p != '"') {
+        return NULL;
+    }
+
+    p++;
+
+    for ( ; ; ) {
+        /* copy the run of characters which don't need decoding */
+        const char *start = p;
+        while (*p != '"' && *p != '\\' && *p != 0) {
+            p++;
+        }
+
+        SB_add_len (out, start, p - start);
+
+        switch (*p) {
+        case '"':
+            return p + 1;
+        case 0:
+            return NULL;        /* unterminated string */
+        }
+
+        /* we have a backslash */
+        p++;
+        switch (*(p++)) {
+        case '"':  SB_add_char (out, '"');  break;
+        case '\\': SB_add_char (out, '\\'); break;
+        case '/':  SB_add_char (out, '/');  break;
+        case 'b':  SB_add_char (out, '\b'); break;
+        case 'f':  SB_add_char (out, '\f'); break;
+        case 'n':  SB_add_char (out, '\n'); break;
+        case 'r':  SB_add_char (out, '\r'); break;
+        case 't':  SB_add_char (out, '\t'); break;
+        case 'u':
+            p = decode_unicode (p, out);
+            if (p == NULL) {
+                return NULL;
+            }
+            break;
+        default:
+            return NULL;
+        }
+    }
+}
+
+bool Json_path (const char *line, StrBuf *path) {
+    static const char prefix[] = "{\"path\":";
+    const char *p = NULL;
+
+    SB_clear (path);
+
+    if (0 == strncmp (line, prefix, sizeof (prefix) - 1)) {
+        p = Json_string (line + sizeof (prefix) - 1, path);
+    } else {
+        /* written by something else, so look for it among the members */
+        ArrayList fields;
+        size_t i;
+
+        AL_init (&fields);
+        if (Json_fields (line, &fields)) {
+            for (i = 0; i < fields.size; i += 2) {
+                if (0 == strcmp (fields.strings[i], "path")) {
+                    p = Json_string (fields.strings[i + 1], path);
+                    break;
+                }
+            }
+        }
+        AL_cleanup (&fields);
+    }
+
+    if (path->buf == NULL) {
+        SB_add_len (path, "", 0);
+    }
+
+    return (p != NULL);
+}
+
+bool Json_fields (const char *line, ArrayList *fields) {
+    StrBuf name;
+    const char *p = line;
+    bool ok = false;
+
+    AL_clear (fields);
+
+    if (*p++ != '{') {
+        return false;
+    } else if (*p == '}') {
+        return true;
+    }
+
+    SB_init (&name);
+
+    for ( ; ; ) {
+        SB_clear (&name);
+        p = Json_string (p, &name);
+        if (p == NULL || *p++ != ':') {
+            break;
+        }
+
+        /* the value is kept as it appears in the line */
+        const char *start = p;
+        if (*p == '"') {
+            StrBuf value;
+            SB_init (&value);
+            p = Json_string (p, &value);
+            SB_cleanup (&value);
+            if (p == NULL) {
+                break;
+            }
+        } else {
+            while (*p != ',' && *p != '}' && *p != 0) {
+                p++;
+            }
+        }
+
+        char *raw = MY_MALLOC (p - start + 1);
+        memcpy (raw, start, p - start);
+        raw[p - start] = 0;
+
+        AL_add (fields, (name.buf != NULL ? name.buf : ""));
+        AL_add_nocopy (fields, raw);
+
+        if (*p != ',') {
+            ok = (*p == '}');
+            break;
+        }
+        p++;
+    }
+
+    SB_cleanup (&name);
+    return ok;
+}
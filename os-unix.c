@@ -0,0 +1,551 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE             /* for statx() */
+#endif
+
+#include "whence.h"
+
+#ifndef _WIN32
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+/* Most pieces writeGather() passes to writev() at once.  POSIX only
+ * promises an IOV_MAX of 16, but every system we run on allows 1024. */
+#define GATHER_MAX 64
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <sched.h>
+
+/* from linux/ioprio.h, which glibc doesn't wrap */
+#define IOPRIO_WHO_PROCESS 1
+#define IOPRIO_CLASS_IDLE 3
+#define IOPRIO_CLASS_SHIFT 13
+
+/* statx() lets us say that cached attributes are good enough, which on
+ * a network filesystem saves a round trip to the server per file. */
+#if defined (STATX_CTIME) && defined (AT_STATX_DONT_SYNC)
+#define USE_STATX
+#endif
+
+/* On Linux, read directories with getdents64() directly, rather than
+ * with readdir(), so that we can use a much bigger buffer than the C
+ * library does.  Fewer, larger reads make a big difference on network
+ * filesystems and on HSM-backed storage, where each read of a directory
+ * may be a round trip.
+ */
+#define USE_GETDENTS
+#define GETDENTS_BUFSIZE (256 * 1024)
+
+/* This is the layout the kernel uses; it isn't in any header. */
+struct linux_dirent64 {
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+#endif  /* __linux__ */
+
+struct DirReader {
+#ifdef USE_GETDENTS
+    int fd;
+    char *buf;                  /* GETDENTS_BUFSIZE bytes */
+    size_t len;                 /* bytes returned by last getdents64() */
+    size_t pos;                 /* offset of next entry in buf */
+#else
+    DIR *dir;
+#endif
+    int errnum;                 /* errno from reading the directory, or 0 */
+};
+
+static ErrorCode errnum2ec (int errnum) {
+    switch (errnum) {
+    case ENOENT:
+    case ENOTDIR:
+    case EACCES:
+    case ELOOP:
+    case ENAMETOOLONG:
+        return EC_NOFILE;
+    default:
+        return EC_OTHER;
+    }
+}
+
+static FileType mode2type (mode_t mode) {
+    if (S_ISREG (mode)) {
+        return FT_FILE;
+    } else if (S_ISDIR (mode)) {
+        return FT_DIR;
+    } else {
+        return FT_OTHER;
+    }
+}
+
+#ifdef DT_UNKNOWN
+static FileType dtype2type (unsigned char dtype) {
+    switch (dtype) {
+    case DT_REG:     return FT_FILE;
+    case DT_DIR:     return FT_DIR;
+    case DT_UNKNOWN: return FT_UNKNOWN;
+    default:         return FT_OTHER;
+    }
+}
+#endif
+
+static bool is_dot_or_dotdot (const char *name) {
+    return (name[0] == '.' &&
+            (name[1] == 0 || (name[1] == '.' && name[2] == 0)));
+}
+
+ErrorCode Dir_open (const char *path, DirReader **dr, char **errmsg) {
+#ifdef USE_GETDENTS
+    const int fd = open (path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    const bool failed = (fd < 0);
+#else
+    DIR *dir = opendir (path);
+    const bool failed = (dir == NULL);
+#endif
+
+    if (failed) {
+        const int errnum = errno;
+        *dr = NULL;
+        *errmsg = MY_STRDUP (strerror (errnum));
+        return errnum2ec (errnum);
+    }
+
+    *dr = MY_MALLOC (sizeof (**dr));
+    memset (*dr, 0, sizeof (**dr));
+
+#ifdef USE_GETDENTS
+    (*dr)->fd = fd;
+    (*dr)->buf = MY_MALLOC (GETDENTS_BUFSIZE);
+#else
+    (*dr)->dir = dir;
+#endif
+
+    return EC_OK;
+}
+
+bool Dir_read (DirReader *dr, DirEntry *ent) {
+    for ( ; ; ) {
+#ifdef USE_GETDENTS
+        if (dr->pos >= dr->len) {
+            const long n = syscall (SYS_getdents64, dr->fd,
+                                    dr->buf, GETDENTS_BUFSIZE);
+            if (n <= 0) {
+                dr->errnum = (n < 0 ? errno : 0);
+                return false;
+            }
+
+            dr->len = n;
+            dr->pos = 0;
+        }
+
+        const struct linux_dirent64 *d =
+            (const struct linux_dirent64 *) (dr->buf + dr->pos);
+        dr->pos += d->d_reclen;
+#else
+        errno = 0;
+        const struct dirent *d = readdir (dr->dir);
+
+        if (d == NULL) {
+            dr->errnum = errno;
+            return false;
+        }
+#endif
+
+        if (is_dot_or_dotdot (d->d_name)) {
+            continue;
+        }
+
+        ent->name = d->d_name;
+        ent->inode = d->d_ino;
+#ifdef DT_UNKNOWN
+        ent->type = dtype2type (d->d_type);
+#else
+        ent->type = FT_UNKNOWN;
+#endif
+
+        return true;
+    }
+}
+
+uint64_t Dir_device (DirReader *dr) {
+    struct stat st;
+#ifdef USE_GETDENTS
+    const int fd = dr->fd;
+#else
+    const int fd = dirfd (dr->dir);
+#endif
+
+    if (fstat (fd, &st) < 0) {
+        return 0;
+    }
+
+    return st.st_dev;
+}
+
+ErrorCode Dir_close (DirReader *dr, char **errmsg) {
+    ErrorCode ec = EC_OK;
+
+    if (dr->errnum != 0) {
+        *errmsg = MY_STRDUP (strerror (dr->errnum));
+        ec = errnum2ec (dr->errnum);
+    }
+
+#ifdef USE_GETDENTS
+    close (dr->fd);
+    free (dr->buf);
+#else
+    closedir (dr->dir);
+#endif
+
+    free (dr);
+    return ec;
+}
+
+ErrorCode getFileInfo (const char *path,
+                       bool followLinks,
+                       FileInfo *info,
+                       char **errmsg) {
+    struct stat st;
+    const int ret = (followLinks ? stat (path, &st) : lstat (path, &st));
+
+    if (ret < 0) {
+        const int errnum = errno;
+        *errmsg = MY_STRDUP (strerror (errnum));
+        return errnum2ec (errnum);
+    }
+
+    info->type = mode2type (st.st_mode);
+    info->device = st.st_dev;
+    info->inode = st.st_ino;
+    return EC_OK;
+}
+
+ErrorCode getChangeTime (const char *path, int64_t *nanos, char **errmsg) {
+#ifdef USE_STATX
+    struct statx stx;
+
+    if (statx (AT_FDCWD, path, AT_SYMLINK_NOFOLLOW | AT_STATX_DONT_SYNC,
+               STATX_CTIME, &stx) == 0) {
+        *nanos = (int64_t) stx.stx_ctime.tv_sec * 1000000000 +
+            stx.stx_ctime.tv_nsec;
+        return EC_OK;
+    } else if (errno != ENOSYS) {
+        const int errnum = errno;
+        *errmsg = MY_STRDUP (strerror (errnum));
+        return errnum2ec (errnum);
+    }
+    /* else the kernel is too old for statx(); fall back to lstat() */
+#endif
+
+    struct stat st;
+
+    if (lstat (path, &st) < 0) {
+        const int errnum = errno;
+        *errmsg = MY_STRDUP (strerror (errnum));
+        return errnum2ec (errnum);
+    }
+
+#ifdef __APPLE__
+    *nanos = (int64_t) st.st_ctimespec.tv_sec * 1000000000 +
+        st.st_ctimespec.tv_nsec;
+#else
+    *nanos = (int64_t) st.st_ctim.tv_sec * 1000000000 + st.st_ctim.tv_nsec;
+#endif
+    return EC_OK;
+}
+
+ErrorCode getFileSize (const char *path, uint64_t *size, char **errmsg) {
+#ifdef USE_STATX
+    struct statx stx;
+
+    if (statx (AT_FDCWD, path, AT_SYMLINK_NOFOLLOW | AT_STATX_DONT_SYNC,
+               STATX_SIZE, &stx) == 0) {
+        *size = stx.stx_size;
+        return EC_OK;
+    } else if (errno != ENOSYS) {
+        const int errnum = errno;
+        *errmsg = MY_STRDUP (strerror (errnum));
+        return errnum2ec (errnum);
+    }
+    /* else the kernel is too old for statx(); fall back to lstat() */
+#endif
+
+    struct stat st;
+
+    if (lstat (path, &st) < 0) {
+        const int errnum = errno;
+        *errmsg = MY_STRDUP (strerror (errnum));
+        return errnum2ec (errnum);
+    }
+
+    *size = (uint64_t) st.st_size;
+    return EC_OK;
+}
+
+int64_t currentTime (void) {
+    struct timespec ts;
+
+    clock_gettime (CLOCK_REALTIME, &ts);
+    return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+FILE *openFile (const char *path, const char *mode) {
+    return fopen (path, mode);
+}
+
+ErrorCode mapFile (const char *path,
+                   const void **data,
+                   size_t *size,
+                   char **errmsg) {
+    struct stat st;
+    const int fd = open (path, O_RDONLY);
+
+    if (fd < 0) {
+        const int errnum = errno;
+        *errmsg = MY_STRDUP (strerror (errnum));
+        return (errnum == ENOENT ? EC_NOFILE : EC_OTHER);
+    }
+
+    if (fstat (fd, &st) < 0) {
+        *errmsg = MY_STRDUP (strerror (errno));
+        close (fd);
+        return EC_OTHER;
+    }
+
+    *data = NULL;
+    *size = (size_t) st.st_size;
+
+    /* mmap() doesn't allow a length of 0 */
+    if (*size > 0) {
+        void *p = mmap (NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            *errmsg = MY_STRDUP (strerror (errno));
+            close (fd);
+            return EC_OTHER;
+        }
+        *data = p;
+    }
+
+    close (fd);
+    return EC_OK;
+}
+
+void unmapFile (const void *data, size_t size) {
+    if (data != NULL) {
+        munmap ((void *) data, size);
+    }
+}
+
+FILE *tempFile (void) {
+    const char *dir = getenv ("TMPDIR");
+    ArrayList al;
+
+    if (dir == NULL || *dir == 0) {
+        dir = "/tmp";
+    }
+
+    AL_init (&al);
+    AL_add (&al, dir);
+    AL_add (&al, "/" CMD_NAME ".XXXXXX");
+    char *name = AL_join (&al);
+    AL_cleanup (&al);
+
+    const int fd = mkstemp (name);
+    if (fd >= 0) {
+        unlink (name);          /* so it goes away when closed */
+    }
+
+    free (name);
+    return (fd < 0 ? NULL : fdopen (fd, "w+b"));
+}
+
+bool seekFile (FILE *f, uint64_t offset) {
+    return (fseeko (f, (off_t) offset, SEEK_SET) == 0);
+}
+
+bool writeGather (FILE *f, const OutPiece *pieces, size_t n) {
+    struct iovec iov[GATHER_MAX];
+    const int fd = fileno (f);
+    size_t i = 0, done = 0;     /* bytes of pieces[i] already written */
+
+    if (fflush (f) != 0) {
+        return false;
+    }
+
+    while (i < n) {
+        size_t j;
+        int cnt = 0;
+
+        for (j = i; j < n && cnt < GATHER_MAX; j++) {
+            const size_t skip = (j == i ? done : 0);
+            iov[cnt].iov_base = (char *) pieces[j].buf + skip;
+            iov[cnt].iov_len = pieces[j].len - skip;
+            cnt++;
+        }
+
+        ssize_t written = writev (fd, iov, cnt);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+
+        /* a short write leaves us part way through some piece */
+        while (i < n && (size_t) written >= pieces[i].len - done) {
+            written -= pieces[i].len - done;
+            done = 0;
+            i++;
+        }
+        done += written;
+    }
+
+    return true;
+}
+
+bool streamSize (FILE *f, uint64_t *size) {
+    struct stat st;
+
+    if (fstat (fileno (f), &st) < 0 || ! S_ISREG (st.st_mode)) {
+        return false;
+    }
+
+    *size = st.st_size;
+    return true;
+}
+
+ErrorCode truncateStream (FILE *f, uint64_t size, char **errmsg) {
+    fflush (f);
+
+    if (ftruncate (fileno (f), (off_t) size) < 0 ||
+        fseeko (f, 0, SEEK_END) < 0) {
+        *errmsg = MY_STRDUP (strerror (errno));
+        return EC_OTHER;
+    }
+
+    return EC_OK;
+}
+
+ErrorCode syncStream (FILE *f, char **errmsg) {
+    if (fflush (f) != 0 || fsync (fileno (f)) < 0) {
+        *errmsg = MY_STRDUP (strerror (errno));
+        return EC_OTHER;
+    }
+
+    return EC_OK;
+}
+
+ErrorCode replaceFile (const char *from, const char *to, char **errmsg) {
+    if (rename (from, to) < 0) {
+        *errmsg = MY_STRDUP (strerror (errno));
+        return EC_OTHER;
+    }
+
+    /* Make the rename itself durable.  This is best effort, since not
+     * every system lets a directory be opened for this. */
+    const char *slash = strrchr (to, '/');
+    char *dir = MY_STRDUP (slash == NULL ? "." : to);
+    if (slash != NULL) {
+        dir[slash - to + 1] = 0;
+    }
+
+    const int fd = open (dir, O_RDONLY);
+    if (fd >= 0) {
+        fsync (fd);
+        close (fd);
+    }
+
+    free (dir);
+    return EC_OK;
+}
+
+bool enterBackground (void) {
+    bool ok = true;
+
+#if defined (__linux__)
+    struct sched_param param;
+
+    memset (&param, 0, sizeof (param));
+    if (sched_setscheduler (0, SCHED_IDLE, &param) != 0) {
+        ok = false;
+    }
+
+    if (syscall (SYS_ioprio_set, IOPRIO_WHO_PROCESS, 0,
+                 IOPRIO_CLASS_IDLE << IOPRIO_CLASS_SHIFT) != 0) {
+        ok = false;
+    }
+#elif defined (__APPLE__)
+    /* throttles both CPU and disk */
+    if (setpriority (PRIO_DARWIN_PROCESS, 0, PRIO_DARWIN_BG) != 0) {
+        ok = false;
+    }
+#else
+    /* idprio(1) is only for root on FreeBSD, so settle for nice */
+    if (setpriority (PRIO_PROCESS, 0, PRIO_MAX) != 0) {
+        ok = false;
+    }
+#endif
+
+    return ok;
+}
+
+bool ioPressure (double *percent) {
+#ifdef __linux__
+    FILE *f = fopen ("/proc/pressure/io", "r");
+    bool ok;
+
+    if (f == NULL) {
+        return false;           /* before Linux 4.20, or PSI disabled */
+    }
+
+    ok = (fscanf (f, "some avg10=%lf", percent) == 1);
+    fclose (f);
+    return ok;
+#else
+    return false;
+#endif
+}
+
+int numberOfCPUs (void) {
+    const long n = sysconf (_SC_NPROCESSORS_ONLN);
+    return (n < 1 ? 1 : (int) n);
+}
+
+#endif  /* not _WIN32 */
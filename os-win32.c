@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#ifdef _WIN32
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <Windows.h>
+#include <io.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+struct DirReader {
+    HANDLE h;
+    WIN32_FIND_DATAW data;
+    bool haveData;              /* "data" holds an entry not yet returned */
+    DWORD lastErr;              /* error from FindNextFileW(), or 0 */
+    char *name;                 /* UTF-8 name of the last entry returned */
+};
+
+static ErrorCode lastErr2ec (DWORD lastErr) {
+    switch (lastErr) {
+    case ERROR_FILE_NOT_FOUND:
+    case ERROR_PATH_NOT_FOUND:
+    case ERROR_ACCESS_DENIED:
+    case ERROR_DIRECTORY:
+    case ERROR_INVALID_NAME:
+        return EC_NOFILE;
+    default:
+        return EC_OTHER;
+    }
+}
+
+static FileType attrs2type (DWORD attrs) {
+    if (0 != (attrs & FILE_ATTRIBUTE_REPARSE_POINT)) {
+        return FT_OTHER;        /* symbolic link or junction */
+    } else if (0 != (attrs & FILE_ATTRIBUTE_DIRECTORY)) {
+        return FT_DIR;
+    } else if (0 != (attrs & FILE_ATTRIBUTE_DEVICE)) {
+        return FT_OTHER;
+    } else {
+        return FT_FILE;
+    }
+}
+
+ErrorCode Dir_open (const char *path, DirReader **dr, char **errmsg) {
+    ArrayList al;
+
+    AL_init (&al);
+    AL_add (&al, path);
+    AL_add (&al, "\\*");
+    char *pattern = AL_join (&al);
+    AL_cleanup (&al);
+
+    utf16 *wpattern = utf8to16_nofail (pattern);
+    DirReader *r = MY_MALLOC (sizeof (*r));
+    memset (r, 0, sizeof (*r));
+
+    r->h = FindFirstFileW (wpattern, &r->data);
+    free (wpattern);
+    free (pattern);
+
+    if (r->h == INVALID_HANDLE_VALUE) {
+        const DWORD lastErr = GetLastError ();
+        free (r);
+        *dr = NULL;
+        *errmsg = getErrorString (lastErr);
+        return lastErr2ec (lastErr);
+    }
+
+    r->haveData = true;
+    *dr = r;
+    return EC_OK;
+}
+
+bool Dir_read (DirReader *dr, DirEntry *ent) {
+    for ( ; ; ) {
+        if (! dr->haveData) {
+            if (! FindNextFileW (dr->h, &dr->data)) {
+                const DWORD lastErr = GetLastError ();
+                if (lastErr != ERROR_NO_MORE_FILES) {
+                    dr->lastErr = lastErr;
+                }
+                return false;
+            }
+        }
+
+        dr->haveData = false;
+
+        const utf16 *wname = dr->data.cFileName;
+        if (wname[0] == L'.' &&
+            (wname[1] == 0 || (wname[1] == L'.' && wname[2] == 0))) {
+            continue;           /* skip "." and ".." */
+        }
+
+        free (dr->name);
+        dr->name = utf16to8 (wname);
+        if (dr->name == NULL) {
+            continue;           /* not representable; skip it */
+        }
+
+        ent->name = dr->name;
+        ent->inode = 0;
+        ent->type = attrs2type (dr->data.dwFileAttributes);
+        return true;
+    }
+}
+
+uint64_t Dir_device (DirReader *dr) {
+    return 0;
+}
+
+ErrorCode Dir_close (DirReader *dr, char **errmsg) {
+    ErrorCode ec = EC_OK;
+
+    if (dr->lastErr != 0) {
+        *errmsg = getErrorString (dr->lastErr);
+        ec = lastErr2ec (dr->lastErr);
+    }
+
+    FindClose (dr->h);
+    free (dr->name);
+    free (dr);
+    return ec;
+}
+
+ErrorCode getFileInfo (const char *path,
+                       bool followLinks,
+                       FileInfo *info,
+                       char **errmsg) {
+    utf16 *wpath = utf8to16_nofail (path);
+    const DWORD attrs = GetFileAttributesW (wpath);
+    free (wpath);
+
+    if (attrs == INVALID_FILE_ATTRIBUTES) {
+        const DWORD lastErr = GetLastError ();
+        *errmsg = getErrorString (lastErr);
+        return lastErr2ec (lastErr);
+    }
+
+    if (followLinks) {
+        info->type = attrs2type (attrs & ~FILE_ATTRIBUTE_REPARSE_POINT);
+    } else {
+        info->type = attrs2type (attrs);
+    }
+
+    info->device = 0;
+    info->inode = 0;
+    return EC_OK;
+}
+
+/* FILETIME counts 100-nanosecond intervals since 1601. */
+#define EPOCH_DIFF 116444736000000000LL /* 1970 - 1601, in FILETIME units */
+
+static int64_t filetime2nanos (int64_t ft) {
+    return (ft - EPOCH_DIFF) * 100;
+}
+
+ErrorCode getChangeTime (const char *path, int64_t *nanos, char **errmsg) {
+    utf16 *wpath = utf8to16_nofail (path);
+    const HANDLE h = CreateFileW (wpath, FILE_READ_ATTRIBUTES,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE |
+                                  FILE_SHARE_DELETE,
+                                  NULL, OPEN_EXISTING,
+                                  FILE_FLAG_BACKUP_SEMANTICS |
+                                  FILE_FLAG_OPEN_REPARSE_POINT,
+                                  NULL);
+    free (wpath);
+
+    if (h == INVALID_HANDLE_VALUE) {
+        const DWORD lastErr = GetLastError ();
+        *errmsg = getErrorString (lastErr);
+        return lastErr2ec (lastErr);
+    }
+
+    FILE_BASIC_INFO info;
+    const BOOL ok = GetFileInformationByHandleEx (h, FileBasicInfo,
+                                                  &info, sizeof (info));
+    const DWORD lastErr = GetLastError ();
+    CloseHandle (h);
+
+    if (! ok) {
+        *errmsg = getErrorString (lastErr);
+        return lastErr2ec (lastErr);
+    }
+
+    *nanos = filetime2nanos (info.ChangeTime.QuadPart);
+    return EC_OK;
+}
+
+ErrorCode getFileSize (const char *path, uint64_t *size, char **errmsg) {
+    utf16 *wpath = utf8to16_nofail (path);
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    const BOOL ok = GetFileAttributesExW (wpath, GetFileExInfoStandard,
+                                          &data);
+    const DWORD lastErr = GetLastError ();
+    free (wpath);
+
+    if (! ok) {
+        *errmsg = getErrorString (lastErr);
+        return lastErr2ec (lastErr);
+    }
+
+    *size = ((uint64_t) data.nFileSizeHigh << 32) | data.nFileSizeLow;
+    return EC_OK;
+}
+
+int64_t currentTime (void) {
+    FILETIME ft;
+    ULARGE_INTEGER u;
+
+    GetSystemTimeAsFileTime (&ft);
+    u.LowPart = ft.dwLowDateTime;
+    u.HighPart = ft.dwHighDateTime;
+    return filetime2nanos ((int64_t) u.QuadPart);
+}
+
+FILE *openFile (const char *path, const char *mode) {
+    utf16 *wpath = utf8to16_nofail (path);
+    utf16 *wmode = utf8to16_nofail (mode);
+    FILE *f = _wfopen (wpath, wmode);
+
+    free (wpath);
+    free (wmode);
+    return f;
+}
+
+bool streamSize (FILE *f, uint64_t *size) {
+    struct _stati64 st;
+
+    if (_fstati64 (_fileno (f), &st) < 0 || 0 == (st.st_mode & _S_IFREG)) {
+        return false;
+    }
+
+    *size = st.st_size;
+    return true;
+}
+
+ErrorCode truncateStream (FILE *f, uint64_t size, char **errmsg) {
+    fflush (f);
+
+    const errno_t err = _chsize_s (_fileno (f), (__int64) size);
+    if (err != 0 || _fseeki64 (f, 0, SEEK_END) != 0) {
+        *errmsg = MY_STRDUP (strerror (err != 0 ? err : errno));
+        return EC_OTHER;
+    }
+
+    return EC_OK;
+}
+
+ErrorCode syncStream (FILE *f, char **errmsg) {
+    if (fflush (f) != 0 || _commit (_fileno (f)) != 0) {
+        *errmsg = MY_STRDUP (strerror (errno));
+        return EC_OTHER;
+    }
+
+    return EC_OK;
+}
+
+ErrorCode replaceFile (const char *from, const char *to, char **errmsg) {
+    utf16 *wfrom = utf8to16_nofail (from);
+    utf16 *wto = utf8to16_nofail (to);
+    const BOOL ok = MoveFileExW (wfrom, wto,
+                                 MOVEFILE_REPLACE_EXISTING |
+                                 MOVEFILE_WRITE_THROUGH);
+    const DWORD lastErr = GetLastError ();
+
+    free (wfrom);
+    free (wto);
+
+    if (! ok) {
+        *errmsg = getErrorString (lastErr);
+        return EC_OTHER;
+    }
+
+    return EC_OK;
+}
+
+ErrorCode mapFile (const char *path,
+                   const void **data,
+                   size_t *size,
+                   char **errmsg) {
+    utf16 *wpath = utf8to16_nofail (path);
+    HANDLE h = CreateFileW (wpath, GENERIC_READ, FILE_SHARE_READ, NULL,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    DWORD lastErr = GetLastError ();
+    LARGE_INTEGER li;
+
+    free (wpath);
+
+    if (h == INVALID_HANDLE_VALUE) {
+        *errmsg = getErrorString (lastErr);
+        return lastErr2ec (lastErr);
+    }
+
+    if (! GetFileSizeEx (h, &li)) {
+        *errmsg = getErrorString (GetLastError ());
+        CloseHandle (h);
+        return EC_OTHER;
+    }
+
+    *data = NULL;
+    *size = (size_t) li.QuadPart;
+
+    /* an empty file can't be mapped */
+    if (*size > 0) {
+        HANDLE m = CreateFileMappingW (h, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (m != NULL) {
+            *data = MapViewOfFile (m, FILE_MAP_READ, 0, 0, 0);
+        }
+
+        lastErr = GetLastError ();
+        if (m != NULL) {
+            CloseHandle (m);    /* the view keeps the mapping alive */
+        }
+
+        if (*data == NULL) {
+            *errmsg = getErrorString (lastErr);
+            CloseHandle (h);
+            return EC_OTHER;
+        }
+    }
+
+    CloseHandle (h);
+    return EC_OK;
+}
+
+void unmapFile (const void *data, size_t size) {
+    if (data != NULL) {
+        UnmapViewOfFile (data);
+    }
+}
+
+FILE *tempFile (void) {
+    utf16 dir[MAX_PATH + 1];
+    utf16 name[MAX_PATH + 1];
+
+    if (0 == GetTempPathW (MAX_PATH + 1, dir) ||
+        0 == GetTempFileNameW (dir, L"whe", 0, name)) {
+        return NULL;
+    }
+
+    /* "D" deletes the file when it is closed */
+    return _wfopen (name, L"w+bD");
+}
+
+bool seekFile (FILE *f, uint64_t offset) {
+    return (_fseeki64 (f, (__int64) offset, SEEK_SET) == 0);
+}
+
+/* There is no writev() here, so this just leaves it to stdio. */
+bool writeGather (FILE *f, const OutPiece *pieces, size_t n) {
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        if (fwrite (pieces[i].buf, 1, pieces[i].len, f) != pieces[i].len) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Background mode lowers the CPU, I/O, and memory priority of the
+ * whole process. */
+bool enterBackground (void) {
+    return (0 != SetPriorityClass (GetCurrentProcess (),
+                                   PROCESS_MODE_BACKGROUND_BEGIN));
+}
+
+/* Windows has nothing like /proc/pressure/io. */
+bool ioPressure (double *percent) {
+    return false;
+}
+
+int numberOfCPUs (void) {
+    SYSTEM_INFO si;
+
+    GetSystemInfo (&si);
+    return (si.dwNumberOfProcessors < 1 ? 1 : (int) si.dwNumberOfProcessors);
+}
+
+#endif  /* _WIN32 */
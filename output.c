@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+/* All output to stdout from the scanning threads goes through
+ * Output_write(), which serializes the threads, and also takes care
+ * of putting commas between the members of the JSON object printed
+ * by --json.
+ *
+ * Unless stdout is a terminal (or --output-queue is 0), the buffers
+ * are not written by the scanning threads themselves, but queued for
+ * a writer thread, which writes as many as it can at once with
+ * writeGather().  So the scan only waits for a slow reader of stdout
+ * when the queue holds more than queueLimit bytes.  The buffers are
+ * handed over whole, and the writer gives them back afterwards to be
+ * reused, so the lock is only held long enough to move a few pointers.
+ */
+
+#define RING_SLOTS 256          /* most buffers which can be queued */
+#define BATCH 32                /* most buffers written at once */
+#define SPARE_SLOTS 16          /* most written buffers kept for reuse */
+
+typedef struct Chunk {
+    char *buf;                  /* malloced; a StrBuf's buffer */
+    size_t len;
+    size_t capacity;
+    bool separated;             /* write Output_separator() first? */
+} Chunk;
+
+static pthread_mutex_t outLock = PTHREAD_MUTEX_INITIALIZER;
+static AttrStyle outStyle = AS_HUMAN;
+static bool anyRecords = false;
+static Sorter *sorter = NULL;   /* for --sort path */
+
+/* The following are all protected by outLock. */
+static pthread_cond_t notEmpty = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t notFull = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t drained = PTHREAD_COND_INITIALIZER;
+static bool async = false;      /* is there a writer thread? */
+static bool stopping = false;   /* Output_end() was called */
+static bool writing = false;    /* the writer has chunks out of the ring */
+static Chunk ring[RING_SLOTS];
+static size_t head = 0;         /* index of oldest chunk in ring */
+static size_t count = 0;        /* number of chunks in ring */
+static size_t queued = 0;       /* bytes queued or being written */
+static size_t queueLimit = 0;
+static Chunk spare[SPARE_SLOTS];
+static size_t nSpare = 0;
+
+static pthread_t writer;
+
+/* "s" must be NUL terminated at "len", as a StrBuf is, but may also
+ * contain NULs of its own, such as from --format '%p\0'. */
+static void write_stdout (const char *s, size_t len) {
+#ifdef _WIN32
+    if (stdoutTerminal.is_terminal) {
+        /* writeUTF8() so that the console gets UTF-16, a piece at a
+         * time, since it stops at the first NUL */
+        const char *end = s + len;
+        while (true) {
+            writeUTF8 (stdout, s);
+            s += strlen (s);
+            if (s >= end) {
+                return;
+            }
+            fputc (0, stdout);
+            s++;
+        }
+    }
+#endif
+
+    fwrite (s, 1, len, stdout);
+}
+
+/* Writes the chunks "c[0]" to "c[n-1]" to stdout. */
+static void write_chunks (const Chunk *c, size_t n) {
+    OutPiece pieces[2 * BATCH];
+    const char *sep = Output_separator ();
+    const size_t sepLen = strlen (sep);
+    size_t i, nPieces = 0;
+
+    for (i = 0; i < n; i++) {
+        if (c[i].separated && sepLen > 0) {
+            pieces[nPieces].buf = sep;
+            pieces[nPieces++].len = sepLen;
+        }
+        pieces[nPieces].buf = c[i].buf;
+        pieces[nPieces++].len = c[i].len;
+    }
+
+    /* As with fwrite() before there was a writer thread, an error
+     * (other than a broken pipe, which kills us) is not reported. */
+    writeGather (stdout, pieces, nPieces);
+}
+
+static void *writer_main (void *arg) {
+    Chunk batch[BATCH];
+    size_t n, i, bytes;
+
+    pthread_mutex_lock (&outLock);
+
+    for ( ; ; ) {
+        while (count == 0 && ! stopping) {
+            pthread_cond_wait (&notEmpty, &outLock);
+        }
+
+        if (count == 0) {
+            break;
+        }
+
+        for (n = 0; n < BATCH && count > 0; n++, count--) {
+            batch[n] = ring[head];
+            head = (head + 1) % RING_SLOTS;
+        }
+
+        writing = true;
+        pthread_mutex_unlock (&outLock);
+
+        write_chunks (batch, n);
+
+        pthread_mutex_lock (&outLock);
+        writing = false;
+
+        for (i = 0, bytes = 0; i < n; i++) {
+            bytes += batch[i].len;
+            if (nSpare < SPARE_SLOTS) {
+                spare[nSpare++] = batch[i];
+            } else {
+                free (batch[i].buf);
+            }
+        }
+
+        queued -= bytes;
+        pthread_cond_broadcast (&notFull);
+        if (count == 0) {
+            pthread_cond_broadcast (&drained);
+        }
+    }
+
+    pthread_mutex_unlock (&outLock);
+    return NULL;
+}
+
+void Output_sortByPath (size_t runSize) {
+    sorter = Sorter_new (runSize);
+}
+
+void Output_begin (AttrStyle style, size_t limit) {
+    outStyle = style;
+    anyRecords = false;
+
+    if (style == AS_JSON) {
+        printf ("{\n");
+    }
+
+    /* With --sort, nothing is written until the end. */
+    if (limit > 0 && ! stdoutTerminal.is_terminal && sorter == NULL) {
+        fflush (stdout);        /* before the writer bypasses stdio */
+        queueLimit = limit;
+        stopping = false;
+        async = (0 == pthread_create (&writer, NULL, writer_main, NULL));
+    }
+}
+
+const char *Output_separator (void) {
+    return (outStyle == AS_JSON ? ",\n" : "");
+}
+
+/* Hands the buffer of "records" over to the writer thread, and gives
+ * "records" an empty one.  Must be called with outLock held. */
+static void enqueue (StrBuf *records) {
+    Chunk *c;
+
+    /* Always let one chunk in, no matter how big, or we'd wait forever. */
+    while (count == RING_SLOTS ||
+           (queued > 0 && queued + records->len > queueLimit)) {
+        pthread_cond_wait (&notFull, &outLock);
+    }
+
+    c = &ring[(head + count) % RING_SLOTS];
+    c->buf = records->buf;
+    c->len = records->len;
+    c->capacity = records->capacity;
+    c->separated = anyRecords;
+    count++;
+    queued += records->len;
+    pthread_cond_signal (&notEmpty);
+
+    SB_init (records);
+    if (nSpare > 0) {
+        nSpare--;
+        records->buf = spare[nSpare].buf;
+        records->capacity = spare[nSpare].capacity;
+        records->buf[0] = 0;
+    }
+}
+
+void Output_write (StrBuf *records) {
+    if (records->len == 0) {
+        return;
+    }
+
+    pthread_mutex_lock (&outLock);
+
+    if (sorter != NULL) {
+        Sorter_add (sorter, records->buf, records->len);
+    } else if (async) {
+        enqueue (records);
+    } else {
+        if (anyRecords) {
+            const char *sep = Output_separator ();
+            write_stdout (sep, strlen (sep));
+        }
+
+        write_stdout (records->buf, records->len);
+
+        if (stdoutTerminal.is_terminal) {
+            fflush (stdout);
+        }
+    }
+
+    anyRecords = true;
+    pthread_mutex_unlock (&outLock);
+    SB_clear (records);
+}
+
+/* Waits until the writer thread has written everything queued so far.
+ * Must be called with outLock held. */
+static void drain (void) {
+    while (async && (count > 0 || writing)) {
+        pthread_cond_wait (&drained, &outLock);
+    }
+}
+
+ErrorCode Output_end (void) {
+    ErrorCode ec = EC_OK;
+
+    pthread_mutex_lock (&outLock);
+
+    if (async) {
+        stopping = true;
+        pthread_cond_signal (&notEmpty);
+        pthread_mutex_unlock (&outLock);
+        pthread_join (writer, NULL);
+        pthread_mutex_lock (&outLock);
+        async = false;
+
+        while (nSpare > 0) {
+            free (spare[--nSpare].buf);
+        }
+    }
+
+    if (sorter != NULL) {
+        ec = Sorter_finish (sorter, stdout);
+        Sorter_free (sorter);
+        sorter = NULL;
+    }
+
+    if (outStyle == AS_JSON) {
+        printf ("%s}\n", (anyRecords ? "\n" : ""));
+    }
+
+    fflush (stdout);
+    pthread_mutex_unlock (&outLock);
+    return ec;
+}
+
+bool Output_sync (uint64_t *offset) {
+    pthread_mutex_lock (&outLock);
+    drain ();
+    fflush (stdout);
+    const bool ret = streamSize (stdout, offset);
+    pthread_mutex_unlock (&outLock);
+
+    return ret;
+}
+
+ErrorCode Output_resume (const Checkpoint *cp) {
+    uint64_t size;
+    char *errmsg = NULL;
+
+    if (! cp->haveOffset || ! streamSize (stdout, &size)) {
+        return EC_OK;           /* a pipe, then or now; nothing to check */
+    }
+
+    if (size < cp->offset) {
+        err_printf (CMD_NAME ": stdout does not contain the output so far "
+                    "(append to the same file with \">>\")");
+        return EC_OTHER;
+    }
+
+    if (size > cp->offset &&
+        EC_OK != truncateStream (stdout, cp->offset, &errmsg)) {
+        err_printf ("(stdout): %s", errmsg);
+        free (errmsg);
+        return EC_OTHER;
+    }
+
+    return EC_OK;
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+
+/* For --file-timeout and --deadline, attributes are looked up on a
+ * thread of their own, so that the scan can give up on a file whose
+ * lookup never returns (as with a dead NFS server) and move on.  The
+ * thread which hung is left behind, and cleans up after itself if the
+ * lookup ever does return.
+ */
+
+struct Prober {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    pthread_t thread;
+    bool busy;                  /* a lookup is waiting or in progress */
+    bool abandoned;             /* the owner gave up on the lookup */
+    bool quit;                  /* the owner is done with us */
+    char *path;                 /* malloced; file to look up */
+    AttrQuery query;
+    Attributes attrs;           /* result of the lookup */
+    ErrorCode ec;
+    Cache cache;
+};
+
+static void destroy (Prober *pr) {
+    free (pr->path);
+    Cache_cleanup (&pr->cache);
+    pthread_cond_destroy (&pr->cond);
+    pthread_mutex_destroy (&pr->lock);
+    free (pr);
+}
+
+static void *prober_main (void *arg) {
+    Prober *pr = (Prober *) arg;
+    Attributes attrs;
+    ErrorCode ec;
+
+    pthread_mutex_lock (&pr->lock);
+
+    for ( ; ; ) {
+        while (! pr->busy && ! pr->quit) {
+            pthread_cond_wait (&pr->cond, &pr->lock);
+        }
+
+        if (! pr->busy) {
+            break;
+        }
+
+        pthread_mutex_unlock (&pr->lock);
+
+        /* pr->path and pr->query don't change while we're busy */
+        Attr_init (&attrs);
+        ec = getAttributes (pr->path, &pr->query, &attrs, &pr->cache);
+
+        pthread_mutex_lock (&pr->lock);
+        pr->busy = false;
+
+        if (pr->abandoned) {
+            Attr_cleanup (&attrs);
+            break;
+        }
+
+        pr->attrs = attrs;
+        pr->ec = ec;
+        pthread_cond_signal (&pr->cond);
+    }
+
+    const bool abandoned = pr->abandoned;
+    pthread_mutex_unlock (&pr->lock);
+
+    /* Nobody else refers to us any more. */
+    if (abandoned) {
+        destroy (pr);
+    }
+
+    return NULL;
+}
+
+Prober *Prober_new (void) {
+    Prober *pr = MY_MALLOC (sizeof (*pr));
+
+    memset (pr, 0, sizeof (*pr));
+    pthread_mutex_init (&pr->lock, NULL);
+    pthread_cond_init (&pr->cond, NULL);
+    Cache_init (&pr->cache);
+
+    if (0 != pthread_create (&pr->thread, NULL, prober_main, pr)) {
+        err_printf (CMD_NAME ": could not create thread");
+        exit (EC_OTHER);
+    }
+
+    return pr;
+}
+
+void Prober_free (Prober *pr) {
+    pthread_mutex_lock (&pr->lock);
+    pr->quit = true;
+    pthread_cond_signal (&pr->cond);
+    pthread_mutex_unlock (&pr->lock);
+
+    pthread_join (pr->thread, NULL);
+    destroy (pr);
+}
+
+bool Prober_get (Prober *pr,
+                 const char *path,
+                 const AttrQuery *query,
+                 int64_t limit,
+                 Attributes *dest,
+                 ErrorCode *ec) {
+    struct timespec ts;
+    bool done;
+
+    ts.tv_sec = (time_t) (limit / 1000000000);
+    ts.tv_nsec = (long) (limit % 1000000000);
+
+    pthread_mutex_lock (&pr->lock);
+
+    free (pr->path);
+    pr->path = MY_STRDUP (path);
+    pr->query = *query;
+    pr->busy = true;
+    pthread_cond_signal (&pr->cond);
+
+    while (pr->busy) {
+        if (ETIMEDOUT == pthread_cond_timedwait (&pr->cond, &pr->lock, &ts) &&
+            pr->busy) {
+            break;
+        }
+    }
+
+    done = ! pr->busy;
+
+    if (done) {
+        *dest = pr->attrs;
+        *ec = pr->ec;
+    } else {
+        pr->abandoned = true;
+        pthread_detach (pr->thread);
+    }
+
+    pthread_mutex_unlock (&pr->lock);
+    return done;
+}
@@ -73,8 +73,7 @@ static const char *typeString (CFPropertyListRef plist) {
 
 static void addString (CFStringRef str, ArrayList *dest) {
     size_t buflen = CFStringGetLength (str) * 4 + 1;
-    char *buf = malloc (buflen);
-    CHECK_NULL (buf);
+    char *buf = MY_MALLOC (buflen);
     if (CFStringGetCString (str, buf, buflen, kCFStringEncodingUTF8)) {
         AL_add (dest, buf);
     } else {
@@ -85,16 +84,13 @@ static void addString (CFStringRef str, ArrayList *dest) {
 
 static char *copyString (CFStringRef str) {
     size_t buflen = CFStringGetLength (str) * 4 + 1;
-    char *buf = malloc (buflen);
-    CHECK_NULL (buf);
+    char *buf = MY_MALLOC (buflen);
     if (CFStringGetCString (str, buf, buflen, kCFStringEncodingUTF8)) {
         const size_t len = strlen (buf);
-        buf = realloc (buf, len + 1);
-        CHECK_NULL (buf);
+        buf = MY_REALLOC (buf, len + 1);
         return buf;
     } else {
-        buf = realloc (buf, 4);
-        CHECK_NULL (buf);
+        buf = MY_REALLOC (buf, 4);
         memset (buf, '?', 3);
         buf[3] = 0;
         return buf;
@@ -0,0 +1,16396 @@
+/* Generated by regenerate-psl.sh from the Public Suffix List
+ * (https://publicsuffix.org/), which is subject to the terms of the
+ * Mozilla Public License, v. 2.0 (https://mozilla.org/MPL/2.0/).
+ * Do not edit.
+ */
+
+#include "whence.h"
+
+const size_t pslTableSize = 16384;      /* for 9700 names */
+
+const PslRule pslTable[16384] = {
+    { "lol", 0x34514000, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "istmein.de", 0x3f784003, PSL_RULE },
+    { "eid.no", 0xa4904004, PSL_RULE },
+    { "yuzawa.niigata.jp", 0x752e0005, PSL_RULE },
+    { "accountants", 0x4851c006, PSL_RULE },
+    { "ras.ru", 0xabea0006, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.re", 0x3b480009, PSL_RULE },
+    { "minamitane.kagoshima.jp", 0x7c8f400a, PSL_RULE },
+    { "basilicata.it", 0x3dda800b, PSL_RULE },
+    { "bievat.no", 0x7ca3000b, PSL_RULE },
+    { "niikappu.hokkaido.jp", 0xb462400a, PSL_RULE },
+    { "nissedal.no", 0x9df6000b, PSL_RULE },
+    { "s3.dualstack.ap-northeast-2.amazonaws.com", 0x72e7000a, PSL_RULE },
+    { "sells-for-less.com", 0x81e98009, PSL_RULE },
+    { "notodden.no", 0x5be1c011, PSL_RULE },
+    { "ooguy.com", 0xf3fc4011, PSL_RULE },
+    { "soundcast.me", 0x2da44011, PSL_RULE },
+    { "andriatranibarletta.it", 0x19f10014, PSL_RULE },
+    { "sp.it", 0x4833c009, PSL_RULE },
+    { "s3-website-ap-northeast-1.amazonaws.com", 0x07eb0016, PSL_RULE },
+    { "star", 0x9c838011, PSL_RULE },
+    { "askvoll.no", 0xb2fa4018, PSL_RULE },
+    { "com.hn", 0x1479c018, PSL_RULE },
+    { "landrover", 0x44610018, PSL_RULE },
+    { "xn--gls-elac.no", 0x6edfc00c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bato.tochigi.jp", 0x3639c01e, PSL_RULE },
+    { "ac.leg.br", 0x2c47001f, PSL_RULE },
+    { "guovdageaidnu.no", 0x6620c01f, PSL_RULE },
+    { "parma.it", 0xd5ee4021, PSL_RULE },
+    { "stadt.museum", 0x73d1c021, PSL_RULE },
+    { "tsuiki.fukuoka.jp", 0x7af04022, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "zm", 0x4d2e0026, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nf.ca", 0x8f5d8029, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.ar", 0xb2cd402b, PSL_RULE },
+    { "nanbu.tottori.jp", 0x87fb802c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "waw.pl", 0xaa3ac02e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "natori.miyagi.jp", 0x545f8030, PSL_RULE },
+    { NULL, 0, 0 },
+    { "coop.mw", 0xe8bd0032, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dappnode.io", 0xba534034, 0 },
+    { NULL, 0, 0 },
+    { "is-a-geek.org", 0xdd2cc036, PSL_RULE },
+    { NULL, 0, 0 },
+    { "flickr", 0x315ec038, PSL_RULE },
+    { "nishiawakura.okayama.jp", 0xd528c039, PSL_RULE },
+    { "air-surveillance.aero", 0x7df8803a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "g12.br", 0x1597803d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloudfunctions.net", 0xb8ab0040, PSL_RULE },
+    { "hyundai", 0xf1e00041, PSL_RULE },
+    { "dyndns-home.com", 0x51110042, PSL_RULE },
+    { "ne.ke", 0xe9ad0042, PSL_RULE },
+    { "airkitapps.com", 0xae8f8044, PSL_RULE },
+    { "sobetsu.hokkaido.jp", 0x267cc044, PSL_RULE },
+    { "etisalat", 0x748cc046, PSL_RULE },
+    { "sandiego.museum", 0xa875c047, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "akita.akita.jp", 0x1ccf804b, PSL_RULE },
+    { "karasjok.no", 0xc58d004c, PSL_RULE },
+    { "vaga.no", 0xd078c04d, PSL_RULE },
+    { "no.eu.org", 0x4058004e, PSL_RULE },
+    { "gov.ac", 0x86b8804f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rar.ve", 0x04e90051, PSL_RULE },
+    { NULL, 0, 0 },
+    { "archaeological.museum", 0x46088053, PSL_RULE },
+    { "hbo", 0xc5454054, PSL_RULE },
+    { "br", 0x5f548055, PSL_RULE },
+    { "is-a-knight.org", 0x06f38053, PSL_RULE },
+    { "ma.us", 0x7007c057, PSL_RULE },
+    { "xn--ygarden-p1a.no", 0x20094057, PSL_RULE },
+    { "web.gu", 0xfb074059, PSL_RULE },
+    { "copro.uk", 0xeb9d805a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "modum.no", 0x4fc7005c, PSL_RULE },
+    { "priv.no", 0xdb98c05d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.ua", 0x7b678061, PSL_RULE },
+    { "meme", 0x366a4061, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vinnica.ua", 0xa65f4065, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ktistory.com", 0x0ae00069, PSL_RULE },
+    { "rost.no", 0x9fc7806a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mediatech.dev", 0x1d23806e, PSL_RULE },
+    { "overhalla.no", 0xae79806e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ah.cn", 0x06a6c073, PSL_RULE },
+    { "xn--bck1b9a5dre4c", 0xd5140073, PSL_RULE },
+    { "gifu.gifu.jp", 0x42304075, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rennesoy.no", 0x23b64079, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.gg", 0x615d807e, PSL_RULE },
+    { "asia", 0xea28c07f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "a.bg", 0xd2d68085, PSL_RULE },
+    { "tanagura.fukushima.jp", 0xde2f8085, PSL_RULE },
+    { "akkeshi.hokkaido.jp", 0x4861c087, PSL_RULE },
+    { "info.et", 0x7fabc088, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gratis", 0x7e64408d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloudjiffy.net", 0x26d3008f, PSL_RULE },
+    { "pepper.jp", 0x0deb408f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tv.br", 0xcc9ec093, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "homelinux.com", 0x0fae8097, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "amazonaws.com.cn", 0xde8b009a, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nakatane.kagoshima.jp", 0xc265809e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dev.adobeaemcloud.com", 0x77ce00a4, PSL_WILDCARD },
+    { "net.sh", 0x996080a5, PSL_RULE },
+    { "valdaosta.it", 0xc97400a5, PSL_RULE },
+    { "pharmacien.fr", 0x7af500a7, PSL_RULE },
+    { "sex.pl", 0x8d0b00a7, PSL_RULE },
+    { "tateyama.chiba.jp", 0xe06440a8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bergamo.it", 0x651940ad, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gs.tr.no", 0xac8940b0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bing", 0x7e1880b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "celtic.museum", 0xf22a40b5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fidelity", 0xac2d40bb, PSL_RULE },
+    { "indianmarket.museum", 0x2d02c0bc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "uno", 0xaa2700bf, PSL_RULE },
+    { "uvic.museum", 0x97ac40c0, PSL_RULE },
+    { "cloudns.club", 0xe50c00c1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "i.se", 0xa47880c4, PSL_RULE },
+    { "lib.ar.us", 0x5a8ec0c5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pro.typeform.com", 0x7e1400c7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "oto.fukuoka.jp", 0xdb2e80cd, PSL_RULE },
+    { "is-a-doctor.com", 0x8cc840ce, PSL_RULE },
+    { "pharmacy.museum", 0x0e2e00ce, PSL_RULE },
+    { "shimofusa.chiba.jp", 0x6e2040cf, PSL_RULE },
+    { "suzuki", 0xb8a140ce, PSL_RULE },
+    { "stange.no", 0xad7b80d2, PSL_RULE },
+    { "transporte.bo", 0x659c40d2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.lv", 0x763400d5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "veterinaire.km", 0xeeb080d7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kvafjord.no", 0x159300db, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--vhquv", 0x0e5b80dd, PSL_RULE },
+    { "deta.dev", 0xbd0fc0de, PSL_RULE },
+    { "tamatsukuri.ibaraki.jp", 0x51c380de, PSL_RULE },
+    { "xn--pssu33l.jp", 0xc5d0c0e0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.pr.us", 0xc547c0e2, PSL_RULE },
+    { "buy", 0x5f7840e3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "family", 0xef4e80e5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sharp", 0xb6c340e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.ga.us", 0x0cc040e9, PSL_RULE },
+    { "info.hu", 0x2768c0ea, PSL_RULE },
+    { "attorney", 0x8cce00eb, PSL_RULE },
+    { "org.bi", 0xb225c0ea, PSL_RULE },
+    { "kunitachi.tokyo.jp", 0xc70f40ed, PSL_RULE },
+    { "lib.mn.us", 0xd58400ed, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hitachi.ibaraki.jp", 0x44d740f2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "discordsays.com", 0x147480f4, PSL_RULE },
+    { "gov.sg", 0x0c1e00f5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloud9.eu-west-2.amazonaws.com", 0x670e80f8, 0 },
+    { "blogspot.com.by", 0xd01100f9, PSL_RULE },
+    { "xn--fiq228c5hs", 0x251280fa, PSL_RULE },
+    { "lyngen.no", 0x652c40fb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "stathelle.no", 0x7378c0fe, PSL_RULE },
+    { "user.aseinet.ne.jp", 0x0cbd80fe, PSL_RULE },
+    { "zlg.br", 0xcb230100, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rs.gov.br", 0xff570102, PSL_RULE },
+    { "xn--l1acc", 0xd026c103, PSL_RULE },
+    { "in-berlin.de", 0xfd390104, PSL_RULE },
+    { "eero.online", 0x16010105, PSL_RULE },
+    { "kaminokawa.tochigi.jp", 0x56328105, PSL_RULE },
+    { "us-west-2.amazonaws.com", 0x911b4104, 0 },
+    { NULL, 0, 0 },
+    { "fm.no", 0xc5b68109, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gleeze.com", 0xd5e4010c, PSL_RULE },
+    { "shiroi.chiba.jp", 0x9c30010c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.mo", 0x8745410f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ga", 0x4a250111, PSL_RULE },
+    { "cci.fr", 0xbd458112, PSL_RULE },
+    { "com.gi", 0x71f90112, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "easypanel.app", 0xaca84116, PSL_RULE },
+    { NULL, 0, 0 },
+    { "laakesvuemie.no", 0xf0d40118, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "comsec", 0xdf9b411f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "oceanographique.museum", 0x770c4122, PSL_RULE },
+    { "experts-comptables.fr", 0x7a794123, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ogawa.ibaraki.jp", 0x2cb34125, PSL_RULE },
+    { "airguard.museum", 0x62114126, PSL_RULE },
+    { NULL, 0, 0 },
+    { "grocery", 0x43c30128, PSL_RULE },
+    { "volkswagen", 0xd5394128, PSL_RULE },
+    { "mp.br", 0xc791412a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "asso.dz", 0x5ff7c12d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "koto.tokyo.jp", 0x484ac132, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nom.ro", 0x6b704134, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sanuki.kagawa.jp", 0xba2e4138, PSL_RULE },
+    { "cloudaccess.net", 0x32bdc139, PSL_RULE },
+    { "shimodate.ibaraki.jp", 0xa5cf013a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "k12.nv.us", 0x6ac6813d, PSL_RULE },
+    { "ac.mz", 0xe42e413e, PSL_RULE },
+    { "gop.pk", 0x812bc13e, PSL_RULE },
+    { "hemnes.no", 0x7e6ac13e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--mosjen-eya.no", 0x85364144, PSL_RULE },
+    { "com.lc", 0x39210145, PSL_RULE },
+    { "siiites.com", 0x18ecc146, PSL_RULE },
+    { "assn.lk", 0x2cc88147, PSL_RULE },
+    { "co.gy", 0x37854147, PSL_RULE },
+    { "sandnessjoen.no", 0xa2ef0149, PSL_RULE },
+    { "gob.ar", 0xbce7414a, PSL_RULE },
+    { "oncilla.mythic-beasts.com", 0x5a29014b, PSL_RULE },
+    { "ox.rs", 0xc130c14b, PSL_RULE },
+    { "today", 0x31dec14a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ube.yamaguchi.jp", 0x2b2f814f, PSL_RULE },
+    { "co.ir", 0x413c8150, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hyllestad.no", 0x66d3c152, PSL_RULE },
+    { NULL, 0, 0 },
+    { "miharu.fukushima.jp", 0xf7cfc154, PSL_RULE },
+    { NULL, 0, 0 },
+    { "homelink.one", 0xbe67c156, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "b-data.io", 0x0a21015a, PSL_RULE },
+    { "cc.gu.us", 0x1e67815b, PSL_RULE },
+    { "fans", 0xa574415b, PSL_RULE },
+    { "ebina.kanagawa.jp", 0x80ddc15d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gob.ec", 0x3c8cc15f, PSL_RULE },
+    { "kaga.ishikawa.jp", 0xb7660160, PSL_RULE },
+    { "kustanai.su", 0xc1b2415f, PSL_RULE },
+    { "com.gy", 0xcf1cc162, PSL_RULE },
+    { "k12.tr", 0xaddc4163, PSL_RULE },
+    { "asnes.no", 0x6e090164, PSL_RULE },
+    { "aso.kumamoto.jp", 0x56770165, PSL_RULE },
+    { "pmn.it", 0xdcaa815f, PSL_RULE },
+    { "ontario.museum", 0x61150167, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "r2.dev", 0x9479016e, PSL_RULE },
+    { "nogata.fukuoka.jp", 0x776a416f, PSL_RULE },
+    { "edu.lk", 0x40bf4170, PSL_RULE },
+    { "net.ng", 0x0fdb4171, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.rw", 0xdf2dc174, PSL_RULE },
+    { "ong", 0x5d198175, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gniezno.pl", 0xe9654177, PSL_RULE },
+    { "blogspot.co.id", 0xa92c0178, PSL_RULE },
+    { "got", 0x9610c179, PSL_RULE },
+    { "fujisawa.kanagawa.jp", 0xe281c17a, PSL_RULE },
+    { "campidano-medio.it", 0xd340817b, PSL_RULE },
+    { "kameyama.mie.jp", 0xe0f9017c, PSL_RULE },
+    { "nom.pl", 0x20c58179, PSL_RULE },
+    { "ogasawara.tokyo.jp", 0xea2e4179, PSL_RULE },
+    { "org.ae", 0xa3ea417b, PSL_RULE },
+    { "xn--rholt-mra.no", 0x1557817e, PSL_RULE },
+    { "co.ma", 0xe4adc181, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eco", 0x9e474186, PSL_RULE },
+    { "kirovograd.ua", 0xdf5c4187, PSL_RULE },
+    { "ouchi.saga.jp", 0xd1ce4187, PSL_RULE },
+    { "pp.ua", 0x80ef8187, PSL_RULE },
+    { "pro.br", 0x37c00188, PSL_RULE },
+    { "webhop.info", 0x0280418a, PSL_RULE },
+    { "yoshino.nara.jp", 0x4268418c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "keymachine.de", 0xf037c18e, PSL_RULE },
+    { "edogawa.tokyo.jp", 0x52bbc18f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tsuyama.okayama.jp", 0xccfb8192, PSL_RULE },
+    { "svn-repos.de", 0x1fd74193, PSL_RULE },
+    { "entomology.museum", 0xd2628194, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "getmyip.com", 0x726e0197, PSL_RULE },
+    { "yawatahama.ehime.jp", 0x10dd8197, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--kvfjord-nxa.no", 0xe78a819a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shibukawa.gunma.jp", 0x34b6819c, PSL_RULE },
+    { "edu.so", 0x7dbf419d, PSL_RULE },
+    { "in-dsl.de", 0x7d63019d, PSL_RULE },
+    { "mg.gov.br", 0xf275019f, PSL_RULE },
+    { "net.bb", 0xa17181a0, PSL_RULE },
+    { "aero.mv", 0x6b2b41a1, PSL_RULE },
+    { "tp.it", 0x4933c19c, PSL_RULE },
+    { "hurum.no", 0x414c01a3, PSL_RULE },
+    { "anpachi.gifu.jp", 0x1230c1a4, PSL_RULE },
+    { "per.la", 0x81d681a5, PSL_RULE },
+    { "royrvik.no", 0x8ed381a4, PSL_RULE },
+    { "surrey.museum", 0x291141a3, PSL_RULE },
+    { "tv.bb", 0xe0ac41a3, PSL_RULE },
+    { "viterbo.it", 0x779201a3, PSL_RULE },
+    { "itv", 0x7d5b41aa, PSL_RULE },
+    { NULL, 0, 0 },
+    { "weblike.jp", 0x376181ac, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hurdal.no", 0x9cc081b2, PSL_RULE },
+    { "gold", 0x5a4041b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hordaland.no", 0x9cd081b5, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloud66.zone", 0xfb0bc1b8, PSL_RULE },
+    { "hiroshima.jp", 0x8191c1b9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "4lima.ch", 0xb312c1bb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.bg", 0x38a4c1be, PSL_RULE },
+    { "shizuoka.shizuoka.jp", 0x1e3401bf, PSL_RULE },
+    { "hanamigawa.chiba.jp", 0x077301c0, PSL_RULE },
+    { "com.mx", 0x716641c1, PSL_RULE },
+    { "org.mt", 0x7e7c41c2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ro.gov.br", 0xf76181c6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.bs", 0x0e3641ca, PSL_RULE },
+    { NULL, 0, 0 },
+    { "barlettatraniandria.it", 0x2003c1cc, PSL_RULE },
+    { "applinzi.com", 0x92e201cd, PSL_RULE },
+    { "mc.it", 0x426181cc, PSL_RULE },
+    { "wakasa.fukui.jp", 0x1ec681cd, PSL_RULE },
+    { "xn--6btw5a.jp", 0x874c01ce, PSL_RULE },
+    { "ie.eu.org", 0x1f48c1d1, PSL_RULE },
+    { "xn--b4w605ferd", 0x266901cc, PSL_RULE },
+    { "from-nj.com", 0xd61cc1d3, PSL_RULE },
+    { "tjome.no", 0x16bc41d3, PSL_RULE },
+    { "yombo.me", 0xa29701d5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bel.tr", 0xb60701da, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tkmaxx", 0x109fc1dc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ac.tz", 0x833841df, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tempio-olbia.it", 0xb49fc1e2, PSL_RULE },
+    { "essex.museum", 0xfa5b01e3, PSL_RULE },
+    { "monash", 0x004a01e3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.bb", 0x5b8d01e7, PSL_RULE },
+    { "mr", 0x605481e8, PSL_RULE },
+    { "versicherung", 0xadae41e8, PSL_RULE },
+    { "lugs.org.uk", 0x3fad01ea, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "demo.jelastic.com", 0x5043c1ee, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vr.it", 0x4b3841f0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.la", 0x1d3801f2, PSL_RULE },
+    { "langevag.no", 0x637d81f3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "service.gov.scot", 0x6d9b81f5, PSL_RULE },
+    { "lunner.no", 0x3bf181f6, PSL_RULE },
+    { "readymade.jp", 0x81fb01f7, PSL_RULE },
+    { "baidu", 0xee2181f8, PSL_RULE },
+    { "mil.ar", 0x405401f8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.rw", 0x2865c1fe, PSL_RULE },
+    { "kids", 0xeb20c1fe, PSL_RULE },
+    { "myspreadshop.fi", 0x0ba441ff, PSL_RULE },
+    { "nl", 0x4331c1ff, PSL_RULE },
+    { "platformsh.site", 0x167401fe, PSL_WILDCARD },
+    { "minamioguni.kumamoto.jp", 0xc7388203, PSL_RULE },
+    { "royal-commission.uk", 0xc2d04200, PSL_RULE },
+    { "science.museum", 0x892d8201, PSL_RULE },
+    { "seat", 0x041b81fe, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.eu.org", 0x7b80020a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.ss", 0xff13420e, PSL_RULE },
+    { "rokunohe.aomori.jp", 0xe510c20f, PSL_RULE },
+    { "biz.my", 0xc5528210, PSL_RULE },
+    { "ybo.faith", 0x2a80c211, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--trentinosd-tirol-rzb.it", 0x4c2b0214, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "n.bg", 0xd3d68218, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kamisu.ibaraki.jp", 0x24f3821a, PSL_RULE },
+    { "k12.ia.us", 0x3926421b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "africa.com", 0x457ac21e, PSL_RULE },
+    { "mcpe.me", 0xd220421e, PSL_RULE },
+    { "misconfused.org", 0x138b821f, PSL_RULE },
+    { "ostroleka.pl", 0xd2e68221, PSL_RULE },
+    { "edu.sl", 0xc8fc8222, PSL_RULE },
+    { "org.hn", 0xbe56c223, PSL_RULE },
+    { "brindisi.it", 0xec474224, PSL_RULE },
+    { "fie.ee", 0x2e0a8225, PSL_RULE },
+    { "epilepsy.museum", 0x0c0cc226, PSL_RULE },
+    { "kita.osaka.jp", 0xccbc0227, PSL_RULE },
+    { "simple-url.com", 0xe9ba8222, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mv", 0x4049c22c, PSL_RULE },
+    { "mov", 0x9921822d, PSL_RULE },
+    { "to.gt", 0xf17c022d, PSL_RULE },
+    { "portland.museum", 0xbbd0822f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yamazoe.nara.jp", 0x9b610233, PSL_RULE },
+    { "lab.ms", 0x115e4234, PSL_RULE },
+    { "fujieda.shizuoka.jp", 0x9c470235, PSL_RULE },
+    { "net.ac", 0xb4990234, PSL_RULE },
+    { "sarpsborg.no", 0x9b4e4235, PSL_RULE },
+    { NULL, 0, 0 },
+    { "audio", 0xd8dac239, PSL_RULE },
+    { "sener", 0xf866823a, PSL_RULE },
+    { "org.ma", 0xa477023b, PSL_RULE },
+    { "mintere.site", 0xc7f7c23c, PSL_RULE },
+    { "yomitan.okinawa.jp", 0xe4bc823a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--gnstigbestellen-zvb.de", 0x6ea34241, PSL_RULE },
+    { "eu.ax", 0x3eff0242, PSL_RULE },
+    { "llc", 0x10904242, PSL_RULE },
+    { "medicina.bo", 0x67138242, PSL_RULE },
+    { "rwe", 0x6ea44245, PSL_RULE },
+    { "shiiba.miyazaki.jp", 0x60af8246, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ap-east-1.amazonaws.com", 0xfb358248, 0 },
+    { "arpa", 0xcdb14249, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sondre-land.no", 0xacb2824b, PSL_RULE },
+    { "nico", 0x1249424c, PSL_RULE },
+    { "telebit.xyz", 0x5cd3424d, PSL_WILDCARD },
+    { "events", 0xc2d1c24e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "balat.no", 0x87210250, PSL_RULE },
+    { "vg", 0x49208250, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pn", 0x45364253, PSL_RULE },
+    { "bz.it", 0x6f4c0254, PSL_RULE },
+    { NULL, 0, 0 },
+    { "coop.br", 0x40270256, PSL_RULE },
+    { "h.se", 0xa5788257, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chikusei.ibaraki.jp", 0xd24c025b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gildeskal.no", 0x744d025e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.vn", 0xa1fe4260, PSL_RULE },
+    { "sakai.fukui.jp", 0xfddd0260, PSL_RULE },
+    { "xn--1ck2e1b", 0xcfc28260, PSL_RULE },
+    { "international", 0x7a208263, PSL_RULE },
+    { "foz.br", 0xb573c264, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cc.wv.us", 0xdb488266, PSL_RULE },
+    { "web.ve", 0x284b4266, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fam.pk", 0x2814026c, PSL_RULE },
+    { "nantan.kyoto.jp", 0x2329826d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tsuru.yamanashi.jp", 0x81e3026f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cust.dev.thingdust.io", 0x84de8271, PSL_RULE },
+    { "gaivuotna.no", 0xf9d5c272, PSL_RULE },
+    { "blogspot.am", 0x799c0273, PSL_RULE },
+    { "bardu.no", 0x5de14274, PSL_RULE },
+    { "bofa", 0x03dc8273, PSL_RULE },
+    { "joy", 0x47b8c271, PSL_RULE },
+    { "nakagawa.fukuoka.jp", 0x5e7f4274, PSL_RULE },
+    { "yasaka.nagano.jp", 0xef4b0277, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "frosinone.it", 0xead8c27b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ki", 0x4638827d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dentist", 0x81ba4280, PSL_RULE },
+    { "shiojiri.nagano.jp", 0x00a44280, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "arita.saga.jp", 0x2a4b4284, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.sd", 0x38f18287, PSL_RULE },
+    { "xn--smla-hra.no", 0xf5204287, PSL_RULE },
+    { "mil.fj", 0x416d0289, PSL_RULE },
+    { "nationalfirearms.museum", 0xa77e428a, PSL_RULE },
+    { "gorge.museum", 0x98e3428b, PSL_RULE },
+    { "info.ni", 0x9a8e828c, PSL_RULE },
+    { "mosjoen.no", 0xb4f7428b, PSL_RULE },
+    { "sabae.fukui.jp", 0x8b39428b, PSL_RULE },
+    { "istanbul", 0x0e85828f, PSL_RULE },
+    { "ascoli-piceno.it", 0x6e0e8290, PSL_RULE },
+    { "mil.bo", 0x0f660290, PSL_RULE },
+    { "xn--fiq64b", 0x0b7cc289, PSL_RULE },
+    { "vp4.me", 0x8c8ec293, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "city.sapporo.jp", 0x44e6c296, PSL_EXCEPTION },
+    { "matta-varjjat.no", 0x025d8296, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "builder.code.com", 0x5517429a, PSL_WILDCARD },
+    { "myeffect.net", 0x13e7829b, PSL_RULE },
+    { "off.ai", 0xbb15429c, PSL_RULE },
+    { "rygge.no", 0xa534029c, PSL_RULE },
+    { "we.tc", 0xcd56429c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "yurihonjo.akita.jp", 0xb3e002a0, PSL_RULE },
+    { "telemark.no", 0x122ac2a1, 0 },
+    { NULL, 0, 0 },
+    { "nord-aurdal.no", 0xefe382a3, PSL_RULE },
+    { "hobby-site.com", 0xb7c282a4, PSL_RULE },
+    { "info.bb", 0x767bc2a5, PSL_RULE },
+    { "k12.al.us", 0x3f45c2a6, PSL_RULE },
+    { "edu.vn", 0x5c19c2a7, PSL_RULE },
+    { "from-wa.com", 0x1a8802a7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "social", 0x6b9c02ac, PSL_RULE },
+    { "xn--linds-pra.no", 0x52e902ac, PSL_RULE },
+    { "xn--h1ahn.xn--p1acf", 0x641dc2ae, PSL_RULE },
+    { "hamatama.saga.jp", 0xb91c42af, PSL_RULE },
+    { "oyabe.toyama.jp", 0xe9e182b0, PSL_RULE },
+    { "jeep", 0xb01502b1, PSL_RULE },
+    { "xn--lcvr32d.hk", 0x0baa42b0, PSL_RULE },
+    { "barsy.ro", 0xc5fa02b3, PSL_RULE },
+    { "bo", 0x6d3442b4, PSL_RULE },
+    { "co.mz", 0x0a2582b4, PSL_RULE },
+    { "bialowieza.pl", 0x72bb02b6, PSL_RULE },
+    { "com.pa", 0x2d94c2b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "smushcdn.com", 0x29bf82b9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rr.gov.br", 0x015942bf, PSL_RULE },
+    { "ullensvang.no", 0x6cc8c2bf, PSL_RULE },
+    { "evje-og-hornnes.no", 0xfb3ec2c1, PSL_RULE },
+    { "ac.pa", 0xcef702c2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "osaka", 0x36ed02c6, PSL_RULE },
+    { "pya.jp", 0x2d14c2c7, PSL_RULE },
+    { "awdev.ca", 0xc44c02c8, PSL_WILDCARD },
+    { "org.pt", 0x66df82c9, PSL_RULE },
+    { "re.it", 0x6167c2c7, PSL_RULE },
+    { "tn.it", 0x5d7d82ca, PSL_RULE },
+    { "notaires.km", 0x06a742cc, PSL_RULE },
+    { "saogonca.br", 0x2a18c2cc, PSL_RULE },
+    { "webview-assets.cloud9.us-east-2.amazonaws.com", 0xa54782c7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dnsdojo.com", 0x666902d1, PSL_RULE },
+    { "dyndns.ws", 0x55f7c2d1, PSL_RULE },
+    { "kaufen", 0xc005c2d1, PSL_RULE },
+    { "nishinoshima.shimane.jp", 0xef0d42d4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hammerfest.no", 0x63ddc2d6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tm.mc", 0x4cf002d8, PSL_RULE },
+    { "joyent.com", 0x0dd242d9, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "messerli.app", 0xdb14c2de, PSL_RULE },
+    { "net.ae", 0x988302de, PSL_RULE },
+    { "tokushima.tokushima.jp", 0x69d982df, PSL_RULE },
+    { "gq", 0x6a4c42e1, PSL_RULE },
+    { "com.km", 0xfdc842e2, PSL_RULE },
+    { "dweb.link", 0x4b3e42e3, PSL_WILDCARD },
+    { "noda.iwate.jp", 0x4a5042e1, PSL_RULE },
+    { "dyndns-wiki.com", 0x5e4082e5, PSL_RULE },
+    { "pro.ht", 0xc6f782e4, PSL_RULE },
+    { "is-a-hard-worker.com", 0xeb9042e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.mo.us", 0x16eb02e9, PSL_RULE },
+    { "scientist.aero", 0x324e02ea, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "azurewebsites.net", 0x3d7c02ef, PSL_RULE },
+    { NULL, 0, 0 },
+    { "u2.xnbay.com", 0x246982f1, PSL_RULE },
+    { "kustanai.ru", 0x293c82f2, PSL_RULE },
+    { "loan", 0x923e42f3, PSL_RULE },
+    { "bauhaus", 0x56efc2f4, PSL_RULE },
+    { "med.pl", 0x152582f5, PSL_RULE },
+    { "net.mo", 0xb525c2f4, PSL_RULE },
+    { "strand.no", 0xc0e442f6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.ss", 0x6d1ac2f9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sakai.osaka.jp", 0x55b302fd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--vgan-qoa.no", 0x047bc300, PSL_RULE },
+    { "plo.ps", 0x9a634301, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blackfriday", 0xed7bc303, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "himeshima.oita.jp", 0x87140307, PSL_RULE },
+    { "int.eu.org", 0x969c0308, PSL_RULE },
+    { "kikirara.jp", 0xb0b64307, PSL_RULE },
+    { "stateofdelaware.museum", 0xcb18030a, PSL_RULE },
+    { "edu.eg", 0x3e03c30b, PSL_RULE },
+    { "us.reclaim.cloud", 0xcb79430b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lincoln", 0x285cc310, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tromsa.no", 0x6a518314, PSL_RULE },
+    { "mil.cy", 0x82810315, PSL_RULE },
+    { "com.aw", 0xfdfd8316, PSL_RULE },
+    { "asso.fr", 0xd795c317, PSL_RULE },
+    { "xn--s-1fa.no", 0x1ab18318, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fuso.aichi.jp", 0x0222431c, PSL_RULE },
+    { "granvin.no", 0xa8e5831d, PSL_RULE },
+    { "org.tt", 0x9e6b031d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sb", 0x4e2bc322, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "oita.jp", 0x17e58326, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--12co0c3b4eva.xn--o3cw4h", 0x65e4c328, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "zao.miyagi.jp", 0x6e57c32b, PSL_RULE },
+    { "drangedal.no", 0x7d68c32c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.place", 0x434d8330, PSL_RULE },
+    { NULL, 0, 0 },
+    { "jls-sto1.elastx.net", 0xaf3e0332, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "k12.ky.us", 0x81fa8335, PSL_RULE },
+    { "lasalle", 0xa7920335, PSL_RULE },
+    { "dyn-o-saur.com", 0x3195c337, PSL_RULE },
+    { "is-a-financialadvisor.com", 0x04b48338, PSL_RULE },
+    { "org.sa", 0xf30b8335, PSL_RULE },
+    { "pro.pr", 0x08d10336, PSL_RULE },
+    { "www.ro", 0x12604339, PSL_RULE },
+    { NULL, 0, 0 },
+    { "asaminami.hiroshima.jp", 0xf4b7433d, PSL_RULE },
+    { "kunimi.fukushima.jp", 0xc4e7833d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.al", 0xa011c341, PSL_RULE },
+    { "cipriani", 0xaaf6c342, PSL_RULE },
+    { NULL, 0, 0 },
+    { "marugame.kagawa.jp", 0x42468344, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.na", 0x42884346, PSL_RULE },
+    { "gov.fj", 0xba13c347, PSL_RULE },
+    { NULL, 0, 0 },
+    { "risor.no", 0xe5ae4349, PSL_RULE },
+    { "xn--fjord-lra.no", 0x6771c349, PSL_RULE },
+    { "itami.hyogo.jp", 0xc1bc834b, PSL_RULE },
+    { "shirakawa.fukushima.jp", 0xdde9c34b, PSL_RULE },
+    { "homelinux.net", 0x093e834d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.pk", 0x4c5d834f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eu-west-1.amazonaws.com", 0x84080353, 0 },
+    { "florence.it", 0xbb21c354, PSL_RULE },
+    { "myforum.community", 0x899f0353, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gamvik.no", 0x532e4357, PSL_RULE },
+    { "edu.mt", 0x59464358, PSL_RULE },
+    { "bss.design", 0x0c8e8359, PSL_RULE },
+    { "lewismiller.museum", 0x7e17c35a, PSL_RULE },
+    { "rybnik.pl", 0xaabb435a, PSL_RULE },
+    { "sydney.museum", 0x5d208359, PSL_RULE },
+    { "k12.ms.us", 0x21e5435d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "katsuyama.fukui.jp", 0x6e28035f, PSL_RULE },
+    { "lc.it", 0x4361835f, PSL_RULE },
+    { "airkitapps-au.com", 0xa91f8361, PSL_RULE },
+    { "neen.it", 0xf8968362, 0 },
+    { "nd.us", 0x9314c363, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "teaches-yoga.com", 0x8a4f8368, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fly", 0x51b0836a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "in.rs", 0xe35c836f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.lb", 0xa2d6c371, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloudapps.digital", 0xdc534374, PSL_RULE },
+    { NULL, 0, 0 },
+    { "childrensgarden.museum", 0x66950376, PSL_RULE },
+    { "mediocampidano.it", 0xb7500376, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lr", 0x6154837b, PSL_RULE },
+    { "name.fj", 0xd947437c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "discourse.group", 0x0a44c37f, PSL_RULE },
+    { "sa-east-1.amazonaws.com", 0xe55bc37f, 0 },
+    { "ac.mw", 0x3ed10381, PSL_RULE },
+    { "jewelry", 0xaadb8381, PSL_RULE },
+    { "onporter.run", 0xd6480383, PSL_RULE },
+    { "rn.gov.br", 0xf963c383, PSL_RULE },
+    { "linode.com", 0x7bc1c385, 0 },
+    { "vn.ua", 0x6ea5c37f, PSL_RULE },
+    { "dhl", 0x5e4f4387, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "takarazuka.hyogo.jp", 0xbe72438a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "instance.datadetect.com", 0x9b74838c, PSL_RULE },
+    { "servecounterstrike.com", 0xfce0838d, PSL_RULE },
+    { "andasuolo.no", 0x75f8038e, PSL_RULE },
+    { "wa.au", 0x8c94c38f, PSL_RULE },
+    { "mn.us", 0x902cc390, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ml", 0x4431c392, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lv.ua", 0x88e08395, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "from-ak.com", 0x0e8b039b, PSL_RULE },
+    { "mi.th", 0xf86dc39b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.ma", 0x990fc39e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--oppegrd-ixa.no", 0xce0d83a0, PSL_RULE },
+    { "gov.my", 0x8f3043a1, PSL_RULE },
+    { "prof.pr", 0x596283a2, PSL_RULE },
+    { "egoism.jp", 0x530ec3a3, PSL_RULE },
+    { "e12.ve", 0x2f1fc3a4, PSL_RULE },
+    { "edu.iq", 0xc08083a5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "iwate.jp", 0xf9b883a9, PSL_RULE },
+    { "me.tz", 0xab3403a9, PSL_RULE },
+    { "o.bg", 0xd4d683ab, PSL_RULE },
+    { "ac.gn", 0x24fbc3ac, PSL_RULE },
+    { "xn--t60b56a", 0x398d83ad, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.gp", 0xf76883af, PSL_RULE },
+    { NULL, 0, 0 },
+    { "doesntexist.org", 0xdb3443b1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "boston", 0x148143ba, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gift", 0x309c43bf, PSL_RULE },
+    { "lv", 0x4149c3bf, PSL_RULE },
+    { "platter-app.dev", 0x465903c0, PSL_RULE },
+    { "babymilk.jp", 0xdd0d43c2, PSL_RULE },
+    { "minano.saitama.jp", 0xd292c3c3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "seihi.nagasaki.jp", 0xaf6783c6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cc.mn.us", 0x229a03c8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "monza-e-della-brianza.it", 0x021fc3ca, PSL_RULE },
+    { "takayama.gifu.jp", 0x10ca03cb, PSL_RULE },
+    { "press.cy", 0x4880c3cc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kill.jp", 0xb250c3cf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kiwi", 0xde8bc3d1, PSL_RULE },
+    { "camp", 0x47e943d2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mashiki.kumamoto.jp", 0x63b843d4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "oops.jp", 0x7be703d6, PSL_RULE },
+    { "at.it", 0x4e3cc3d7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "huissier-justice.fr", 0x931b43d9, PSL_RULE },
+    { "is-a-soxfan.org", 0x7aad03d9, PSL_RULE },
+    { "nikolaev.ua", 0x56c783da, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "obanazawa.yamagata.jp", 0x51c9c3e0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sn", 0x463643e6, PSL_RULE },
+    { "cz.it", 0x704c03e7, PSL_RULE },
+    { "net.hk", 0x573343e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k.se", 0xa67883ea, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.uz", 0x7f6943ec, PSL_RULE },
+    { "expert", 0x58f043ed, PSL_RULE },
+    { "kicks-ass.net", 0x5c5343ed, PSL_RULE },
+    { "koge.tottori.jp", 0x45dec3ee, PSL_RULE },
+    { "ott", 0xbe2b43ee, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bc.ca", 0x9950c3f4, PSL_RULE },
+    { "amusement.aero", 0xcd8383f5, PSL_RULE },
+    { "tsuruoka.yamagata.jp", 0xe90103f6, PSL_RULE },
+    { "carraramassa.it", 0x33b143f7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ac.nz", 0xf96383f9, PSL_RULE },
+    { "tel", 0x506b03fa, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bryne.no", 0x1d9ec3fc, PSL_RULE },
+    { "ck.ua", 0x71ac83fd, PSL_RULE },
+    { "marine.ru", 0x879e03fe, PSL_RULE },
+    { "mortgage", 0xb5fb83ff, PSL_RULE },
+    { "edu.sb", 0x49e5c400, PSL_RULE },
+    { "konan.aichi.jp", 0xac9b0400, PSL_RULE },
+    { "yamatotakada.nara.jp", 0xac310400, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kisarazu.chiba.jp", 0x15054404, PSL_RULE },
+    { "secaas.hk", 0xbf294404, PSL_RULE },
+    { "ibaraki.jp", 0x5ed10406, PSL_RULE },
+    { "lk3.ru", 0x6f18c406, PSL_RULE },
+    { "pstmn.io", 0x28484407, PSL_RULE },
+    { "kitadaito.okinawa.jp", 0xb50c0409, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "isumi.chiba.jp", 0xacd0440d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bharti", 0xf362840f, PSL_RULE },
+    { "int.la", 0x2046840f, PSL_RULE },
+    { "degree", 0xc6c50411, PSL_RULE },
+    { "xn--efvn9s.jp", 0x9f1d8412, PSL_RULE },
+    { "np", 0x434e4413, PSL_WILDCARD },
+    { "eu.encoway.cloud", 0x9152c414, PSL_RULE },
+    { "hughes", 0x36d54415, PSL_RULE },
+    { "yuu.yamaguchi.jp", 0x67700414, PSL_RULE },
+    { "net.ps", 0x733fc417, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "k12.co.us", 0x4351041b, PSL_RULE },
+    { "aivencloud.com", 0xecdb441c, PSL_RULE },
+    { "skoczow.pl", 0xeaf5841b, PSL_RULE },
+    { "xn--mgbbh1a", 0xff83841d, PSL_RULE },
+    { "kusatsu.gunma.jp", 0xa8db441f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "arboretum.museum", 0x41018422, PSL_RULE },
+    { "toyoake.aichi.jp", 0xa15ac423, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cam", 0xeca30428, PSL_RULE },
+    { "siellak.no", 0x5e82c429, PSL_RULE },
+    { "cldmail.ru", 0xd2ca442a, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "syno-ds.de", 0x1e18042d, PSL_RULE },
+    { "dyndns-mail.com", 0x3d48842e, PSL_RULE },
+    { "xn--vg-yiab.no", 0x0fff842d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.ec", 0x2b850436, PSL_RULE },
+    { "mitou.yamaguchi.jp", 0x43cd4437, PSL_RULE },
+    { "navoi.su", 0xa4f18436, PSL_RULE },
+    { "holy.jp", 0xe1638439, PSL_RULE },
+    { "pinoko.jp", 0xcce04439, PSL_RULE },
+    { NULL, 0, 0 },
+    { "czest.pl", 0x0b77843c, PSL_RULE },
+    { "xn--ses554g", 0xfda8043d, PSL_RULE },
+    { "dopaas.com", 0xca43843e, PSL_RULE },
+    { "gov.kp", 0xc639843e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "name.my", 0x0ae64442, PSL_RULE },
+    { "s3-us-west-1.amazonaws.com", 0x0c5d4442, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co", 0x6e344447, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.gi", 0x47a1c44b, PSL_RULE },
+    { "hof.no", 0xbe09c44b, PSL_RULE },
+    { "ky", 0x665fc44d, PSL_RULE },
+    { "gov.gd", 0xaa2ec44e, PSL_RULE },
+    { "air.museum", 0x1909044f, PSL_RULE },
+    { "gonna.jp", 0x9a628450, PSL_RULE },
+    { "myhome-server.de", 0x045b4451, PSL_RULE },
+    { "pp.se", 0xb3c8844d, PSL_RULE },
+    { "vfs.cloud9.ap-southeast-2.amazonaws.com", 0x3b660451, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "myspreadshop.it", 0x3ad88457, PSL_RULE },
+    { "xn--krehamn-dxa.no", 0x20dc0458, PSL_RULE },
+    { "as", 0x38520459, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lima-city.de", 0xed8ac45d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "uk0.bigv.io", 0x95b0045f, PSL_RULE },
+    { "linkyard.cloud", 0xb6f58460, PSL_RULE },
+    { "jaworzno.pl", 0x421c0461, PSL_RULE },
+    { "vm.bytemark.co.uk", 0x82c5845f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fk", 0x493d0464, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "smart", 0x5b4c4466, PSL_RULE },
+    { NULL, 0, 0 },
+    { "moda", 0x53cc4468, PSL_RULE },
+    { "ntdll.top", 0x287d4468, PSL_RULE },
+    { "musician.io", 0x8593c46a, PSL_RULE },
+    { "es-1.axarnet.cloud", 0x0e4f446b, PSL_RULE },
+    { "operaunite.com", 0x6816846c, PSL_RULE },
+    { "theater.museum", 0x77ef046a, PSL_RULE },
+    { "thick.jp", 0xb4e7046c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "agro.pl", 0xcf514470, PSL_RULE },
+    { "adobeioruntime.net", 0x3c6c8471, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--sr-fron-q1a.no", 0x1b774477, PSL_RULE },
+    { NULL, 0, 0 },
+    { "iwamizawa.hokkaido.jp", 0x8ca10479, PSL_RULE },
+    { "lanbib.se", 0xb6b7c479, PSL_RULE },
+    { "mtr", 0x4dcfc47a, PSL_RULE },
+    { "cnpy.gdn", 0xc981c47c, PSL_RULE },
+    { "mysecuritycamera.org", 0xd156047c, PSL_RULE },
+    { "on.ca", 0x6e49c47e, PSL_RULE },
+    { "tranoy.no", 0xa972c479, PSL_RULE },
+    { "nohost.me", 0x6c798480, PSL_RULE },
+    { "uda.nara.jp", 0x2eb0c47d, PSL_RULE },
+    { "xn--tn0ag.hk", 0xa8230482, PSL_RULE },
+    { "com.az", 0x956bc483, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "po.it", 0x5f7fc487, PSL_RULE },
+    { "urasoe.okinawa.jp", 0x1bd44488, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "virtualserver.io", 0x9918048b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kobe.jp", 0x9c108492, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "gov.gn", 0xd2854494, PSL_RULE },
+    { "xn--s9brj9c", 0x3c4c0495, PSL_RULE },
+    { "isen.kagoshima.jp", 0x73004496, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mma", 0x3827c49a, PSL_RULE },
+    { "go.ug", 0x8330849b, PSL_RULE },
+    { "emr.it", 0xfe84049c, PSL_RULE },
+    { "iamallama.com", 0xf7f9c49d, PSL_RULE },
+    { "iwate.iwate.jp", 0x3b8b449b, PSL_RULE },
+    { "dep.no", 0x1393c49f, PSL_RULE },
+    { "jdevcloud.com", 0x6023049e, PSL_RULE },
+    { "ltd.gi", 0x9addc49b, PSL_RULE },
+    { "naamesjevuemie.no", 0x9a07449b, PSL_RULE },
+    { "open.tim.it", 0x9d98c49c, 0 },
+    { "takahama.aichi.jp", 0x48d4c49f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "clan.rip", 0x8bb804a6, PSL_RULE },
+    { "dielddanuorri.no", 0x3aed04a6, PSL_RULE },
+    { "grp.lk", 0x9ad284a7, PSL_RULE },
+    { "net.tw", 0x57c004a7, PSL_RULE },
+    { "ownprovider.com", 0x66ee04a9, PSL_RULE },
+    { "storj.farm", 0xc82344a7, PSL_RULE },
+    { "tsunan.niigata.jp", 0x19c4c4a7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "og.it", 0x646c44ae, PSL_RULE },
+    { "rodoy.no", 0x3e1a44af, PSL_RULE },
+    { NULL, 0, 0 },
+    { "aremark.no", 0x3aae04b1, PSL_RULE },
+    { "fnc.fr-par.scw.cloud", 0x9d5cc4b2, PSL_RULE },
+    { "cupcake.is", 0x9fc604b3, PSL_RULE },
+    { "navy", 0x439d84b1, PSL_RULE },
+    { "rikuzentakata.iwate.jp", 0x28ce44b1, PSL_RULE },
+    { "shikaoi.hokkaido.jp", 0x103a44b3, PSL_RULE },
+    { "uri.arpa", 0x987184b5, PSL_RULE },
+    { "fuossko.no", 0x8080c4b8, PSL_RULE },
+    { "pescara.it", 0x79bec4b9, PSL_RULE },
+    { "xn--c2br7g", 0x52a704b8, PSL_RULE },
+    { "commbank", 0x700d44bb, PSL_RULE },
+    { "marker.no", 0x100844bc, PSL_RULE },
+    { "xn--ggaviika-8ya47h.no", 0x44ad84b5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "consulting.aero", 0x15f444c0, PSL_RULE },
+    { "community-pro.de", 0xc26084c1, PSL_RULE },
+    { "jed.wafaicloud.com", 0xe0e844c2, PSL_RULE },
+    { "net.vu", 0xc04f04c3, PSL_RULE },
+    { "dyndns-ip.com", 0xb1b344c4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hino.tokyo.jp", 0xd9ac84c7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "global", 0xfc1b84d0, PSL_RULE },
+    { "cloudsite.builders", 0x759884d1, PSL_RULE },
+    { "kurogi.fukuoka.jp", 0xab8584d2, PSL_RULE },
+    { "rel.ht", 0x449584d0, PSL_RULE },
+    { "moi", 0x9aebc4d4, PSL_RULE },
+    { "iwakura.aichi.jp", 0x531a84d5, PSL_RULE },
+    { "ma.gov.br", 0x168444d5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "prd.km", 0xee4f84d9, PSL_RULE },
+    { "fantasyleague.cc", 0x404fc4da, PSL_RULE },
+    { "noop.app", 0xfb19c4da, PSL_RULE },
+    { NULL, 0, 0 },
+    { "staples", 0xc7e4c4dd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "orx.biz", 0xbe4844df, PSL_RULE },
+    { "philadelphiaarea.museum", 0x4a44c4df, PSL_RULE },
+    { "dynv6.net", 0x9fff04e1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--80aqecdr1a", 0xd38084e3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "next", 0x925084e6, PSL_RULE },
+    { "authgear-staging.com", 0x6f3a04e7, PSL_RULE },
+    { "mil.ye", 0x132644e7, PSL_RULE },
+    { "nakijin.okinawa.jp", 0x223e04e9, PSL_RULE },
+    { "cloud9.ap-east-1.amazonaws.com", 0xe61dc4ea, 0 },
+    { "kanonji.kagawa.jp", 0x279b44eb, PSL_RULE },
+    { "to.gov.br", 0xf96184ec, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--kcrx77d1x4a", 0xacc244ef, PSL_RULE },
+    { "arts.ro", 0xd4e2c4f0, PSL_RULE },
+    { "fastvps-server.com", 0x7c9904f1, PSL_RULE },
+    { "ina.ibaraki.jp", 0x8dcbc4f2, PSL_RULE },
+    { "ms.kr", 0xe04cc4f0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.ar", 0x2c8044f5, PSL_RULE },
+    { "md.us", 0x9414c4f6, PSL_RULE },
+    { "review", 0xb5fa84f5, PSL_RULE },
+    { "run.app", 0xd05604f7, PSL_RULE },
+    { "msk.ru", 0x11ae04f9, PSL_RULE },
+    { "ltd.ng", 0x6282c4fa, PSL_RULE },
+    { "kalisz.pl", 0x214484fb, PSL_RULE },
+    { "asker.no", 0xd9d604fc, PSL_RULE },
+    { "blogspot.se", 0x4931c4fd, PSL_RULE },
+    { "dreamhosters.com", 0x217644fd, PSL_RULE },
+    { "it", 0x404544fe, PSL_RULE },
+    { "s3-website-us-west-1.amazonaws.com", 0xf70304f6, PSL_RULE },
+    { "of.no", 0xccc1c501, PSL_RULE },
+    { "mi.it", 0x6670c502, PSL_RULE },
+    { "name.az", 0xd15fc503, PSL_RULE },
+    { "scw.cloud", 0x657944fb, 0 },
+    { "store.nf", 0x1e7944f6, PSL_RULE },
+    { "hitra.no", 0xd78d0506, PSL_RULE },
+    { "tourism.tn", 0xd900c4f8, PSL_RULE },
+    { "yamada.fukuoka.jp", 0xbf0f0506, PSL_RULE },
+    { "dnsalias.net", 0x84bf4509, PSL_RULE },
+    { "yamaxun", 0xb26704fc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "uonuma.niigata.jp", 0xed68c50d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pa.us", 0x7307c510, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "udi.br", 0x9f3e0513, PSL_RULE },
+    { NULL, 0, 0 },
+    { "guge", 0xa1058515, PSL_RULE },
+    { "taipei", 0x9ea68515, PSL_RULE },
+    { "tr.it", 0x4d384516, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lawyer", 0x17a38519, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ushistory.museum", 0x8235c51b, PSL_RULE },
+    { "blogspot.com.es", 0x8471451c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "wtf", 0xb1ddc520, PSL_RULE },
+    { "anthro.museum", 0x685b0521, PSL_RULE },
+    { "intl.tn", 0x98964522, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-by.us", 0xaad90525, PSL_RULE },
+    { "cc.na", 0xcdfc8526, PSL_RULE },
+    { "kanmaki.nara.jp", 0x3127c525, PSL_RULE },
+    { "cv.ua", 0x89e08528, PSL_RULE },
+    { "catfood.jp", 0xe2cbc529, PSL_RULE },
+    { "study", 0x478f0526, PSL_RULE },
+    { "askoy.no", 0x7b0f452b, PSL_RULE },
+    { "tara.saga.jp", 0x3cc74529, PSL_RULE },
+    { "sakaiminato.tottori.jp", 0xc151c52d, PSL_RULE },
+    { "city.kitakyushu.jp", 0xe460052e, PSL_EXCEPTION },
+    { "xn--vler-qoa.xn--stfold-9xa.no", 0x5927452c, PSL_RULE },
+    { "cd", 0x561cc530, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--davvenjrga-y4a.no", 0x33e10535, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "l.bg", 0xd5d6853e, PSL_RULE },
+    { "exchange.aero", 0xc03b053f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ballangen.no", 0x78c54542, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.tw", 0x4cb30546, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pro.ec", 0x043f4548, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "atl.jelastic.vps-host.net", 0x139ac54e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "grandrapids.museum", 0x66a60552, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nat.tn", 0xfcd5c556, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nore-og-uvdal.no", 0x4b220558, PSL_RULE },
+    { NULL, 0, 0 },
+    { "crd.co", 0xeb0ec55a, PSL_RULE },
+    { "ac.mu", 0x327b455b, PSL_RULE },
+    { "federation.aero", 0xa243055b, PSL_RULE },
+    { "gaular.no", 0x0491855c, PSL_RULE },
+    { "kaas.gg", 0x3241055b, PSL_RULE },
+    { "walmart", 0x4610855f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "askim.no", 0xaf2d4561, PSL_RULE },
+    { "beats", 0x79560562, PSL_RULE },
+    { NULL, 0, 0 },
+    { "from-oh.com", 0x6fd20564, PSL_RULE },
+    { "military.museum", 0xbde74564, PSL_RULE },
+    { NULL, 0, 0 },
+    { "chuo.osaka.jp", 0x9eee8567, PSL_RULE },
+    { "latrobe", 0x365f0568, PSL_RULE },
+    { "bunkyo.tokyo.jp", 0x32abc569, PSL_RULE },
+    { "bt.it", 0x4f3cc56a, PSL_RULE },
+    { "c.la", 0xd35a056b, PSL_RULE },
+    { "info.nr", 0xf8340569, PSL_RULE },
+    { "cloudlets.com.au", 0xbab0056d, 0 },
+    { "gov.sx", 0x21a7056e, PSL_RULE },
+    { "nakama.fukuoka.jp", 0xd650056a, PSL_RULE },
+    { "fuchu.tokyo.jp", 0x35e30570, PSL_RULE },
+    { "girlfriend.jp", 0x7abf8571, PSL_RULE },
+    { "kazteleport.kz", 0x06da4571, 0 },
+    { "kiso.nagano.jp", 0xa1bbc573, PSL_RULE },
+    { "luxe", 0xc633c571, PSL_RULE },
+    { "mitsue.nara.jp", 0xe94fc570, PSL_RULE },
+    { "pt.eu.org", 0x2c24056f, PSL_RULE },
+    { "tg", 0x4b208576, PSL_RULE },
+    { "from-hi.com", 0xb8090578, PSL_RULE },
+    { "xn--mely-ira.no", 0x8a258570, PSL_RULE },
+    { "pleskns.com", 0x048a457a, PSL_RULE },
+    { "org.uy", 0xb83fc57b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dyroy.no", 0x7e2d057d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.co.ke", 0xb717057f, PSL_RULE },
+    { "fj.cn", 0x0bab4580, PSL_RULE },
+    { "ntt", 0xbf2b4581, PSL_RULE },
+    { "potager.org", 0x921b057f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "scrapping.cc", 0xbbef4584, PSL_RULE },
+    { "bungoono.oita.jp", 0xfa930585, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mishima.shizuoka.jp", 0x61ccc587, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-a-nurse.com", 0xe108058e, PSL_RULE },
+    { "net.au", 0x37e9858e, PSL_RULE },
+    { "xn--uc0atv.hk", 0x662cc58f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kita.tokyo.jp", 0x8fc6c592, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.mv", 0xe5e34596, PSL_RULE },
+    { "net.lb", 0x242fc596, PSL_RULE },
+    { "sasayama.hyogo.jp", 0x07b14597, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--45br5cyl", 0x968b859b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "valle-d-aosta.it", 0xa446059e, PSL_RULE },
+    { "rhcloud.com", 0x9dfd859f, PSL_RULE },
+    { "migration.run", 0xade1c5a0, PSL_WILDCARD },
+    { "bio.br", 0x4b8c45a1, PSL_RULE },
+    { "edu.af", 0x01d2c5a2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "myspreadshop.de", 0xa10345a5, PSL_RULE },
+    { "mp", 0x444e45a6, PSL_RULE },
+    { "cc.wi.us", 0xa2d0c5a7, PSL_RULE },
+    { "crew.aero", 0x8e36c5a7, PSL_RULE },
+    { "city.yokohama.jp", 0x3bf885a9, PSL_EXCEPTION },
+    { "mil.pl", 0xadf9c5a9, PSL_RULE },
+    { "sokndal.no", 0x4b7545aa, PSL_RULE },
+    { "tychy.pl", 0x67a545a8, PSL_RULE },
+    { "xn--wcvs22d.hk", 0x3e7e45a7, PSL_RULE },
+    { "k12.vi.us", 0x331d85ae, PSL_RULE },
+    { "chicago.museum", 0xa230c5af, PSL_RULE },
+    { "shimamaki.hokkaido.jp", 0x5d5b45af, PSL_RULE },
+    { "selfip.biz", 0x6cc345b1, PSL_RULE },
+    { "oshima.tokyo.jp", 0xcb7f05b2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "123minsida.se", 0xfd42c5b4, PSL_RULE },
+    { "sardinia.it", 0x6be9c5b5, PSL_RULE },
+    { "taka.hyogo.jp", 0x6383c5b6, PSL_RULE },
+    { "xn--io0a7i", 0xaec905b4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "direct", 0x340685ba, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pri.ee", 0xf29f45bc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "catering", 0xbd3285be, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "s3.dualstack.us-east-1.amazonaws.com", 0x84ab85c1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sale", 0xc39245c4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "yandex", 0xb5a845c6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.nc.us", 0xbb4445c8, PSL_RULE },
+    { "clinic", 0xa611c5c9, PSL_RULE },
+    { "ba", 0x4d2505ca, PSL_RULE },
+    { "nesna.no", 0xdc5305c9, PSL_RULE },
+    { "pol.ht", 0x4aa305cc, PSL_RULE },
+    { "bu.no", 0xd9a185cd, PSL_RULE },
+    { "xn--mgbai9a5eva00b", 0x506e85ce, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-an-accountant.com", 0x896705d1, PSL_RULE },
+    { "radio.am", 0xb87405d2, PSL_RULE },
+    { "tra.kp", 0xef4985d3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sorfold.no", 0xf58545d5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "discover", 0x235c45d8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "laspezia.it", 0xec4d85db, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ako.hyogo.jp", 0x71c805e0, PSL_RULE },
+    { "dev", 0x6c3045e0, PSL_RULE },
+    { "hi.cn", 0x33a945e1, PSL_RULE },
+    { "int.ar", 0x258d05e3, PSL_RULE },
+    { "minoh.osaka.jp", 0xeabb45e1, PSL_RULE },
+    { "pr.gov.br", 0x035945e5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "deporte.bo", 0xdbea85e9, PSL_RULE },
+    { "stada", 0xe69905ea, PSL_RULE },
+    { NULL, 0, 0 },
+    { "supplies", 0x881245ec, PSL_RULE },
+    { "hidaka.kochi.jp", 0x447245ed, PSL_RULE },
+    { "pe.it", 0x6367c5ed, PSL_RULE },
+    { "namikata.ehime.jp", 0x445a45ef, PSL_RULE },
+    { "sex", 0xc55cc5ef, PSL_RULE },
+    { "tlon.network", 0x0408c5ee, PSL_RULE },
+    { "xn--6orx2r.jp", 0x147785ec, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "turin.it", 0x4b8045f8, PSL_RULE },
+    { "b.br", 0xc3d985f9, PSL_RULE },
+    { "qoto.io", 0xceba05fa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.tm", 0xb26845fd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "linodeobjects.com", 0x5afe4601, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "karelia.su", 0xa1c80606, PSL_RULE },
+    { "aq", 0x6c4c4607, PSL_RULE },
+    { "co.bw", 0xb5b4c608, PSL_RULE },
+    { "khplay.nl", 0xa16b4608, PSL_RULE },
+    { NULL, 0, 0 },
+    { "myactivedirectory.com", 0x7f99060b, PSL_RULE },
+    { "heroy.more-og-romsdal.no", 0x903c460c, PSL_RULE },
+    { "trapani.it", 0xfe11460b, PSL_RULE },
+    { "ufcfan.org", 0xcb4a060e, PSL_RULE },
+    { "usantiques.museum", 0xdee3460f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hikimi.shimane.jp", 0xdce28611, PSL_RULE },
+    { NULL, 0, 0 },
+    { "harstad.no", 0x1aa90613, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mcdir.me", 0x0a870616, PSL_RULE },
+    { "plc.ly", 0xd0504617, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.mz", 0x55cc0619, PSL_RULE },
+    { "so.it", 0x607fc61a, PSL_RULE },
+    { "plants.museum", 0x8f8ac61b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.wa.us", 0x99fa061f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "americanantiques.museum", 0x48738621, PSL_RULE },
+    { "xn--finny-yua.no", 0xe1998622, PSL_RULE },
+    { NULL, 0, 0 },
+    { "izumo.shimane.jp", 0x10aa8624, PSL_RULE },
+    { "gulen.no", 0x539fc625, PSL_RULE },
+    { "mihama.chiba.jp", 0x30a54625, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pars", 0x35d2c629, PSL_RULE },
+    { "kh.ua", 0x69b4c62a, PSL_RULE },
+    { "ofunato.iwate.jp", 0x446f862b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rissa.no", 0x9f8dc630, PSL_RULE },
+    { "coop.mv", 0x76120631, PSL_RULE },
+    { "bot", 0x9910c632, PSL_RULE },
+    { NULL, 0, 0 },
+    { "yamagata.nagano.jp", 0x27090634, PSL_RULE },
+    { "eu-2.evennode.com", 0x5470c635, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cdn77.net", 0x4e6e8637, 0 },
+    { "yachiyo.ibaraki.jp", 0xa6760638, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mibu.tochigi.jp", 0x80bf063b, PSL_RULE },
+    { "photography.museum", 0x901f463c, PSL_RULE },
+    { "ranzan.saitama.jp", 0xb95a463d, PSL_RULE },
+    { "official.academy", 0xffc7463e, PSL_RULE },
+    { "vt.us", 0x8b3bc63b, PSL_RULE },
+    { "xn--hbmer-xqa.no", 0x9975463b, PSL_RULE },
+    { "mizuho.tokyo.jp", 0x4bac4641, PSL_RULE },
+    { "wa.gov.au", 0x0017c641, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bbs.tr", 0x81810648, PSL_RULE },
+    { "datadetect.com", 0x41638649, 0 },
+    { "org.bn", 0x9fb5c649, PSL_RULE },
+    { "bhz.br", 0xb368864b, PSL_RULE },
+    { "nsn.us", 0xd472464c, PSL_RULE },
+    { "origins", 0x9129064c, PSL_RULE },
+    { "tunes", 0xe4c44648, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "horokanai.hokkaido.jp", 0x1b670653, PSL_RULE },
+    { "col.ng", 0xd42b0654, PSL_RULE },
+    { "krokstadelva.no", 0xc3d94655, PSL_RULE },
+    { NULL, 0, 0 },
+    { "conf.se", 0xbd534657, PSL_RULE },
+    { "homegoods", 0x55f4c658, PSL_RULE },
+    { NULL, 0, 0 },
+    { "taishi.osaka.jp", 0x30c3c65a, PSL_RULE },
+    { "2ix.at", 0x3283865b, PSL_RULE },
+    { "pecori.jp", 0xe47d065b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "familyds.net", 0xd3480661, PSL_RULE },
+    { "al.us", 0x90284662, PSL_RULE },
+    { "dyn.home-webserver.de", 0x3a29c662, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "barsy.uk", 0xcc960666, PSL_RULE },
+    { "gov.pl", 0x26a08667, PSL_RULE },
+    { "ba.gov.br", 0x17844668, PSL_RULE },
+    { "net.pe", 0xcd6a4669, PSL_RULE },
+    { "isteingeek.de", 0x3d1e066a, PSL_RULE },
+    { "name.mv", 0xd35e866b, PSL_RULE },
+    { "xn--4pvxs.jp", 0xea89466a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "aoste.it", 0x0325c66e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hiraya.nagano.jp", 0xd7348671, PSL_RULE },
+    { "staging.onred.one", 0xe4b4c672, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--trentin-sdtirol-7vb.it", 0xb9c64678, PSL_RULE },
+    { "edu.au", 0xa5f10679, PSL_RULE },
+    { "jobs.tt", 0x74a2c679, PSL_RULE },
+    { "sz", 0x5e68067a, PSL_RULE },
+    { "radio", 0xeda9467c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "filegear-de.me", 0x5d95c67e, PSL_RULE },
+    { "biz.mv", 0x9c6dc67f, PSL_RULE },
+    { "br.com", 0x1cb44680, PSL_RULE },
+    { "omi.niigata.jp", 0x7cb6467f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.gt", 0x3c7b8685, PSL_RULE },
+    { NULL, 0, 0 },
+    { "biz.gl", 0x58198687, PSL_RULE },
+    { "art.dz", 0xdf9b0688, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "conn.uk", 0xaf2a068b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "southwest.museum", 0x6969068d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "halsa.no", 0xadf4868f, PSL_RULE },
+    { "ginowan.okinawa.jp", 0x63030690, PSL_RULE },
+    { "ht", 0x41454691, PSL_RULE },
+    { "satx.museum", 0x1b568691, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "li.it", 0x6770c695, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "firm.dk", 0xbe4c4698, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "telebit.io", 0x36a946a0, PSL_RULE },
+    { "nr", 0x635486a1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hirogawa.wakayama.jp", 0x1b4dc6a3, PSL_RULE },
+    { "louvre.museum", 0x8acb86a4, PSL_RULE },
+    { "obihiro.hokkaido.jp", 0x5de3c6a5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ifm", 0xe6afc6a9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "school.na", 0xa10106ac, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "salangen.no", 0x45ef86af, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nakai.kanagawa.jp", 0xdf1e86b2, PSL_RULE },
+    { "l-o-g-i-n.de", 0xb61886b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shikama.miyagi.jp", 0x7d0046b5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "higashichichibu.saitama.jp", 0xc1b886b7, PSL_RULE },
+    { "cl", 0x4631c6b8, PSL_RULE },
+    { "its.me", 0xc634c6b7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "is-a-cpa.com", 0x788186bb, PSL_RULE },
+    { "michigan.museum", 0xb6f5c6bb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "takashima.shiga.jp", 0x9af0c6c0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bd", 0x571cc6c3, PSL_WILDCARD },
+    { "gdynia.pl", 0xaf0486c3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nom.ve", 0x671f46c6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "16-b.it", 0xe888c6cc, PSL_RULE },
+    { "pharmaciens.km", 0x99db46cc, PSL_RULE },
+    { "ogawa.nagano.jp", 0xf5a686ce, PSL_RULE },
+    { "net.bm", 0x8533c6cf, PSL_RULE },
+    { "edu.bi", 0x1f2c86d0, PSL_RULE },
+    { "m.bg", 0xd6d686d1, PSL_RULE },
+    { "sm.ua", 0x71a806cf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "arai.shizuoka.jp", 0x6fdf86d4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--bulsan-sdtirol-nsb.it", 0xee5dc6d7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hotmail", 0x366886db, PSL_RULE },
+    { "supply", 0x50f386dc, PSL_RULE },
+    { "gs.hm.no", 0x75f686dd, PSL_RULE },
+    { "net.uy", 0xacd886de, PSL_RULE },
+    { "africa", 0x28cd86df, PSL_RULE },
+    { "philately.museum", 0xb0d106df, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nordland.no", 0x168c46e2, 0 },
+    { "adv.mz", 0x8d87c6e3, PSL_RULE },
+    { "voyage", 0x13b046e2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.ye", 0x2a8346e6, PSL_RULE },
+    { "click", 0x751bc6e7, PSL_RULE },
+    { "pi.leg.br", 0x373806e6, PSL_RULE },
+    { "rovno.ua", 0x7b5c46e9, PSL_RULE },
+    { "bloomberg", 0xf0a6c6ea, PSL_RULE },
+    { "snowflake.app", 0xf75386e6, PSL_RULE },
+    { "mil.in", 0xaf3ec6ec, PSL_RULE },
+    { "fusa.no", 0xfbb746ed, PSL_RULE },
+    { "shinshiro.aichi.jp", 0xab2e86ee, PSL_RULE },
+    { "shonai.yamagata.jp", 0xf94946ec, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "podlasie.pl", 0x3476c6f4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "joso.ibaraki.jp", 0xac6d46f7, PSL_RULE },
+    { "lib.va.us", 0x1dae86f7, PSL_RULE },
+    { "reise", 0x7eee86f7, PSL_RULE },
+    { "tosa.kochi.jp", 0x22b5c6fa, PSL_RULE },
+    { "ragusa.it", 0x42f686fb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ct.it", 0x503cc6fd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "futbol", 0xc2174701, PSL_RULE },
+    { "itcouldbewor.se", 0x278c0702, PSL_RULE },
+    { "twmail.cc", 0x6630c701, PSL_RULE },
+    { NULL, 0, 0 },
+    { "khakassia.su", 0x5ebf0705, PSL_RULE },
+    { "cc.ne.us", 0x88a98706, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lplfinancial", 0x08d1c708, PSL_RULE },
+    { "ug", 0x4c208709, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "df.gov.br", 0x1f77870d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "u.se", 0xa8788710, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "echizen.fukui.jp", 0x54894713, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "e4.cz", 0x90168717, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "divttasvuotna.no", 0xcf5e471e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tv.sd", 0x235dc720, PSL_RULE },
+    { "xn--80aaa0cvac.xn--p1acf", 0x4c0f8720, PSL_RULE },
+    { "elb.amazonaws.com", 0x06784722, PSL_WILDCARD },
+    { "fan", 0x278f0722, PSL_RULE },
+    { "xn--klty5x.jp", 0x36d6c724, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bcg", 0x6a114727, PSL_RULE },
+    { "stjordalshalsen.no", 0x362e0727, PSL_RULE },
+    { "com.ps", 0xbc2a4729, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "oirm.gov.pl", 0x4cf6c72c, PSL_RULE },
+    { "cbre", 0x6191c72d, PSL_RULE },
+    { "ikeda.osaka.jp", 0x7eb1c72e, PSL_RULE },
+    { "al.it", 0x5e79072f, PSL_RULE },
+    { "nic.in", 0x480a8730, PSL_RULE },
+    { "zama.kanagawa.jp", 0xc574472f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--4dbgdty6c.xn--4dbrk0ce", 0x63a28733, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vi", 0x49388736, PSL_RULE },
+    { "solund.no", 0xa524c737, PSL_RULE },
+    { NULL, 0, 0 },
+    { "g.vbrplsbx.io", 0x1ee60739, PSL_RULE },
+    { "k12.nm.us", 0xe086873a, PSL_RULE },
+    { "s3-website.fr-par.scw.cloud", 0xa1a2c73b, PSL_RULE },
+    { "yamagata.yamagata.jp", 0xd62b0739, PSL_RULE },
+    { "nikita.jp", 0x56b2c73d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kadena.okinawa.jp", 0xaedbc73f, PSL_RULE },
+    { "gov.it", 0x92f00740, PSL_RULE },
+    { "iserv.dev", 0xc6b34741, PSL_RULE },
+    { "k12.il", 0x9fe20742, PSL_RULE },
+    { "lpages.co", 0x550b873f, PSL_RULE },
+    { "upaas.kazteleport.kz", 0xeaed873f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "evenes.no", 0xe2280746, PSL_RULE },
+    { "murmansk.su", 0xe8194747, PSL_RULE },
+    { "qsl.br", 0xd4268747, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yashio.saitama.jp", 0x401bc74c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "jeonbuk.kr", 0xedbe074e, PSL_RULE },
+    { "wroclaw.pl", 0xecfdc74e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gmbh", 0x58be4753, PSL_RULE },
+    { "karasjohka.no", 0xb1324753, PSL_RULE },
+    { "dnp", 0x6b35c755, PSL_RULE },
+    { "pro.fj", 0xa5158754, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "trd.br", 0x5e91c759, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ca", 0x4e25075d, PSL_RULE },
+    { "cloud.jelastic.open.tim.it", 0x3206075e, PSL_RULE },
+    { "radio.fm", 0x5583c75f, PSL_RULE },
+    { "bayern", 0x8d8c0760, PSL_RULE },
+    { "sola.no", 0xc5c80761, PSL_RULE },
+    { "alsace", 0xfab10762, PSL_RULE },
+    { NULL, 0, 0 },
+    { "info.zm", 0xc1b70764, PSL_RULE },
+    { "busan.kr", 0xc1990765, PSL_RULE },
+    { "okaya.nagano.jp", 0x78750764, PSL_RULE },
+    { "net.zm", 0x90098767, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--kbrq7o.jp", 0x50e6c769, PSL_RULE },
+    { "lib.me.us", 0x8f2d476a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ao", 0x7034476d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "villas", 0xac7c0772, PSL_RULE },
+    { NULL, 0, 0 },
+    { "is-a-landscaper.com", 0xeabac774, PSL_RULE },
+    { "leirvik.no", 0x61018774, PSL_RULE },
+    { "egyptian.museum", 0xa3f4c776, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pila.pl", 0xda670779, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bo.telemark.no", 0xe3dd077c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gs", 0x3a52077f, PSL_RULE },
+    { "k12.pa.us", 0xdedf0780, PSL_RULE },
+    { "kalmykia.ru", 0x0e92877f, PSL_RULE },
+    { "rel.pl", 0x8eef0780, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vaporcloud.io", 0x319a0784, PSL_RULE },
+    { "vfs.cloud9.ap-northeast-3.amazonaws.com", 0x0e5d8784, PSL_RULE },
+    { "ynh.fr", 0x3c28c786, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dk", 0x4b3d078a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "like", 0x3859878c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mjondalen.no", 0xe6fd078e, PSL_RULE },
+    { "andoy.no", 0x4b16878f, PSL_RULE },
+    { "cc.ga.us", 0xdf64478f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "szex.hu", 0x9afc4796, PSL_RULE },
+    { "edu.br", 0xba9a8797, PSL_RULE },
+    { "presse.ci", 0xcd1dc797, PSL_RULE },
+    { "valer.hedmark.no", 0x1aeb8798, PSL_RULE },
+    { NULL, 0, 0 },
+    { "trentino-sud-tirol.it", 0x2716479b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "groks-the.info", 0xb8f5479d, PSL_RULE },
+    { "demon.nl", 0x203f879e, PSL_RULE },
+    { "com.ly", 0xa5b4c79f, PSL_RULE },
+    { "farmstead.museum", 0xb5d507a0, PSL_RULE },
+    { "nishigo.fukushima.jp", 0x3e4f879f, PSL_RULE },
+    { "treviso.it", 0xf48e479e, PSL_RULE },
+    { "tur.ar", 0x0250479d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--avery-yua.no", 0x497d07a5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "final", 0x03bfc7a7, PSL_RULE },
+    { "tone.ibaraki.jp", 0x535f47a8, PSL_RULE },
+    { "edu.sc", 0x6949c7a9, PSL_RULE },
+    { "nakanojo.gunma.jp", 0xca6307aa, PSL_RULE },
+    { NULL, 0, 0 },
+    { "business.in", 0xfef6c7ac, PSL_RULE },
+    { "ro.it", 0x617fc7ad, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "google", 0x91b247b0, PSL_RULE },
+    { "noho.st", 0xa10c87b0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cc.ky.us", 0x545ac7b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "codes", 0xa9ba87b5, PSL_RULE },
+    { "pioneer", 0xc86b87b5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "togliatti.su", 0x9f6047bc, PSL_RULE },
+    { "arezzo.it", 0x381fc7bd, PSL_RULE },
+    { "togo.aichi.jp", 0x722307bc, PSL_RULE },
+    { "trycloudflare.com", 0xe483c7be, PSL_RULE },
+    { "menu", 0xcfd307c0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.gd", 0xc229c7c6, PSL_RULE },
+    { "store.bb", 0x35a487c6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "frenchkiss.jp", 0x21d807c9, PSL_RULE },
+    { "hemne.no", 0xa19547c9, PSL_RULE },
+    { "moto", 0xfff947ca, PSL_RULE },
+    { "cn.eu.org", 0x1d5a07cc, PSL_RULE },
+    { "my-gateway.de", 0x39e507c9, PSL_RULE },
+    { "nom.co", 0xeccf07cb, PSL_RULE },
+    { "ut.us", 0x8c3bc7ce, PSL_RULE },
+    { "xn--merker-kua.no", 0xe29587ce, PSL_RULE },
+    { "lohmus.me", 0x247ac7d1, PSL_RULE },
+    { "aco", 0xa24747d2, PSL_RULE },
+    { "bremanger.no", 0x5eddc7d3, PSL_RULE },
+    { "cc.al.us", 0x089247d2, PSL_RULE },
+    { "info.nf", 0xacb807d5, PSL_RULE },
+    { "is-a-democrat.com", 0xcdc9c7d2, PSL_RULE },
+    { "molise.it", 0x2b5ec7d5, PSL_RULE },
+    { "org.lb", 0x8d0c07d3, PSL_RULE },
+    { "statics.cloud", 0x5d9207d7, PSL_WILDCARD },
+    { "uchiko.ehime.jp", 0xdc0a87d4, PSL_RULE },
+    { "co.bb", 0xfde4c7db, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "alesund.no", 0xf36347e0, PSL_RULE },
+    { "com.tr", 0x101c07e0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.th", 0x6b7087e4, PSL_RULE },
+    { "spa", 0x226a87e5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.or.us", 0x83d687e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "customer.mythic-beasts.com", 0x829b07e9, PSL_RULE },
+    { "xn--55qx5d.hk", 0xdf0407ea, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.tn", 0xeac1c7ef, PSL_RULE },
+    { "barsy.me", 0x6aeac7f0, PSL_RULE },
+    { "gosen.niigata.jp", 0xacdbc7f0, PSL_RULE },
+    { "media.hu", 0x09bd07f2, PSL_RULE },
+    { "thingdust.io", 0x8d7907ef, 0 },
+    { NULL, 0, 0 },
+    { "dazaifu.fukuoka.jp", 0x15cf87f5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.pe", 0x8be807f7, PSL_RULE },
+    { "softbank", 0x3c4007f7, PSL_RULE },
+    { "ekloges.cy", 0xbf9487f9, PSL_RULE },
+    { "cloudfront.net", 0xb8d287fa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.gn", 0xe074c7fd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.ph", 0xaa444800, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "firebaseapp.com", 0xc4d18804, PSL_RULE },
+    { "for-better.biz", 0xd7374804, PSL_RULE },
+    { "mitoyo.kagawa.jp", 0x95f70806, PSL_RULE },
+    { "fujiyoshida.yamanashi.jp", 0xa3f44807, PSL_RULE },
+    { "xn--fiqz9s", 0x1ef30807, PSL_RULE },
+    { "sch.sa", 0x4edc4809, PSL_RULE },
+    { "oguchi.aichi.jp", 0x5463080a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "suwa.nagano.jp", 0xc70c480d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "health", 0x8100880f, PSL_RULE },
+    { "dagestan.su", 0x7ad78810, PSL_RULE },
+    { "daito.osaka.jp", 0x92654811, PSL_RULE },
+    { "from-ia.com", 0x3c634811, PSL_RULE },
+    { "travelers", 0xca534813, PSL_RULE },
+    { "sinaapp.com", 0x3858c814, PSL_RULE },
+    { "webhop.net", 0xa4518815, PSL_RULE },
+    { "woltlab-demo.com", 0xd11ac811, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aviation.museum", 0x6392c81c, PSL_RULE },
+    { "me.eu.org", 0x2348c81d, PSL_RULE },
+    { "myoko.niigata.jp", 0xf55c881d, PSL_RULE },
+    { "ny-1.paas.massivegrid.net", 0xfaae881e, PSL_RULE },
+    { "toyota.yamaguchi.jp", 0xbd40481d, PSL_RULE },
+    { "yoshikawa.saitama.jp", 0x9ae7881f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.iq", 0x0947c824, PSL_RULE },
+    { "cloudns.org", 0x13860825, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--djty4k.jp", 0x776a0827, PSL_RULE },
+    { "ci.it", 0x6870c828, PSL_RULE },
+    { NULL, 0, 0 },
+    { "framer.wiki", 0xdac2082a, PSL_RULE },
+    { "xn--gmqw5a.hk", 0x9280882a, PSL_RULE },
+    { "shintoku.hokkaido.jp", 0x34a5482c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "adult", 0x06f3882f, PSL_RULE },
+    { "maebashi.gunma.jp", 0xf5c1c82f, PSL_RULE },
+    { "k12.ak.us", 0x6e0c0831, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ir", 0x64548834, PSL_RULE },
+    { "erotica.hu", 0x5fd88835, PSL_RULE },
+    { "xn--slt-elab.no", 0x9a2e0834, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ms.leg.br", 0x506e483b, PSL_RULE },
+    { "uppo.gov.pl", 0x9cd5483b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yufu.oita.jp", 0x0b6f8841, PSL_RULE },
+    { "com.ac", 0xdc358842, PSL_RULE },
+    { "gs.va.no", 0x21040843, PSL_RULE },
+    { "ind.gt", 0x87bb4843, PSL_RULE },
+    { "kitagawa.kochi.jp", 0x510f0844, PSL_RULE },
+    { "mls", 0xc1384845, PSL_RULE },
+    { "airkitapps.eu", 0xb1a9c847, PSL_RULE },
+    { NULL, 0, 0 },
+    { "arts.co", 0xa769c849, PSL_RULE },
+    { "affinitylottery.org.uk", 0x18e6c84a, PSL_RULE },
+    { "etc.br", 0x254b8849, PSL_RULE },
+    { "edu.it", 0x2482084c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "jozi.biz", 0x6ecc084e, PSL_RULE },
+    { "toyotsu.fukuoka.jp", 0x6b48484e, PSL_RULE },
+    { "net.br", 0x3fe00850, PSL_RULE },
+    { "beep.pl", 0x538d4851, PSL_RULE },
+    { "noip.me", 0x8da74851, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fukagawa.hokkaido.jp", 0xd74b4854, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ad", 0x581cc856, PSL_RULE },
+    { "fst.br", 0x380b8856, PSL_RULE },
+    { "per.sg", 0x46ec4856, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kira.aichi.jp", 0x7607085a, PSL_RULE },
+    { "olbiatempio.it", 0x3bf0485b, PSL_RULE },
+    { "union.aero", 0xbef9485b, PSL_RULE },
+    { "zagan.pl", 0x3337485a, PSL_RULE },
+    { "noticeable.news", 0x6498885e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bitbridge.net", 0x91f38860, PSL_RULE },
+    { "co.tm", 0x88f68860, PSL_RULE },
+    { "gallery.museum", 0x0228c861, PSL_RULE },
+    { NULL, 0, 0 },
+    { "j.bg", 0xd7d68864, PSL_RULE },
+    { "family.museum", 0x1e2a0865, PSL_RULE },
+    { "lajolla.museum", 0x3f9a8864, PSL_RULE },
+    { "gov.nr", 0x30cb4867, PSL_RULE },
+    { "matsumoto.nagano.jp", 0xfdf84864, PSL_RULE },
+    { "belau.pw", 0x3c4a0869, PSL_RULE },
+    { "biz.wf", 0x5c364869, PSL_RULE },
+    { "imamat", 0xd198486a, PSL_RULE },
+    { "cc.ct.us", 0xb3ce886c, PSL_RULE },
+    { "edu.ni", 0xbdd3c86c, PSL_RULE },
+    { "xn--rdy-0nab.no", 0xa65d4869, PSL_RULE },
+    { NULL, 0, 0 },
+    { "utazu.kagawa.jp", 0x62100870, PSL_RULE },
+    { "wroc.pl", 0x404ec870, PSL_RULE },
+    { "org.lc", 0x7cfc4872, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.gu", 0xdc6ac876, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "int", 0xc413487a, PSL_RULE },
+    { "barsy.bg", 0xcc6f487b, PSL_RULE },
+    { "com.kg", 0xb366887c, PSL_RULE },
+    { "ac.uk", 0xea99487d, PSL_RULE },
+    { "gs.bu.no", 0x576e087b, PSL_RULE },
+    { "happou.akita.jp", 0x8849087c, PSL_RULE },
+    { "kamo.niigata.jp", 0x6de14880, PSL_RULE },
+    { "com.cv", 0xa733c881, PSL_RULE },
+    { "we.bs", 0xfe44887e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tarumizu.kagoshima.jp", 0x73eb4884, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.hk", 0x49aa4886, PSL_RULE },
+    { "ltd.cy", 0x162cc887, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jfk.museum", 0x2c03c88a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "trentino-aadige.it", 0xa920888d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "123website.ch", 0xf4c54891, PSL_RULE },
+    { "uber.space", 0x5eab4891, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kouzushima.tokyo.jp", 0x233c8897, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "independent-inquest.uk", 0xd973c89b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tn", 0x4936489f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "arab", 0x5dda88a1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "t.se", 0xa97888a3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ulm.museum", 0xb18c88ab, PSL_RULE },
+    { "ac.za", 0xc74608ac, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sondrio.it", 0xa2ecc8ae, PSL_RULE },
+    { "dynalias.com", 0xa17508af, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sodegaura.chiba.jp", 0x0e7708b1, PSL_RULE },
+    { "xn--lhppi-xqa.no", 0xc442c8b2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "crafts.museum", 0x10c708b4, PSL_RULE },
+    { "gov.bh", 0xecf2c8b5, PSL_RULE },
+    { "edu.kp", 0x1d9588b6, PSL_RULE },
+    { "hekinan.aichi.jp", 0x70c848b7, PSL_RULE },
+    { "loisirs.bj", 0xf37388b4, PSL_RULE },
+    { "site", 0x2ab508b4, PSL_RULE },
+    { "independent-panel.uk", 0x48a248ba, PSL_RULE },
+    { "xn--kput3i", 0x3f9208b7, PSL_RULE },
+    { "cash", 0x42cc48bc, PSL_RULE },
+    { "chernovtsy.ua", 0xdf8408bc, PSL_RULE },
+    { "nagi.okayama.jp", 0x89b4c8bd, PSL_RULE },
+    { "quipelements.com", 0xc26d48be, PSL_WILDCARD },
+    { "gs.jan-mayen.no", 0xb547c8c0, PSL_RULE },
+    { "minato.osaka.jp", 0xa4a008c0, PSL_RULE },
+    { "bl.it", 0x5f7908c2, PSL_RULE },
+    { "tm.mg", 0x253c48bc, PSL_RULE },
+    { "xn--gmq050i.hk", 0xa363c8c3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gucci", 0x391288c6, PSL_RULE },
+    { "live", 0x08e748c7, PSL_RULE },
+    { "barsy.eu", 0xdabe48c8, PSL_RULE },
+    { "blog.br", 0xdf7e08c9, PSL_RULE },
+    { "aejrie.no", 0xd28bc8ca, PSL_RULE },
+    { "cc.hi.us", 0xc4e448c8, PSL_RULE },
+    { "kp", 0x464e48cc, PSL_RULE },
+    { "nrw.museum", 0xdcab48c6, PSL_RULE },
+    { "oyamazaki.kyoto.jp", 0xd0b388cb, PSL_RULE },
+    { "pg.in", 0xdc91c8cd, PSL_RULE },
+    { "pl.eu.org", 0x3c6048c7, PSL_RULE },
+    { "co.im", 0x2b1988d1, PSL_RULE },
+    { "msk.su", 0x08df48d2, PSL_RULE },
+    { "xn--lrdal-sra.no", 0x23d088cc, PSL_RULE },
+    { "contemporary.museum", 0x087808d4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yamanashi.yamanashi.jp", 0x898408d7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "desi", 0xac6e08dc, PSL_RULE },
+    { "dynamic-dns.info", 0x59c208dc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fukudomi.saga.jp", 0x4fc188e1, PSL_RULE },
+    { "reklam.hu", 0xf54ac8e2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--rht27z.jp", 0x06c608e4, PSL_RULE },
+    { "yawara.ibaraki.jp", 0xc3b5c8e5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mil.my", 0x277bc8e7, PSL_RULE },
+    { "mizumaki.fukuoka.jp", 0x5b9588e8, PSL_RULE },
+    { "akita.jp", 0xfd56c8e9, PSL_RULE },
+    { "net.ws", 0x9f9588ea, PSL_RULE },
+    { "commune.am", 0x2efd48eb, PSL_RULE },
+    { "tirol", 0xf71a88e7, PSL_RULE },
+    { "hol.no", 0x5e8748ed, PSL_RULE },
+    { "gov.ar", 0x5a7d48ee, PSL_RULE },
+    { "hk.com", 0x4ca348ef, PSL_RULE },
+    { "eidskog.no", 0x870808f0, PSL_RULE },
+    { "edu.tj", 0xe5d7c8f1, PSL_RULE },
+    { "kasama.ibaraki.jp", 0x8ff9c8f2, PSL_RULE },
+    { "savannahga.museum", 0xda3088ed, PSL_RULE },
+    { "po.gov.pl", 0x878308f4, PSL_RULE },
+    { "webview-assets.cloud9.us-west-1.amazonaws.com", 0x0396c8e8, PSL_RULE },
+    { "shiraoi.hokkaido.jp", 0x608888f6, PSL_RULE },
+    { "barsy.pub", 0x783c08f7, PSL_RULE },
+    { "shimamoto.osaka.jp", 0x820148f7, PSL_RULE },
+    { "ujiie.tochigi.jp", 0x6e5308f6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "web.tr", 0x158b08fb, PSL_RULE },
+    { "nagara.chiba.jp", 0x6a3188fc, PSL_RULE },
+    { "modelling.aero", 0x67d5c8fd, PSL_RULE },
+    { "naoshima.kagawa.jp", 0x22cb48fd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "demo.datadetect.com", 0x59580900, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "otaki.saitama.jp", 0x0ca6c903, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "en-root.fr", 0x01e90909, PSL_RULE },
+    { "skype", 0x828ec909, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "farmers", 0xd9648913, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fukushima.hokkaido.jp", 0x958ec916, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kaminoyama.yamagata.jp", 0x12fdc91b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ebetsu.hokkaido.jp", 0xb80a891d, PSL_RULE },
+    { "pc.pl", 0x35d8091e, PSL_RULE },
+    { "samegawa.fukushima.jp", 0x5f3ac91e, PSL_RULE },
+    { "ichinohe.iwate.jp", 0x3cee8920, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "venice.it", 0x337b4924, PSL_RULE },
+    { NULL, 0, 0 },
+    { "privatizehealthinsurance.net", 0x415a4926, PSL_RULE },
+    { "contagem.br", 0x64418927, PSL_RULE },
+    { "grong.no", 0x07b9c927, PSL_RULE },
+    { "snoasa.no", 0xb62cc929, PSL_RULE },
+    { "xn--trentinsdtirol-nsb.it", 0xdf670929, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "seaport.museum", 0x9e8f092f, PSL_RULE },
+    { "aerobatic.aero", 0xf51a4930, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kakinoki.shimane.jp", 0x94cd4933, PSL_RULE },
+    { "hamatonbetsu.hokkaido.jp", 0xdafb8934, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gay", 0x52a9c938, PSL_RULE },
+    { NULL, 0, 0 },
+    { "it.ao", 0x4b4a893a, PSL_RULE },
+    { "columbus.museum", 0x1df4493b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lodi.it", 0x9077893e, PSL_RULE },
+    { "seiyo.ehime.jp", 0x91b8c93e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "deatnu.no", 0xde340943, PSL_RULE },
+    { "edu.mw", 0x8bda8943, PSL_RULE },
+    { "takagi.nagano.jp", 0xa7f20944, PSL_RULE },
+    { NULL, 0, 0 },
+    { "appspot.com", 0xc4a50947, PSL_RULE },
+    { "lifestyle", 0xc93d0948, PSL_RULE },
+    { "balashov.su", 0xdb214949, PSL_RULE },
+    { NULL, 0, 0 },
+    { "grue.no", 0xaaf2894b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "miyota.nagano.jp", 0xde94c94e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ac.cn", 0x26c2c950, PSL_RULE },
+    { "kyotamba.kyoto.jp", 0xca690951, PSL_RULE },
+    { "moroyama.saitama.jp", 0xb0b78952, PSL_RULE },
+    { "trentino-sued-tirol.it", 0x11730950, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.mi.us", 0xabd14956, PSL_RULE },
+    { "donetsk.ua", 0x19a68957, PSL_RULE },
+    { "na.it", 0x455d0957, PSL_RULE },
+    { "volkenkunde.museum", 0x1933c959, PSL_RULE },
+    { "xn--90a1af.xn--p1acf", 0x138a0956, PSL_RULE },
+    { "usuki.oita.jp", 0x2016895b, PSL_RULE },
+    { "encr.app", 0x1e38495c, PSL_RULE },
+    { "inc.hk", 0xb942c95c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dyndns-free.com", 0x8b56095f, PSL_RULE },
+    { "drud.us", 0x289c4960, PSL_RULE },
+    { "cymru", 0x9f680961, PSL_RULE },
+    { "myspreadshop.at", 0xe0e5c95f, PSL_RULE },
+    { "servebeer.com", 0x39b1c961, PSL_RULE },
+    { "qld.edu.au", 0xa1348964, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cieszyn.pl", 0x3eaf496a, PSL_RULE },
+    { "shitara.aichi.jp", 0x44fe896b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "takamori.kumamoto.jp", 0xe8d6496e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "from-az.net", 0x53330972, PSL_RULE },
+    { "myddns.rocks", 0xdfd0c972, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.is", 0x7a56c975, PSL_RULE },
+    { "herokussl.com", 0xf0230976, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "8.bg", 0x29d7097a, PSL_RULE },
+    { "gsj.bz", 0x591fc97b, PSL_RULE },
+    { "channel", 0x2c23497c, PSL_RULE },
+    { "kawaiishop.jp", 0x59f4097d, PSL_RULE },
+    { "nagasu.kumamoto.jp", 0xca92c97b, PSL_RULE },
+    { "tv.tz", 0xa458c97d, PSL_RULE },
+    { "aki.kochi.jp", 0xda95c980, PSL_RULE },
+    { "cc.ks.us", 0x1611c981, PSL_RULE },
+    { "wellbeingzone.eu", 0xd113c97c, PSL_RULE },
+    { "ide.kyoto.jp", 0xebc94983, PSL_RULE },
+    { "xn--unjrga-rta.no", 0x8b250983, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.bi", 0xc3c54986, PSL_RULE },
+    { "dvr", 0x52d44987, PSL_RULE },
+    { "student.aero", 0xe03bc987, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "minamifurano.hokkaido.jp", 0x29cb498d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fbxos.fr", 0x831f8991, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "minamiizu.shizuoka.jp", 0x13940994, PSL_RULE },
+    { "realty", 0xf3bf0994, PSL_RULE },
+    { NULL, 0, 0 },
+    { "stargard.pl", 0x01db8997, PSL_RULE },
+    { "pm", 0x532e0998, PSL_RULE },
+    { NULL, 0, 0 },
+    { "loppa.no", 0x0c8f499a, PSL_RULE },
+    { "info.co", 0xc383499b, PSL_RULE },
+    { "mansions.museum", 0xb258c99b, PSL_RULE },
+    { "webspace.rocks", 0x8c15899d, PSL_RULE },
+    { "properties", 0xccd5c99e, PSL_RULE },
+    { "shakotan.hokkaido.jp", 0xafb4c99e, PSL_RULE },
+    { "sexy", 0x865a09a0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ugim.gov.pl", 0xd34289a5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vivo", 0x2dd9c9af, PSL_RULE },
+    { "daplie.me", 0xc071c9b0, PSL_RULE },
+    { "de.trendhosting.cloud", 0x0c6609b0, PSL_RULE },
+    { "fortal.br", 0xbf6e09b1, PSL_RULE },
+    { "news", 0x6ee309b0, PSL_RULE },
+    { "gob.mx", 0xc6e349b4, PSL_RULE },
+    { "landing.myjino.ru", 0x5147c9b5, PSL_WILDCARD },
+    { "xn--h1aegh.museum", 0x9cd549b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tomari.hokkaido.jp", 0xfc9649b9, PSL_RULE },
+    { "cheap.jp", 0x453cc9ba, PSL_RULE },
+    { "bi.it", 0x6970c9bb, PSL_RULE },
+    { "higashi.okinawa.jp", 0xde7f89bc, PSL_RULE },
+    { "ngo.ng", 0x5add49ba, PSL_RULE },
+    { "party.eus", 0x899489be, 0 },
+    { "planetarium.museum", 0x2606c9bd, PSL_RULE },
+    { "geekgalaxy.com", 0x880a09c0, PSL_RULE },
+    { "r.appspot.com", 0xe4fec9bb, PSL_WILDCARD },
+    { "co.na", 0xf5f3c9c2, PSL_RULE },
+    { "wajiki.tokushima.jp", 0x6753c9bb, PSL_RULE },
+    { "assabu.hokkaido.jp", 0xafe689c4, PSL_RULE },
+    { "athleta", 0x818789c4, PSL_RULE },
+    { "repl.co", 0x29d889c4, PSL_RULE },
+    { "hr", 0x655489c7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "takahata.yamagata.jp", 0xb44cc9c9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "int.bo", 0x1f9189cb, PSL_RULE },
+    { "oh.us", 0x721d89cc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sr.it", 0x503849cf, PSL_RULE },
+    { "net.nf", 0x6e8b89d0, PSL_RULE },
+    { "ogawa.saitama.jp", 0x348909d0, PSL_RULE },
+    { "on-aptible.com", 0xb72209d1, PSL_RULE },
+    { "city.hu", 0x1be009d3, PSL_RULE },
+    { "kainan.wakayama.jp", 0x36a3c9d3, PSL_RULE },
+    { "aguni.okinawa.jp", 0xc5d789d5, PSL_RULE },
+    { "press.museum", 0x1b7309d0, PSL_RULE },
+    { "1kapp.com", 0xbf1189d7, PSL_RULE },
+    { "lucca.it", 0xe01489d8, PSL_RULE },
+    { "wildlife.museum", 0xb08fc9cf, PSL_RULE },
+    { "net.pr", 0xcf4549da, PSL_RULE },
+    { NULL, 0, 0 },
+    { "biz.pr", 0xa46949dc, PSL_RULE },
+    { "in.us", 0x942cc9dc, PSL_RULE },
+    { "al", 0x4831c9de, PSL_RULE },
+    { "net.to", 0x97cc89df, PSL_RULE },
+    { "tabitorder.co.il", 0x354449de, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ookuwa.nagano.jp", 0x679689e3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ma.leg.br", 0x344b89e5, PSL_RULE },
+    { "tjmaxx", 0x16a209e5, PSL_RULE },
+    { "gov.bf", 0x5f76c9e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "zero", 0xe61c89eb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "us.platform.sh", 0x22fb09ef, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kutchan.hokkaido.jp", 0xa85689f1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "k.bg", 0xd8d689f7, PSL_RULE },
+    { "setouchi.okayama.jp", 0xd3dec9f8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.pe", 0x433b89fa, PSL_RULE },
+    { "gausdal.no", 0x63f709fb, PSL_RULE },
+    { "gov.bb", 0xa31a89fb, PSL_RULE },
+    { "umb.it", 0xbc4f89fc, PSL_RULE },
+    { "co.sz", 0xf797c9fe, PSL_RULE },
+    { "greater.jp", 0x7c1349ff, PSL_RULE },
+    { "xn--porsgu-sta26f.no", 0xa5a009fb, PSL_RULE },
+    { "you", 0x43d6c9fc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.al", 0xe8a34a04, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.ru", 0x362d4a07, PSL_RULE },
+    { "ogano.saitama.jp", 0x229a8a07, PSL_RULE },
+    { "mormon", 0x07fdca09, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "wien.funkfeuer.at", 0x22de4a0c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.bz", 0xea600a0f, PSL_RULE },
+    { "half.host", 0xe1f74a10, PSL_RULE },
+    { "ono.hyogo.jp", 0x9fcf0a0f, PSL_RULE },
+    { "varoy.no", 0x7c408a0f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.ai", 0x62ee4a1a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ac.lk", 0x10a60a1c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.lr", 0x41454a21, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shiksha", 0xa82b4a28, PSL_RULE },
+    { "sncf", 0xdaeb0a29, PSL_RULE },
+    { "sweden.museum", 0x56078a29, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.ma.us", 0x36f78a2e, PSL_RULE },
+    { "quicksytes.com", 0x9af38a2f, PSL_RULE },
+    { "sg", 0x4e208a2f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nagaoka.niigata.jp", 0x0f858a32, PSL_RULE },
+    { "harima.hyogo.jp", 0x03ab8a33, PSL_RULE },
+    { "sub.jp", 0xa96e4a33, PSL_RULE },
+    { NULL, 0, 0 },
+    { "w.se", 0xaa788a36, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "oumu.hokkaido.jp", 0xf7ca4a39, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.mn", 0x6c3c0a3c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "familyds.org", 0xa206ca3e, PSL_RULE },
+    { "kitahata.saga.jp", 0x1bc04a3e, PSL_RULE },
+    { "name.pr", 0x9ab3ca3e, PSL_RULE },
+    { "sveio.no", 0x0e33ca3e, PSL_RULE },
+    { "vagan.no", 0x41bc4a3f, PSL_RULE },
+    { "yokohama", 0x11838a40, PSL_RULE },
+    { NULL, 0, 0 },
+    { "inawashiro.fukushima.jp", 0xecf28a45, PSL_RULE },
+    { "art", 0x941d8a46, PSL_RULE },
+    { "ac.im", 0x5110ca47, PSL_RULE },
+    { "org.gp", 0xb915ca48, PSL_RULE },
+    { "baseball", 0x9f798a49, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sb.ua", 0x71c24a4c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "eastasia.azurestaticapps.net", 0x1b6cca4e, PSL_RULE },
+    { "tochio.niigata.jp", 0xbc084a4e, PSL_RULE },
+    { "tonkotsu.jp", 0xe8c70a50, PSL_RULE },
+    { "xn--mk1bu44c", 0xf306ca50, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cl.it", 0x60790a55, PSL_RULE },
+    { "russia.museum", 0x4001ca56, PSL_RULE },
+    { "tainai.niigata.jp", 0x9c410a56, PSL_RULE },
+    { "film.hu", 0xbbb9ca58, PSL_RULE },
+    { "xn--mjndalen-64a.no", 0x3727ca57, PSL_RULE },
+    { "ddns5.com", 0xc2898a5a, PSL_RULE },
+    { "ssl.origin.cdn77-secure.org", 0xe0354a5a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jp", 0x474e4a5f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "honbetsu.hokkaido.jp", 0x6f954a63, PSL_RULE },
+    { NULL, 0, 0 },
+    { "habikino.osaka.jp", 0x2fdc0a65, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "autocode.dev", 0x15e40a68, PSL_RULE },
+    { "j.scaleforce.net", 0xd11f0a69, PSL_RULE },
+    { "marshalls", 0xc068ca68, PSL_RULE },
+    { "faststacks.net", 0xf5d1ca6b, PSL_RULE },
+    { "house", 0x46300a6b, PSL_RULE },
+    { "katashina.gunma.jp", 0x58ab0a6d, PSL_RULE },
+    { "net.sg", 0xce410a6a, PSL_RULE },
+    { "xn--zfr164b", 0x47574a68, PSL_RULE },
+    { "info.ls", 0xbf68ca70, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mishima.fukushima.jp", 0x4dbf4a76, PSL_RULE },
+    { "sch.so", 0xb0d7ca77, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bzz.dapps.earth", 0xf1684a79, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "translated.page", 0xcd53ca7c, PSL_RULE },
+    { "lib.az.us", 0xfaf8ca7d, PSL_RULE },
+    { "ethnology.museum", 0xe9cbca7e, PSL_RULE },
+    { "tvedestrand.no", 0xeac8ca7c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--node", 0x1715ca81, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "de.gt", 0xfd6d0a87, PSL_RULE },
+    { "gov.il", 0x91420a88, PSL_RULE },
+    { "schools.nsw.edu.au", 0x0c5f4a88, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bielawa.pl", 0x60a8ca8c, PSL_RULE },
+    { "bms", 0xec3aca8d, PSL_RULE },
+    { "dr.na", 0x02d38a8e, PSL_RULE },
+    { "nyc.museum", 0xe3574a8d, PSL_RULE },
+    { "test.ru", 0x115b4a8c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "biz.fj", 0xdaa74a92, PSL_RULE },
+    { "sakae.chiba.jp", 0xd103ca93, PSL_RULE },
+    { "supabase.in", 0x90354a94, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "owo.codes", 0xe71e4a98, PSL_WILDCARD },
+    { "com.hk", 0xfd92ca99, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aomori.aomori.jp", 0xdade4a9d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kiwi.nz", 0x37c08aa1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "info.na", 0xcddd4aa4, PSL_RULE },
+    { "es", 0x3c520aa5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jampa.br", 0x5164caa8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "forgot.her.name", 0xba610aac, PSL_RULE },
+    { "net.bo", 0x46ac0aad, PSL_RULE },
+    { "ipiranga", 0x3d76caae, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil", 0x394ccab1, PSL_RULE },
+    { "nike", 0x3a598ab2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hopto.org", 0xf16e8ab5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "webview-assets.cloud9.eu-south-1.amazonaws.com", 0xd7f20ab8, PSL_RULE },
+    { "gle", 0x59884ab9, PSL_RULE },
+    { "schwarz", 0xd0cc8ab9, PSL_RULE },
+    { "myasustor.com", 0x8f3d8abb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "builders", 0xb552cabd, PSL_RULE },
+    { "org.ni", 0x70910abe, PSL_RULE },
+    { "kawanabe.kagoshima.jp", 0x88f40abf, PSL_RULE },
+    { "xn--imr513n", 0xff8b0ac0, PSL_RULE },
+    { "nom.km", 0x02c84ac1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "oregontrail.museum", 0x57980ac3, PSL_RULE },
+    { "xn--o3cyx2a.xn--o3cw4h", 0xfebd8ac4, PSL_RULE },
+    { "novecore.site", 0x527c4ac5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "skjervoy.no", 0x9c750acb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "forde.no", 0x1c52cace, PSL_RULE },
+    { "llp", 0x6f3a4acf, PSL_RULE },
+    { "camera", 0x78dbcad0, PSL_RULE },
+    { "fredrikstad.no", 0x02a0cad1, PSL_RULE },
+    { "shop.ro", 0xb2324ad2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "loyalist.museum", 0x19494ad4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "reservd.dev.thingdust.io", 0x9f724ad7, PSL_RULE },
+    { "moriyama.shiga.jp", 0xd48a4ad8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sellfy.store", 0xfb95cadb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "deal", 0x50044adf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--smna-gra.no", 0xde6b8ae2, PSL_RULE },
+    { "shiroishi.saga.jp", 0xe0c40ae3, PSL_RULE },
+    { "com.ws", 0x74b08ae4, PSL_RULE },
+    { "ishikari.hokkaido.jp", 0x454c0ae5, PSL_RULE },
+    { "hockey", 0x46558ae6, PSL_RULE },
+    { "co.ug", 0x87308ae7, PSL_RULE },
+    { "net.my", 0x3ed8cae6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "saito.miyazaki.jp", 0xd277caf0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.md.us", 0x6f7a0af2, PSL_RULE },
+    { "biz.in", 0x488ecaf3, PSL_RULE },
+    { "us.in", 0xc7600af2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.gt", 0xc4508af6, PSL_RULE },
+    { "org.vi", 0x59884af6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.tn", 0xfccccafa, PSL_RULE },
+    { "tomika.gifu.jp", 0xd7430afb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.to", 0xac700afe, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--hmmrfeasta-s4ac.no", 0x4db68b00, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tsukumi.oita.jp", 0xb0b14b02, PSL_RULE },
+    { "selbu.no", 0x1f818b03, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kvalsund.no", 0x38be0b08, PSL_RULE },
+    { "loginline.app", 0xe235cb09, PSL_RULE },
+    { "dscloud.biz", 0x025f4b0a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "9.bg", 0x2ad70b0d, PSL_RULE },
+    { "fin.ec", 0x86ee0b0e, PSL_RULE },
+    { "fakefur.jp", 0x285f8b0f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "yamato.kanagawa.jp", 0x2b128b11, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.tj", 0x6730cb16, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "flanders.museum", 0x883b8b1a, PSL_RULE },
+    { "asn.au", 0x9861cb1b, PSL_RULE },
+    { "org.gn", 0x66fb4b1a, PSL_RULE },
+    { "pro", 0xad1e0b1c, PSL_RULE },
+    { "myspreadshop.pl", 0x6aa30b1e, PSL_RULE },
+    { "xn--ngbrx", 0xb8c40b1e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "public-inquiry.uk", 0x4cae0b22, PSL_RULE },
+    { "pistoia.it", 0xdf054b23, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cc.vt.us", 0xd4c8cb25, PSL_RULE },
+    { "toba.mie.jp", 0x9a2e8b26, PSL_RULE },
+    { "cn.com", 0x55968b27, PSL_RULE },
+    { "edu.fm", 0x1e104b28, PSL_RULE },
+    { NULL, 0, 0 },
+    { "wazuka.kyoto.jp", 0x5c130b2a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "davvenjarga.no", 0x96ac8b2f, PSL_RULE },
+    { "lebesby.no", 0x34da8b30, PSL_RULE },
+    { "wedding", 0xf4facb2f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "careers", 0x40f14b34, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.cn", 0x3edd0b38, PSL_RULE },
+    { "ar.com", 0x1fb44b39, PSL_RULE },
+    { "boston.museum", 0x435ccb3a, PSL_RULE },
+    { "enebakk.no", 0xd44f0b3b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.sl", 0xe1c98b3f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bet.ar", 0x30804b41, PSL_RULE },
+    { "barsy.shop", 0xd6fbcb42, PSL_RULE },
+    { "blogspot.com.ar", 0x4b900b43, PSL_RULE },
+    { "edu.hn", 0x6ecccb41, PSL_RULE },
+    { "id.us", 0x9814cb42, PSL_RULE },
+    { "mus.mi.us", 0x50660b46, PSL_RULE },
+    { "se.eu.org", 0x2548cb43, PSL_RULE },
+    { "dance", 0x4fe88b48, PSL_RULE },
+    { "wakuya.miyagi.jp", 0xbbe48b49, PSL_RULE },
+    { "mt", 0x44454b4a, PSL_RULE },
+    { "presse.km", 0xead90b4b, PSL_RULE },
+    { "sennan.osaka.jp", 0xd05a4b4b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dunlop", 0x8ba7cb4f, PSL_RULE },
+    { "k12.az.us", 0x1ceb8b50, PSL_RULE },
+    { "xn--vegrshei-c0a.no", 0x1e800b50, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lerdal.no", 0xb8980b56, PSL_RULE },
+    { "adult.ht", 0xfc0ecb57, PSL_RULE },
+    { "dynu.net", 0x709f0b58, PSL_RULE },
+    { "al.no", 0xa2b40b59, PSL_RULE },
+    { "isleofman.museum", 0xf02d4b59, PSL_RULE },
+    { "capital", 0x242d4b5b, PSL_RULE },
+    { "edu.pk", 0xada2cb5c, PSL_RULE },
+    { "kr", 0x66548b5a, PSL_RULE },
+    { "nagai.yamagata.jp", 0x7bb54b58, PSL_RULE },
+    { "nh.us", 0x731d8b5f, PSL_RULE },
+    { "nishikawa.yamagata.jp", 0x3f284b5d, PSL_RULE },
+    { "run", 0x2b728b5a, PSL_RULE },
+    { "pr.it", 0x51384b62, PSL_RULE },
+    { "com.gl", 0xa2848b63, PSL_RULE },
+    { "szkola.pl", 0x2f14cb59, PSL_RULE },
+    { "tt.im", 0x3de5cb57, PSL_RULE },
+    { "pet", 0xa301cb66, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nakagyo.kyoto.jp", 0xaf42cb69, PSL_RULE },
+    { "trading", 0x4e104b6a, PSL_RULE },
+    { "hu.net", 0x462e4b6b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ise.mie.jp", 0xb4140b6d, PSL_RULE },
+    { "mobi.ng", 0x7c7e0b6d, PSL_RULE },
+    { "no.com", 0x4a9a4b6d, PSL_RULE },
+    { "sk.ca", 0x7a3d0b6f, PSL_RULE },
+    { "xn--9dbq2a", 0xfb5a8b6e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "coolblog.jp", 0x4ebdcb74, PSL_RULE },
+    { "pictures", 0xc770cb74, PSL_RULE },
+    { "karacol.su", 0xcef18b76, PSL_RULE },
+    { "sch.id", 0xc7becb76, PSL_RULE },
+    { "ba.leg.br", 0x354b8b78, PSL_RULE },
+    { "ex.futurecms.at", 0x70514b79, PSL_WILDCARD },
+    { "bg.eu.org", 0x4c448b7a, PSL_RULE },
+    { "fjaler.no", 0x641e0b78, PSL_RULE },
+    { "123homepage.it", 0xb73a8b7c, PSL_RULE },
+    { "gd", 0x5a1ccb7c, PSL_RULE },
+    { "girly.jp", 0xbcd24b78, PSL_RULE },
+    { "loginline.io", 0x1c06cb7c, PSL_RULE },
+    { "pp.ru", 0x7f4f4b78, PSL_RULE },
+    { "solar", 0x43df4b7a, PSL_RULE },
+    { "sth.ac.at", 0xb288cb7f, PSL_RULE },
+    { "xn--kfjord-iua.no", 0x155dcb76, PSL_RULE },
+    { "schoenbrunn.museum", 0x34e20b84, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.id.us", 0x56894b86, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hosting.myjino.ru", 0x7ff04b88, PSL_WILDCARD },
+    { "name.tt", 0x93904b88, PSL_RULE },
+    { "exhibition.museum", 0x8861cb8a, PSL_RULE },
+    { "h.bg", 0xd9d68b8a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "suedtirol.it", 0xf4ea0b8f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "s3-website-ap-southeast-2.amazonaws.com", 0xfb358b91, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--rros-gra.no", 0xba168b97, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.de", 0x736b0b9e, PSL_RULE },
+    { "cv", 0x4649cb9e, PSL_RULE },
+    { "economia.bo", 0xc6e8cb9f, PSL_RULE },
+    { "game", 0x0c748b9f, PSL_RULE },
+    { "tarui.gifu.jp", 0xa7d30b9f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "minamiyamashiro.kyoto.jp", 0x747c0ba5, PSL_RULE },
+    { "takasu.hokkaido.jp", 0x29308ba6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "joyo.kyoto.jp", 0x8e61cba8, PSL_RULE },
+    { "cityeats", 0xf1414ba9, PSL_RULE },
+    { "potenza.it", 0x1de40ba9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "slz.br", 0xba718bac, PSL_RULE },
+    { "fhs.no", 0xd8a04bad, PSL_RULE },
+    { "from-va.com", 0x28f74bae, PSL_RULE },
+    { "joinville.br", 0xe3984baf, PSL_RULE },
+    { "handson.museum", 0x0a684bb0, PSL_RULE },
+    { "or.ug", 0x7b50cbae, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dnepropetrovsk.ua", 0x86470bb5, PSL_RULE },
+    { "gx.cn", 0x2cce0bb5, PSL_RULE },
+    { "ally", 0xa7c64bb7, PSL_RULE },
+    { "okinawa.jp", 0x2f6f8bb5, PSL_RULE },
+    { "xn--fjq720a", 0x4070cbb6, PSL_RULE },
+    { "com.ht", 0x00cb4bba, PSL_RULE },
+    { "kahoku.ishikawa.jp", 0xa4cc4bbb, PSL_RULE },
+    { "media.pl", 0x20ea8bbb, PSL_RULE },
+    { "web.ni", 0x678c4bba, PSL_RULE },
+    { "tsuruga.fukui.jp", 0x0adc8bbe, PSL_RULE },
+    { "land-4-sale.us", 0x9c3e0bbf, PSL_RULE },
+    { "edu.gn", 0x33a1cbc0, PSL_RULE },
+    { "ferrara.it", 0x6c7d0bc1, PSL_RULE },
+    { "pg", 0x4f208bc2, PSL_WILDCARD },
+    { "blogspot.ie", 0x41e30bc3, PSL_RULE },
+    { "hakodate.hokkaido.jp", 0xdf9e4bc4, PSL_RULE },
+    { "vindafjord.no", 0x644a8bc1, PSL_RULE },
+    { "vn", 0x4b364bc5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.sa", 0xb8170bc8, PSL_RULE },
+    { "shingo.aomori.jp", 0xb2a4cbc8, PSL_RULE },
+    { "xn--mtta-vrjjat-k7af.no", 0x563ccbc8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bj.cn", 0x0fab4bcc, PSL_RULE },
+    { "minamiboso.chiba.jp", 0x355b0bcc, PSL_RULE },
+    { "vxl.sh", 0x3619cbcc, PSL_RULE },
+    { "io.kg", 0xd4e14bcf, PSL_RULE },
+    { "xin", 0x19a40bd0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nagaokakyo.kyoto.jp", 0x5a554bd4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.hr", 0x0be80bd7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "office", 0xd6790bd9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--o1ac.xn--90a3ac", 0x41914bdc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blue", 0xa26a4be1, PSL_RULE },
+    { "asahi.toyama.jp", 0xb5028be2, PSL_RULE },
+    { "kaneyama.fukushima.jp", 0x98838be3, PSL_RULE },
+    { "prudential", 0xfc5a0be3, PSL_RULE },
+    { "hacca.jp", 0x60988be5, PSL_RULE },
+    { "com.vn", 0x6113cbe6, PSL_RULE },
+    { "fuji.shizuoka.jp", 0xbffb8be7, PSL_RULE },
+    { "ac.id", 0x066d4be8, PSL_RULE },
+    { "dray-dns.de", 0x38920be8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "knightpoint.systems", 0x94928bee, PSL_RULE },
+    { "artcenter.museum", 0x586a4bef, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "singles", 0x1c51cbf2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.io", 0x15410bf6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "otari.nagano.jp", 0x17dc0bf8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "at.md", 0x557c4bfb, PSL_RULE },
+    { "kami.kochi.jp", 0x00760bfb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kahoku.yamagata.jp", 0x68e78bff, PSL_RULE },
+    { "gotemba.shizuoka.jp", 0xb07ecc00, PSL_RULE },
+    { "mil.az", 0x13408c00, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.zm", 0x82808c06, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "app.lmpm.com", 0xac5b8c09, PSL_RULE },
+    { "diskstation.eu", 0xdd324c0a, PSL_RULE },
+    { "k8s.pl-waw.scw.cloud", 0x10dbcc09, PSL_RULE },
+    { "richardli", 0xaee28c0b, PSL_RULE },
+    { "vipsinaapp.com", 0x56f90c0b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.ec", 0x0c5f4c10, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nl-ams-1.baremetal.scw.cloud", 0xc2258c16, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloud9.af-south-1.amazonaws.com", 0x9bd20c18, 0 },
+    { "th", 0x4d3acc19, PSL_RULE },
+    { "xn--trany-yua.no", 0xde534c1a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.ba", 0x8b258c1c, PSL_RULE },
+    { "df.leg.br", 0x3d3ecc1d, PSL_RULE },
+    { "gov.me", 0xed744c1d, PSL_RULE },
+    { "gs.fm.no", 0x6c0c8c1f, PSL_RULE },
+    { "chigasaki.kanagawa.jp", 0xabac4c20, PSL_RULE },
+    { "hosted-by-previder.com", 0x936bcc1f, 0 },
+    { "kanzaki.saga.jp", 0x640e8c1e, PSL_RULE },
+    { "prochowice.pl", 0x53300c1e, PSL_RULE },
+    { "herad.no", 0x2744cc24, PSL_RULE },
+    { "app.render.com", 0x500d0c25, PSL_RULE },
+    { "philips", 0x111b8c26, PSL_RULE },
+    { "int.in", 0x9c89cc27, PSL_RULE },
+    { "oksnes.no", 0x631dcc27, PSL_RULE },
+    { "on-k3s.io", 0x91ab0c28, PSL_WILDCARD },
+    { "seiro.niigata.jp", 0xa9d7cc20, PSL_RULE },
+    { "ha.no", 0xa7bf4c2b, PSL_RULE },
+    { "wnext.app", 0x17e88c22, PSL_RULE },
+    { NULL, 0, 0 },
+    { "messina.it", 0x52c44c2e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "toyono.osaka.jp", 0x8915cc30, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "circle", 0xa7918c35, PSL_RULE },
+    { "sicily.it", 0xbd18cc35, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fujimino.saitama.jp", 0x8f334c38, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hasuda.saitama.jp", 0xc9a18c3b, PSL_RULE },
+    { "dev.br", 0x0f0e8c3c, PSL_RULE },
+    { "group", 0xf6728c3c, PSL_RULE },
+    { "saintlouis.museum", 0x75f80c3c, PSL_RULE },
+    { "equipment", 0xac75cc3f, PSL_RULE },
+    { "kamimine.saga.jp", 0xd1d7cc40, PSL_RULE },
+    { "hachinohe.aomori.jp", 0x80bd8c41, PSL_RULE },
+    { "love", 0x0cebcc41, PSL_RULE },
+    { "mil.lv", 0x7de7cc43, PSL_RULE },
+    { "aramco", 0x251f4c44, PSL_RULE },
+    { "ddnsking.com", 0x4e988c44, PSL_RULE },
+    { "flight.aero", 0x7dc5cc46, PSL_RULE },
+    { "iwafune.tochigi.jp", 0x772c4c45, PSL_RULE },
+    { "k12.va.us", 0x237a0c46, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pnc", 0xf88a0c4c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "musashino.tokyo.jp", 0xcd404c52, PSL_RULE },
+    { "nalchik.su", 0xf3220c53, PSL_RULE },
+    { "nishikatsura.yamanashi.jp", 0x9a7bcc54, PSL_RULE },
+    { "cern", 0x276a4c55, PSL_RULE },
+    { "xn--mgbbh1a71e", 0xda0dcc52, PSL_RULE },
+    { NULL, 0, 0 },
+    { "in.th", 0xd46b4c58, PSL_RULE },
+    { "recreation.aero", 0xcbf7cc58, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "browsersafetymark.io", 0x98f60c5c, PSL_RULE },
+    { "birkenes.no", 0x64e60c5d, PSL_RULE },
+    { "functions.fnc.fr-par.scw.cloud", 0x76448c5d, PSL_RULE },
+    { "sugito.saitama.jp", 0xf80a8c5c, PSL_RULE },
+    { "bando.ibaraki.jp", 0xa97dcc60, PSL_RULE },
+    { "malatvuopmi.no", 0x59520c61, PSL_RULE },
+    { "powiat.pl", 0x19e04c61, PSL_RULE },
+    { "trafficplex.cloud", 0xa7234c60, PSL_RULE },
+    { "com.sg", 0xa35c0c64, PSL_RULE },
+    { "under.jp", 0x6ab20c63, PSL_RULE },
+    { "edu.ar", 0x72784c66, PSL_RULE },
+    { "net.am", 0x6d844c66, PSL_RULE },
+    { "blogsite.org", 0x8dd80c68, PSL_RULE },
+    { "orsta.no", 0x21698c67, PSL_RULE },
+    { "pages.dev", 0xd9224c66, PSL_RULE },
+    { "leadpages.co", 0x472b0c6b, PSL_RULE },
+    { "sasaguri.fukuoka.jp", 0x9adc4c6c, PSL_RULE },
+    { "wmcloud.org", 0xd6ac4c62, PSL_RULE },
+    { "geo.br", 0x4ea8cc6e, PSL_RULE },
+    { "xn--90ae", 0x7498cc68, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--vler-qoa.hedmark.no", 0xebd04c71, PSL_RULE },
+    { "frontier", 0x6cf54c72, PSL_RULE },
+    { "joburg", 0xef1e8c72, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.az", 0xeae8cc76, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--ldingen-q1a.no", 0x0eb00c79, PSL_RULE },
+    { "res.aero", 0xffaa0c7a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vultrobjects.com", 0x69724c7d, PSL_WILDCARD },
+    { "moriyoshi.akita.jp", 0xcd164c7e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ai.in", 0xafa08c80, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cherkasy.ua", 0x63d40c83, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aibetsu.hokkaido.jp", 0x2c784c88, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lcube-server.de", 0x9f1b4c8b, PSL_RULE },
+    { "manaus.br", 0x12490c8c, PSL_RULE },
+    { "sa.gov.au", 0x0417cc8d, PSL_RULE },
+    { "u2-local.xnbay.com", 0xd75b8c8b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ybo.party", 0x3d2c0c91, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.pr", 0x5d740c95, PSL_RULE },
+    { "pixolino.com", 0x0de60c96, PSL_RULE },
+    { "from-nv.com", 0xac0acc97, PSL_RULE },
+    { "praxi", 0x97cccc95, PSL_RULE },
+    { "indiana.museum", 0xcc370c99, PSL_RULE },
+    { "mito.ibaraki.jp", 0x88438c99, PSL_RULE },
+    { "press.ma", 0xf8168c9a, PSL_RULE },
+    { "ullensaker.no", 0x9d3d8c9c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.ls", 0xcbddcca2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rendalen.no", 0x19ae4ca5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pubol.museum", 0xee7b8ca7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "draydns.de", 0xf2bf4ca9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "minamimaki.nagano.jp", 0xdcb94cac, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "soccer", 0x1d14ccb0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net-freaks.com", 0x29de0cb2, PSL_RULE },
+    { "omaha.museum", 0x16ef4cb3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nt.au", 0xa5658cb5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "berkeley.museum", 0xc7f24cba, PSL_RULE },
+    { "yoichi.hokkaido.jp", 0x6588ccba, PSL_RULE },
+    { "koobin.events", 0x597cccbc, PSL_RULE },
+    { "vfs.cloud9.ca-central-1.amazonaws.com", 0x8c7f8cbc, PSL_RULE },
+    { "cafe", 0x1e29ccbe, PSL_RULE },
+    { "xn--tnsberg-q1a.no", 0x7a7e4cbf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.ae", 0xf7420cc1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "motobu.okinawa.jp", 0xe79eccc5, PSL_RULE },
+    { "plc.co.im", 0x0284ccc6, PSL_RULE },
+    { "abeno.osaka.jp", 0xc42d0cc7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bjerkreim.no", 0xd3ab0cc9, PSL_RULE },
+    { "mel.cloudlets.com.au", 0x54430cc9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cranky.jp", 0x75190ccd, PSL_RULE },
+    { "kani.gifu.jp", 0xa8c20ccd, PSL_RULE },
+    { "earth", 0x0d5a8ccf, PSL_RULE },
+    { "hs.kr", 0xe54ccccf, PSL_RULE },
+    { "hs.run", 0x9f16cccf, PSL_RULE },
+    { "shibetsu.hokkaido.jp", 0xec4fccd0, PSL_RULE },
+    { "supabase.co", 0x76a88cd1, PSL_RULE },
+    { "bizen.okayama.jp", 0x38688cd4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dh.bytemark.co.uk", 0x7ecdccd8, PSL_RULE },
+    { "mallorca.museum", 0xb5b2ccd8, PSL_RULE },
+    { "med.br", 0x55b20cd9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "web.app", 0xd45f0cdc, PSL_RULE },
+    { "is-a-caterer.com", 0x8cb08cdd, PSL_RULE },
+    { "lt", 0x45454cdd, PSL_RULE },
+    { "com.uz", 0xead04cdf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "toda.saitama.jp", 0x9fd90ce1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tamamura.gunma.jp", 0x6721cce3, PSL_RULE },
+    { "nord-odal.no", 0x0e930ce4, PSL_RULE },
+    { "gives", 0x2e658ce5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "usa.museum", 0xff694ce8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rahkkeravju.no", 0x267f0cea, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.do", 0x642dccef, PSL_RULE },
+    { "futurecms.at", 0x725a8cf0, PSL_WILDCARD },
+    { "physio", 0x65ad0cf1, PSL_RULE },
+    { "ciscofreak.com", 0xfd70ccf2, PSL_RULE },
+    { "boutir.com", 0x07c2ccf3, PSL_RULE },
+    { "hellas.museum", 0xf575ccf4, PSL_RULE },
+    { "kagami.kochi.jp", 0x41c84cf3, PSL_RULE },
+    { "togitsu.nagasaki.jp", 0xd3f50cf1, PSL_RULE },
+    { "kurashiki.okayama.jp", 0x2cf8ccf7, PSL_RULE },
+    { "yamagata.jp", 0xc1014cf6, PSL_RULE },
+    { "gov.bt", 0x052f4cf9, PSL_RULE },
+    { "crotone.it", 0x4812ccfa, PSL_RULE },
+    { "mil.kg", 0x22448cfb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "framer.app", 0x69720cfd, PSL_RULE },
+    { "azure-mobile.net", 0xa3d48cfe, PSL_RULE },
+    { "securitytactics.com", 0x97720cff, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gl", 0x4a31cd04, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pages.wiardweb.com", 0x1fb60d09, PSL_RULE },
+    { "sc.ls", 0xad670d0a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.dm", 0x7dd18d0d, PSL_RULE },
+    { "barsy.club", 0xffe1cd0e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nog.community", 0x3b5f4d10, PSL_RULE },
+    { "edu.pf", 0xbaa70d11, PSL_RULE },
+    { "xn--h3cuzk1di.xn--o3cw4h", 0x439d0d11, PSL_RULE },
+    { "fukumitsu.toyama.jp", 0xccff4d13, PSL_RULE },
+    { "songdalen.no", 0x29fe4d13, PSL_RULE },
+    { "yukuhashi.fukuoka.jp", 0xd1158d14, PSL_RULE },
+    { "fairwinds", 0xdd904d16, PSL_RULE },
+    { NULL, 0, 0 },
+    { "takko.aomori.jp", 0x34c10d18, PSL_RULE },
+    { "tysnes.no", 0x58404d18, PSL_RULE },
+    { "youth.museum", 0x31190d18, PSL_RULE },
+    { NULL, 0, 0 },
+    { "music", 0xaf264d1c, PSL_RULE },
+    { "i.bg", 0xdad68d1d, PSL_RULE },
+    { "settlement.museum", 0x0caf0d1c, PSL_RULE },
+    { "chesapeakebay.museum", 0x810e4d1f, PSL_RULE },
+    { "apartments", 0xaaa64d20, PSL_RULE },
+    { "xn--d1alf", 0x2c8f4d1f, PSL_RULE },
+    { "xn--sr-aurdal-l8a.no", 0x144d4d21, PSL_RULE },
+    { NULL, 0, 0 },
+    { "instances.spawn.cc", 0x5242cd24, PSL_RULE },
+    { NULL, 0, 0 },
+    { "webview-assets.cloud9.eu-west-1.amazonaws.com", 0x11af0d26, PSL_RULE },
+    { "zhitomir.ua", 0x64c18d27, PSL_RULE },
+    { NULL, 0, 0 },
+    { "avocat.fr", 0x5a818d29, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nara.nara.jp", 0x382ecd2f, PSL_RULE },
+    { "school.za", 0xba5c4d30, PSL_RULE },
+    { "bv", 0x4749cd31, PSL_RULE },
+    { "eidsberg.no", 0x25fbcd31, PSL_RULE },
+    { "fujikawa.yamanashi.jp", 0xbad20d32, PSL_RULE },
+    { "consulado.st", 0xf5bc0d34, PSL_RULE },
+    { "cn.in", 0xd9a30d35, PSL_RULE },
+    { "mino.gifu.jp", 0xa7c70d31, PSL_RULE },
+    { "tcm.museum", 0xa29f4d2f, PSL_RULE },
+    { "tochigi.jp", 0x805ccd38, PSL_RULE },
+    { "xn--zf0avx.hk", 0xdce30d37, PSL_RULE },
+    { NULL, 0, 0 },
+    { "olayan", 0xa3148d3b, PSL_RULE },
+    { "co.cl", 0x9c9ecd3c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-a-bulls-fan.com", 0x835e0d3f, PSL_RULE },
+    { "ac.be", 0xde90cd40, PSL_RULE },
+    { NULL, 0, 0 },
+    { "afl", 0x5568cd42, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "buzz", 0xbf448d46, PSL_RULE },
+    { "xn--nnx388a", 0x4c030d47, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kamiichi.toyama.jp", 0xb5c48d49, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "prequalifyme.today", 0x329b4d4e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "emerck", 0xf2308d50, PSL_RULE },
+    { NULL, 0, 0 },
+    { "is-very-bad.org", 0xba1a0d52, PSL_RULE },
+    { "ac.pr", 0xe5310d53, PSL_RULE },
+    { "flora.no", 0x37a28d54, PSL_RULE },
+    { "org.tj", 0xd00d0d53, PSL_RULE },
+    { "katano.osaka.jp", 0x2dc9cd56, PSL_RULE },
+    { NULL, 0, 0 },
+    { "s3-website-eu-west-1.amazonaws.com", 0x40cf8d58, PSL_RULE },
+    { "xn--hyanger-q1a.no", 0xc0648d58, PSL_RULE },
+    { NULL, 0, 0 },
+    { "geelvinck.museum", 0x3bef4d5b, PSL_RULE },
+    { "dualstack.ap-southeast-2.amazonaws.com", 0xd4068d5c, 0 },
+    { NULL, 0, 0 },
+    { "environmentalconservation.museum", 0x36328d5e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sekigahara.gifu.jp", 0x105acd60, PSL_RULE },
+    { "xn--krdsherad-m8a.no", 0x0fe50d61, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloud9.us-east-1.amazonaws.com", 0x69b88d63, 0 },
+    { "is-a-painter.com", 0xb76c8d64, PSL_RULE },
+    { "nationalheritage.museum", 0x75c68d64, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nanae.hokkaido.jp", 0x3596cd6a, PSL_RULE },
+    { "blogdns.com", 0xa24e0d6b, PSL_RULE },
+    { "chattanooga.museum", 0xd21f4d6c, PSL_RULE },
+    { "nakamura.kochi.jp", 0x338e8d6b, PSL_RULE },
+    { "blogspot.ch", 0x233f8d6e, PSL_RULE },
+    { "sca", 0x324a4d6a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "raholt.no", 0x7faa4d72, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "soy", 0x4eb8cd76, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vfs.cloud9.us-east-1.amazonaws.com", 0xb9e30d78, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fermo.it", 0x087e4d7d, PSL_RULE },
+    { "usculture.museum", 0xa3c48d7d, PSL_RULE },
+    { "endoftheinternet.org", 0x4ffdcd7f, PSL_RULE },
+    { "co.gl", 0xfe948d80, PSL_RULE },
+    { "futurehosting.at", 0xa2a80d7f, PSL_RULE },
+    { "likes-pie.com", 0x75504d7f, PSL_RULE },
+    { "prod.fastly.net", 0xde8b8d82, 0 },
+    { NULL, 0, 0 },
+    { "australia.museum", 0xfa554d85, PSL_RULE },
+    { "koshimizu.hokkaido.jp", 0x5d744d86, PSL_RULE },
+    { "wanggou", 0x30d20d87, PSL_RULE },
+    { "mil.mv", 0x146e8d88, PSL_RULE },
+    { NULL, 0, 0 },
+    { "esashi.hokkaido.jp", 0xaa5b4d8a, PSL_RULE },
+    { "amsterdam.museum", 0xde034d8b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "biz.at", 0x662d0d8d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "malbork.pl", 0x981c0d91, PSL_RULE },
+    { "kiyokawa.kanagawa.jp", 0x9e51cd92, PSL_RULE },
+    { "karate.museum", 0x79f34d93, PSL_RULE },
+    { "kosher", 0x98da8d93, PSL_RULE },
+    { "my-vigor.de", 0x7aa20d92, PSL_RULE },
+    { "ovh", 0x0989cd94, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chimkent.su", 0x31ab4d9c, PSL_RULE },
+    { "ulsan.kr", 0xded18d9d, PSL_RULE },
+    { "kasserver.com", 0xd2168d9e, PSL_RULE },
+    { "k12.ma.us", 0x85748d9f, PSL_RULE },
+    { "matsuyama.ehime.jp", 0xc8a48d9f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.gh", 0x91c3cda2, PSL_RULE },
+    { "hamar.no", 0x77e78da3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "delmenhorst.museum", 0x1773cda8, PSL_RULE },
+    { "xn--valleaoste-e7a.it", 0x9e6e4da8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mil.co", 0x560c0dab, PSL_RULE },
+    { "genkai.saga.jp", 0x51720dac, PSL_RULE },
+    { "sh", 0x4e3acdac, PSL_RULE },
+    { "so.gov.pl", 0x8a830dad, PSL_RULE },
+    { "vennesla.no", 0xd3d2cdac, PSL_RULE },
+    { "atlassian-dev.net", 0x3a888db0, 0 },
+    { "edu.dz", 0x5b6b4db1, PSL_RULE },
+    { "biz.pl", 0x47340db2, PSL_RULE },
+    { "me.us", 0x70124db3, PSL_RULE },
+    { "hzc.io", 0xe0260db4, PSL_RULE },
+    { "kaizuka.osaka.jp", 0x51218db4, PSL_RULE },
+    { "xn--4dbrk0ce", 0xfeed8db4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "members.linode.com", 0x4e664db8, PSL_RULE },
+    { "freedesktop.org", 0xabfccdb9, PSL_RULE },
+    { "shiwa.iwate.jp", 0xc752cdb9, PSL_RULE },
+    { "tsuga.tochigi.jp", 0xa2bf4dba, PSL_RULE },
+    { NULL, 0, 0 },
+    { "yoshimi.saitama.jp", 0x22f90dbd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.jp", 0xb1884dbf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gripe", 0x56c38dc4, PSL_RULE },
+    { "omotego.fukushima.jp", 0xec9d4dc4, PSL_RULE },
+    { "jetzt", 0x764acdc6, PSL_RULE },
+    { "urn.arpa", 0x37da4dc4, PSL_RULE },
+    { "is-a-rockstar.com", 0xa8368dc8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--rennesy-v1a.no", 0x6ebb0dcb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lombardia.it", 0xae0dcdcd, PSL_RULE },
+    { "users.scale.virtualcloud.com.br", 0x6c510dce, PSL_RULE },
+    { "platform.sh", 0xa5a58dcf, 0 },
+    { "myspreadshop.co.uk", 0xe3584dd0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kosaka.akita.jp", 0x4ef50dd7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "assisi.museum", 0x87374dd9, PSL_RULE },
+    { "friuliv-giulia.it", 0x589c8dd9, PSL_RULE },
+    { "org.eg", 0xe143cdd9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pink", 0x4d504ddd, PSL_RULE },
+    { "edgekey.net", 0x917acdde, PSL_RULE },
+    { "0emm.com", 0xbab4cddf, PSL_WILDCARD },
+    { "aomori.jp", 0x05d64de0, PSL_RULE },
+    { "chofu.tokyo.jp", 0x14290de0, PSL_RULE },
+    { "nanbu.yamanashi.jp", 0x7bf94de2, PSL_RULE },
+    { "xn--5su34j936bgsg", 0x32130de2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloud9.me-south-1.amazonaws.com", 0xb31c8de5, 0 },
+    { "ac.in", 0xb3888de6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "town", 0x5e6e4de9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "plantation.museum", 0x11758deb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nj.us", 0x9323cded, PSL_RULE },
+    { "cust.retrosnub.co.uk", 0x15cd0dee, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cricket", 0xf5be4df0, PSL_RULE },
+    { "day", 0x55a9cdf1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "toyokawa.aichi.jp", 0x8b108df6, PSL_RULE },
+    { "fitness", 0x69b08df7, PSL_RULE },
+    { "hattfjelldal.no", 0x38dd4df7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "coop", 0x9edd8dfa, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.so", 0xf6678dfc, PSL_RULE },
+    { "org.br", 0xbfd94dfd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bifuka.hokkaido.jp", 0x57330dff, PSL_RULE },
+    { "samnanger.no", 0xce980e00, PSL_RULE },
+    { "shirataka.yamagata.jp", 0x9dcd0e00, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bluebite.io", 0x9708ce0b, PSL_RULE },
+    { "from-ky.com", 0xe5cd4e0b, PSL_RULE },
+    { "jogasz.hu", 0xb9a4ce0c, PSL_RULE },
+    { "buyshouses.net", 0x6d004e0e, PSL_RULE },
+    { "from-tx.com", 0x04170e0f, PSL_RULE },
+    { "kasahara.gifu.jp", 0x91f44e10, PSL_RULE },
+    { "nyc.mn", 0xffdb0e0c, PSL_RULE },
+    { "s3.dualstack.eu-west-2.amazonaws.com", 0x6c350e0e, PSL_RULE },
+    { "rieti.it", 0x19fa4e13, PSL_RULE },
+    { "sa.it", 0x485d0e10, PSL_RULE },
+    { "cc.co.us", 0x2d5c8e15, PSL_RULE },
+    { "mitsuke.niigata.jp", 0x0bf48e16, PSL_RULE },
+    { "gen.tr", 0xb75dce17, PSL_RULE },
+    { "modalen.no", 0x9a724e18, PSL_RULE },
+    { "com.zm", 0x36690e19, PSL_RULE },
+    { "niepce.museum", 0xc8f24e15, PSL_RULE },
+    { "sfr", 0x3ffcce0e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--g2xx48c", 0x180b0e1d, PSL_RULE },
+    { "sas", 0xd31c8e1e, PSL_RULE },
+    { "xn--vermgensberater-ctb", 0x063a4e1f, PSL_RULE },
+    { "is-a-designer.com", 0x2f528e20, PSL_RULE },
+    { "takinoue.hokkaido.jp", 0xe59b8e21, PSL_RULE },
+    { "user.srcf.net", 0xf652ce21, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.tz", 0x6c974e27, PSL_RULE },
+    { "kamikitayama.nara.jp", 0x7d880e28, PSL_RULE },
+    { "frogans", 0xa1d94e29, PSL_RULE },
+    { "daejeon.kr", 0xbdb18e2a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--sdtirol-n2a.it", 0x5f994e2f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ciao.jp", 0x2ef40e33, PSL_RULE },
+    { "lavangen.no", 0xc9874e34, PSL_RULE },
+    { "xn--vard-jra.no", 0x1d040e35, PSL_RULE },
+    { "co.ve", 0xf1690e36, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "beardu.no", 0xb9988e39, PSL_RULE },
+    { "dnsking.ch", 0x84454e3a, PSL_RULE },
+    { "gal", 0x5f608e3b, PSL_RULE },
+    { "valleeaoste.it", 0xa8908e3b, PSL_RULE },
+    { "capitalone", 0x02d4ce3d, PSL_RULE },
+    { "workers.dev", 0xa1df4e39, PSL_RULE },
+    { NULL, 0, 0 },
+    { "elburg.museum", 0x11024e40, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cadaques.museum", 0x6361ce42, PSL_RULE },
+    { NULL, 0, 0 },
+    { "app", 0x5a7f4e44, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ainan.ehime.jp", 0xc5414e46, PSL_RULE },
+    { "komatsu", 0x9e03ce47, PSL_RULE },
+    { "ru", 0x45430e46, PSL_RULE },
+    { "xn--flor-jra.no", 0x461a8e49, PSL_RULE },
+    { "uk.in", 0xd79c4e4a, PSL_RULE },
+    { "mykolaiv.ua", 0x3cdcce4b, PSL_RULE },
+    { "tours", 0xeab00e4c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--mgbaam7a8h", 0x19760e50, PSL_RULE },
+    { "sm", 0x562e0e51, PSL_RULE },
+    { "udine.it", 0xccf44e51, PSL_RULE },
+    { "gov.lt", 0x079b8e53, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "usgarden.museum", 0x63864e56, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "art.sn", 0xa7dfce59, PSL_RULE },
+    { NULL, 0, 0 },
+    { "s3-ap-northeast-2.amazonaws.com", 0x306a8e5b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "coop.in", 0x51bd4e5d, PSL_RULE },
+    { "daiwa.hiroshima.jp", 0x2c714e5d, PSL_RULE },
+    { "com.in", 0x197bce5f, PSL_RULE },
+    { "drud.io", 0x1b34ce60, PSL_RULE },
+    { "gr.com", 0x21b44e5f, PSL_RULE },
+    { "khmelnytskyi.ua", 0x067e8e61, PSL_RULE },
+    { "mil.kr", 0x2658ce62, PSL_RULE },
+    { "med.pa", 0x31e28e64, PSL_RULE },
+    { "xn--qcka1pmc", 0xd1434e5e, PSL_RULE },
+    { "hlx.page", 0x9cbe4e66, PSL_RULE },
+    { "joetsu.niigata.jp", 0xe86e4e66, PSL_RULE },
+    { NULL, 0, 0 },
+    { "city.kobe.jp", 0xbeeb0e69, PSL_EXCEPTION },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.ok.us", 0x34a74e6d, PSL_RULE },
+    { "galsa.no", 0xb2f48e6e, PSL_RULE },
+    { "matsushima.miyagi.jp", 0x72108e6d, PSL_RULE },
+    { "myjino.ru", 0x91268e70, PSL_RULE },
+    { "perso.tn", 0xea104e70, PSL_RULE },
+    { "st", 0x46454e70, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shangrila", 0x8f980e74, PSL_RULE },
+    { "hlx.live", 0xb45f4e75, PSL_RULE },
+    { "mond.jp", 0x87364e75, PSL_RULE },
+    { "watarai.mie.jp", 0x36904e77, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "judygarland.museum", 0x5053ce7a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "matsubara.osaka.jp", 0xf1d58e7c, PSL_RULE },
+    { "cloudns.info", 0x2a70ce7d, PSL_RULE },
+    { "blog.gt", 0x555c4e7e, PSL_RULE },
+    { "12hp.ch", 0xa2f34e7f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "desa.id", 0x2232ce81, PSL_RULE },
+    { "iwade.wakayama.jp", 0xd044ce81, PSL_RULE },
+    { "higashi.fukushima.jp", 0x82020e83, PSL_RULE },
+    { "midatlantic.museum", 0x48ac4e81, PSL_RULE },
+    { "va.us", 0x7907ce82, PSL_RULE },
+    { NULL, 0, 0 },
+    { "leksvik.no", 0xb0154e87, PSL_RULE },
+    { "healthcare", 0xa4d24e88, PSL_RULE },
+    { "nerdpol.ovh", 0x9a62ce88, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dvrcam.info", 0x91580e8c, PSL_RULE },
+    { "vet", 0xa501ce8c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ne.kr", 0xe364ce8f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "friuli-veneziagiulia.it", 0xc4520e91, PSL_RULE },
+    { "tax", 0xc2674e92, PSL_RULE },
+    { "zgorzelec.pl", 0xc34f0e92, PSL_RULE },
+    { NULL, 0, 0 },
+    { "4u.com", 0xf4a8ce95, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tuscany.it", 0xb0558e99, PSL_RULE },
+    { "edu.rs", 0xf38a0e9a, PSL_RULE },
+    { "boxfuse.io", 0x71654e9b, PSL_RULE },
+    { "net.ls", 0x54c4ce9b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "stuff-4-sale.us", 0xe8d8ce9e, PSL_RULE },
+    { "konskowola.pl", 0x0d348e9f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fukuroi.shizuoka.jp", 0xecca4ea4, PSL_RULE },
+    { "abudhabi", 0x938b4ea5, PSL_RULE },
+    { "lahppi.no", 0x78becea6, PSL_RULE },
+    { "nishinoomote.kagoshima.jp", 0xcb3ecea7, PSL_RULE },
+    { "nom.nc", 0x5a278ea4, PSL_RULE },
+    { "opencraft.hosting", 0xcaf90ea9, PSL_RULE },
+    { "audi", 0xdb194eaa, PSL_RULE },
+    { "notteroy.no", 0x82bb4eaa, PSL_RULE },
+    { "boavista.br", 0x4516ceac, PSL_RULE },
+    { "cc.sd.us", 0xddf20eac, PSL_RULE },
+    { "hn.cn", 0x31b60eae, PSL_RULE },
+    { "forum.hu", 0xa8b54eaf, PSL_RULE },
+    { "akaiwa.okayama.jp", 0x42a30eb0, PSL_RULE },
+    { "tonami.toyama.jp", 0xfcac0eb0, PSL_RULE },
+    { "v.bg", 0xdbd68eb0, PSL_RULE },
+    { "verona.it", 0x8369cea5, PSL_RULE },
+    { "org.py", 0xff9e0eb4, PSL_RULE },
+    { "xn--ntsq17g.jp", 0xe30d0eb2, PSL_RULE },
+    { "yokoshibahikari.chiba.jp", 0x2071ceaf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "app.br", 0x70b68eb8, PSL_RULE },
+    { "bitter.jp", 0x8410ceb9, PSL_RULE },
+    { "consulting", 0x16d30eb9, PSL_RULE },
+    { "otobe.hokkaido.jp", 0x32ca0eb8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.af", 0x1a9fcebf, PSL_RULE },
+    { "sakuragawa.ibaraki.jp", 0xaa0d0ebf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "foggia.it", 0x10958ec5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tamakawa.fukushima.jp", 0xdbf34ec7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edgesuite.net", 0x8a430ec9, PSL_RULE },
+    { "services", 0x9a27cec9, PSL_RULE },
+    { "finland.museum", 0xbdd0cecb, PSL_RULE },
+    { "guardian", 0xcb1f4ecc, PSL_RULE },
+    { "iglesiascarbonia.it", 0xac9d4ecc, PSL_RULE },
+    { "dealer", 0x940a4ece, PSL_RULE },
+    { "her.jp", 0x8fc34ece, PSL_RULE },
+    { "blogspot.co.il", 0xfd5f0ed0, PSL_RULE },
+    { "lebork.pl", 0xdd040ecc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ap-northeast-3.amazonaws.com", 0xbc77ced3, 0 },
+    { "linz.museum", 0x013f4ed4, PSL_RULE },
+    { "t3l3p0rt.net", 0x6d22ced4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--54b7fta0cc", 0xca374ed8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.bm", 0xe6790edc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "balsan-suedtirol.it", 0x39c68edf, PSL_RULE },
+    { "odo.br", 0x26a64edf, PSL_RULE },
+    { "shikatsu.aichi.jp", 0x5544cedf, PSL_RULE },
+    { "yamato.kumamoto.jp", 0xac53cedf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "heavy.jp", 0xf0f38ee6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "int.ve", 0x80a10ee9, PSL_RULE },
+    { "edu.mz", 0xcd784eea, PSL_RULE },
+    { NULL, 0, 0 },
+    { "customer-oci.com", 0x51470eec, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "p.se", 0xad788eef, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "valled-aosta.it", 0x9d4ecef5, PSL_RULE },
+    { "seven", 0x09c94ef6, PSL_RULE },
+    { "spjelkavik.no", 0x8cb68ef6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shirako.chiba.jp", 0x9b310efd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mutsu.aomori.jp", 0xc7ff0f00, PSL_RULE },
+    { NULL, 0, 0 },
+    { "platter-app.com", 0x5fc10f02, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "biz.ki", 0x86294f06, PSL_RULE },
+    { NULL, 0, 0 },
+    { "doomdns.com", 0x1a014f08, PSL_RULE },
+    { "webview-assets.cloud9.ap-northeast-1.amazonaws.com", 0x0576cf08, PSL_RULE },
+    { "fukushima.jp", 0xa6784f0a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.tx.us", 0xcf4a4f0c, PSL_RULE },
+    { "com.lk", 0x8d820f0d, PSL_RULE },
+    { "saxo", 0x5fbecf0e, PSL_RULE },
+    { "akune.kagoshima.jp", 0x31c20f0f, PSL_RULE },
+    { "niki.hokkaido.jp", 0x7f354f10, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nl-ams.scw.cloud", 0x6662cf13, 0 },
+    { "build.run", 0x02450f14, PSL_WILDCARD },
+    { "country", 0x29938f15, PSL_RULE },
+    { "flog.br", 0xe37e0f15, PSL_RULE },
+    { "omg.lol", 0xca624f13, PSL_RULE },
+    { "gp", 0x4a4e4f18, PSL_RULE },
+    { "si", 0x4e388f15, PSL_RULE },
+    { "utwente.io", 0xeecccf19, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.ks.us", 0x1ba4cf1e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "press.aero", 0xb19fcf23, PSL_RULE },
+    { "simplesite.com.br", 0x139ecf23, PSL_RULE },
+    { "xihuan", 0x79730f24, PSL_RULE },
+    { "com.bb", 0x5e0b0f26, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--42c2d9a", 0xd898cf28, PSL_RULE },
+    { "kuleuven.be", 0x4f228f29, 0 },
+    { NULL, 0, 0 },
+    { "slg.br", 0xd4230f2b, PSL_RULE },
+    { "wodzislaw.pl", 0x7791cf2b, PSL_RULE },
+    { "ina.nagano.jp", 0x80908f2d, PSL_RULE },
+    { "xn--comunicaes-v6a2o.museum", 0x536a0f2d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "primetel.cloud", 0x1fde0f30, PSL_RULE },
+    { "xn--ciqpn.hk", 0x8f130f31, PSL_RULE },
+    { "genoa.it", 0x163fcf32, PSL_RULE },
+    { "authgearapps.com", 0x22d38f33, PSL_RULE },
+    { "dyndns-at-home.com", 0x26598f34, PSL_RULE },
+    { "mayfirst.org", 0x93540f32, PSL_RULE },
+    { "s3.ca-central-1.amazonaws.com", 0x31c4cf35, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ups", 0xc9414f39, PSL_RULE },
+    { "vfs.cloud9.us-west-1.amazonaws.com", 0x22034f3a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aichi.jp", 0xa3124f3d, PSL_RULE },
+    { "taku.saga.jp", 0xdd248f3e, PSL_RULE },
+    { "uk.net", 0x64f6cf3e, PSL_RULE },
+    { "org.rs", 0xc0308f40, PSL_RULE },
+    { "pointto.us", 0x4888cf40, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ne.us", 0x71124f46, PSL_RULE },
+    { "barsy.support", 0xcac14f47, PSL_RULE },
+    { "gifu.jp", 0x8a2fcf48, PSL_RULE },
+    { "gotdns.com", 0xf6734f47, PSL_RULE },
+    { "lon.wafaicloud.com", 0x98b5cf48, PSL_RULE },
+    { "matsukawa.nagano.jp", 0x6b4acf49, PSL_RULE },
+    { "nh-serv.co.uk", 0x31960f48, PSL_RULE },
+    { "is-leet.com", 0xaa570f4d, PSL_RULE },
+    { "belem.br", 0xeb578f4e, PSL_RULE },
+    { "medio-campidano.it", 0x1db44f4f, PSL_RULE },
+    { "freebox-os.com", 0x5e4b0f50, PSL_RULE },
+    { "tsuchiura.ibaraki.jp", 0x42b14f50, PSL_RULE },
+    { "city.kawasaki.jp", 0x4149cf52, PSL_EXCEPTION },
+    { NULL, 0, 0 },
+    { "xn--b-5ga.nordland.no", 0x76704f54, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "phx.enscaled.us", 0x80a1cf58, PSL_RULE },
+    { "gov.tr", 0x107e0f59, PSL_RULE },
+    { "novara.it", 0x4a5b8f59, PSL_RULE },
+    { "os.hordaland.no", 0x210ecf5b, PSL_RULE },
+    { "blogspot.fi", 0x5082cf5c, PSL_RULE },
+    { "emp.br", 0x78a9cf5d, PSL_RULE },
+    { "gr.eu.org", 0x39150f5c, PSL_RULE },
+    { "kommunalforbund.se", 0x5a720f5d, PSL_RULE },
+    { "ozu.ehime.jp", 0x91030f59, PSL_RULE },
+    { "plurinacional.bo", 0xc26ccf5d, PSL_RULE },
+    { "minakami.gunma.jp", 0x9affcf62, PSL_RULE },
+    { "takaoka.toyama.jp", 0xf0b34f5a, PSL_RULE },
+    { "tozawa.yamagata.jp", 0x5a0bcf5c, PSL_RULE },
+    { "kragero.no", 0x0e990f65, PSL_RULE },
+    { "misato.miyagi.jp", 0x41470f66, PSL_RULE },
+    { "caa.aero", 0x67c8cf67, PSL_RULE },
+    { "higashikagura.hokkaido.jp", 0x6de70f67, PSL_RULE },
+    { "sogndal.no", 0x4ed00f66, PSL_RULE },
+    { "me.vu", 0xbf190f6a, PSL_RULE },
+    { "xn--seral-lra.no", 0xc8d0cf65, PSL_RULE },
+    { "yotsukaido.chiba.jp", 0xfd078f5e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--mgbc0a9azcg", 0x495b4f71, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pi.gov.br", 0xf9708f76, PSL_RULE },
+    { "hatogaya.saitama.jp", 0x3ac8cf77, PSL_RULE },
+    { "prime", 0xe3790f78, PSL_RULE },
+    { "dupont", 0x341acf79, PSL_RULE },
+    { "blogspot.com.tr", 0xd4cf0f7a, PSL_RULE },
+    { "takamatsu.kagawa.jp", 0x267c0f7a, PSL_RULE },
+    { "xn--mgba3a4fra", 0x05984f7b, PSL_RULE },
+    { "xn--bmlo-gra.no", 0x44500f7d, PSL_RULE },
+    { "suita.osaka.jp", 0xa7b70f7e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vpnplus.to", 0x65d78f80, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.fr", 0x2b7bcf82, PSL_RULE },
+    { "workshop.museum", 0x64644f82, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.nc.us", 0x0dc14f85, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.cw", 0x101e0f8a, PSL_RULE },
+    { "vfs.cloud9.af-south-1.amazonaws.com", 0x1e5a8f8b, PSL_RULE },
+    { "onjuku.chiba.jp", 0xd0a24f8c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "health.museum", 0xafdc0f8f, PSL_RULE },
+    { "edu.ml", 0x9d1e4f90, PSL_RULE },
+    { "usdecorativearts.museum", 0xecc74f91, PSL_RULE },
+    { "abbvie", 0xeb314f92, PSL_RULE },
+    { "santabarbara.museum", 0x8ffe0f93, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mining.museum", 0x42730f95, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tachikawa.tokyo.jp", 0x70dbcf9a, PSL_RULE },
+    { "int.az", 0xc5f70f9b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sony", 0x7adf0fa0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.pt", 0xf0c0cfa2, PSL_RULE },
+    { "ra.it", 0x495d0fa3, PSL_RULE },
+    { "hot", 0x9f10cfa4, PSL_RULE },
+    { "s3-sa-east-1.amazonaws.com", 0xfa45cfa4, PSL_RULE },
+    { "be.gy", 0xfe6b4fa6, PSL_RULE },
+    { "mil.hn", 0x9b42cfa7, PSL_RULE },
+    { "kunitomi.miyazaki.jp", 0xc56d8fa8, PSL_RULE },
+    { "accountant", 0x9f44cfa9, PSL_RULE },
+    { "com.fj", 0xbf38cfaa, PSL_RULE },
+    { "tsukuba.ibaraki.jp", 0x218e4fa5, PSL_RULE },
+    { "bonn.museum", 0x8b418fac, PSL_RULE },
+    { "edu.mx", 0x0d1a0fac, PSL_RULE },
+    { "peewee.jp", 0xb0b54fac, PSL_RULE },
+    { "surf", 0x8f8ccfad, PSL_RULE },
+    { "volda.no", 0x4f408fac, PSL_RULE },
+    { "id.ly", 0xe7494fb1, PSL_RULE },
+    { "biz.nr", 0x515ecfb2, PSL_RULE },
+    { "mil.iq", 0x67864fb3, PSL_RULE },
+    { "servemp3.com", 0x4bf44fb1, PSL_RULE },
+    { "politica.bo", 0x11978fb5, PSL_RULE },
+    { "xn--7t0a264c.jp", 0xca5bcfb4, PSL_RULE },
+    { "xn--loabt-0qa.no", 0x98008fab, PSL_RULE },
+    { "xn--mgbqly7cvafr", 0x856f4fae, PSL_RULE },
+    { "dolls.museum", 0x617ccfb9, PSL_RULE },
+    { "us-east-2.amazonaws.com", 0x0c594fba, 0 },
+    { "vfs.cloud9.ap-south-1.amazonaws.com", 0xfb2e0fb9, PSL_RULE },
+    { "photography", 0x97d28fbc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kokonoe.oita.jp", 0x5b010fbe, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "architecture.museum", 0x5940cfc4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "himeji.hyogo.jp", 0x13958fc7, PSL_RULE },
+    { "namsos.no", 0xfdac8fc7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "giving", 0x70074fcf, PSL_RULE },
+    { "uzhgorod.ua", 0x9f898fcf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.sb", 0xe8cacfd4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nanporo.hokkaido.jp", 0xcad38fd6, PSL_RULE },
+    { "net.dz", 0xdcc44fd6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bygland.no", 0x46de4fd9, PSL_RULE },
+    { "su", 0x46430fd9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "med", 0xd0598fdd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nishitosa.kochi.jp", 0xa03d4fdf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dyndns-web.com", 0xe9dd0fe3, PSL_RULE },
+    { "tm", 0x572e0fe4, PSL_RULE },
+    { "xn--90ais", 0xa4abcfe3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pictet", 0x6e028fea, PSL_RULE },
+    { "sumita.iwate.jp", 0x89e08fea, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yamaguchi.jp", 0x78ab0fef, PSL_RULE },
+    { "otoineppu.hokkaido.jp", 0xf3f74ff0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.ri.us", 0xa76d8ff3, PSL_RULE },
+    { "sbi", 0x80decff3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "uzs.gov.pl", 0x5a3e4ff9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sap", 0x64560ffb, PSL_RULE },
+    { "org.dm", 0x42e60ffc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "westeurope.azurestaticapps.net", 0x8b4b1000, PSL_RULE },
+    { "nv.us", 0x93405001, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lancashire.museum", 0x76ad5003, PSL_RULE },
+    { "gotsu.shimane.jp", 0x049c9004, PSL_RULE },
+    { "cc.pr.us", 0xab635005, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fi.it", 0x6d70d007, PSL_RULE },
+    { "blogspot.dk", 0xf61c1008, PSL_RULE },
+    { "yonaguni.okinawa.jp", 0xc9a81009, PSL_RULE },
+    { NULL, 0, 0 },
+    { "council.aero", 0xdc37d00b, PSL_RULE },
+    { "saitama.jp", 0xa388900b, PSL_RULE },
+    { "is-a-lawyer.com", 0x03a4d00d, PSL_RULE },
+    { "forli-cesena.it", 0x9438500e, PSL_RULE },
+    { "noor.jp", 0x9fdb100d, PSL_RULE },
+    { "show", 0x73b2900e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "wa.us", 0x7a07d015, PSL_RULE },
+    { "xn--gjvik-wua.no", 0x858d9015, PSL_RULE },
+    { "ostrowwlkp.pl", 0x0d915017, PSL_RULE },
+    { "is-certified.com", 0x64349018, PSL_RULE },
+    { "net.ms", 0x9c2a5018, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "panel.gg", 0xc9bd901f, PSL_RULE },
+    { "eastafrica.museum", 0xb9819020, PSL_RULE },
+    { "gov.al", 0xaa339020, PSL_RULE },
+    { "net.uz", 0x6cd31021, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "myspreadshop.net", 0x0faa902d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bar.pro", 0xa5e6d02f, PSL_RULE },
+    { "net.cy", 0xe5f9d030, PSL_RULE },
+    { "kakogawa.hyogo.jp", 0xefc31031, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.st", 0x80539034, PSL_RULE },
+    { "natal.br", 0xafee9035, PSL_RULE },
+    { "dubai", 0x12955036, PSL_RULE },
+    { "merckmsd", 0xe73e9037, PSL_RULE },
+    { NULL, 0, 0 },
+    { "friuli-ve-giulia.it", 0x82861039, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hirono.fukushima.jp", 0x8cab503d, PSL_RULE },
+    { "firm.in", 0x8ccf903e, PSL_RULE },
+    { "sells-it.net", 0xd5a9903d, PSL_RULE },
+    { "xn--4gbrim", 0x71419040, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "w.bg", 0xdcd69043, PSL_RULE },
+    { "green", 0x71039044, PSL_RULE },
+    { "neat-url.com", 0xe0605044, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nemuro.hokkaido.jp", 0x5f49d047, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tsuno.kochi.jp", 0x60ef904c, PSL_RULE },
+    { "est-mon-blogueur.com", 0xb99a504d, PSL_RULE },
+    { "j.layershift.co.uk", 0xe087d04e, PSL_RULE },
+    { "xn--j6w193g", 0x9974904e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "golffan.us", 0x4966d052, PSL_RULE },
+    { "gov.bz", 0x11c65053, PSL_RULE },
+    { "kijo.miyazaki.jp", 0x9445d053, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "iservschule.de", 0x6f809057, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gen.ng", 0xe700d05c, PSL_RULE },
+    { "spot", 0x4e8ad05d, PSL_RULE },
+    { "cc.ri.us", 0x5eaa505e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "akiruno.tokyo.jp", 0x19425060, PSL_RULE },
+    { "inabe.mie.jp", 0x368f1061, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "youtube", 0x98c61066, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pl.ua", 0x78aa506b, PSL_RULE },
+    { "ap-southeast-2.amazonaws.com", 0xfede906c, 0 },
+    { NULL, 0, 0 },
+    { "jx.cn", 0x2fce106e, PSL_RULE },
+    { "name.ng", 0x8a87506f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "izumi.kagoshima.jp", 0x72931075, PSL_RULE },
+    { "pvh.br", 0x14a9d075, PSL_RULE },
+    { "tagami.niigata.jp", 0x14245077, PSL_RULE },
+    { NULL, 0, 0 },
+    { "amakusa.kumamoto.jp", 0xc4739079, PSL_RULE },
+    { "gov.pn", 0x3e059079, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-a-teacher.com", 0xcc32d07f, PSL_RULE },
+    { "kamioka.akita.jp", 0xe0151080, PSL_RULE },
+    { "dontexist.org", 0xac1b9081, PSL_RULE },
+    { "s.se", 0xae789082, PSL_RULE },
+    { NULL, 0, 0 },
+    { "basel.museum", 0x1f115084, PSL_RULE },
+    { "biz.pk", 0xb5bb1085, PSL_RULE },
+    { "cc.in.us", 0xbbcf9084, PSL_RULE },
+    { "fukuyama.hiroshima.jp", 0x8a23d086, PSL_RULE },
+    { "edu.lc", 0xfc7d9088, PSL_RULE },
+    { "toyoura.hokkaido.jp", 0x76c39088, PSL_RULE },
+    { "voss.no", 0xbd949089, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.sv", 0x26be908e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sciencesnaturelles.museum", 0x11151091, PSL_RULE },
+    { NULL, 0, 0 },
+    { "niteroi.br", 0x60275093, PSL_RULE },
+    { "xn--hylandet-54a.no", 0x05a29094, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sorum.no", 0x3a821098, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "logoip.de", 0xfb3d909c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "coffee", 0xa5bbd0a1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "littlestar.jp", 0x4df3d0a3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nara.jp", 0xf20090ab, PSL_RULE },
+    { "sherbrooke.museum", 0x8b5ed0ab, PSL_RULE },
+    { "maori.nz", 0xd6a390ad, PSL_RULE },
+    { "nu.ca", 0x8d7dd0ae, PSL_RULE },
+    { "omniwe.site", 0x864f50ad, PSL_RULE },
+    { "state.museum", 0x317a90ae, PSL_RULE },
+    { "vacations", 0x8ee4d0ab, PSL_RULE },
+    { "seto.aichi.jp", 0x15f410b2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "asago.hyogo.jp", 0x7f2bd0b4, PSL_RULE },
+    { "minato.tokyo.jp", 0x676590b5, PSL_RULE },
+    { "is-with-theband.com", 0xcb7b50b6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.ru", 0xdc8cd0b9, PSL_RULE },
+    { "beskidy.pl", 0xcad910ba, PSL_RULE },
+    { "fail", 0xead890b9, PSL_RULE },
+    { "urakawa.hokkaido.jp", 0xbe73d0bb, PSL_RULE },
+    { "tatar", 0xdc25d0bd, PSL_RULE },
+    { "lynx.mythic-beasts.com", 0xb9b410be, PSL_RULE },
+    { "nagahama.shiga.jp", 0x065d50bf, PSL_RULE },
+    { "is-a-green.com", 0xc5e690c0, PSL_RULE },
+    { "naples.it", 0x815450bf, PSL_RULE },
+    { "nordre-land.no", 0xb30d50c0, PSL_RULE },
+    { "perso.ht", 0x3b8e10c2, PSL_RULE },
+    { "skedsmokorset.no", 0x7cf2d0c2, PSL_RULE },
+    { "devcdnaccesso.com", 0x368bd0c5, PSL_WILDCARD },
+    { "kitakami.iwate.jp", 0xd7c9d0c6, PSL_RULE },
+    { "hm.no", 0xcfb690c7, PSL_RULE },
+    { "trentinosuedtirol.it", 0x30d890c4, PSL_RULE },
+    { "xn--troms-zua.no", 0x369490c8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ak.us", 0xa02010cd, PSL_RULE },
+    { "fvg.it", 0x003690cd, PSL_RULE },
+    { "wafflecell.com", 0xb68fd0cd, PSL_RULE },
+    { "xen.prgmr.com", 0xd82cd0cd, PSL_RULE },
+    { "chernihiv.ua", 0x501050d1, PSL_RULE },
+    { "tanohata.iwate.jp", 0x1062d0d1, PSL_RULE },
+    { "starnberg.museum", 0x371390d3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--mgbah1a3hjkrd", 0x3b6490d8, PSL_RULE },
+    { "boleslawiec.pl", 0x193410d9, PSL_RULE },
+    { "nichinan.tottori.jp", 0x6c6d10da, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ilovecollege.info", 0x287010e1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tgory.pl", 0x236590e4, PSL_RULE },
+    { "vibovalentia.it", 0x63de10e4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ecn.br", 0xbd86d0ed, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.com.ng", 0x2eaf90ef, PSL_RULE },
+    { "fr.eu.org", 0x3a1510ef, PSL_RULE },
+    { "is", 0x405210f1, PSL_RULE },
+    { "sauherad.no", 0xd4b5d0ef, PSL_RULE },
+    { "gov.ki", 0xa69350f3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mn.it", 0x667d90f5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.om", 0x8f5fd0f7, PSL_RULE },
+    { "newhampshire.museum", 0x494950f8, PSL_RULE },
+    { "dualstack.eu-west-3.amazonaws.com", 0xbbad10f9, 0 },
+    { "mayfirst.info", 0x0cde90fa, PSL_RULE },
+    { NULL, 0, 0 },
+    { "norddal.no", 0xabeed0fc, PSL_RULE },
+    { "frosta.no", 0x988750fd, PSL_RULE },
+    { "bike", 0x3e5990fe, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "amazon", 0xede1d101, PSL_RULE },
+    { "mihara.hiroshima.jp", 0x93519101, PSL_RULE },
+    { "educator.aero", 0x8ec51103, PSL_RULE },
+    { "nagiso.nagano.jp", 0xe5821104, PSL_RULE },
+    { "sakado.saitama.jp", 0xb2d21104, PSL_RULE },
+    { "is-a-bruinsfan.org", 0x89839106, PSL_RULE },
+    { "duckdns.org", 0x3a42d107, PSL_RULE },
+    { "k12.ar.us", 0x7ca89108, PSL_RULE },
+    { "buskerud.no", 0xd64b5109, 0 },
+    { "izumi.osaka.jp", 0x8ba3110a, PSL_RULE },
+    { "mil.sh", 0x4d44d108, PSL_RULE },
+    { "nab", 0x5ab75106, PSL_RULE },
+    { "rodeo", 0x6fb8d106, PSL_RULE },
+    { "jamison.museum", 0xc002110e, PSL_RULE },
+    { "omaezaki.shizuoka.jp", 0x5aa9910e, PSL_RULE },
+    { "tokai.aichi.jp", 0x00d45103, PSL_RULE },
+    { "webview-assets.cloud9.ap-southeast-2.amazonaws.com", 0xd03fd105, PSL_RULE },
+    { "kinder", 0x28f05112, PSL_RULE },
+    { "ae", 0x341a5113, PSL_RULE },
+    { "xn--djrs72d6uy.jp", 0x8d46910b, PSL_RULE },
+    { "foodnetwork", 0xc4101115, PSL_RULE },
+    { "minisite.ms", 0xf51cd115, PSL_RULE },
+    { "cloud9.eu-west-1.amazonaws.com", 0x5d5fd117, 0 },
+    { NULL, 0, 0 },
+    { "nakanoto.ishikawa.jp", 0xfefb9119, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.gt", 0x6555111b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nic.za", 0x7553511e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mydatto.net", 0x21521120, PSL_RULE },
+    { "carbonia-iglesias.it", 0xfa615121, PSL_RULE },
+    { "sko.gov.pl", 0xda129122, PSL_RULE },
+    { "cc", 0x56299123, PSL_RULE },
+    { "tos.it", 0x5e55d122, PSL_RULE },
+    { "scotland.museum", 0xa7ac1125, PSL_RULE },
+    { "gov.ir", 0x90c0d126, PSL_RULE },
+    { "mil.tw", 0x9feb9126, PSL_RULE },
+    { NULL, 0, 0 },
+    { "historical.museum", 0x2a4c9129, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.al", 0x3bc5912c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "iijima.nagano.jp", 0xcf419132, PSL_RULE },
+    { "boyfriend.jp", 0xeba95133, PSL_RULE },
+    { "dabur", 0x4d9a5133, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "crimea.ua", 0x00209138, PSL_RULE },
+    { "museet.museum", 0x70cf5138, PSL_RULE },
+    { "edu.st", 0x9281d13a, PSL_RULE },
+    { "sc.kr", 0xde73d13a, PSL_RULE },
+    { "blogspot.sn", 0x40c8113c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cc.nm.us", 0xcc42513e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "eastus2.azurestaticapps.net", 0x257f1140, PSL_RULE },
+    { "fosnes.no", 0x3a149140, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "masfjorden.no", 0xbb489145, PSL_RULE },
+    { "sukumo.kochi.jp", 0x84c2d145, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edgeapp.net", 0x5d35d14a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.gr", 0x067f914c, PSL_RULE },
+    { "cruise", 0x1575914c, PSL_RULE },
+    { "hvaler.no", 0x79ec914e, PSL_RULE },
+    { "flekkefjord.no", 0xe32d514f, PSL_RULE },
+    { "tashkent.su", 0x2ec4914f, PSL_RULE },
+    { "bushey.museum", 0x74fa5151, PSL_RULE },
+    { "webpaas.ovh.net", 0x73a01152, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "cc.oh.us", 0xe9cad154, PSL_RULE },
+    { NULL, 0, 0 },
+    { "newport.museum", 0x08ca5156, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hasura.app", 0x247b1158, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nom.re", 0x4648115a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--6frz82g", 0x5e23515c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.cx", 0x563f515e, PSL_RULE },
+    { "kumiyama.kyoto.jp", 0xdc99115f, PSL_RULE },
+    { "vb.it", 0x4b5f5160, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "id.repl.co", 0xbfc19165, PSL_RULE },
+    { "cc.dc.us", 0xc2275166, PSL_RULE },
+    { "fujisato.akita.jp", 0xf5129166, PSL_RULE },
+    { "zhytomyr.ua", 0xce4d9167, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gouv.ht", 0x53d3516a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.mw", 0xe121516c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "synology-diskstation.de", 0x856c116e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "company", 0x51b65170, PSL_RULE },
+    { "here-for-more.info", 0x4a9bd171, PSL_RULE },
+    { "red", 0xd1599170, PSL_RULE },
+    { "ondigitalocean.app", 0x8cc65173, PSL_RULE },
+    { "org.pf", 0xa4dc5173, PSL_RULE },
+    { "tatamotors", 0xfa101173, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mar.it", 0xe6795178, PSL_RULE },
+    { "prd.fr", 0x1c031179, PSL_RULE },
+    { "atsuma.hokkaido.jp", 0x0332117a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "suzaka.nagano.jp", 0x15b51182, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.ph", 0x6959d186, PSL_RULE },
+    { NULL, 0, 0 },
+    { "es.kr", 0xe84cd188, PSL_RULE },
+    { "gobo.wakayama.jp", 0x5ea5d188, PSL_RULE },
+    { "eu.int", 0xd1d0918a, PSL_RULE },
+    { "remotewd.com", 0x7afb518b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "chocolate.museum", 0xdf3a918d, PSL_RULE },
+    { "geek.nz", 0xdb86518d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lincoln.museum", 0x6bf31190, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "encyclopedic.museum", 0x428fd193, PSL_RULE },
+    { "hole.no", 0xf9e3d194, PSL_RULE },
+    { "lon-2.paas.massivegrid.net", 0x09f3d193, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ap-southeast-1.amazonaws.com", 0xe7abd197, 0 },
+    { NULL, 0, 0 },
+    { "tank.museum", 0xd3471199, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rishiri.hokkaido.jp", 0x6119119d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hachijo.tokyo.jp", 0x0ded51a1, PSL_RULE },
+    { "net.in", 0x9b7e91a1, PSL_RULE },
+    { "health.vn", 0x08bcd1a3, PSL_RULE },
+    { "xn--fiqs8s", 0xd63591a1, PSL_RULE },
+    { "gop", 0x483351a5, PSL_RULE },
+    { "net.hn", 0xb29fd1a6, PSL_RULE },
+    { "perspecta.cloud", 0xdc6351a7, PSL_RULE },
+    { "financial", 0x392051a8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "taito.tokyo.jp", 0x965511ae, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.et", 0x6c8e11b0, PSL_RULE },
+    { "eero-stage.online", 0xedd651b0, PSL_RULE },
+    { "net.om", 0x14a551b0, PSL_RULE },
+    { "photo", 0x9d6511b3, PSL_RULE },
+    { "sandoy.no", 0x307811b4, PSL_RULE },
+    { "iveland.no", 0x9ee251b5, PSL_RULE },
+    { "vic.gov.au", 0x358c91b5, PSL_RULE },
+    { "politie", 0x8f6051b7, PSL_RULE },
+    { "shw.io", 0x5d08d1b7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nom.es", 0x802651bd, PSL_RULE },
+    { "xn--correios-e-telecomunicaes-ghc29a.museum", 0xfad051be, PSL_RULE },
+    { "host", 0xe7e591bf, PSL_RULE },
+    { "xn--clchc0ea0b2g2a9gcd", 0xf21691bf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "esan.hokkaido.jp", 0xe3b851c6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shimonoseki.yamaguchi.jp", 0xd4dd91cc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "indie.porn", 0x97a791cf, PSL_RULE },
+    { "taki.mie.jp", 0xfae711cf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fm.it", 0x3d7b11d3, PSL_RULE },
+    { "oya.to", 0x1ec4d1d3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "t.bg", 0xddd691d6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "servep2p.com", 0xdfe251d9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "k8s.scw.cloud", 0x8917d1dd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "firenet.ch", 0xa1f211e1, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yabuki.fukushima.jp", 0xcbe0d1e5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lavagis.no", 0x8d2211ed, PSL_RULE },
+    { "xn--mgba3a4f16a.ir", 0xe73611ed, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "grimstad.no", 0x272c11f1, PSL_RULE },
+    { "kisofukushima.nagano.jp", 0xe0a751f2, PSL_RULE },
+    { "citadel", 0x101b11f3, PSL_RULE },
+    { "kagoshima.jp", 0x6d6611f3, PSL_RULE },
+    { "xn--kltx9a.jp", 0xdd37d1f4, PSL_RULE },
+    { "coop.tt", 0x7f8851f6, PSL_RULE },
+    { "goto.nagasaki.jp", 0xb77691f7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "karasuyama.tochigi.jp", 0x5075d1f9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nfl", 0x5868d1fb, PSL_RULE },
+    { "paas.massivegrid.net", 0xc46551fb, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mk.eu.org", 0x1f4ed1ff, PSL_RULE },
+    { NULL, 0, 0 },
+    { "aioi.hyogo.jp", 0x309c9201, PSL_RULE },
+    { "jewelry.museum", 0xee71d201, PSL_RULE },
+    { "kafjord.no", 0x0dafd201, PSL_RULE },
+    { "grajewo.pl", 0x68969204, PSL_RULE },
+    { "aogashima.tokyo.jp", 0xe4229205, PSL_RULE },
+    { "marnardal.no", 0x07971204, PSL_RULE },
+    { "matsuno.ehime.jp", 0x66e31204, PSL_RULE },
+    { "sc.gov.br", 0x007e1205, PSL_RULE },
+    { NULL, 0, 0 },
+    { "avianca", 0x55cf120a, PSL_RULE },
+    { "salvadordali.museum", 0xfa5b520b, PSL_RULE },
+    { "us.na", 0xdfd5920c, PSL_RULE },
+    { "gose.nara.jp", 0xed7f920d, PSL_RULE },
+    { "environment.museum", 0x7142120e, PSL_RULE },
+    { "shimabara.nagasaki.jp", 0x9173920e, PSL_RULE },
+    { "blogspot.com", 0x31ba9210, PSL_RULE },
+    { "org.sd", 0xb844d210, PSL_RULE },
+    { "own.pm", 0x49545212, PSL_RULE },
+    { "org.dz", 0x45a09213, PSL_RULE },
+    { "kawaue.gifu.jp", 0xde375214, PSL_RULE },
+    { "ap-northeast-2.elasticbeanstalk.com", 0x3769d215, PSL_RULE },
+    { "milano.it", 0x09fcd216, PSL_RULE },
+    { "neko.am", 0x53ef9216, PSL_RULE },
+    { "r.se", 0xaf789215, PSL_RULE },
+    { "setagaya.tokyo.jp", 0xbd741210, PSL_RULE },
+    { "yoga", 0x8bdf5219, PSL_RULE },
+    { "betainabox.com", 0xbdcb921b, PSL_RULE },
+    { "cust.disrec.thingdust.io", 0xa59dd21c, PSL_RULE },
+    { "okoppe.hokkaido.jp", 0xc965d21d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "babyblue.jp", 0x7bced21f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ooshika.nagano.jp", 0x585c9223, PSL_RULE },
+    { "isa-geek.net", 0x2637d224, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "man", 0x2e8f1227, PSL_RULE },
+    { "spdns.eu", 0xd6615227, PSL_RULE },
+    { "kinghost.net", 0xafe1d229, PSL_RULE },
+    { "xn--jlster-bya.no", 0x5b33d227, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "user.fm", 0xfe9cd22d, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "fbsbx.com", 0xdbde122f, 0 },
+    { "okegawa.saitama.jp", 0xbf5c1230, PSL_RULE },
+    { "agr.br", 0x4dc95231, PSL_RULE },
+    { "org.is", 0x62411231, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "discourse.team", 0x898a5235, PSL_RULE },
+    { "dyndns.biz", 0x97241236, PSL_RULE },
+    { "fujisawa.iwate.jp", 0x8200d235, PSL_RULE },
+    { "mikawa.yamagata.jp", 0x3a905236, PSL_RULE },
+    { "net.bz", 0x3fa6d238, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.pt", 0x6164923b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "americana.museum", 0x06fdd23e, PSL_RULE },
+    { "jprs", 0x29a7d23e, PSL_RULE },
+    { "ch.trendhosting.cloud", 0xeb4b9240, PSL_RULE },
+    { "nissan", 0x527a1241, PSL_RULE },
+    { NULL, 0, 0 },
+    { "arakawa.tokyo.jp", 0x1af1d243, PSL_RULE },
+    { "jur.pro", 0xa6035243, PSL_RULE },
+    { NULL, 0, 0 },
+    { "naumburg.museum", 0x10225246, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tokigawa.saitama.jp", 0x06405248, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kunstunddesign.museum", 0x0fd6124d, PSL_RULE },
+    { "compute.estate", 0x94b9d24e, PSL_WILDCARD },
+    { "xn--aurskog-hland-jnb.no", 0xaf69524d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--jlq480n2rg", 0x14d25251, PSL_RULE },
+    { NULL, 0, 0 },
+    { "snillfjord.no", 0xa14b1253, PSL_RULE },
+    { NULL, 0, 0 },
+    { "as.us", 0x90351255, PSL_RULE },
+    { "bergen.no", 0xe11c5255, PSL_RULE },
+    { "work", 0xb8649256, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kitaakita.akita.jp", 0x6ca7125a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--krjohka-hwab49j.no", 0x9d8e525c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "uk.kg", 0xb8d6925f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kamikawa.saitama.jp", 0x5e9cd261, PSL_RULE },
+    { "suzuka.mie.jp", 0x574a5261, PSL_RULE },
+    { "za", 0x55251262, 0 },
+    { NULL, 0, 0 },
+    { "ph", 0x513ad265, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kumano.mie.jp", 0xda57d269, PSL_RULE },
+    { "web.id", 0x5022926a, PSL_RULE },
+    { "brandywinevalley.museum", 0xfe6f526b, PSL_RULE },
+    { "club.aero", 0x7694526c, PSL_RULE },
+    { "org.ss", 0x679fd26b, PSL_RULE },
+    { "yura.wakayama.jp", 0x5abf526e, PSL_RULE },
+    { "bank", 0x4b63d26f, PSL_RULE },
+    { "otoyo.kochi.jp", 0x2b8ad26f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "helsinki.museum", 0xd994d272, PSL_RULE },
+    { "krym.ua", 0x73e45272, PSL_RULE },
+    { "name.tj", 0x84d11272, PSL_RULE },
+    { "from-nh.com", 0x253c1275, PSL_RULE },
+    { "freeddns.us", 0x28459276, PSL_RULE },
+    { "sunndal.no", 0x6cd99277, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tsurugashima.saitama.jp", 0x51a4527a, PSL_RULE },
+    { "openair.museum", 0x90f1d27b, PSL_RULE },
+    { "blogspot.be", 0x1c5a527c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "taiwa.miyagi.jp", 0x1244927f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "space", 0xadd55281, PSL_RULE },
+    { "cc.or.us", 0x90c41282, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nom.za", 0x4e5f5286, PSL_RULE },
+    { "kitchen", 0xe44a9287, PSL_RULE },
+    { "bn.it", 0x677d9288, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dev-myqnapcloud.com", 0x6f85928b, PSL_RULE },
+    { "passagens", 0x89f4528c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--qxa6a", 0xaae2d28e, PSL_RULE },
+    { "odesa.ua", 0x7d67528f, PSL_RULE },
+    { "szczecin.pl", 0x27525290, PSL_RULE },
+    { "lib.la.us", 0x163c1291, PSL_RULE },
+    { "minokamo.gifu.jp", 0x14d99291, PSL_RULE },
+    { "takata.fukuoka.jp", 0x78d4128f, PSL_RULE },
+    { "ne.jp", 0xbc9bd294, PSL_RULE },
+    { "swatch", 0x867b9295, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nhlfan.net", 0xf41b5297, PSL_RULE },
+    { "dyndns-pics.com", 0x4d4f1298, PSL_RULE },
+    { "gov.ps", 0x53685298, PSL_RULE },
+    { "leirfjord.no", 0x8749d299, PSL_RULE },
+    { "shouji", 0x5afd929b, PSL_RULE },
+    { "wmflabs.org", 0xcb14d299, PSL_RULE },
+    { "zapto.xyz", 0x18031298, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "avoues.fr", 0x9eee92a0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ap-northeast-2.amazonaws.com", 0x5b2692a2, 0 },
+    { "s3-us-gov-west-1.amazonaws.com", 0x7cbf12a3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "be", 0x351a52a6, PSL_RULE },
+    { "blogspot.ro", 0xd50812a6, PSL_RULE },
+    { "monzabrianza.it", 0x780d12a8, PSL_RULE },
+    { "dualstack.eu-central-1.amazonaws.com", 0xcad812a9, 0 },
+    { "gmo", 0xac2f52aa, PSL_RULE },
+    { "poltava.ua", 0xbfe6d2a8, PSL_RULE },
+    { "coupons", 0x2f8a12ac, PSL_RULE },
+    { "shinshinotsu.hokkaido.jp", 0x509152aa, PSL_RULE },
+    { "32-b.it", 0x727f12ae, PSL_RULE },
+    { NULL, 0, 0 },
+    { "swidnik.pl", 0x156e12b0, PSL_RULE },
+    { "comcast", 0xbfc3d2b1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "wallonie.museum", 0x2d6912b4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "inf.mk", 0xc7ff12b8, PSL_RULE },
+    { "lucania.it", 0x8e7412b9, PSL_RULE },
+    { "niiza.saitama.jp", 0x8c9712b8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nz.basketball", 0xdee912be, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "arq.br", 0xfda952c5, PSL_RULE },
+    { "nextdirect", 0xf56bd2c5, PSL_RULE },
+    { "fastlylb.net", 0x6ce512c7, PSL_RULE },
+    { "trieste.it", 0x392e92c6, PSL_RULE },
+    { "molde.no", 0x707512c9, PSL_RULE },
+    { "com.pl", 0x2bc592ca, PSL_RULE },
+    { "jot", 0xa110d2ca, PSL_RULE },
+    { "mex.com", 0xaecf92ca, PSL_RULE },
+    { "pa.it", 0x4b5d12c9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "voto", 0x06f952cf, PSL_RULE },
+    { "nishiizu.shizuoka.jp", 0x520992d0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "airline.aero", 0x0b3712d2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "database.run", 0x0f7a12db, PSL_WILDCARD },
+    { "bosch", 0x68be92dc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "zaporizhzhia.ua", 0x7d7352de, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.ml", 0xfb6392e4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.gt", 0xf2dbd2e8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tonsberg.no", 0x774ad2ea, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "drayddns.com", 0x618e92ed, PSL_RULE },
+    { "co.dk", 0x57c952ee, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kimino.wakayama.jp", 0x9d7dd2f0, PSL_RULE },
+    { "nodes.k8s.fr-par.scw.cloud", 0x48b192f0, PSL_RULE },
+    { "agriculture.museum", 0x9352d2f2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.ai", 0x99f612f4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ddnsfree.com", 0x628d52f7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bambina.jp", 0x315292f9, PSL_RULE },
+    { "il.us", 0x982852fa, PSL_RULE },
+    { NULL, 0, 0 },
+    { "achi.nagano.jp", 0xe6c192fc, PSL_RULE },
+    { "akamaiorigin-staging.net", 0xf568d2fc, PSL_RULE },
+    { "vantaa.museum", 0x98dd92fe, PSL_RULE },
+    { "codespot.com", 0x5edb92ff, PSL_RULE },
+    { "hicam.net", 0x9aaa5300, PSL_RULE },
+    { "hanamaki.iwate.jp", 0x8da89301, PSL_RULE },
+    { "shinjuku.tokyo.jp", 0x95949300, PSL_RULE },
+    { "yono.saitama.jp", 0xad709302, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dinosaur.museum", 0x0147d30c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.dz", 0xec7d9311, PSL_RULE },
+    { "tokyo", 0x1ba15311, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "prod.atlassian-dev.net", 0xc5a15315, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chirurgiens-dentistes-en-france.fr", 0xd1a39318, PSL_RULE },
+    { "calvinklein", 0x51a35319, PSL_RULE },
+    { "org.gi", 0xe865d319, PSL_RULE },
+    { "security", 0xddc7d31b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fc.it", 0x4d61931d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "health.nz", 0xad9c931f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ac.ir", 0x4b591322, PSL_RULE },
+    { "com.bn", 0x29971322, PSL_RULE },
+    { "legal", 0xcf2e9322, PSL_RULE },
+    { "in-the-band.net", 0xd5ea9325, PSL_RULE },
+    { "yabu.hyogo.jp", 0xde251322, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pt", 0x49455329, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--h2brj9c", 0x58f9d32b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.km", 0x52769331, PSL_RULE },
+    { "design.aero", 0x51229332, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tushu", 0x4c0b1338, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "illustration.museum", 0x1825d33b, PSL_RULE },
+    { "net.ba", 0xbb22933b, PSL_RULE },
+    { "nom.ag", 0xaed1d33d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "georgia.museum", 0x5f8c933f, PSL_RULE },
+    { "lib.nv.us", 0xf7f99340, PSL_RULE },
+    { NULL, 0, 0 },
+    { "trolley.museum", 0x7ee95342, PSL_RULE },
+    { "tci", 0x83e11343, PSL_RULE },
+    { "omachi.nagano.jp", 0x79601344, PSL_RULE },
+    { "aoki.nagano.jp", 0x10169345, PSL_RULE },
+    { "ryugasaki.ibaraki.jp", 0x6b75d344, PSL_RULE },
+    { "lima-city.at", 0x13dc9347, PSL_RULE },
+    { "tagawa.fukuoka.jp", 0xedd11346, PSL_RULE },
+    { "kawakami.nara.jp", 0xbac89349, PSL_RULE },
+    { "touch.museum", 0x9824d348, PSL_RULE },
+    { "vladimir.su", 0x13951347, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "for-our.info", 0xa1ba134f, PSL_RULE },
+    { "eurodir.ru", 0x8ce21350, PSL_RULE },
+    { "iris.arpa", 0xcd40d350, PSL_RULE },
+    { "rzeszow.pl", 0x4037d34f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "abarth", 0xc384d355, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "try-snowplow.com", 0xa8e4935b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "amber.museum", 0x73e0d360, PSL_RULE },
+    { "az.us", 0x644a9360, PSL_RULE },
+    { "aaa", 0x3445d362, PSL_RULE },
+    { "bostik", 0xa873d361, PSL_RULE },
+    { "xn--c1avg.xn--p1acf", 0xbfa41362, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--trgstad-r1a.no", 0xb44fd366, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jls-sto2.elastx.net", 0x51655369, PSL_RULE },
+    { "lans.museum", 0x39579369, PSL_RULE },
+    { "gov.ec", 0xcea7536b, PSL_RULE },
+    { "tydal.no", 0xec8f936a, PSL_RULE },
+    { "u.bg", 0xded69369, PSL_RULE },
+    { "is-a-chef.org", 0xbe67136e, PSL_RULE },
+    { "wy.us", 0x8a44136d, PSL_RULE },
+    { "cat.ax", 0xff851370, PSL_RULE },
+    { "horology.museum", 0x27fa9370, PSL_RULE },
+    { "miniserver.com", 0xd9a95370, PSL_RULE },
+    { "synology.me", 0x4ae71371, PSL_RULE },
+    { "name.eg", 0x46d79374, PSL_RULE },
+    { "bmoattachments.org", 0x29849375, PSL_RULE },
+    { "oji.nara.jp", 0xcd809375, PSL_RULE },
+    { "ostroda.pl", 0x358fd375, PSL_RULE },
+    { "sanfrancisco.museum", 0x15bdd375, PSL_RULE },
+    { "shirosato.ibaraki.jp", 0xdae61374, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "club.tw", 0x0422537c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yuza.yamagata.jp", 0xda091381, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ibm", 0xcea51385, PSL_RULE },
+    { "xn--skierv-uta.no", 0x6e845385, PSL_RULE },
+    { "gov.mw", 0xe5e29387, PSL_RULE },
+    { "ca.na", 0xfdf85388, PSL_RULE },
+    { NULL, 0, 0 },
+    { "in-addr.arpa", 0x77e0938a, PSL_RULE },
+    { "play", 0x6b3b138b, PSL_RULE },
+    { "capetown", 0xd875538c, PSL_RULE },
+    { "cr.ua", 0x61ead38c, PSL_RULE },
+    { "gs.svalbard.no", 0x286c938d, PSL_RULE },
+    { "sc.us", 0x7e0c538f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "trainer.aero", 0xbe1d1391, PSL_RULE },
+    { "cheltenham.museum", 0xd35b1392, PSL_RULE },
+    { "kasai.hyogo.jp", 0xe4d01392, PSL_RULE },
+    { "manchester.museum", 0xd8b29393, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "no-ip.biz", 0x6b6ad397, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "misato.wakayama.jp", 0x3636939a, PSL_RULE },
+    { "xn--hobl-ira.no", 0x4be7539a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "odawara.kanagawa.jp", 0xb57cd39d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "me.ss", 0xb0e313a1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "travel.tt", 0xd41e53a5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kapsi.fi", 0x2046d3a8, PSL_RULE },
+    { "nagoya.jp", 0xd91d13a8, PSL_WILDCARD },
+    { "travel", 0x42aad3a9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hyuga.miyazaki.jp", 0x575a13ac, PSL_RULE },
+    { "kicks-ass.org", 0x01bd53ac, PSL_RULE },
+    { "xn--ystre-slidre-ujb.no", 0xa80153ad, PSL_RULE },
+    { "sanagochi.tokushima.jp", 0xc07ad3af, PSL_RULE },
+    { "edu.kz", 0x76b8d3b0, PSL_RULE },
+    { "org.mg", 0x90ec93b1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.tm", 0xf03e53b6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shimoda.shizuoka.jp", 0x79b213b8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aarborte.no", 0xa90d93be, PSL_RULE },
+    { "xn--od0alg.xn--j6w193g", 0x65e3d3bf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "issmarterthanyou.com", 0x57e713c4, PSL_RULE },
+    { "nalchik.ru", 0x0c9cd3c4, PSL_RULE },
+    { "org.ki", 0x724293c5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pf", 0x5522d3cb, PSL_RULE },
+    { "yahoo", 0x7025d3cb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.gp", 0xd63f53d1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.ao", 0x196193d3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "info.ve", 0xbbc713d8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sp.leg.br", 0x4e7693da, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cymru.museum", 0x605113e1, PSL_RULE },
+    { "sel.no", 0x437813e2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "exeter.museum", 0xe9c2d3e4, PSL_RULE },
+    { "xn--mgbab2bd", 0x139a13e4, PSL_RULE },
+    { "mil.zm", 0xd83513e6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kameoka.kyoto.jp", 0xd19013e8, PSL_RULE },
+    { "av.it", 0x5a4153e9, PSL_RULE },
+    { "camdvr.org", 0xdbc453ea, PSL_RULE },
+    { "net.lc", 0x68bd93eb, PSL_RULE },
+    { "xn--ngbc5azd", 0xbe1cd3e9, PSL_RULE },
+    { "ks.ua", 0x89e8d3ed, PSL_RULE },
+    { "valledaosta.it", 0x7f6b53ee, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "wedeploy.me", 0x00f913f2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "oristano.it", 0x5342d3f7, PSL_RULE },
+    { "air-traffic-control.aero", 0xb1a3d3f8, PSL_RULE },
+    { "copenhagen.museum", 0x0d1013f9, PSL_RULE },
+    { "kiho.mie.jp", 0xeb1b93f9, PSL_RULE },
+    { "k8s.fr-par.scw.cloud", 0xf33a93fb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aero.tt", 0x07871402, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nom.pa", 0x3894d404, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.ss", 0xbde21410, PSL_RULE },
+    { "com.pk", 0x35189411, PSL_RULE },
+    { "kozaki.chiba.jp", 0x86d3d411, PSL_RULE },
+    { NULL, 0, 0 },
+    { "chiyoda.tokyo.jp", 0x422bd414, PSL_RULE },
+    { "fastly.net", 0x406dd415, 0 },
+    { NULL, 0, 0 },
+    { "asakuchi.okayama.jp", 0x11e09417, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cn.it", 0x687d941b, PSL_RULE },
+    { "mil.cl", 0x4b3bd41c, PSL_RULE },
+    { "elk.pl", 0xb725941d, PSL_RULE },
+    { "yonezawa.yamagata.jp", 0x4540d41c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "es.ax", 0x1b0dd420, PSL_RULE },
+    { "coop.ar", 0xfb5fd421, PSL_RULE },
+    { "saskatchewan.museum", 0x118b5420, PSL_RULE },
+    { "simplesite.gr", 0x77ce9423, PSL_RULE },
+    { "cagliari.it", 0x89209424, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kyowa.akita.jp", 0x52cc1426, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "link", 0x51505429, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sch.ae", 0xf943542b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "koshu.yamanashi.jp", 0xea9f942e, PSL_RULE },
+    { "sew", 0x1ed9d42e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ac.jp", 0x8f8e1433, PSL_RULE },
+    { "seoul.kr", 0x67329434, PSL_RULE },
+    { "starostwo.gov.pl", 0xf6de5435, PSL_RULE },
+    { "navigation.aero", 0xd3f6d436, PSL_RULE },
+    { "asn.lv", 0x90a11437, PSL_RULE },
+    { "fedorapeople.org", 0x482e9437, PSL_RULE },
+    { "hotelwithflight.com", 0xf32dd438, PSL_RULE },
+    { "marche.it", 0x6fab543a, PSL_RULE },
+    { "moriguchi.osaka.jp", 0xd0791437, PSL_RULE },
+    { "net.is", 0xe25b543c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "asso.gp", 0x9ffb9444, PSL_RULE },
+    { "centralus.azurestaticapps.net", 0xca2ad444, PSL_RULE },
+    { "badajoz.museum", 0x8e325446, PSL_RULE },
+    { "fukui.jp", 0x7c439445, PSL_RULE },
+    { "mango", 0x4626d445, PSL_RULE },
+    { "ac", 0x58299449, PSL_RULE },
+    { "boo.jp", 0x66ad1449, PSL_RULE },
+    { "edu.uy", 0x5903d449, PSL_RULE },
+    { "blogspot.com.br", 0x61b8944c, PSL_RULE },
+    { "film", 0xb376144b, PSL_RULE },
+    { "itoigawa.niigata.jp", 0x2124944b, PSL_RULE },
+    { "mutual", 0x07131449, PSL_RULE },
+    { "servepics.com", 0x10ca544a, PSL_RULE },
+    { "vikna.no", 0x2af45445, PSL_RULE },
+    { "kalmykia.su", 0xf2439452, PSL_RULE },
+    { "watch", 0x6b8d5444, PSL_RULE },
+    { "mashiko.tochigi.jp", 0xe9229454, PSL_RULE },
+    { "kyoto.jp", 0xb97b1455, PSL_RULE },
+    { "svc.firenet.ch", 0x14e55455, PSL_WILDCARD },
+    { "xn--80adxhks", 0x90e99454, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "banzaicloud.io", 0x2b3f545b, 0 },
+    { "black", 0xcb29545c, PSL_RULE },
+    { "shioya.tochigi.jp", 0xf428145d, PSL_RULE },
+    { "dnsalias.org", 0x0d01145e, PSL_RULE },
+    { "airport.aero", 0x229a145f, PSL_RULE },
+    { "apple", 0xe530945f, PSL_RULE },
+    { "on-the-web.tv", 0x968c545f, PSL_RULE },
+    { "windows", 0x4609945e, PSL_RULE },
+    { "xn--lns-qla.museum", 0x7591d45d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "asso.re", 0x31c15466, PSL_RULE },
+    { "gyeongbuk.kr", 0x845e9467, PSL_RULE },
+    { "plesk.page", 0xbcffd467, PSL_RULE },
+    { "cafjs.com", 0xb87ed469, PSL_RULE },
+    { "jp.eu.org", 0x3e199469, PSL_RULE },
+    { "of.by", 0x542a146b, PSL_RULE },
+    { "tamano.okayama.jp", 0xd30d146c, PSL_RULE },
+    { "com.bi", 0x6bef546d, PSL_RULE },
+    { "vda.it", 0x52665469, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "komforb.se", 0xb7b8d471, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hofu.yamaguchi.jp", 0xb35c9473, PSL_RULE },
+    { "americanart.museum", 0xed6bd474, PSL_RULE },
+    { "brendly.rs", 0xfcbcd474, 0 },
+    { "nakaniikawa.toyama.jp", 0xf4e11475, PSL_RULE },
+    { "americanfamily", 0xade8d477, PSL_RULE },
+    { "aol", 0x41515477, PSL_RULE },
+    { "matsusaka.mie.jp", 0xabe49478, PSL_RULE },
+    { "noshiro.akita.jp", 0x8ff0d473, PSL_RULE },
+    { "horonobe.hokkaido.jp", 0xa2ed947b, PSL_RULE },
+    { "lib.md.us", 0xf4e2d47b, PSL_RULE },
+    { "iki.nagasaki.jp", 0xd5b6147d, PSL_RULE },
+    { "mil.al", 0x0f63147e, PSL_RULE },
+    { "journalism.museum", 0xe895947f, PSL_RULE },
+    { "kasukabe.saitama.jp", 0xdb8b1480, PSL_RULE },
+    { "nakatsugawa.gifu.jp", 0x0bb1d481, PSL_RULE },
+    { "ninohe.iwate.jp", 0x5e4a9482, PSL_RULE },
+    { "shirahama.wakayama.jp", 0xcedf9483, PSL_RULE },
+    { "trentino-a-adige.it", 0x13ffd47e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cal", 0x63609487, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ca-central-1.amazonaws.com", 0x0748d48b, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "corsica", 0xd509d48f, PSL_RULE },
+    { "fr-par-2.baremetal.scw.cloud", 0x9a08548f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dni.us", 0xd444d492, PSL_RULE },
+    { "vu", 0x49431492, PSL_RULE },
+    { NULL, 0, 0 },
+    { "soka.saitama.jp", 0x08a61495, PSL_RULE },
+    { NULL, 0, 0 },
+    { "technology.museum", 0xfe175497, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.bj", 0x75b7949e, PSL_RULE },
+    { "matsuura.nagasaki.jp", 0x6b14949e, PSL_RULE },
+    { "embetsu.hokkaido.jp", 0x008294a0, PSL_RULE },
+    { "morena.br", 0x3ae2d4a1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "casa", 0xfbc394a5, PSL_RULE },
+    { "midori.chiba.jp", 0x13dd14a6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "school", 0x7b9a14a9, PSL_RULE },
+    { "org.vu", 0xb2b414aa, PSL_RULE },
+    { "kr.com", 0x25b454ab, PSL_RULE },
+    { "tottori.jp", 0x2ed794aa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "karpacz.pl", 0xf705d4af, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eu-west-3.elasticbeanstalk.com", 0x991a94b4, PSL_RULE },
+    { "kvinnherad.no", 0xb01194b4, PSL_RULE },
+    { "graphics", 0x14e394b6, PSL_RULE },
+    { "serveftp.org", 0x41ad54b4, PSL_RULE },
+    { "punyu.jp", 0xf6add4b8, PSL_RULE },
+    { "aparecida.br", 0xbd2dd4b9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "towada.aomori.jp", 0x44d0d4c4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "basicserver.io", 0xe0ae94c6, PSL_RULE },
+    { "xn--0trq7p7nn.jp", 0xa9ed94c6, PSL_RULE },
+    { "democrat", 0x4efcd4c8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.nr", 0x35f054ca, PSL_RULE },
+    { NULL, 0, 0 },
+    { "misato.akita.jp", 0xabb654cc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cn.ua", 0x79a5d4d0, PSL_RULE },
+    { "gov.ie", 0xaed214d1, PSL_RULE },
+    { "org.mz", 0x3a7f14d0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "walbrzych.pl", 0x68f3d4d5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ce.gov.br", 0x007994d7, PSL_RULE },
+    { "or.cr", 0xbfa294d7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tdk", 0x6f1394da, PSL_RULE },
+    { "com.de", 0x31d454db, PSL_RULE },
+    { "shingu.wakayama.jp", 0xc7fb54db, PSL_RULE },
+    { "xn--klt787d.jp", 0xe5f914dc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "godaddy", 0x81f8d4df, PSL_RULE },
+    { "lubin.pl", 0x2b9954df, PSL_RULE },
+    { "2ix.de", 0xf86194e1, PSL_RULE },
+    { "read", 0xef9c54e1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "theatre", 0x808494e4, PSL_RULE },
+    { "rio", 0xb13854e5, PSL_RULE },
+    { "bahcavuotna.no", 0xec4814e6, PSL_RULE },
+    { "tw", 0x4b4794e6, PSL_RULE },
+    { "sumoto.hyogo.jp", 0xb7d5d4e8, PSL_RULE },
+    { "xn--hery-ira.xn--mre-og-romsdal-qqb.no", 0xd65014e8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "casino.hu", 0x0210d4eb, PSL_RULE },
+    { "house.museum", 0x071914eb, PSL_RULE },
+    { "git-pages.rit.edu", 0x8a1a14ed, PSL_RULE },
+    { "ichikawamisato.yamanashi.jp", 0x54c954ee, PSL_RULE },
+    { "id", 0x601cd4ee, PSL_RULE },
+    { "matsuda.kanagawa.jp", 0x509214ef, PSL_RULE },
+    { "notaires.fr", 0x418a94ec, PSL_RULE },
+    { "blogspot.hu", 0xc21d14f2, PSL_RULE },
+    { "xn--bhccavuotna-k7a.no", 0x326794f2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mtn", 0x3274d4f6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "activetrail.biz", 0x2824d4fa, PSL_RULE },
+    { "ln.cn", 0x35b614fa, PSL_RULE },
+    { "r.bg", 0xdfd694fc, PSL_RULE },
+    { "platterp.us", 0xd86f94fd, PSL_RULE },
+    { "ss.it", 0x583a94fe, PSL_RULE },
+    { NULL, 0, 0 },
+    { "is-gone.com", 0x4863d500, PSL_RULE },
+    { "amazonaws.com", 0x71d3d501, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chungnam.kr", 0x2f411505, PSL_RULE },
+    { "mat.br", 0x22e8d505, PSL_RULE },
+    { "perugia.it", 0x9f12d505, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-very-nice.org", 0x1ab7950c, PSL_RULE },
+    { "hiraizumi.iwate.jp", 0x8b74150d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "saitama.saitama.jp", 0x96b0550f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hirakata.osaka.jp", 0x4ee25511, PSL_RULE },
+    { "ohda.shimane.jp", 0x4e9b1512, PSL_RULE },
+    { "szczytno.pl", 0xd9f79513, PSL_RULE },
+    { "uy", 0x485f9513, PSL_RULE },
+    { "elementor.cool", 0x26095515, PSL_RULE },
+    { NULL, 0, 0 },
+    { "artdeco.museum", 0xcd7d9517, PSL_RULE },
+    { "technology", 0x912ad517, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kia", 0x3a32551c, PSL_RULE },
+    { "loseyourip.com", 0x97ac151d, PSL_RULE },
+    { "2038.io", 0x99bfd51e, PSL_RULE },
+    { "xn--risr-ira.no", 0x9fdb151f, PSL_RULE },
+    { "folkebibl.no", 0xe972d520, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloudaccess.host", 0xe9415522, PSL_RULE },
+    { "eng.br", 0xd61e9523, PSL_RULE },
+    { "higashiosaka.osaka.jp", 0x12f85522, PSL_RULE },
+    { "website.yandexcloud.net", 0x4b889523, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.il.us", 0x1b89d52a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.vu", 0x6c7c152d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ws.na", 0xe1d59532, PSL_RULE },
+    { "hamura.tokyo.jp", 0xe3f8d533, PSL_RULE },
+    { "jan-mayen.no", 0xf7a71534, PSL_RULE },
+    { "alces.network", 0x16a05535, PSL_WILDCARD },
+    { "koebenhavn.museum", 0x94775536, PSL_RULE },
+    { "miyako.iwate.jp", 0xffd45537, PSL_RULE },
+    { "mobile", 0xb8961537, PSL_RULE },
+    { "dyndns.tv", 0xfd9e5539, PSL_RULE },
+    { "uw.gov.pl", 0x74bf1533, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ent.platform.sh", 0xa15a953c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fage", 0x8fe7553e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ashiya.hyogo.jp", 0x9d28d540, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "channelsdvr.net", 0xcdb15546, PSL_RULE },
+    { "aogaki.hyogo.jp", 0xb77e5547, PSL_RULE },
+    { "blogspot.cz", 0xda239548, PSL_RULE },
+    { "on-web.fr", 0x51db1547, PSL_RULE },
+    { "sano.tochigi.jp", 0xace9d547, PSL_RULE },
+    { "skanland.no", 0x6b34954a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ddnss.de", 0xe2df954e, PSL_RULE },
+    { "naha.okinawa.jp", 0x99f7154f, PSL_RULE },
+    { "moe", 0x7f90d550, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "terni.it", 0x90c6d556, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "spdns.org", 0xe4975559, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "news.hu", 0x2a63155f, PSL_RULE },
+    { "enterprisecloud.nu", 0x580c5560, PSL_RULE },
+    { "katsuragi.nara.jp", 0xd0bc9560, PSL_RULE },
+    { "gujarat.in", 0x190a1562, PSL_RULE },
+    { "boy.jp", 0x5b1a1563, PSL_RULE },
+    { "cisco", 0x86571564, PSL_RULE },
+    { "ora.gunma.jp", 0x0346d563, PSL_RULE },
+    { "xn--5tzm5g", 0xd1cdd561, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.ut.us", 0x88db556e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kumagaya.saitama.jp", 0xa92d5573, PSL_RULE },
+    { NULL, 0, 0 },
+    { "adygeya.su", 0x96715575, PSL_RULE },
+    { "info.cx", 0x552e9576, PSL_RULE },
+    { "pdns.page", 0xb9469577, PSL_RULE },
+    { "hobol.no", 0xf73ed578, PSL_RULE },
+    { "is-a-chef.com", 0xc83dd579, PSL_RULE },
+    { "xn--3bst00m", 0x08829576, PSL_RULE },
+    { "fish", 0x4fb8d57b, PSL_RULE },
+    { "ariake.saga.jp", 0x764b557c, PSL_RULE },
+    { "webview-assets.cloud9.ap-south-1.amazonaws.com", 0x92e9157d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pup.gov.pl", 0xb1465584, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jp.md", 0x3685158a, PSL_RULE },
+    { "bahccavuotna.no", 0x1e9d958b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "culture.museum", 0x9a06d58d, PSL_RULE },
+    { "hirosaki.aomori.jp", 0x5e24558e, PSL_RULE },
+    { "k12.ks.us", 0x456b558f, PSL_RULE },
+    { "arkhangelsk.su", 0x8f8b9590, PSL_RULE },
+    { "alpha.bounty-full.com", 0xafed9591, PSL_RULE },
+    { "home.dyndns.org", 0x99b29592, PSL_RULE },
+    { "sado.niigata.jp", 0x838d958f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tourism.bj", 0x219d1596, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chungbuk.kr", 0x5441159b, PSL_RULE },
+    { "voagat.no", 0xa04f559c, PSL_RULE },
+    { "clubmed", 0x21ca159d, PSL_RULE },
+    { "saka.hiroshima.jp", 0x35f7d59d, PSL_RULE },
+    { "annaka.gunma.jp", 0x9ed3559f, PSL_RULE },
+    { "stord.no", 0x4266d5a0, PSL_RULE },
+    { "xn--fzc2c9e2c", 0xb40715a0, PSL_RULE },
+    { "hb.cn", 0x39bf15a2, PSL_RULE },
+    { "exnet.su", 0x81fb55a3, PSL_RULE },
+    { "net.lk", 0xdeda95a3, PSL_RULE },
+    { "xn--rmskog-bya.no", 0xd5b515a2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kr.eu.org", 0x3d1515a8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ls", 0x435215aa, PSL_RULE },
+    { "kiryu.gunma.jp", 0x902955ab, PSL_RULE },
+    { "pruszkow.pl", 0x39cc55ac, PSL_RULE },
+    { "fedex", 0x390615ad, PSL_RULE },
+    { "ac.rs", 0xe76955ae, PSL_RULE },
+    { "tools", 0x3e0b95ac, PSL_RULE },
+    { "kawai.iwate.jp", 0x07f655b0, PSL_RULE },
+    { "njs.jelastic.vps-host.net", 0xdde2d5b0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "id.forgerock.io", 0xe9a515b6, PSL_RULE },
+    { "nagawa.nagano.jp", 0x751715b6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.bn", 0x9a3ad5bb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "akamaiedge-staging.net", 0x1033d5bd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "moseushi.hokkaido.jp", 0x0e7655c2, PSL_RULE },
+    { "plc.uk", 0x4e2d95c2, PSL_RULE },
+    { "xn--xhq521b", 0xdc76d5c4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shiranuka.hokkaido.jp", 0x47be55c7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.cn", 0xaa17d5c9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "de", 0x371a55cc, PSL_RULE },
+    { "erotika.hu", 0xc5ce55cd, PSL_RULE },
+    { "nordeste-idc.saveincloud.net", 0x56af15ce, PSL_RULE },
+    { "fastly-terrarium.com", 0x293e55cf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.nj.us", 0x7a3815d1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "arna.no", 0xb74c55d4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "moma.museum", 0xf37855db, PSL_RULE },
+    { "show.aero", 0xe86695db, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "123webseite.at", 0x0d9955e2, PSL_RULE },
+    { "ing.pa", 0xecf515e2, PSL_RULE },
+    { "kumamoto.jp", 0x207295e2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "minamiashigara.kanagawa.jp", 0x408315e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "homedns.org", 0xe0d195e9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.au", 0xa07615eb, PSL_RULE },
+    { "rent", 0xaa3dd5ec, PSL_RULE },
+    { NULL, 0, 0 },
+    { "austrheim.no", 0xbcaa15ee, PSL_RULE },
+    { "handa.aichi.jp", 0xdcdfd5ef, PSL_RULE },
+    { "friulive-giulia.it", 0xfdaad5f0, PSL_RULE },
+    { "va.it", 0x4d5d15ef, PSL_RULE },
+    { "magazine.aero", 0x902b95f2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.ec", 0xa66c15f5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vuelos", 0xea3995f7, PSL_RULE },
+    { "xn--mxtq1m.xn--j6w193g", 0x7bed95f8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nodeart.io", 0x798255fe, 0 },
+    { "trentino-stirol.it", 0x7470d5ff, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nodes.k8s.nl-ams.scw.cloud", 0x0e881602, PSL_RULE },
+    { "seljord.no", 0xb37a5603, PSL_RULE },
+    { "chirurgiens-dentistes.fr", 0xb8599604, PSL_RULE },
+    { "ishikawa.okinawa.jp", 0xe0241604, PSL_RULE },
+    { "surnadal.no", 0xa50a1602, PSL_RULE },
+    { "weibo", 0x4da41603, PSL_RULE },
+    { "oamishirasato.chiba.jp", 0x6dca1608, PSL_RULE },
+    { "fjell.no", 0x91859609, PSL_RULE },
+    { "knowsitall.info", 0x67fad609, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.gl", 0x19eb560c, PSL_RULE },
+    { "e164.arpa", 0xf711560d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pug.it", 0xd82f9610, PSL_RULE },
+    { NULL, 0, 0 },
+    { "zakopane.pl", 0x54975612, PSL_RULE },
+    { "dattorelay.com", 0x9570d613, PSL_RULE },
+    { "okinoshima.shimane.jp", 0xa01e9614, PSL_RULE },
+    { "jobs", 0x86285615, PSL_RULE },
+    { "publishproxy.com", 0xb0c49613, PSL_RULE },
+    { "scb", 0x5fbbd613, PSL_RULE },
+    { "vps.myjino.ru", 0x4b625615, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "muroran.hokkaido.jp", 0x9926d61b, PSL_RULE },
+    { "lugansk.ua", 0x0661961c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "steigen.no", 0x70c1961f, PSL_RULE },
+    { "custom.metacentrum.cz", 0xd72d5620, PSL_RULE },
+    { NULL, 0, 0 },
+    { "semine.miyagi.jp", 0x95b25622, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "firewall-gateway.de", 0x42af5627, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sande.more-og-romsdal.no", 0x4dc7162a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "qbuser.com", 0x5d75d62c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kyotango.kyoto.jp", 0x28be962f, PSL_RULE },
+    { "hm", 0x5b2e1630, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fribourg.museum", 0x3fc25635, PSL_RULE },
+    { "logoip.com", 0x99abd636, PSL_RULE },
+    { "olkusz.pl", 0xb06c9637, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shaw", 0x9030963c, PSL_RULE },
+    { "kusatsu.shiga.jp", 0x40acd63d, PSL_RULE },
+    { "xn--mgbx4cd0ab", 0x912ed63d, PSL_RULE },
+    { "tobe.ehime.jp", 0xc827d63f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "aostavalley.it", 0x24aed641, PSL_RULE },
+    { "paas.hosted-by-previder.com", 0x148e9642, PSL_RULE },
+    { "is-a-candidate.org", 0xb43ad643, PSL_RULE },
+    { "kawasaki.miyagi.jp", 0x85b99643, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vestvagoy.no", 0x45cd9646, PSL_RULE },
+    { "email", 0x8ef8d647, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hiho.jp", 0x5bcfd64d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chuo.fukuoka.jp", 0x2ee55656, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "minami-alps.yamanashi.jp", 0x25cd165a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pwc", 0x0e51d65d, PSL_RULE },
+    { "hl.no", 0xa9b4165e, PSL_RULE },
+    { "org.je", 0x87fa965e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nm.cn", 0x35b3d663, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nsw.au", 0xd3fad665, PSL_RULE },
+    { "xn--90azh.xn--90a3ac", 0xa9759666, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.de.us", 0x84205668, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bjarkoy.no", 0xa3e7d66a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "auto", 0x0fea5670, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ac.ae", 0xdd375677, PSL_RULE },
+    { "hamamatsu.shizuoka.jp", 0xde4f5678, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--jvr189m", 0x594d967a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--sr-odal-q1a.no", 0x9fbc967c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "game.tw", 0x5181d67e, PSL_RULE },
+    { "ryd.wafaicloud.com", 0xd0ca167e, PSL_RULE },
+    { "bargains", 0x19c29680, PSL_RULE },
+    { "edu.ye", 0xe9291681, PSL_RULE },
+    { "co.zm", 0xb99ad682, PSL_RULE },
+    { "ltd.lk", 0x8af71680, PSL_RULE },
+    { "edu.hk", 0xa917d684, PSL_RULE },
+    { "trentino-suedtirol.it", 0xa3669685, PSL_RULE },
+    { "ichikawa.hyogo.jp", 0x795d5686, PSL_RULE },
+    { "cosidns.de", 0x790fd687, 0 },
+    { "meeres.museum", 0xee43d686, PSL_RULE },
+    { "mil.ru", 0x7e58d686, PSL_RULE },
+    { "hosteur.com", 0xbb8ed68a, 0 },
+    { "org", 0x5d379689, PSL_RULE },
+    { "uhren.museum", 0x84df5689, PSL_RULE },
+    { "usui.fukuoka.jp", 0x9ee7d689, PSL_RULE },
+    { NULL, 0, 0 },
+    { "s.bg", 0xe0d6968f, PSL_RULE },
+    { "itabashi.tokyo.jp", 0xe496d690, PSL_RULE },
+    { "coop.rw", 0xb60a9691, PSL_RULE },
+    { "stokke.no", 0x50b39691, PSL_RULE },
+    { "edu.is", 0x4c765693, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--rht61e.jp", 0x23895695, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bauern.museum", 0xc8f9569c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kasugai.aichi.jp", 0x572e16a0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hakusan.ishikawa.jp", 0xa9ca56a3, PSL_RULE },
+    { "name", 0x137496a4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "airtel", 0x54de16a6, PSL_RULE },
+    { "condos", 0x445096a7, PSL_RULE },
+    { "org.il", 0xa60956a6, PSL_RULE },
+    { "sund.no", 0xfac4d6a8, PSL_RULE },
+    { "flow.ch", 0xd78996aa, 0 },
+    { NULL, 0, 0 },
+    { "gjesdal.no", 0x01ac96ac, PSL_RULE },
+    { "kannami.shizuoka.jp", 0x269b16ac, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tatsuno.hyogo.jp", 0xd0d356af, PSL_RULE },
+    { "massa-carrara.it", 0x497616b0, PSL_RULE },
+    { "ogata.akita.jp", 0x815bd6b1, PSL_RULE },
+    { "toshima.tokyo.jp", 0x1ef616b2, PSL_RULE },
+    { "game-server.cc", 0x971b96b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "12hp.at", 0xfcd716b5, PSL_RULE },
+    { "imageandsound.museum", 0xe4af56b6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.sl", 0xa3c816b8, PSL_RULE },
+    { "marburg.museum", 0x9ea5d6b9, PSL_RULE },
+    { "nx.cn", 0x33ce16ba, PSL_RULE },
+    { "ikeda.fukui.jp", 0xd64116bb, PSL_RULE },
+    { "vic.au", 0x6e5f16bb, PSL_RULE },
+    { "tx.us", 0x8d4656bd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dualstack.ap-southeast-1.amazonaws.com", 0xa04c56bf, 0 },
+    { NULL, 0, 0 },
+    { "s3-us-west-2.amazonaws.com", 0xebd196c1, PSL_RULE },
+    { "blogspot.cl", 0x8988d6c2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--pssy2u", 0xf82056c5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.ba", 0xde01d6c8, PSL_RULE },
+    { "surgeonshall.museum", 0xa36fd6c8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "spacekit.io", 0x145516cb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "okutama.tokyo.jp", 0xbfb216cd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sande.vestfold.no", 0x4b2b56d2, PSL_RULE },
+    { "taobao", 0x0b3796d3, PSL_RULE },
+    { "northwesternmutual", 0x1cd8d6d4, PSL_RULE },
+    { "123sait.ru", 0xa9d196d5, PSL_RULE },
+    { "temasek", 0x9d4756d5, PSL_RULE },
+    { "tas.gov.au", 0x132156d7, PSL_RULE },
+    { "eisenbahn.museum", 0x813656d8, PSL_RULE },
+    { "bedzin.pl", 0xd39156d9, PSL_RULE },
+    { "lamer", 0x907216da, PSL_RULE },
+    { "muenster.museum", 0xdbaf16da, PSL_RULE },
+    { "nhk", 0x54f556d8, PSL_RULE },
+    { "tromso.no", 0xa7aa16da, PSL_RULE },
+    { "now.sh", 0x2a9796de, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mo.it", 0x427f96e0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "myshopify.com", 0xdaa016e4, PSL_RULE },
+    { "minamisanriku.miyagi.jp", 0x086716e5, PSL_RULE },
+    { "sowa.ibaraki.jp", 0xe57116e6, PSL_RULE },
+    { "hoyanger.no", 0x68ef56e7, PSL_RULE },
+    { "org.me", 0x6635d6e7, PSL_RULE },
+    { "tr.no", 0xc19016e4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cx", 0x3e6356ec, PSL_RULE },
+    { "xn--qqqt11m.jp", 0xc9d996ed, PSL_RULE },
+    { "tenkawa.nara.jp", 0xb9d916ee, PSL_RULE },
+    { "trentinoaltoadige.it", 0x5521d6ef, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--uuwu58a.jp", 0xaad916f7, PSL_RULE },
+    { "tatebayashi.gunma.jp", 0x041816f8, PSL_RULE },
+    { "uberspace.de", 0xf0dfd6f8, PSL_WILDCARD },
+    { "lib.ok.us", 0x728b16fa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bieszczady.pl", 0x667756fd, PSL_RULE },
+    { "edu.az", 0x24e616fe, PSL_RULE },
+    { "nm.us", 0x7125d6fe, PSL_RULE },
+    { "togakushi.nagano.jp", 0x85a856fe, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.tj", 0xbdf19709, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-a-llama.com", 0x4c1b570e, PSL_RULE },
+    { "in.futurecms.at", 0x987d170f, PSL_WILDCARD },
+    { "net.kn", 0xb102970f, PSL_RULE },
+    { "hiphop", 0xf5945711, PSL_RULE },
+    { "luxembourg.museum", 0xb3b61711, PSL_RULE },
+    { "parallel.jp", 0x7c299712, PSL_RULE },
+    { NULL, 0, 0 },
+    { "java", 0x03a79715, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ua", 0x5825171b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "masaki.ehime.jp", 0x3e32171d, PSL_RULE },
+    { "skin", 0x101e171e, PSL_RULE },
+    { "barsy.in", 0x17b5971f, PSL_RULE },
+    { "or.kr", 0xc24a571f, PSL_RULE },
+    { "lowicz.pl", 0xc8299721, PSL_RULE },
+    { NULL, 0, 0 },
+    { "aisho.shiga.jp", 0x35ff5723, PSL_RULE },
+    { "gov.uk", 0xaaa6d723, PSL_RULE },
+    { NULL, 0, 0 },
+    { "from-il.com", 0x421b1726, PSL_RULE },
+    { NULL, 0, 0 },
+    { "builtwithdark.com", 0x4720d728, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xz.cn", 0x29d4172a, PSL_RULE },
+    { "ginan.gifu.jp", 0x7c20972b, PSL_RULE },
+    { "net.fj", 0xb7cb572c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "luxury", 0x4402d72e, PSL_RULE },
+    { "ono.fukushima.jp", 0xc26e972e, PSL_RULE },
+    { "yosemite.museum", 0x543d172e, PSL_RULE },
+    { "ch.it", 0x486e5731, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.co.uk", 0x5918173b, PSL_RULE },
+    { "com.vc", 0x3d23173b, PSL_RULE },
+    { "ms", 0x4452173d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mz", 0x4067d740, PSL_RULE },
+    { "an.it", 0x6a7d9741, PSL_RULE },
+    { "moriya.ibaraki.jp", 0x47839741, PSL_RULE },
+    { "org.pl", 0x82035741, PSL_RULE },
+    { "edu.tw", 0xa9a49744, PSL_RULE },
+    { "mt.leg.br", 0x306bd744, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--h-2fa.no", 0x706e5748, PSL_RULE },
+    { NULL, 0, 0 },
+    { "est-a-la-masion.com", 0x81e4d74a, PSL_RULE },
+    { "namaste.jp", 0x86bfd74a, PSL_RULE },
+    { "k12.la.us", 0x83cdd74c, PSL_RULE },
+    { "beauty", 0x7e8a574d, PSL_RULE },
+    { "takatori.nara.jp", 0xa657974a, PSL_RULE },
+    { "homeunix.com", 0x37e0974f, PSL_RULE },
+    { "salerno.it", 0xf6aad750, PSL_RULE },
+    { "sor-fron.no", 0xf2709750, PSL_RULE },
+    { "kmpsp.gov.pl", 0x36751752, PSL_RULE },
+    { "antiques.museum", 0x874d1753, PSL_RULE },
+    { "aikawa.kanagawa.jp", 0xf89ed754, PSL_RULE },
+    { "mil.ba", 0x67c8d752, PSL_RULE },
+    { "takasaki.gunma.jp", 0xa35f1754, PSL_RULE },
+    { "dyn.ddnss.de", 0x8a569757, PSL_RULE },
+    { "tsuruta.aomori.jp", 0x9a9bd74c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-saved.org", 0x1df0575b, PSL_RULE },
+    { "jevnaker.no", 0x3f5b575c, PSL_RULE },
+    { "kamiamakusa.kumamoto.jp", 0x8d7d175b, PSL_RULE },
+    { "leg.br", 0xdf11d75b, PSL_RULE },
+    { "ee", 0x381a575f, PSL_RULE },
+    { "org.bh", 0x35db175f, PSL_RULE },
+    { "nom.fr", 0x307bd761, PSL_RULE },
+    { "nirasaki.yamanashi.jp", 0x60ed5762, PSL_RULE },
+    { "sandvik", 0x042b975b, PSL_RULE },
+    { "travelchannel", 0x8ce1d760, PSL_RULE },
+    { "xn--givuotna-8ya.no", 0xbf0b975e, PSL_RULE },
+    { "user.localcert.dev", 0xb1c9d766, PSL_WILDCARD },
+    { "kristiansand.no", 0x06809767, PSL_RULE },
+    { "me.in", 0xdb97d768, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--bievt-0qa.no", 0x76a3976b, PSL_RULE },
+    { "cc.la.us", 0x9aad576c, PSL_RULE },
+    { "eb.amazonaws.com.cn", 0x8ea5576d, 0 },
+    { "go.id", 0x0c89d76e, PSL_RULE },
+    { "org.ci", 0x4979976d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "higashi.fukuoka.jp", 0x46811772, PSL_RULE },
+    { "be.ax", 0x1a25d773, PSL_RULE },
+    { NULL, 0, 0 },
+    { "independent-inquiry.uk", 0x48201775, PSL_RULE },
+    { "andria-barletta-trani.it", 0x6c311776, PSL_RULE },
+    { "nachikatsuura.wakayama.jp", 0x164cd776, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "platform0.app", 0x2cdf577b, PSL_RULE },
+    { "pub.instances.scw.cloud", 0xc458977c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dattoweb.com", 0x5430d77e, PSL_RULE },
+    { "d.gv.vc", 0xd1be177f, PSL_RULE },
+    { "higashimatsuyama.saitama.jp", 0x0ad8577e, PSL_RULE },
+    { "ogimi.okinawa.jp", 0x63be1780, PSL_RULE },
+    { "xn--io0a7i.cn", 0xc2e85781, PSL_RULE },
+    { NULL, 0, 0 },
+    { "postman-echo.com", 0x2c781784, PSL_RULE },
+    { "wolterskluwer", 0x49471785, PSL_RULE },
+    { NULL, 0, 0 },
+    { "arts.nf", 0xb1025787, PSL_RULE },
+    { "feedback", 0x2ec0d788, PSL_RULE },
+    { NULL, 0, 0 },
+    { "adobeio-static.net", 0x5d3d578a, PSL_RULE },
+    { "alaska.museum", 0x045b178a, PSL_RULE },
+    { "enscaled.sg", 0x1b6c978c, PSL_RULE },
+    { "gov.cy", 0xa841d78b, PSL_RULE },
+    { "co.ls", 0xb54a978e, PSL_RULE },
+    { "fuchu.hiroshima.jp", 0xb009978e, PSL_RULE },
+    { "com.au", 0xf6b85790, PSL_RULE },
+    { "com.bm", 0x6deed791, PSL_RULE },
+    { "halloffame.museum", 0x1ede178a, PSL_RULE },
+    { "farmers.museum", 0x1cfad793, PSL_RULE },
+    { "in.eu.org", 0x275a178a, PSL_RULE },
+    { "is-a-nascarfan.com", 0xccec5792, PSL_RULE },
+    { "org.mv", 0x42d4d794, PSL_RULE },
+    { "bolt.hu", 0x8e011797, PSL_RULE },
+    { "cloud9.ap-northeast-3.amazonaws.com", 0x719e5797, 0 },
+    { "sp.gov.br", 0x105dd78a, PSL_RULE },
+    { "xn--rst-0na.no", 0x5f52d78f, PSL_RULE },
+    { "fujitsu", 0xab0c979b, PSL_RULE },
+    { "music.museum", 0x700f579c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "awaji.hyogo.jp", 0x859d579f, PSL_RULE },
+    { "cuiaba.br", 0xc30517a0, PSL_RULE },
+    { "faith", 0x117f979f, PSL_RULE },
+    { "edu.krd", 0x3992d7a2, PSL_RULE },
+    { "laquila.it", 0xc611d7a3, PSL_RULE },
+    { "mycd.eu", 0xac8ad7a4, PSL_RULE },
+    { "phone", 0x28b7579f, PSL_RULE },
+    { "sakai.ibaraki.jp", 0x3b5317a3, PSL_RULE },
+    { "settlers.museum", 0xd43457a5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lenvik.no", 0xb684d7ab, PSL_RULE },
+    { "uruma.okinawa.jp", 0x15a0d7ab, PSL_RULE },
+    { "yusui.kagoshima.jp", 0xedf7d7ac, PSL_RULE },
+    { NULL, 0, 0 },
+    { "holmestrand.no", 0xbc5697af, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "culturalcenter.museum", 0x9398d7b4, PSL_RULE },
+    { "edu.ps", 0x048557b4, PSL_RULE },
+    { "xn--mix891f", 0xef5757b5, PSL_RULE },
+    { "org.qa", 0x57da57b7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "brumunddal.no", 0x73a797ba, PSL_RULE },
+    { "pfizer", 0xab8917bb, PSL_RULE },
+    { "rotorcraft.aero", 0xb458d7ba, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "storage.yandexcloud.net", 0xb48d17bf, PSL_RULE },
+    { "oystre-slidre.no", 0x77eb17c0, PSL_RULE },
+    { "my-wan.de", 0xed8d57c1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bd.se", 0xa996d7c3, PSL_RULE },
+    { "im", 0x5c2e17c3, PSL_RULE },
+    { "xn--b-5ga.telemark.no", 0x655dd7c3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nobushi.jp", 0x72e797c9, PSL_RULE },
+    { "tokoname.aichi.jp", 0x4734d7c9, PSL_RULE },
+    { "digital", 0x8efe57cb, PSL_RULE },
+    { "narviika.no", 0x6b5e97cb, PSL_RULE },
+    { "aknoluokta.no", 0x4d7617cd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "civilisation.museum", 0xab0797d1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "paleo.museum", 0x995b57d6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--ryken-vua.no", 0x446297da, PSL_RULE },
+    { "myftp.org", 0x1a6b97db, PSL_RULE },
+    { "amagasaki.hyogo.jp", 0x22d217dc, PSL_RULE },
+    { "discovery.museum", 0xbac857dd, PSL_RULE },
+    { "bas.it", 0x585bd7de, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fastvps.site", 0x649c57e3, PSL_RULE },
+    { "ic.gov.pl", 0x888d97e3, PSL_RULE },
+    { "lezajsk.pl", 0x40c597e5, PSL_RULE },
+    { "musica.bo", 0x535817e4, PSL_RULE },
+    { "protection", 0x0b5757e4, PSL_RULE },
+    { "bodo.no", 0xaa1057e8, PSL_RULE },
+    { "kuromatsunai.hokkaido.jp", 0xaa1817e8, PSL_RULE },
+    { "pussycat.jp", 0x2bf997e7, PSL_RULE },
+    { "saigawa.fukuoka.jp", 0x0bec17ea, PSL_RULE },
+    { "abb", 0x55bf97ec, PSL_RULE },
+    { "extraspace", 0x6da897ed, PSL_RULE },
+    { "gentapps.com", 0x646717ee, PSL_RULE },
+    { "kyuragi.saga.jp", 0x4edd57ef, PSL_RULE },
+    { "myspreadshop.nl", 0x4508d7ec, PSL_RULE },
+    { "us-1.evennode.com", 0x64d197ec, PSL_RULE },
+    { "vallee-d-aoste.it", 0x98a7d7eb, PSL_RULE },
+    { "blogspot.sk", 0xb92e17f3, PSL_RULE },
+    { "productions", 0xfc1d17f3, PSL_RULE },
+    { "vestnes.no", 0x60e857ee, PSL_RULE },
+    { "xn--gildeskl-g0a.no", 0x2284d7ee, PSL_RULE },
+    { "naka.ibaraki.jp", 0x973997f7, PSL_RULE },
+    { "shiftedit.io", 0x154dd7f7, PSL_RULE },
+    { "xn--od0aq3b.hk", 0x84e957f2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--fzys8d69uvgm", 0xa9fa97fb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hotel.lk", 0x5b5ad7fe, PSL_RULE },
+    { "kotoura.tottori.jp", 0xee4e17ff, PSL_RULE },
+    { "sicilia.it", 0xa81f97fe, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kumano.hiroshima.jp", 0x2e0c9802, PSL_RULE },
+    { "meland.no", 0x9b079803, PSL_RULE },
+    { "org.lr", 0x8e54d803, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sa-east-1.elasticbeanstalk.com", 0x8c69180a, PSL_RULE },
+    { "edeka", 0x87ef180b, PSL_RULE },
+    { "dynserv.org", 0x5208980c, PSL_RULE },
+    { "rw", 0x4d47980c, PSL_RULE },
+    { "det.br", 0x49e0180e, PSL_RULE },
+    { "sandefjord.no", 0x4c0b180e, PSL_RULE },
+    { "kyowa.hokkaido.jp", 0x241cd810, PSL_RULE },
+    { "yonabaru.okinawa.jp", 0x4f02d80a, PSL_RULE },
+    { "lon-1.paas.massivegrid.net", 0x53b81812, PSL_RULE },
+    { "buzen.fukuoka.jp", 0x48521813, PSL_RULE },
+    { "edu.mg", 0x7b21d813, PSL_RULE },
+    { "cc.ia.us", 0x71f11815, PSL_RULE },
+    { "aero", 0xef1c9816, PSL_RULE },
+    { "campobasso.it", 0xee9e1816, PSL_RULE },
+    { "myfirewall.org", 0x92c61813, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ip.linodeusercontent.com", 0x5eb1581a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "muni.cz", 0x7078d81d, 0 },
+    { "gov.mv", 0x8c0cd81e, PSL_RULE },
+    { "nome.cv", 0x9931d81f, PSL_RULE },
+    { "tajiri.osaka.jp", 0x9c0b981f, PSL_RULE },
+    { "yonago.tottori.jp", 0x595d981d, PSL_RULE },
+    { "baremetal.scw.cloud", 0x37a3d822, 0 },
+    { "p.bg", 0xe1d69822, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "takatsuki.shiga.jp", 0x545c1828, PSL_RULE },
+    { "au.eu.org", 0x3721d829, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ishigaki.okinawa.jp", 0xe8f7182c, PSL_RULE },
+    { "suldal.no", 0x7144982d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "adachi.tokyo.jp", 0x3a64d835, PSL_RULE },
+    { "int.ru", 0x3b431835, PSL_RULE },
+    { "sa.gov.pl", 0x8a921837, PSL_RULE },
+    { "santafe.museum", 0x40ae5837, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "boutique", 0x050a583b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "toyonaka.osaka.jp", 0xac7b583e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edugit.io", 0xbed69841, PSL_RULE },
+    { "edu.in", 0x00b05842, PSL_RULE },
+    { "eu-south-1.amazonaws.com", 0xac331841, 0 },
+    { "localzone.xyz", 0x23181843, PSL_RULE },
+    { NULL, 0, 0 },
+    { "me.it", 0x46679846, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vfs.cloud9.eu-north-1.amazonaws.com", 0x2e9e5848, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.cl", 0xc33d584a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "myds.me", 0xacb9984e, PSL_RULE },
+    { "vt.it", 0x5b3cd84e, PSL_RULE },
+    { "square.museum", 0x1aa35850, PSL_RULE },
+    { NULL, 0, 0 },
+    { "info.sd", 0xfd269852, PSL_RULE },
+    { "tselinograd.su", 0xc0449853, PSL_RULE },
+    { NULL, 0, 0 },
+    { "serveftp.com", 0xbf931855, PSL_RULE },
+    { "trentino-alto-adige.it", 0xb9215855, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.uz", 0xacced858, PSL_RULE },
+    { "lib.in.us", 0x26f49859, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "abc", 0x016d9863, PSL_RULE },
+    { "bid", 0xd9629864, PSL_RULE },
+    { "xn--trentino-sdtirol-szb.it", 0xd2e15863, PSL_RULE },
+    { "kraanghke.no", 0xa4471866, PSL_RULE },
+    { "newmexico.museum", 0x1f569866, PSL_RULE },
+    { "pin", 0x21a41868, PSL_RULE },
+    { "tube", 0x7eead867, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "web.bo", 0x390ed86c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "app.os.fedoraproject.org", 0x53b5d86e, PSL_RULE },
+    { "ed.pw", 0xfc7ad86f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ocs.customer-oci.com", 0x5a9a1871, PSL_WILDCARD },
+    { "diamonds", 0xb0415872, PSL_RULE },
+    { "cn-northwest-1.eb.amazonaws.com.cn", 0x207d1873, PSL_RULE },
+    { "lo.it", 0x437f9873, PSL_RULE },
+    { "pueblo.bo", 0x964f5875, PSL_RULE },
+    { "nakagawa.nagano.jp", 0xe1aa1876, PSL_RULE },
+    { "kaita.hiroshima.jp", 0x902c9877, PSL_RULE },
+    { "salud.bo", 0x44221873, PSL_RULE },
+    { "williamhill", 0x6e8f1879, PSL_RULE },
+    { "feira.br", 0xe5a9587a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.hk", 0x44ba187c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kashiwara.osaka.jp", 0xdfde5881, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--mgberp4a5d4ar", 0x34d7d887, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--5rtp49c.jp", 0xca84988c, PSL_RULE },
+    { "org.ge", 0x7701188d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "acct.pro", 0x87ed188f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eu.com", 0x23a91892, PSL_RULE },
+    { "chuo.yamanashi.jp", 0xc886d893, PSL_RULE },
+    { "yanaizu.fukushima.jp", 0xc80bd893, PSL_RULE },
+    { "network", 0x8b16d895, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--uc0atv.xn--j6w193g", 0x0e4d1897, PSL_RULE },
+    { "kihoku.ehime.jp", 0xee17d898, PSL_RULE },
+    { "xn--stre-toten-zcb.no", 0x86e41899, PSL_RULE },
+    { "mordovia.su", 0x8732d89a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "virgin", 0x07d8589e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dish", 0x51b8d8a1, PSL_RULE },
+    { "mil.eg", 0xfda918a1, PSL_RULE },
+    { "bbt", 0xb2f518a3, PSL_RULE },
+    { "ms.us", 0x943518a1, PSL_RULE },
+    { "gs.mr.no", 0xcfba98a5, PSL_RULE },
+    { "telekommunikation.museum", 0x306818a3, PSL_RULE },
+    { "tempioolbia.it", 0xa600d8a7, PSL_RULE },
+    { "xn--gmqw5a.xn--j6w193g", 0xe0f498a2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "asso.ci", 0x4fd618ab, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "va", 0x592518ae, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "freiburg.museum", 0x35ca98b5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "de.us", 0x771258b8, PSL_RULE },
+    { "dnsupdate.info", 0x5c8118b9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "varggat.no", 0x0e0058bc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nativeamerican.museum", 0xfac758be, PSL_RULE },
+    { "ink", 0x57f9d8bf, PSL_RULE },
+    { "xn--vry-yla5g.no", 0xe69298c0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hk.org", 0x66d2d8c6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "info.fj", 0x354dd8c9, PSL_RULE },
+    { "beta.tailscale.net", 0xd27258ca, PSL_RULE },
+    { "unusualperson.com", 0x75d458ca, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "beiarn.no", 0x275798cf, PSL_RULE },
+    { "rs", 0x455218d0, PSL_RULE },
+    { "bar2.net", 0x42c758d1, PSL_RULE },
+    { "edu.ng", 0x75aad8d2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lacaixa", 0xde1c58d6, PSL_RULE },
+    { "olsztyn.pl", 0x640398d6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mobi.tt", 0x92e2d8da, PSL_RULE },
+    { "com.py", 0x4629d8db, PSL_RULE },
+    { "ril", 0x424cd8dc, PSL_RULE },
+    { "sk", 0x563d18db, PSL_RULE },
+    { "tomakomai.hokkaido.jp", 0x607e58db, PSL_RULE },
+    { "yolasite.com", 0x2a47d8dc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloudcontrolapp.com", 0x910958e1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "karikatur.museum", 0x835fd8e3, PSL_RULE },
+    { "or.at", 0x61e058e3, PSL_RULE },
+    { "mo.us", 0x742a58e5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shobara.hiroshima.jp", 0x6b5e18e7, PSL_RULE },
+    { "is-a-musician.com", 0x272998e8, PSL_RULE },
+    { "museum", 0xed4cd8e9, PSL_RULE },
+    { "rikubetsu.hokkaido.jp", 0x346898e9, PSL_RULE },
+    { "store.ve", 0x74fa58e9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.do", 0xfe1598ee, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jelastic.com", 0x197398f3, 0 },
+    { NULL, 0, 0 },
+    { "pubtls.org", 0xfb39d8f5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kanagawa.jp", 0x799cd900, PSL_RULE },
+    { "seek", 0xf17b9901, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vfs.cloud9.eu-west-1.amazonaws.com", 0x351d1904, PSL_RULE },
+    { "inuyama.aichi.jp", 0xe97b5905, PSL_RULE },
+    { "systems", 0x557e1905, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.uk", 0xd8875908, PSL_RULE },
+    { "xn--q9jyb4c", 0x6fb39909, PSL_RULE },
+    { "museum.no", 0x25d8190a, PSL_RULE },
+    { "gov.om", 0xd6ed590b, PSL_RULE },
+    { "haga.tochigi.jp", 0x18ef590b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "imizu.toyama.jp", 0x33b0590e, PSL_RULE },
+    { "drobak.no", 0xc825190f, PSL_RULE },
+    { "karatsu.saga.jp", 0x9dd8d90e, PSL_RULE },
+    { "lib.vi.us", 0xa172190f, PSL_RULE },
+    { "barsy.info", 0xbb62d912, PSL_RULE },
+    { "myphotos.cc", 0x2fa91912, PSL_RULE },
+    { "workisboring.com", 0xc7935910, PSL_RULE },
+    { "ta.it", 0x4f5d1915, PSL_RULE },
+    { "vps-host.net", 0xd9ac9916, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "priv.pl", 0x65d1d91a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloud.fedoraproject.org", 0xdb39d91e, PSL_RULE },
+    { "money", 0xaff2d91f, PSL_RULE },
+    { "lomo.jp", 0xec325920, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "smile", 0x0d10d927, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "miyoshi.hiroshima.jp", 0xc797992b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "read-books.org", 0x33c4d930, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bbva", 0xd9a09932, PSL_RULE },
+    { NULL, 0, 0 },
+    { "agakhan", 0x23c2d934, PSL_RULE },
+    { "fundacio.museum", 0xd43a9934, PSL_RULE },
+    { NULL, 0, 0 },
+    { "meiwa.mie.jp", 0x06c15937, PSL_RULE },
+    { "lmpm.com", 0xdd8d1938, 0 },
+    { "biella.it", 0x1db61939, PSL_RULE },
+    { "skodje.no", 0x1415593a, PSL_RULE },
+    { "xn--1lqs03n.jp", 0xb593193b, PSL_RULE },
+    { "xn--msy-ula0h.no", 0x4133993c, PSL_RULE },
+    { "heteml.net", 0xa074193d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "coach", 0x68565941, PSL_RULE },
+    { "gov.cd", 0xa92d5942, PSL_RULE },
+    { "org.nr", 0x8c2e1941, PSL_RULE },
+    { "serveexchange.com", 0x04c5d942, PSL_RULE },
+    { "tynset.no", 0x9ef5d941, PSL_RULE },
+    { "nc.tr", 0x3e829946, PSL_RULE },
+    { "minamidaito.okinawa.jp", 0x6817d947, PSL_RULE },
+    { NULL, 0, 0 },
+    { "finnoy.no", 0xd8add949, PSL_RULE },
+    { "chernivtsi.ua", 0x5cc8d94a, PSL_RULE },
+    { "higashiagatsuma.gunma.jp", 0xf952d94b, PSL_RULE },
+    { "sucks", 0x407c994c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "medecin.km", 0x51f2594e, PSL_RULE },
+    { "munakata.fukuoka.jp", 0xc543994f, PSL_RULE },
+    { "vadso.no", 0xdb7cd94f, PSL_RULE },
+    { "kasuya.fukuoka.jp", 0x975e5951, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--lury-ira.no", 0x100bd955, PSL_RULE },
+    { "jm", 0x5d2e1956, PSL_WILDCARD },
+    { "misasa.tottori.jp", 0x361cd956, PSL_RULE },
+    { "dontexist.net", 0x1ed91958, PSL_RULE },
+    { "xn--4it797k.jp", 0x30511956, PSL_RULE },
+    { NULL, 0, 0 },
+    { "friuli-vgiulia.it", 0x5514995b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "safety.aero", 0x4020995e, PSL_RULE },
+    { "dyndns.info", 0x2b6cd95f, PSL_RULE },
+    { "radio.br", 0xac749960, PSL_RULE },
+    { "saga.saga.jp", 0x2a7dd95f, PSL_RULE },
+    { "tolga.no", 0x19fa9961, PSL_RULE },
+    { "codeberg.page", 0x3e8b5963, PSL_RULE },
+    { "kasamatsu.gifu.jp", 0xc24a5964, PSL_RULE },
+    { NULL, 0, 0 },
+    { "amica", 0x96301966, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gyeonggi.kr", 0x17c71969, PSL_RULE },
+    { "spawn.cc", 0xc85e596a, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gmail", 0x90f8d96d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "c66.me", 0xbef09970, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "marriott", 0xa60f1973, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.mt", 0x3aef1975, PSL_RULE },
+    { "silk", 0x0ba75976, PSL_RULE },
+    { "tt", 0x4d455975, PSL_RULE },
+    { NULL, 0, 0 },
+    { "info.ht", 0x40c35979, PSL_RULE },
+    { "olawa.pl", 0x60709979, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bmd.br", 0x6e9d197c, PSL_RULE },
+    { "gunma.jp", 0xf8cf997d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kamigori.hyogo.jp", 0x48f95980, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "messwithdns.com", 0xd2b55983, PSL_RULE },
+    { "bokn.no", 0xa5d39984, PSL_RULE },
+    { "nl.no", 0xabb41984, PSL_RULE },
+    { "but.jp", 0xf38e9986, PSL_RULE },
+    { "onojo.fukuoka.jp", 0xc38a1984, PSL_RULE },
+    { "padova.it", 0xc4aad985, PSL_RULE },
+    { "org.se", 0x33605989, PSL_RULE },
+    { "sagamihara.kanagawa.jp", 0xbe549986, PSL_RULE },
+    { "soc.srcf.net", 0x209ed983, PSL_RULE },
+    { "xn--srfold-bya.no", 0x65d4998b, PSL_RULE },
+    { "karmoy.no", 0x568f198d, PSL_RULE },
+    { "averoy.no", 0xd45e198e, PSL_RULE },
+    { "poker", 0xa8eb998e, PSL_RULE },
+    { "sch.ir", 0xf3ea1990, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hadsel.no", 0x354c5993, PSL_RULE },
+    { "encoreapi.com", 0x85e1d994, PSL_RULE },
+    { "xn--dnna-gra.no", 0x053b9994, PSL_RULE },
+    { "yugawa.fukushima.jp", 0x153c1996, PSL_RULE },
+    { "consultant.aero", 0xfdfa9997, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cyber.museum", 0xadc3199a, PSL_RULE },
+    { "calabria.it", 0xfe5b199b, PSL_RULE },
+    { "or.id", 0x0492199b, PSL_RULE },
+    { "napoli.it", 0x8b0dd99d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "su.paba.se", 0x866e199f, PSL_RULE },
+    { "prof", 0x235899a0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "katsuura.chiba.jp", 0x6c0759a2, PSL_RULE },
+    { "qh.cn", 0x16a6d9a3, PSL_RULE },
+    { "blogspot.it", 0x11e659a4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "alta.no", 0x3cb919a8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "haboro.hokkaido.jp", 0xd3b7d9aa, PSL_RULE },
+    { "eu.pythonanywhere.com", 0xb23419ab, PSL_RULE },
+    { "cutegirl.jp", 0x381259ac, PSL_RULE },
+    { "musica.ar", 0x334a19ac, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jinsekikogen.hiroshima.jp", 0x8fffd9b4, PSL_RULE },
+    { "q.bg", 0xe2d699b5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ginoza.okinawa.jp", 0x0e4299b7, PSL_RULE },
+    { "ebiz.tw", 0x3ae0d9b8, PSL_RULE },
+    { "appengine.flow.ch", 0x440459b9, PSL_RULE },
+    { "kasumigaura.ibaraki.jp", 0xca2359b8, PSL_RULE },
+    { "org.kw", 0x620519b7, PSL_RULE },
+    { "ts.it", 0x5b3a99b7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.il.us", 0x258459be, PSL_RULE },
+    { "dattolocal.net", 0xac2019bf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "grozny.su", 0x106559c2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "download", 0x181419c9, PSL_RULE },
+    { "nom.mg", 0x71d9d9c9, PSL_RULE },
+    { "hangout", 0x57d0d9cb, PSL_RULE },
+    { "pa.gov.pl", 0x8b9219ca, PSL_RULE },
+    { "py", 0x4b5f99cc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "masoy.no", 0xe18399d1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "loans", 0xa6ecd9d4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "grosseto.it", 0x462b19d6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.in", 0xdb7a59d8, PSL_RULE },
+    { "le.it", 0x476799d9, PSL_RULE },
+    { "soundandvision.museum", 0x9fc699d9, PSL_RULE },
+    { "guide", 0xb3f219db, PSL_RULE },
+    { "basketball", 0x393999dc, PSL_RULE },
+    { "kainan.tokushima.jp", 0x696099dc, PSL_RULE },
+    { "qc.com", 0x338f99dc, PSL_RULE },
+    { "cc.as.us", 0x454b99df, PSL_RULE },
+    { "wafaicloud.com", 0x2a59d9db, 0 },
+    { "maserati", 0xc095d9e1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "arts.museum", 0x683ed9e3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "okinawa.okinawa.jp", 0x9be019e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "app.gp", 0x36d1d9e9, PSL_RULE },
+    { "edu.tr", 0x9f4359e9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sakurai.nara.jp", 0x608919ed, PSL_RULE },
+    { NULL, 0, 0 },
+    { "marketing", 0x7b3099ef, PSL_RULE },
+    { "oppdal.no", 0x90ac59f0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mazury.pl", 0x837019f3, PSL_RULE },
+    { "y.se", 0xb47899f4, PSL_RULE },
+    { "govt.nz", 0xd71c19f5, PSL_RULE },
+    { "bbc", 0x026d99f6, PSL_RULE },
+    { "dyndns.org", 0x1bc819f7, PSL_RULE },
+    { "lib.sc.us", 0xa08419f6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mihama.wakayama.jp", 0xb056da02, PSL_RULE },
+    { "xn--q7ce6a", 0x15bb1a02, PSL_RULE },
+    { "edu.zm", 0xe1ee1a04, PSL_RULE },
+    { "izena.okinawa.jp", 0x91369a04, PSL_RULE },
+    { "adv.br", 0xf0109a06, PSL_RULE },
+    { "leikanger.no", 0x77ca1a04, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kawahara.tottori.jp", 0x86dd1a0a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hatoyama.saitama.jp", 0xaee1da0d, PSL_RULE },
+    { "nonoichi.ishikawa.jp", 0xa071da0d, PSL_RULE },
+    { "speedpartner.de", 0x21fc1a0f, 0 },
+    { "iwanai.hokkaido.jp", 0x7a17da10, PSL_RULE },
+    { "alwaysdata.net", 0x3389da11, PSL_RULE },
+    { "ax", 0x40635a12, PSL_RULE },
+    { "net.me", 0xbd955a12, PSL_RULE },
+    { "kibichuo.okayama.jp", 0x381c5a14, PSL_RULE },
+    { "tiffany", 0x7d1d1a10, PSL_RULE },
+    { "xn--c1avg", 0xf59c9a0f, PSL_RULE },
+    { "cryptonomic.net", 0x6df99a17, PSL_WILDCARD },
+    { "s3.fr-par.scw.cloud", 0xbe1c1a17, PSL_RULE },
+    { "jefferson.museum", 0x874d1a19, PSL_RULE },
+    { "tf", 0x5922da17, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "oki.fukuoka.jp", 0xdff0da20, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.ga.us", 0xf68b9a24, PSL_RULE },
+    { NULL, 0, 0 },
+    { "flt.cloud.muni.cz", 0x76469a26, PSL_RULE },
+    { "dev.vu", 0x9f6a1a27, PSL_RULE },
+    { "akamaiorigin.net", 0xeb1f5a28, PSL_RULE },
+    { "froya.no", 0xe008da29, PSL_RULE },
+    { "gon.pk", 0xc5515a28, PSL_RULE },
+    { "presse.ml", 0x320a1a26, PSL_RULE },
+    { NULL, 0, 0 },
+    { "myfritz.net", 0x85d25a2d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "inagawa.hyogo.jp", 0x22b7da2f, PSL_RULE },
+    { "info.tr", 0xe8ca5a2f, PSL_RULE },
+    { "int.co", 0xa8bfda30, PSL_RULE },
+    { "q-a.eu.org", 0x2d211a30, PSL_RULE },
+    { "xn--hpmir-xqa.no", 0xf05cda31, PSL_RULE },
+    { "github.io", 0x346e1a34, PSL_RULE },
+    { "samsclub", 0x1a3d5a35, PSL_RULE },
+    { "pinb.gov.pl", 0x0e791a36, PSL_RULE },
+    { "pittsburgh.museum", 0x05ef5a37, PSL_RULE },
+    { "org.af", 0xdc9e5a38, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "colonialwilliamsburg.museum", 0x39e05a3c, PSL_RULE },
+    { "xn--rady-ira.no", 0xaae95a3d, PSL_RULE },
+    { "avocats.bj", 0x8b54da3e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nichinan.miyazaki.jp", 0x5aed9a40, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.mt.us", 0xb1e49a46, PSL_RULE },
+    { "shisui.chiba.jp", 0xdced9a47, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "reserve-online.net", 0xaf175a4a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "allfinanz", 0xfffa9a4c, PSL_RULE },
+    { "net.pl", 0x24581a4c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "agrigento.it", 0x88015a50, PSL_RULE },
+    { "conf.au", 0xbf511a51, PSL_RULE },
+    { "cdn77-secure.org", 0xd74f5a52, 0 },
+    { NULL, 0, 0 },
+    { "aig", 0x672ada54, PSL_RULE },
+    { "global.ssl.fastly.net", 0x21ca1a54, PSL_RULE },
+    { "naka.hiroshima.jp", 0x38f7da56, PSL_RULE },
+    { "room", 0x0d84da54, PSL_RULE },
+    { "s3-external-1.amazonaws.com", 0x69bb5a57, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gsm.pl", 0x47809a5a, PSL_RULE },
+    { "tono.iwate.jp", 0x962ada5b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--skjervy-v1a.no", 0x8f139a5d, PSL_RULE },
+    { "oum.gov.pl", 0xa7339a5e, PSL_RULE },
+    { "filegear-jp.me", 0xb3185a5f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "catanzaro.it", 0xdc2dda61, PSL_RULE },
+    { "hr.eu.org", 0x40151a61, PSL_RULE },
+    { "rockart.museum", 0x70595a61, PSL_RULE },
+    { "sanjo.niigata.jp", 0x6609da61, PSL_RULE },
+    { "ss", 0x46521a63, PSL_RULE },
+    { "starachowice.pl", 0x9d5f1a66, PSL_RULE },
+    { "kuju.oita.jp", 0x3cca9a67, PSL_RULE },
+    { "stolos.io", 0x9e60da67, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.pa.us", 0x0d6d9a6d, PSL_RULE },
+    { "pk", 0x573d1a6e, PSL_RULE },
+    { "us-east-1.amazonaws.com", 0xdf2e9a6f, PSL_RULE },
+    { "pokrovsk.su", 0x1aa61a70, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "toyooka.hyogo.jp", 0x6273da73, PSL_RULE },
+    { NULL, 0, 0 },
+    { "miyako.fukuoka.jp", 0x71d31a75, PSL_RULE },
+    { "rep.kp", 0x5889da75, PSL_RULE },
+    { "xn--gecrj9c", 0xeb009a76, PSL_RULE },
+    { "children.museum", 0xcd589a78, PSL_RULE },
+    { "microlight.aero", 0xc1491a78, PSL_RULE },
+    { "uji.kyoto.jp", 0x8e21da79, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "data", 0x1078da7d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tachiarai.fukuoka.jp", 0xd052da7f, PSL_RULE },
+    { "rip", 0x5340da80, PSL_RULE },
+    { "edu.my", 0xfd7e9a81, PSL_RULE },
+    { "miyazu.kyoto.jp", 0xc28b1a82, PSL_RULE },
+    { "s3-eu-central-1.amazonaws.com", 0x3bb49a82, PSL_RULE },
+    { "shingu.fukuoka.jp", 0x6de3da83, PSL_RULE },
+    { "ge", 0x3a1a5a85, PSL_RULE },
+    { "tm.fr", 0x894d1a84, PSL_RULE },
+    { "skole.museum", 0xf4da5a87, PSL_RULE },
+    { "ueda.nagano.jp", 0x3cef5a86, PSL_RULE },
+    { "pramerica", 0x111b1a89, PSL_RULE },
+    { "unicom", 0x98791a88, PSL_RULE },
+    { "yaotsu.gifu.jp", 0xa5c0da81, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.mk", 0x812bda8d, PSL_RULE },
+    { "pro.in", 0x638bda8d, PSL_RULE },
+    { "rexroth", 0xf004da8f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ec", 0x5c299a95, PSL_RULE },
+    { "eidsvoll.no", 0xb8441a96, PSL_RULE },
+    { NULL, 0, 0 },
+    { "qa2.com", 0xf8621a98, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.events", 0x7c115a9a, PSL_RULE },
+    { "selje.no", 0x8efa9a9b, PSL_RULE },
+    { "cinema.museum", 0xdd7eda9c, PSL_RULE },
+    { "act.au", 0x26e35a9d, PSL_RULE },
+    { "blogspot.fr", 0xc813da9d, PSL_RULE },
+    { "oxford.museum", 0x28c75a9f, PSL_RULE },
+    { "co.zw", 0x83355aa0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--c3s14m.jp", 0xb7141aa4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cfa", 0x423d9aa7, PSL_RULE },
+    { "chu.jp", 0xbfef5aa7, PSL_RULE },
+    { "mil.py", 0xd3b09aa8, PSL_RULE },
+    { "localhistory.museum", 0xcc325aaa, PSL_RULE },
+    { "enterprises", 0x92749aab, PSL_RULE },
+    { "org.zw", 0xc30ddaac, PSL_RULE },
+    { "schulserver.de", 0xcca91aaa, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.pt", 0x9b455aaf, PSL_RULE },
+    { "cs.in", 0xd1601ab0, PSL_RULE },
+    { "trustee.museum", 0xba441aaf, PSL_RULE },
+    { "cf-ipfs.com", 0xc7001ab2, PSL_RULE },
+    { "gov.sd", 0xf3e39ab2, PSL_RULE },
+    { "net.gn", 0xcfe21ab3, PSL_RULE },
+    { "webhosting.be", 0x0037dab0, PSL_RULE },
+    { "origin.cdn77-secure.org", 0x8d565ab6, 0 },
+    { "monticello.museum", 0x2faedab7, PSL_RULE },
+    { "slask.pl", 0xcdcbdab7, PSL_RULE },
+    { "s3.pl-waw.scw.cloud", 0x05611ab9, PSL_RULE },
+    { "xn--vads-jra.no", 0x8ebf1ab0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--mgbqly7c0a67fbc", 0x0f611abe, PSL_RULE },
+    { "gov.as", 0x49d6dabf, PSL_RULE },
+    { "kadoma.osaka.jp", 0x24e61abf, PSL_RULE },
+    { "independent-commission.uk", 0x87031ac1, PSL_RULE },
+    { "xn--uist22h.jp", 0xdf349ac2, PSL_RULE },
+    { "kamitsue.oita.jp", 0xbadddac3, PSL_RULE },
+    { "xn--snsa-roa.no", 0xd5af9ac4, PSL_RULE },
+    { "k8s.nl-ams.scw.cloud", 0xdf5a1ac5, PSL_RULE },
+    { "wphostedmail.com", 0x3c991ac5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ren", 0x2b999aca, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "name.pm", 0xf52f9acf, PSL_RULE },
+    { "trento.it", 0xb3589ad0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "api.stdlib.com", 0x6a565ad2, PSL_RULE },
+    { "lecco.it", 0x1a77dad2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "campidanomedio.it", 0xebeb1ad6, PSL_RULE },
+    { "wielun.pl", 0x08cc9ad7, PSL_RULE },
+    { "klepp.no", 0x5fc81ad8, PSL_RULE },
+    { "tjx", 0xc4789ad9, PSL_RULE },
+    { "tsushima.nagasaki.jp", 0x43f61ada, PSL_RULE },
+    { "rehab", 0x91eddadb, PSL_RULE },
+    { "s3-ap-southeast-1.amazonaws.com", 0x638bdadc, PSL_RULE },
+    { "trentino-s-tirol.it", 0xa3c9dadc, PSL_RULE },
+    { "mobi", 0x5d075ade, PSL_RULE },
+    { "rakkestad.no", 0x57139ade, PSL_RULE },
+    { "workinggroup.aero", 0xafa85ad6, PSL_RULE },
+    { "hlx3.page", 0x31479ae1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "egersund.no", 0x29865ae5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chicappa.jp", 0xf4581ae8, PSL_RULE },
+    { "ac.ug", 0x7125dae9, PSL_RULE },
+    { "cahcesuolo.no", 0x7bf79aea, PSL_RULE },
+    { "from.hr", 0xfe629aeb, PSL_RULE },
+    { "gov.ss", 0x1ef21ae9, PSL_RULE },
+    { "km", 0x5e2e1ae9, PSL_RULE },
+    { "maritimo.museum", 0x13c95aed, PSL_RULE },
+    { "edu.ms", 0x46e51aef, PSL_RULE },
+    { "jele.club", 0x2a325aef, PSL_RULE },
+    { "ichinoseki.iwate.jp", 0x3d219af1, PSL_RULE },
+    { "police.uk", 0x8e77daef, PSL_RULE },
+    { "net.ve", 0x638b1af3, PSL_RULE },
+    { "gyokuto.kumamoto.jp", 0x0b595af4, PSL_RULE },
+    { "mosvik.no", 0x2b111af5, PSL_RULE },
+    { "andriabarlettatrani.it", 0x41e51af6, PSL_RULE },
+    { "aq.it", 0x5a361af6, PSL_RULE },
+    { "seidat.net", 0x56375aee, PSL_RULE },
+    { "123website.lu", 0xdc1e5af9, PSL_RULE },
+    { "nowtv", 0xb4b05af9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kakegawa.shizuoka.jp", 0x4ffedaff, PSL_RULE },
+    { "toho.fukuoka.jp", 0x00c3daff, PSL_RULE },
+    { "komono.mie.jp", 0x4745db01, PSL_RULE },
+    { "forumz.info", 0x50a0db02, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "palace.museum", 0x50791b05, PSL_RULE },
+    { NULL, 0, 0 },
+    { "safety", 0x36dcdb07, PSL_RULE },
+    { "net.ky", 0xe2b21b08, PSL_RULE },
+    { "otap.co", 0x7f3a5b09, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "amsterdam", 0xe6f41b0b, PSL_RULE },
+    { "kawakami.nagano.jp", 0x1bcbdb0b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lubartow.pl", 0x30b3db13, PSL_RULE },
+    { "org.sh", 0x7bab1b14, PSL_RULE },
+    { "telebit.app", 0xc85d5b15, PSL_RULE },
+    { "whoswho", 0xda149b14, PSL_RULE },
+    { "lt.ua", 0x64e65b17, PSL_RULE },
+    { "ol.no", 0xacb41b17, PSL_RULE },
+    { "xn--m3ch0j3a.xn--o3cw4h", 0xda87db16, PSL_RULE },
+    { "yamada.toyama.jp", 0x9fd61b17, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hepforge.org", 0x51cd1b1d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yamanashi.jp", 0xe0ee1b20, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lancia", 0x0f5b9b23, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ru.net", 0x502e5b29, PSL_RULE },
+    { "tecnologia.bo", 0x12ad9b29, PSL_RULE },
+    { "ntr.br", 0x48ee1b2b, PSL_RULE },
+    { "cloud9.ap-northeast-2.amazonaws.com", 0x42bf9b2c, 0 },
+    { "yk.ca", 0x843d1b2d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "figueres.museum", 0xa01a1b2f, PSL_RULE },
+    { "ab.ca", 0x8052db30, PSL_RULE },
+    { "hornindal.no", 0x780adb31, PSL_RULE },
+    { "from-ne.com", 0x55049b32, PSL_RULE },
+    { "pw", 0x4f479b32, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eating-organic.net", 0xeed1db38, PSL_RULE },
+    { "ha.cn", 0x13bc9b39, PSL_RULE },
+    { "md", 0x641cdb3a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.wy.us", 0x7d105b3c, PSL_RULE },
+    { "asahikawa.hokkaido.jp", 0xd3359b3d, PSL_RULE },
+    { "com.ve", 0x741f5b3d, PSL_RULE },
+    { "es.eu.org", 0x17129b3f, PSL_RULE },
+    { "blackbaudcdn.net", 0x29f49b40, PSL_RULE },
+    { "miasa.nagano.jp", 0x33171b3e, PSL_RULE },
+    { "lelux.site", 0x6afc9b42, PSL_RULE },
+    { "per.nf", 0x7f705b3c, PSL_RULE },
+    { "mitsubishi", 0xdb631b44, PSL_RULE },
+    { "tmall", 0x786e1b45, PSL_RULE },
+    { "xn--bozen-sdtirol-2ob.it", 0xc8de5b3e, PSL_RULE },
+    { "edu.ph", 0x64615b47, PSL_RULE },
+    { "secret.jp", 0x5ef65b47, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chikushino.fukuoka.jp", 0xb5f31b4e, PSL_RULE },
+    { "kounosu.saitama.jp", 0xd4405b4f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ami.ibaraki.jp", 0x26c05b51, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "123kotisivu.fi", 0xa0f49b54, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "public.museum", 0xb7171b5a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "int.ni", 0x60dddb5d, PSL_RULE },
+    { "jll", 0x3c599b5d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mad.museum", 0xc3459b61, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mutual.ar", 0x2abfdb6a, PSL_RULE },
+    { "brunel.museum", 0x853b1b6b, PSL_RULE },
+    { "associates", 0xc0265b6c, PSL_RULE },
+    { "iide.yamagata.jp", 0xe16a9b6b, PSL_RULE },
+    { "mypep.link", 0x2d77db6c, PSL_RULE },
+    { "us-gov-west-1.elasticbeanstalk.com", 0xb90bdb6f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pt.it", 0x5d3cdb74, PSL_RULE },
+    { NULL, 0, 0 },
+    { "taa.it", 0x525b1b76, PSL_RULE },
+    { "cc.nj.us", 0xbfa29b77, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "s3.nl-ams.scw.cloud", 0x8e179b7d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "baby", 0xe9a31b81, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "from-nc.com", 0x55665b84, PSL_RULE },
+    { "nasu.tochigi.jp", 0x27209b85, PSL_RULE },
+    { NULL, 0, 0 },
+    { "x.se", 0xb5789b87, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "r.cdn77.net", 0x676e9b8b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "miura.kanagawa.jp", 0xc22a9b8e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "castres.museum", 0x2e001b90, PSL_RULE },
+    { "homesecuritymac.com", 0xbb4f1b90, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "curitiba.br", 0xcd7bdb98, PSL_RULE },
+    { "no.it", 0x457f9b99, PSL_RULE },
+    { "kashiba.nara.jp", 0xe26d5b9a, PSL_RULE },
+    { "railway.museum", 0x4b541b98, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cog.mi.us", 0xd4bf9b9e, PSL_RULE },
+    { "gov.sh", 0xc4e31b9e, PSL_RULE },
+    { "int.ci", 0xeb42db9e, PSL_RULE },
+    { "neustar", 0xc62f5b9f, PSL_RULE },
+    { "shibata.miyagi.jp", 0xc2969ba1, PSL_RULE },
+    { "xn--hkkinen-5wa.fi", 0xb794dba0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ogose.saitama.jp", 0xcf571ba6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "from-pa.com", 0x30085ba8, PSL_RULE },
+    { "unispace.io", 0x20f7dba9, 0 },
+    { "co.je", 0xfb071baa, PSL_RULE },
+    { "gov.gu", 0x7d111bab, PSL_RULE },
+    { "jelastic.dogado.eu", 0x43d0dbac, PSL_RULE },
+    { "adobeaemcloud.com", 0x6e5b1bad, PSL_RULE },
+    { "tsubetsu.hokkaido.jp", 0xea2a9baa, PSL_RULE },
+    { "wake.okayama.jp", 0x7a429baa, PSL_RULE },
+    { "virtuel.museum", 0xea729bb0, PSL_RULE },
+    { "wf", 0x5a22dbaa, PSL_RULE },
+    { "fuettertdasnetz.de", 0x67339bb2, PSL_RULE },
+    { "skanit.no", 0x6c771bb2, PSL_RULE },
+    { "cloud9.us-east-2.amazonaws.com", 0x02c45bb4, 0 },
+    { NULL, 0, 0 },
+    { "domains", 0xb9a1dbb6, PSL_RULE },
+    { "kunisaki.oita.jp", 0xf5111bb7, PSL_RULE },
+    { "dynns.com", 0x02585bb8, PSL_RULE },
+    { "bridgestone", 0x5baddbb9, PSL_RULE },
+    { "minami.kyoto.jp", 0xec71dbb6, PSL_RULE },
+    { "tysfjord.no", 0x1c4c5bbb, PSL_RULE },
+    { "from-sd.com", 0xaf871bbc, PSL_RULE },
+    { "berlin", 0x28309bbd, PSL_RULE },
+    { "us-east-2.elasticbeanstalk.com", 0x55ff9bbb, PSL_RULE },
+    { "tsukui.kanagawa.jp", 0xdd8c1bbf, PSL_RULE },
+    { "wif.gov.pl", 0xb9ae9bb7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ama.shimane.jp", 0x4d5f1bc3, PSL_RULE },
+    { "ltd.hk", 0x00d55bc4, PSL_RULE },
+    { "delivery", 0xe0885bc5, PSL_RULE },
+    { "muika.niigata.jp", 0xe3851bc5, PSL_RULE },
+    { "ks.us", 0x96351bc7, PSL_RULE },
+    { "latino", 0xf7b55bc8, PSL_RULE },
+    { "priv.instances.scw.cloud", 0x1e835bc6, PSL_RULE },
+    { "prod", 0x21c1dbc6, PSL_RULE },
+    { "org.im", 0x1071dbcb, PSL_RULE },
+    { "sakegawa.yamagata.jp", 0xcc3b1bc4, PSL_RULE },
+    { "termez.su", 0xea92dbc6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "historisch.museum", 0x718ddbcf, PSL_RULE },
+    { "industria.bo", 0xd3d3dbcf, PSL_RULE },
+    { "kosuge.yamanashi.jp", 0x6d4b5bd0, PSL_RULE },
+    { "accident-investigation.aero", 0xf1c05bd2, PSL_RULE },
+    { "mordovia.ru", 0xdded5bd3, PSL_RULE },
+    { "pa", 0x5b251bd4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "history.museum", 0x40461bd7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aquila.it", 0xd068dbdd, PSL_RULE },
+    { "lcl.dev", 0xdd079bdd, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gz.cn", 0x2cd41be3, PSL_RULE },
+    { "xn--stjrdalshalsen-sqb.no", 0x9947dbe3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "balestrand.no", 0x425f5be8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "judaica.museum", 0x1ad35bea, PSL_RULE },
+    { NULL, 0, 0 },
+    { "abashiri.hokkaido.jp", 0x3f695bec, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "in.na", 0xd7f15bf1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.fl.us", 0xfbf8dbf3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ps", 0x47521bf6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nz", 0x4367dbf9, PSL_RULE },
+    { "moonscale.io", 0xeb6b1bfa, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "in-butter.de", 0x8d139bfe, PSL_RULE },
+    { "trentino.it", 0x2b461bff, PSL_RULE },
+    { NULL, 0, 0 },
+    { "broke-it.net", 0xf2841c01, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sweetpepper.org", 0x5af95c07, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.us", 0x762a5c0b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "stalbans.museum", 0x8d151c0d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "githubusercontent.com", 0x2e519c11, PSL_RULE },
+    { "hoplix.shop", 0xac205c11, PSL_RULE },
+    { "gs.sf.no", 0xea5d9c13, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--h1aliz.xn--p1acf", 0x4bdc5c15, PSL_RULE },
+    { "web.lk", 0x238a5c16, PSL_RULE },
+    { "from-ga.com", 0x24af5c17, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.lc", 0x6e629c1e, PSL_RULE },
+    { "info.az", 0x071e9c1e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shop.th", 0x8f7d9c21, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.mo.us", 0x00b65c24, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ichiba.tokushima.jp", 0x8fffdc26, PSL_RULE },
+    { "ibaraki.ibaraki.jp", 0x4cca9c27, PSL_RULE },
+    { "kozagawa.wakayama.jp", 0xd97c1c26, PSL_RULE },
+    { "otsuka", 0x95c4dc28, PSL_RULE },
+    { "bytemark.co.uk", 0xee155c2a, 0 },
+    { "school.museum", 0xaa759c29, PSL_RULE },
+    { "tj", 0x593f5c2b, PSL_RULE },
+    { "training", 0x8903dc27, PSL_RULE },
+    { "dontexist.com", 0x97775c2e, PSL_RULE },
+    { "toyohashi.aichi.jp", 0x022a9c2f, PSL_RULE },
+    { "tsukigata.hokkaido.jp", 0x537fdc2e, PSL_RULE },
+    { "leasing.aero", 0xa6c19c31, PSL_RULE },
+    { "noboribetsu.hokkaido.jp", 0xe8339c31, PSL_RULE },
+    { "webview-assets.cloud9.af-south-1.amazonaws.com", 0x79545c2b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--bod-2na.no", 0x445a5c35, PSL_RULE },
+    { NULL, 0, 0 },
+    { "test.tj", 0x386b5c37, PSL_RULE },
+    { "it1.eur.aruba.jenv-aruba.cloud", 0x66829c38, PSL_RULE },
+    { "tsukiyono.gunma.jp", 0x27f5dc38, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cyon.site", 0xb5d4dc3d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dyndns-remote.com", 0x252a9c3f, PSL_RULE },
+    { "gov.eg", 0x78825c3f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "uk.primetel.cloud", 0x50ce1c42, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "emilia-romagna.it", 0x4836dc45, PSL_RULE },
+    { "salzburg.museum", 0x395adc45, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.nr", 0x2e82dc4c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pp.az", 0x0c3a1c4e, PSL_RULE },
+    { "goiania.br", 0xb9a51c4f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chippubetsu.hokkaido.jp", 0x17de1c55, PSL_RULE },
+    { NULL, 0, 0 },
+    { "semboku.akita.jp", 0x2c37dc57, PSL_RULE },
+    { "trentino-sudtirol.it", 0x80db9c58, PSL_RULE },
+    { "com.na", 0xf3f65c59, PSL_RULE },
+    { NULL, 0, 0 },
+    { "glass", 0xcf619c5b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "moka.tochigi.jp", 0x24859c62, PSL_RULE },
+    { "hareid.no", 0x4f0d1c63, PSL_RULE },
+    { "co.no", 0xb8b05c64, PSL_RULE },
+    { "ac.cy", 0x5a9e5c65, PSL_RULE },
+    { "horse", 0xdb581c66, PSL_RULE },
+    { "filegear-ie.me", 0x2344dc67, PSL_RULE },
+    { "com.lb", 0x237f1c68, PSL_RULE },
+    { "naturalhistory.museum", 0x6c285c64, PSL_RULE },
+    { "iobb.net", 0xa979dc6a, PSL_RULE },
+    { "ito.shizuoka.jp", 0xe1cbdc6b, PSL_RULE },
+    { "nsupdate.info", 0xaa771c67, PSL_RULE },
+    { "pro.cy", 0xdddb5c68, PSL_RULE },
+    { "nysa.pl", 0xb6219c6e, PSL_RULE },
+    { "balena-devices.com", 0xf35d1c6f, PSL_RULE },
+    { "akishima.tokyo.jp", 0xfe981c70, PSL_RULE },
+    { "asda", 0x47ae1c70, PSL_RULE },
+    { "song", 0x95261c72, PSL_RULE },
+    { "eti.br", 0x8f16dc73, PSL_RULE },
+    { "j.scaleforce.com.cy", 0x00fd9c73, PSL_RULE },
+    { "amot.no", 0x20b31c75, PSL_RULE },
+    { "sc.leg.br", 0x3e471c75, PSL_RULE },
+    { "vestby.no", 0x49399c6f, PSL_RULE },
+    { "homelinux.org", 0x48b29c78, PSL_RULE },
+    { "date", 0x09c85c79, PSL_RULE },
+    { "mo.cn", 0x12b81c78, PSL_RULE },
+    { "obama.nagasaki.jp", 0x8a12dc78, PSL_RULE },
+    { "sr.gov.pl", 0x82b6dc78, PSL_RULE },
+    { "xn--wgbl6a", 0x4ba35c76, PSL_RULE },
+    { "zarow.pl", 0x13715c74, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "caserta.it", 0x01c81c81, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jele.host", 0x84c49c85, PSL_RULE },
+    { NULL, 0, 0 },
+    { "roros.no", 0xfcbc1c87, PSL_RULE },
+    { NULL, 0, 0 },
+    { "up.in", 0xc763dc89, PSL_RULE },
+    { "quebec", 0x44d41c8a, PSL_RULE },
+    { "lindesnes.no", 0x2a489c8b, PSL_RULE },
+    { "webview-assets.cloud9.eu-west-2.amazonaws.com", 0x29cc1c8b, PSL_RULE },
+    { "org.sy", 0x8b569c8d, PSL_RULE },
+    { "gv.ao", 0x4d509c8e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yoshinogari.saga.jp", 0x5460dc91, PSL_RULE },
+    { "teshikaga.hokkaido.jp", 0x08191c92, PSL_RULE },
+    { "alipay", 0xc7ac9c93, PSL_RULE },
+    { "i234.me", 0xc2e59c93, PSL_RULE },
+    { "susono.shizuoka.jp", 0x34d55c94, PSL_RULE },
+    { "git-repos.de", 0xa6775c96, PSL_RULE },
+    { "best", 0xf1cd9c97, PSL_RULE },
+    { "no-ip.co.uk", 0x12359c96, PSL_RULE },
+    { "urayasu.chiba.jp", 0x0beadc98, PSL_RULE },
+    { "xn--3pxu8k", 0xa0a09c9a, PSL_RULE },
+    { "kamishihoro.hokkaido.jp", 0xcfd99c9b, PSL_RULE },
+    { "jessheim.no", 0xda831c9c, PSL_RULE },
+    { "repbody.aero", 0x10055c9b, PSL_RULE },
+    { "art.ht", 0x7e3e9c9e, PSL_RULE },
+    { "ilawa.pl", 0x62709c9f, PSL_RULE },
+    { "chihayaakasaka.osaka.jp", 0x006c9ca0, PSL_RULE },
+    { "net.ni", 0x5bef1c9f, PSL_RULE },
+    { "stockholm.museum", 0x435b5c9b, PSL_RULE },
+    { "kitagawa.miyazaki.jp", 0x682d1ca3, PSL_RULE },
+    { "edu.ru", 0x8811dca4, PSL_RULE },
+    { "myspreadshop.dk", 0x7a189ca3, PSL_RULE },
+    { "webview-assets.cloud9.ap-northeast-3.amazonaws.com", 0xcfbf5ca6, PSL_RULE },
+    { "talk", 0x1e925ca7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "aarp", 0xde399ca9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cargo.aero", 0xb78c5cac, PSL_RULE },
+    { NULL, 0, 0 },
+    { "style", 0xd4d05cae, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dev-builder.code.com", 0x7f6c9cb0, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "collegefan.org", 0x663e5cb3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dualstack.sa-east-1.amazonaws.com", 0x24971cb7, 0 },
+    { "s3-eu-west-2.amazonaws.com", 0x7a761cb7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.ms.us", 0x84245cbb, PSL_RULE },
+    { "ownip.net", 0xe64a9cbb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "save", 0xfdd21cbe, PSL_RULE },
+    { NULL, 0, 0 },
+    { "coal.museum", 0xe6cf9cc0, PSL_RULE },
+    { "yakage.okayama.jp", 0xb5941cc0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "awsglobalaccelerator.com", 0x0d501cc3, PSL_RULE },
+    { "azumino.nagano.jp", 0xb80adcc4, PSL_RULE },
+    { "gov.tl", 0xf0e65cc3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.co.nz", 0x6cec1cc7, PSL_RULE },
+    { "framer.media", 0x61e19cc8, PSL_RULE },
+    { "homes", 0xaaf1dcc7, PSL_RULE },
+    { "komatsu.ishikawa.jp", 0xb95c5cc8, PSL_RULE },
+    { "sh.cn", 0x18a6dcc9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kawai.nara.jp", 0x23739cce, PSL_RULE },
+    { "org.do", 0xdd869cce, PSL_RULE },
+    { "fyresdal.no", 0x16299cd0, PSL_RULE },
+    { "solutions", 0x55fbdccf, PSL_RULE },
+    { "wa.edu.au", 0x11449cd1, PSL_RULE },
+    { "xn--uc0atv.tw", 0x8dfd5ccf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "amli.no", 0x6ac2dcd5, PSL_RULE },
+    { "storage", 0x21ac1cd6, PSL_RULE },
+    { "abc.br", 0x1528dcd7, PSL_RULE },
+    { "american.museum", 0xf89c5cd7, PSL_RULE },
+    { "akrehamn.no", 0xe8631cd9, PSL_RULE },
+    { "cable-modem.org", 0x1fee9cd9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "unazuki.toyama.jp", 0x6c17dcdd, PSL_RULE },
+    { "jgora.pl", 0x1779dcde, PSL_RULE },
+    { "vs.it", 0x5d3a9cdd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.gg", 0x4a6a9ce1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.sa", 0x8a381ce3, PSL_RULE },
+    { "isesaki.gunma.jp", 0x5a3edce4, PSL_RULE },
+    { "misaki.okayama.jp", 0xc0ecdce4, PSL_RULE },
+    { "okuma.fukushima.jp", 0xbf469ce3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "myspreadshop.ie", 0x6bef9ce8, PSL_RULE },
+    { "labor.museum", 0xaaee5ce9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "jelastic.team", 0xfe17dceb, PSL_RULE },
+    { "yoshida.saitama.jp", 0x9b4c5cec, PSL_RULE },
+    { NULL, 0, 0 },
+    { "medecin.fr", 0xed98dcee, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "arte", 0x14a39cf1, PSL_RULE },
+    { "cc.va.us", 0x940b5cf2, PSL_RULE },
+    { "in-vpn.org", 0x77b41cf3, PSL_RULE },
+    { "force.museum", 0xfa001cf4, PSL_RULE },
+    { "org.gt", 0x21421cf4, PSL_RULE },
+    { "racing", 0x6e32dcf3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.mg", 0xbfad1cf9, PSL_RULE },
+    { "gov.ly", 0x5564dcfa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-an-artist.com", 0xb924dd00, PSL_RULE },
+    { "progressive", 0x31df5d00, PSL_RULE },
+    { "space.museum", 0x6ebe5d01, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dk.eu.org", 0x264edd04, PSL_RULE },
+    { "isshiki.aichi.jp", 0x8a989d05, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.es", 0x70a69d07, PSL_RULE },
+    { "org.kg", 0x452fdd07, PSL_RULE },
+    { "ping", 0x90189d09, PSL_RULE },
+    { "hdfcbank", 0x28561d0a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.financial", 0x860a1d0c, PSL_RULE },
+    { "fedje.no", 0x08e91d0c, PSL_RULE },
+    { "inazawa.aichi.jp", 0x55ad9d0c, PSL_RULE },
+    { "jelastic.cloud", 0xf72c9d0f, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gouv.km", 0xc1ad1d12, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "amami.kagoshima.jp", 0x49921d16, PSL_RULE },
+    { "cn", 0x56365d16, PSL_RULE },
+    { "schokoladen.museum", 0x25d0dd16, PSL_RULE },
+    { "xn--sandnessjen-ogb.no", 0x8de6dd19, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "campania.it", 0x103d5d1c, PSL_RULE },
+    { "jerusalem.museum", 0x066b5d1d, PSL_RULE },
+    { "minamata.kumamoto.jp", 0x83f69d1e, PSL_RULE },
+    { "fukuoka.jp", 0x8a8e5d1f, PSL_RULE },
+    { "1337.pictures", 0x75ad5d20, PSL_RULE },
+    { NULL, 0, 0 },
+    { "randaberg.no", 0x82985d22, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mcpre.ru", 0x88ac1d25, PSL_RULE },
+    { "devices.resinstaging.io", 0x86ef9d26, PSL_RULE },
+    { "onred.one", 0x5bd05d25, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.iq", 0x31b25d2a, PSL_RULE },
+    { "sadist.jp", 0x9ec55d2b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yawata.kyoto.jp", 0xd2695d2e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--czrs0t", 0xbb4f5d33, PSL_RULE },
+    { NULL, 0, 0 },
+    { "global.prod.fastly.net", 0xa0371d35, PSL_RULE },
+    { "hisayama.fukuoka.jp", 0xc5d0dd36, PSL_RULE },
+    { "recife.br", 0x3a735d35, PSL_RULE },
+    { "digick.jp", 0x3099dd38, PSL_RULE },
+    { "shimokitayama.nara.jp", 0x1bd3dd38, PSL_RULE },
+    { "xn--9krt00a", 0x48555d36, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "biz.bb", 0x32f65d3e, PSL_RULE },
+    { "githubpreview.dev", 0x81921d3f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "karumai.iwate.jp", 0x11959d41, PSL_RULE },
+    { "inf.ua", 0xab9e1d42, PSL_RULE },
+    { "otsuki.yamanashi.jp", 0x0c8f5d43, PSL_RULE },
+    { "nid.io", 0x06685d44, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chijiwa.nagasaki.jp", 0x44385d49, PSL_RULE },
+    { "in.ni", 0xa1855d49, PSL_RULE },
+    { "zombie.jp", 0x77269d49, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "minnesota.museum", 0xe751dd53, PSL_RULE },
+    { "pigboat.jp", 0xfb4d9d53, PSL_RULE },
+    { "go.tj", 0xc1f19d55, PSL_RULE },
+    { "portlligat.museum", 0xf119dd53, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fi.eu.org", 0x28535d58, PSL_RULE },
+    { "js.org", 0x64e65d58, PSL_RULE },
+    { "yamashina.kyoto.jp", 0x2eed1d58, PSL_RULE },
+    { NULL, 0, 0 },
+    { "is-a-cubicle-slave.com", 0xf80b1d5c, PSL_RULE },
+    { "dyndns-blog.com", 0xdcfc5d5d, PSL_RULE },
+    { "layershift.co.uk", 0x81609d5e, 0 },
+    { "edu.ky", 0x4ccd1d5f, PSL_RULE },
+    { "from-co.net", 0xdc501d5f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "abu.yamaguchi.jp", 0x67875d63, PSL_RULE },
+    { "mup.gov.pl", 0xb6465d63, PSL_RULE },
+    { "phd", 0xd1665d63, PSL_RULE },
+    { "chiyoda.gunma.jp", 0x10a3dd66, PSL_RULE },
+    { "qa", 0x5c251d67, PSL_RULE },
+    { "krd", 0xea25dd68, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.hr", 0x340e1d6c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "is-a-republican.com", 0x84151d6e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "band", 0x9c29dd70, PSL_RULE },
+    { "com.im", 0x66b41d70, PSL_RULE },
+    { NULL, 0, 0 },
+    { "adm.br", 0x3f641d73, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bir.ru", 0x57191d75, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "oarai.ibaraki.jp", 0x31a6dd78, PSL_RULE },
+    { "xn--mgbtx2b", 0x90949d79, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ravendb.community", 0xec6cdd7c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kids.museum", 0x85041d7e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "biz.tj", 0xadaa1d80, PSL_RULE },
+    { "xn--cg4bki", 0x8513dd81, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sakata.yamagata.jp", 0x5720dd85, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.gy", 0x47b5dd89, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nord-fron.no", 0xab1b9d8b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "en.it", 0x6e7d9d8d, PSL_RULE },
+    { "ozora.hokkaido.jp", 0x0f161d8e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "toyako.hokkaido.jp", 0x06e49d90, PSL_RULE },
+    { "dnipropetrovsk.ua", 0x2b339d91, PSL_RULE },
+    { NULL, 0, 0 },
+    { "appudo.net", 0x19ec1d93, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bib.br", 0x8afe9d96, PSL_RULE },
+    { "porn", 0x105b1d96, PSL_RULE },
+    { "vivian.jp", 0x1ebc5d96, PSL_RULE },
+    { NULL, 0, 0 },
+    { "horten.no", 0x74161d9a, PSL_RULE },
+    { "ota.tokyo.jp", 0x72cc5d9b, PSL_RULE },
+    { "bcn", 0x2b951d9c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "upli.io", 0x22b6dda3, PSL_RULE },
+    { "taiki.mie.jp", 0x47f61da4, PSL_RULE },
+    { "tomobe.ibaraki.jp", 0x5891dda4, PSL_RULE },
+    { "iwaizumi.iwate.jp", 0xc5c3dda6, PSL_RULE },
+    { "vf.no", 0xb3c19da6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "biz", 0x9d825daa, PSL_RULE },
+    { "brescia.it", 0xed96ddab, PSL_RULE },
+    { "ie", 0x3c1a5dab, PSL_RULE },
+    { "tm.pl", 0x25b55dac, PSL_RULE },
+    { "eu-west-2.amazonaws.com", 0xa51fddae, 0 },
+    { "vald-aosta.it", 0x10b51dae, PSL_RULE },
+    { "cnt.br", 0x34c89db0, PSL_RULE },
+    { "com.do", 0x4ce8ddb1, PSL_RULE },
+    { "org.bs", 0x7db5ddb0, PSL_RULE },
+    { "laz.it", 0x4eaf9db3, PSL_RULE },
+    { "tr", 0x49545db3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "orsites.com", 0xd2c29db7, PSL_RULE },
+    { "psse.gov.pl", 0xe3fbddb8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.id", 0x1089ddba, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--mgba7c0bbn0a", 0xe60c5dc3, PSL_RULE },
+    { "bozen.it", 0xcde7ddc4, PSL_RULE },
+    { "mashike.hokkaido.jp", 0xec2d9dc5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "baseball.museum", 0x85171dc9, PSL_RULE },
+    { "xn--brnnysund-m8ac.no", 0xf1ec9dc9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.wi.us", 0x827cddcc, PSL_RULE },
+    { "sport.hu", 0x583c5dcc, PSL_RULE },
+    { "floro.no", 0x9a70ddce, PSL_RULE },
+    { "org.pr", 0xbabfddcf, PSL_RULE },
+    { "mobara.chiba.jp", 0x479b9dd0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "servesarcasm.com", 0x322dddd5, PSL_RULE },
+    { "co.cr", 0xd386ddd6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--2m4a15e.jp", 0x9b551dde, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-uberleet.com", 0xcbec5de1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "higashiyoshino.nara.jp", 0x21cadde3, PSL_RULE },
+    { "sakura.chiba.jp", 0x76ba1de3, PSL_RULE },
+    { "kddi", 0xd0ee5de5, PSL_RULE },
+    { "xn--osyro-wua.no", 0x2aa29de6, PSL_RULE },
+    { "uchihara.ibaraki.jp", 0x163c1de7, PSL_RULE },
+    { "pro.om", 0x0c86dde8, PSL_RULE },
+    { "imakane.hokkaido.jp", 0x2604dde9, PSL_RULE },
+    { "luroy.no", 0x96229de9, PSL_RULE },
+    { "organic", 0x5a5cddea, PSL_RULE },
+    { "bindal.no", 0x77205dec, PSL_RULE },
+    { "forte.id", 0x950dddec, PSL_RULE },
+    { "satte.saitama.jp", 0xdd689dea, PSL_RULE },
+    { "bzh", 0x06a7ddef, PSL_RULE },
+    { "sekikawa.niigata.jp", 0x628d9de8, PSL_RULE },
+    { "verran.no", 0x7f391df0, PSL_RULE },
+    { "legnica.pl", 0x870f5df2, PSL_RULE },
+    { "blogspot.my", 0xe18dddf3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "investments", 0xecf7ddf5, PSL_RULE },
+    { "fitjar.no", 0xdca05df6, PSL_RULE },
+    { "org.bj", 0xd3e1ddf5, PSL_RULE },
+    { "yali.mythic-beasts.com", 0x4f0f5df6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "living", 0x79075dfa, PSL_RULE },
+    { "xn--trentino-sd-tirol-c3b.it", 0x642e1dfb, PSL_RULE },
+    { "s3.ap-south-1.amazonaws.com", 0x85675dfc, PSL_RULE },
+    { "forex", 0xbff29dfd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "maryland.museum", 0xaddc5e07, PSL_RULE },
+    { "lib.ky.us", 0x10e31e08, PSL_RULE },
+    { "myspreadshop.com.au", 0xc5545e09, PSL_RULE },
+    { "shacknet.nu", 0xd5465e09, PSL_RULE },
+    { "motegi.tochigi.jp", 0x712c5e0b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mm", 0x602e1e0f, PSL_WILDCARD },
+    { "gov.kn", 0x80b5de10, PSL_RULE },
+    { "nishi.fukuoka.jp", 0x28841e10, PSL_RULE },
+    { "org.ai", 0x4e68de0f, PSL_RULE },
+    { "taishin.fukushima.jp", 0x131cde12, PSL_RULE },
+    { NULL, 0, 0 },
+    { "education.museum", 0x12cb1e15, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "olbia-tempio.it", 0x76fc1e1a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "123siteweb.fr", 0xb654de1c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "auspost", 0x42e31e1e, PSL_RULE },
+    { "arakawa.saitama.jp", 0x87ed5e1f, PSL_RULE },
+    { "britishcolumbia.museum", 0xe0c01e20, PSL_RULE },
+    { "sld.pa", 0x3fccde1f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "act.edu.au", 0xcbe1de23, PSL_RULE },
+    { "shimoichi.nara.jp", 0x6c639e24, PSL_RULE },
+    { NULL, 0, 0 },
+    { "automotive.museum", 0x16a29e26, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ac.me", 0xee67de2b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yt", 0x50455e2e, PSL_RULE },
+    { "gov.bn", 0xd41b9e2f, PSL_RULE },
+    { "hotel.tz", 0xbcd61e2f, PSL_RULE },
+    { "xn--rdal-poa.no", 0x9024de30, PSL_RULE },
+    { NULL, 0, 0 },
+    { "myfast.host", 0xfe321e33, PSL_RULE },
+    { "xn--mlatvuopmi-s4a.no", 0x294c9e33, PSL_RULE },
+    { "sc.tz", 0x95385e35, PSL_RULE },
+    { "k12.or.us", 0x79211e36, PSL_RULE },
+    { "ac.ma", 0xcaa49e37, PSL_RULE },
+    { "kawanishi.hyogo.jp", 0x2535de38, PSL_RULE },
+    { "aju.br", 0xaa945e39, PSL_RULE },
+    { "katowice.pl", 0xc9209e3a, PSL_RULE },
+    { "co.ci", 0xc1575e3b, PSL_RULE },
+    { "meteorapp.com", 0x27099e3b, PSL_RULE },
+    { "mitane.akita.jp", 0xbe5ade3d, PSL_RULE },
+    { "service.gov.uk", 0xc3365e3a, PSL_RULE },
+    { "xn--indery-fya.no", 0xd9669e3e, PSL_RULE },
+    { "net.ag", 0xe5369e40, PSL_RULE },
+    { "resto.bj", 0xcbc11e40, PSL_RULE },
+    { "upow.gov.pl", 0xa5c5de42, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fukuchi.fukuoka.jp", 0x49b69e44, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "in-vpn.de", 0x8fc5de48, PSL_RULE },
+    { "misugi.mie.jp", 0x92de1e48, PSL_RULE },
+    { "tamba.hyogo.jp", 0xb719de4a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gmina.pl", 0x286c5e4d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.ng", 0x3102de4f, PSL_RULE },
+    { "nose.osaka.jp", 0x8d141e4f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "itau", 0x6ba29e54, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kindle", 0xdd3cde56, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.tw", 0xfe211e59, PSL_RULE },
+    { "org.ve", 0xfaa5de5a, PSL_RULE },
+    { "stuff-4-sale.org", 0xfdf4de5a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "qpon", 0xa58f9e5d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.il.us", 0x2f239e5f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fortmissoula.museum", 0x3b561e63, PSL_RULE },
+    { "cartoonart.museum", 0xf42d5e64, PSL_RULE },
+    { NULL, 0, 0 },
+    { "abogado", 0x083f5e66, PSL_RULE },
+    { "tattoo", 0x15fe9e66, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.au", 0x57c85e69, PSL_RULE },
+    { "urown.cloud", 0xdb1d5e69, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "auction", 0x045ade6e, PSL_RULE },
+    { "cdn77.org", 0x92209e6e, 0 },
+    { "is.it", 0x5e3a9e70, PSL_RULE },
+    { NULL, 0, 0 },
+    { "frusky.de", 0xc7435e72, PSL_WILDCARD },
+    { "nagatoro.saitama.jp", 0x7a7f1e72, PSL_RULE },
+    { "bari.it", 0x5f5bde74, PSL_RULE },
+    { "kin.okinawa.jp", 0x94c19e75, PSL_RULE },
+    { "puglia.it", 0x76d89e76, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "for-more.biz", 0x41ac5e79, PSL_RULE },
+    { "tv.kg", 0xbdcfde79, PSL_RULE },
+    { "bar0.net", 0xd1c9de7b, PSL_RULE },
+    { "onomichi.hiroshima.jp", 0xf92d9e7b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "axis.museum", 0xad7f9e7e, PSL_RULE },
+    { "os.fedoraproject.org", 0xb1669e7f, 0 },
+    { "ac.at", 0x34095e80, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "temp-dns.com", 0x952bde84, PSL_RULE },
+    { "sy", 0x4e5f9e85, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "wiw.gov.pl", 0x0d139e90, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kimobetsu.hokkaido.jp", 0xbe219e92, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mydobiss.com", 0xc1a95e94, PSL_RULE },
+    { "cng.br", 0xdc1e9e95, PSL_RULE },
+    { "com.tt", 0x4011de96, PSL_RULE },
+    { "outsystemscloud.com", 0xbe335e97, PSL_RULE },
+    { "griw.gov.pl", 0x7cee5e98, PSL_RULE },
+    { "tomi.nagano.jp", 0x99b75e98, PSL_RULE },
+    { "xn--tor131o.jp", 0xe349de94, PSL_RULE },
+    { "cc.nv.us", 0x8c371e9b, PSL_RULE },
+    { "pe.ca", 0x77569e9c, PSL_RULE },
+    { "tohma.hokkaido.jp", 0xaa001e9c, PSL_RULE },
+    { "staba.jp", 0x67719e9e, PSL_RULE },
+    { "saga.jp", 0xe73e5e9f, PSL_RULE },
+    { "com.sc", 0xdc9cdea0, PSL_RULE },
+    { "cloudera.site", 0x64c5dea1, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gob.sv", 0xed78dea4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "netbank", 0x795e1ea6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bn", 0x57365ea9, PSL_RULE },
+    { "mircloud.us", 0x5d115eaa, PSL_RULE },
+    { "miyoshi.saitama.jp", 0xeb7fdea9, PSL_RULE },
+    { "shimosuwa.nagano.jp", 0x6eb15ea9, PSL_RULE },
+    { "spb.ru", 0x1df99eab, PSL_RULE },
+    { "xn--cck2b3b", 0xbd8e1ea9, PSL_RULE },
+    { "z.se", 0xb7789ead, PSL_RULE },
+    { NULL, 0, 0 },
+    { "yachts", 0x805f1eb1, PSL_RULE },
+    { "itako.ibaraki.jp", 0xafce9eb2, PSL_RULE },
+    { "apps.fbsbx.com", 0xbe489eb3, PSL_RULE },
+    { "kembuchi.hokkaido.jp", 0x0e2e1eb3, PSL_RULE },
+    { "wiki.br", 0x3f3c9eb5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "elblag.pl", 0x01bf1eb8, PSL_RULE },
+    { "xn--9et52u", 0xc3ea9eb9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "guam.gu", 0x8f7a9ebb, PSL_RULE },
+    { "moareke.no", 0x18ee9ebc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "frankfurt.museum", 0x900fdec0, PSL_RULE },
+    { "transurl.be", 0xa0ab1ec1, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "schokokeks.net", 0x4640dec3, PSL_RULE },
+    { "virtual.museum", 0xebbcdec4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "av.tr", 0x35a2dec6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "swiss", 0x22595ec8, PSL_RULE },
+    { "blogspot.bj", 0x35b9dec9, PSL_RULE },
+    { "org.et", 0xff88deca, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "router.management", 0xdeab9ecd, PSL_RULE },
+    { "lombardy.it", 0xd3a2dece, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "app.banzaicloud.io", 0xd4705ed2, PSL_RULE },
+    { "localcert.dev", 0xbb191ed3, 0 },
+    { "mein-iserv.de", 0xffc75ed3, PSL_RULE },
+    { "myamaze.net", 0xd01eded4, PSL_RULE },
+    { "fineart.museum", 0x0d065ed6, PSL_RULE },
+    { "ravendb.me", 0x727e1ed5, PSL_RULE },
+    { "yoshioka.gunma.jp", 0x69541ed4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "me.uk", 0xfa9ddedb, PSL_RULE },
+    { "xn--p1acf", 0x0f12dedc, PSL_RULE },
+    { "yorkshire.museum", 0x56c6dedd, PSL_RULE },
+    { "rit.edu", 0x82105ede, 0 },
+    { "numata.hokkaido.jp", 0x269e5edf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kitaura.miyazaki.jp", 0x91bd5ee1, PSL_RULE },
+    { "raisa.no", 0xb7109ee2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "restaurant.bj", 0x5efddee4, PSL_RULE },
+    { "gov.nl", 0xc4d21ee5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "koshigaya.saitama.jp", 0x63ef1ee7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "from-ks.com", 0x95abdee9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shinyoshitomi.fukuoka.jp", 0x7b89deec, PSL_RULE },
+    { "psc.br", 0x2a53deed, PSL_RULE },
+    { NULL, 0, 0 },
+    { "winb.gov.pl", 0x11791eef, PSL_RULE },
+    { "nakagawa.hokkaido.jp", 0xcf199ef0, PSL_RULE },
+    { "art.do", 0x49135ef1, PSL_RULE },
+    { "azerbaijan.su", 0x5a689ef2, PSL_RULE },
+    { "backdrop.jp", 0xb4725ef1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "svalbard.no", 0xc99e5ef7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gd.cn", 0x0cc4def9, PSL_RULE },
+    { "matsuzaki.shizuoka.jp", 0x29a75efa, PSL_RULE },
+    { "stpetersburg.museum", 0x68541efb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dog", 0x481b9efd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "journal.aero", 0x019edeff, PSL_RULE },
+    { "neyagawa.osaka.jp", 0x04775eff, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cranbrook.museum", 0x1af1df02, PSL_RULE },
+    { "pru", 0x3e8f5f02, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.km", 0x76615f09, PSL_RULE },
+    { "dnshome.de", 0xcb625f0a, PSL_RULE },
+    { "sykkylven.no", 0x450e9f0a, PSL_RULE },
+    { "directory", 0xa7f61f0c, PSL_RULE },
+    { "saijo.ehime.jp", 0x43375f0d, PSL_RULE },
+    { "tokamachi.niigata.jp", 0x5ea99f0b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nagasaki.jp", 0xc29b1f10, PSL_RULE },
+    { "blogspot.vn", 0x4941df11, PSL_RULE },
+    { "shop", 0x86cc1f11, PSL_RULE },
+    { NULL, 0, 0 },
+    { "chikuhoku.nagano.jp", 0xa3725f14, PSL_RULE },
+    { "fin.tn", 0xc523df14, PSL_RULE },
+    { "cloud9.us-west-2.amazonaws.com", 0xc343df16, 0 },
+    { "komae.tokyo.jp", 0x3aed5f16, PSL_RULE },
+    { "com.ua", 0x8f645f18, PSL_RULE },
+    { "kawanishi.nara.jp", 0x6aa79f18, PSL_RULE },
+    { "org.mu", 0x40725f17, PSL_RULE },
+    { NULL, 0, 0 },
+    { "catholic.edu.au", 0x048c1f1c, PSL_RULE },
+    { "rec.ro", 0x97311f1c, PSL_RULE },
+    { "malvik.no", 0xe0eb1f1e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "from-de.com", 0xb94f9f20, PSL_RULE },
+    { NULL, 0, 0 },
+    { "passenger-association.aero", 0x146e1f22, PSL_RULE },
+    { NULL, 0, 0 },
+    { "glug.org.uk", 0xc3845f24, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.sd", 0x4b3f9f2a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "definima.net", 0x98e45f2d, PSL_RULE },
+    { "xn--snes-poa.no", 0xe4779f2e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "monzaedellabrianza.it", 0xdb999f33, PSL_RULE },
+    { NULL, 0, 0 },
+    { "taifun-dns.de", 0x7ba7df35, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tel.tr", 0xa006df38, PSL_RULE },
+    { "warmia.pl", 0xc6181f38, PSL_RULE },
+    { NULL, 0, 0 },
+    { "better-than.tv", 0xe920df3b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.by", 0x8874df3d, PSL_RULE },
+    { "je", 0x3d1a5f3e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "misaki.osaka.jp", 0x7d02df40, PSL_RULE },
+    { "gu.us", 0x9a399f41, PSL_RULE },
+    { "s3-ca-central-1.amazonaws.com", 0x974f9f40, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rsc.cdn77.org", 0xa2c25f44, PSL_RULE },
+    { "za.net", 0x60105f45, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hidora.com", 0xb7a15f4d, PSL_RULE },
+    { "baltimore.museum", 0xc809df4e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hitachiota.ibaraki.jp", 0x776edf50, PSL_RULE },
+    { "is-very-evil.org", 0x1aef5f51, PSL_RULE },
+    { "nikon", 0xcbfd9f50, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.as.us", 0x2fd65f54, PSL_RULE },
+    { "milan.it", 0x62b05f55, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "k12.as.us", 0xa46f1f59, PSL_RULE },
+    { "democracia.bo", 0x39f25f5a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "katsuragi.wakayama.jp", 0xf16cdf5c, PSL_RULE },
+    { "net.ht", 0x97729f5c, PSL_RULE },
+    { "porsgrunn.no", 0x07895f5c, PSL_RULE },
+    { "servers.run", 0x6896df5c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "arte.bo", 0x9e1d1f62, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.rs", 0xcd5e9f64, PSL_RULE },
+    { "namerikawa.toyama.jp", 0xa6955f64, PSL_RULE },
+    { "kure.hiroshima.jp", 0xe7319f66, PSL_RULE },
+    { "tksat.bo", 0x8f21df65, PSL_RULE },
+    { NULL, 0, 0 },
+    { "info.pl", 0xf6e49f69, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "time.no", 0x86fe5f6d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.cm", 0x3a759f6f, PSL_RULE },
+    { "esp.br", 0x84ae5f6f, PSL_RULE },
+    { "osakasayama.osaka.jp", 0x2eabdf6f, PSL_RULE },
+    { "yamaga.kumamoto.jp", 0x31629f70, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tadaoka.osaka.jp", 0x5084df77, PSL_RULE },
+    { "benevento.it", 0x96d2df78, PSL_RULE },
+    { "saku.nagano.jp", 0xb9585f79, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ine.kyoto.jp", 0xd7ba1f7d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "serveminecraft.net", 0xe2a8df80, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "men", 0x2e999f83, PSL_RULE },
+    { "studio", 0x9a8f1f83, PSL_RULE },
+    { "timekeeping.museum", 0x86cf5f83, PSL_RULE },
+    { "museumcenter.museum", 0x331adf86, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sic.it", 0x26761f89, PSL_RULE },
+    { "info.in", 0x1b139f8a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "community.museum", 0x46cf1f8e, PSL_RULE },
+    { "edu.mn", 0x1efadf8e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bus.museum", 0xaf449f95, PSL_RULE },
+    { NULL, 0, 0 },
+    { "life", 0x193edf97, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kudoyama.wakayama.jp", 0x97395f9c, PSL_RULE },
+    { "kawakita.ishikawa.jp", 0xfb0c9f9d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "android", 0x631a9fa0, PSL_RULE },
+    { "homeunix.net", 0x57305fa1, PSL_RULE },
+    { "gs.vf.no", 0x7adc5fa2, PSL_RULE },
+    { "nom.ni", 0x1d1e5fa2, PSL_RULE },
+    { "ppg.br", 0xccdddfa2, PSL_RULE },
+    { "net.vc", 0x144b1fa5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.ug", 0x125a5fa9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cultural.museum", 0xcdf59fab, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kitaaiki.nagano.jp", 0xb8101fae, PSL_RULE },
+    { NULL, 0, 0 },
+    { "trentinsudtirol.it", 0x5b8b5fb0, PSL_RULE },
+    { "3utilities.com", 0xbb279fb1, PSL_RULE },
+    { "siljan.no", 0xb4db5fb1, PSL_RULE },
+    { "klodzko.pl", 0xcb365fb3, PSL_RULE },
+    { "trana.no", 0xb8c21fb2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "myiphost.com", 0x45761fb7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "go.jp", 0x95aa9fb9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.bt", 0xf0b61fbb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--sknland-fxa.no", 0xc0ccdfbf, PSL_RULE },
+    { "nannestad.no", 0x1b295fc0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "barsy.online", 0xfe111fc3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pb.leg.br", 0x41495fc5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nt.edu.au", 0x1a16dfc7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "showa.gunma.jp", 0x16eddfcb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ishikawa.fukushima.jp", 0xf4685fcd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rl.no", 0xafb41fd0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "adygeya.ru", 0xf53b5fd2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dn.ua", 0x80a5dfd5, PSL_RULE },
+    { "mydatto.com", 0xa2241fd6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nl.eu.org", 0x22601fd9, PSL_RULE },
+    { "kozow.com", 0xa99bdfda, PSL_RULE },
+    { "law", 0x29e2dfdb, PSL_RULE },
+    { "st.no", 0xc09f1fdb, PSL_RULE },
+    { "yokosuka.kanagawa.jp", 0x27071fdc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lg.jp", 0x9a971fe0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sa.cr", 0xdb77dfe4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shingu.hyogo.jp", 0xafdcdfe7, PSL_RULE },
+    { "sl", 0x5631dfe8, PSL_RULE },
+    { "archaeology.museum", 0x6403dfe9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.hi.us", 0x506e9fed, PSL_RULE },
+    { "gob.cl", 0x60d35fee, PSL_RULE },
+    { "zoology.museum", 0xd6d81fee, PSL_RULE },
+    { NULL, 0, 0 },
+    { "asti.it", 0xc5c65ff1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "daa.jp", 0x08d85ff3, PSL_RULE },
+    { "es.gov.br", 0xea56dff3, PSL_RULE },
+    { "advisor.ws", 0xf0461ff5, PSL_WILDCARD },
+    { "fastly-edge.com", 0x2006dff5, PSL_RULE },
+    { "ocp.customer-oci.com", 0xe6e65ff4, PSL_WILDCARD },
+    { "podhale.pl", 0x0d065ff4, PSL_RULE },
+    { "cbs", 0xb3159ff9, PSL_RULE },
+    { "mizunami.gifu.jp", 0x4ac69ffa, PSL_RULE },
+    { "rome.it", 0xf3539ffb, PSL_RULE },
+    { "jls-sto3.elastx.net", 0x57141ffc, PSL_RULE },
+    { "nordreisa.no", 0x4d619ffd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ads", 0xd524e009, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nt.ca", 0x6f7fe00b, PSL_RULE },
+    { "author", 0x837ea00c, PSL_RULE },
+    { "xn--80asehdb", 0xb223e00c, PSL_RULE },
+    { "yamanakako.yamanashi.jp", 0xdf59a00b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fh-muenster.io", 0x9ad2a017, PSL_RULE },
+    { "mincom.tn", 0x1794e018, PSL_RULE },
+    { "funahashi.toyama.jp", 0x96702019, PSL_RULE },
+    { "servehalflife.com", 0x30a1a018, PSL_RULE },
+    { "trust", 0xb9dd2019, PSL_RULE },
+    { "vercel.dev", 0x9f9ae01b, PSL_RULE },
+    { "makurazaki.kagoshima.jp", 0xca3ce01d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "k12.dc.us", 0x5bbe2022, PSL_RULE },
+    { NULL, 0, 0 },
+    { "carboniaiglesias.it", 0x0ac06024, PSL_RULE },
+    { "jmp", 0x5337e024, PSL_RULE },
+    { "kr.ua", 0x69eae024, PSL_RULE },
+    { "lib.de.us", 0xd69d6025, PSL_RULE },
+    { "sor-aurdal.no", 0x74f6a028, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.tt", 0x3f5e202b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ravpage.co.il", 0x4c42202e, PSL_RULE },
+    { "kerryhotels", 0x1e5ca02f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ota.gunma.jp", 0xe34b2031, PSL_RULE },
+    { "net.kg", 0x9c8f6032, PSL_RULE },
+    { "kristiansund.no", 0xe6856033, PSL_RULE },
+    { "sch.lk", 0xb311a032, PSL_RULE },
+    { NULL, 0, 0 },
+    { "chikuzen.fukuoka.jp", 0xb1842036, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "davvesiida.no", 0x6234a03c, PSL_RULE },
+    { "usercontent.jp", 0x1c5ca03d, PSL_RULE },
+    { "aircraft.aero", 0xe227203e, PSL_RULE },
+    { "itigo.jp", 0xeb8f603f, PSL_RULE },
+    { "kanie.aichi.jp", 0x2a92e03f, PSL_RULE },
+    { "gov.lr", 0xd2f56041, PSL_RULE },
+    { "olecko.pl", 0xc565603e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "izunokuni.shizuoka.jp", 0x75af6045, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "the.br", 0xfbc2e048, PSL_RULE },
+    { "selfip.com", 0x069fa049, PSL_RULE },
+    { "virtualcloud.com.br", 0xc38de048, 0 },
+    { "aseinet.ne.jp", 0xa4a8204b, 0 },
+    { "mein-vigor.de", 0x7bdce04b, PSL_RULE },
+    { "lair.io", 0x58f2a04d, 0 },
+    { "tama.tokyo.jp", 0x965de04c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bitbucket.io", 0x7df9a052, PSL_RULE },
+    { "myspreadshop.es", 0xa4982052, PSL_RULE },
+    { "mt.gov.br", 0x1254e054, PSL_RULE },
+    { "oharu.aichi.jp", 0xb9892054, PSL_RULE },
+    { "shia", 0xfc432052, PSL_RULE },
+    { "orkdal.no", 0xc453e057, PSL_RULE },
+    { "stackhero-network.com", 0x97ef2053, PSL_RULE },
+    { "tonaki.okinawa.jp", 0xf2fd6059, PSL_RULE },
+    { "xn--mgbayh7gpa", 0xbacd6052, PSL_RULE },
+    { "xn--asky-ira.no", 0x48bb605b, PSL_RULE },
+    { "ogi.saga.jp", 0xba08a05c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mx", 0x4463605e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.scot", 0xbd61a060, PSL_RULE },
+    { "yorii.saitama.jp", 0xafa12061, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kitanakagusuku.okinawa.jp", 0x51ef6063, PSL_RULE },
+    { "lib.ut.us", 0x24752063, PSL_RULE },
+    { "nahari.kochi.jp", 0xc250a064, PSL_RULE },
+    { "org.jo", 0x22cae064, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "stavern.no", 0x2476206d, PSL_RULE },
+    { "ro.im", 0x3a19a06e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "higashinaruse.akita.jp", 0xa2886070, PSL_RULE },
+    { "hu.com", 0x28a92071, PSL_RULE },
+    { "cloud.muni.cz", 0x437b2072, 0 },
+    { "nishiazai.shiga.jp", 0x1ff1e071, PSL_RULE },
+    { "lancaster", 0x05562074, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kudamatsu.yamaguchi.jp", 0x735ee076, PSL_RULE },
+    { NULL, 0, 0 },
+    { "osaki.miyagi.jp", 0x50922078, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ua.rs", 0xc76da07c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dev.thingdust.io", 0xa3ece07e, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ivanovo.su", 0x78706081, PSL_RULE },
+    { "katagami.akita.jp", 0xbd786082, PSL_RULE },
+    { "nov.ru", 0x0f576083, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-lost.org", 0x7156a086, PSL_RULE },
+    { NULL, 0, 0 },
+    { "torproject.net", 0x2dac2088, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hiji.oita.jp", 0x59e1608a, PSL_RULE },
+    { "mil.ve", 0xfdd6208a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sa", 0x5e25208d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mihama.mie.jp", 0xff4fa08f, PSL_RULE },
+    { "gh", 0x5a3ae090, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.pt", 0xc6a9e094, PSL_RULE },
+    { "vercelli.it", 0x31f1a094, PSL_RULE },
+    { "yokoze.saitama.jp", 0x957c6096, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kisosaki.mie.jp", 0x0dae2098, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.sl", 0x9179a09a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kodaira.tokyo.jp", 0x862e209c, PSL_RULE },
+    { "org.bo", 0x0bc2209c, PSL_RULE },
+    { "compute.amazonaws.com", 0xac75609e, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "net.ge", 0x1c5c20a0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chizu.tottori.jp", 0x3c8320a3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "artsandcrafts.museum", 0x23d420a7, PSL_RULE },
+    { "dogado.eu", 0x676d60a7, 0 },
+    { "frl", 0x608560a7, PSL_RULE },
+    { "net.st", 0x1cb220a9, PSL_RULE },
+    { "exposed", 0xec6aa0ab, PSL_RULE },
+    { "health-carereform.com", 0x323020ab, PSL_RULE },
+    { "report", 0x3ec920ab, PSL_RULE },
+    { "gentlentapis.com", 0xac4d20ae, PSL_RULE },
+    { "wien", 0x5fdfe0a8, PSL_RULE },
+    { "ws", 0x4a5220af, PSL_RULE },
+    { "xn--yer-zna.no", 0x224760b0, PSL_RULE },
+    { "kz", 0x4667e0b2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.gr", 0xc85820b6, PSL_RULE },
+    { "birdart.museum", 0x1860a0b7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lierne.no", 0x4288a0b9, PSL_RULE },
+    { "tk", 0x5b3d20ba, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kokubunji.tokyo.jp", 0xd959a0bf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hjartdal.no", 0xf337e0c2, PSL_RULE },
+    { "xn--sandy-yua.no", 0xeb6ba0c3, PSL_RULE },
+    { "hostedpi.com", 0x025e20c4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "name.qa", 0x360d20c6, PSL_RULE },
+    { "kartuzy.pl", 0xc76760c7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.kz", 0x09b3a0ca, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shinichi.hiroshima.jp", 0x649b20cc, PSL_RULE },
+    { "vip", 0x5740e0cc, PSL_RULE },
+    { "akamaihd.net", 0x628f20ce, PSL_RULE },
+    { "asso.ht", 0x4bada0cf, PSL_RULE },
+    { "og.ao", 0x457560cf, PSL_RULE },
+    { "ke", 0x3e1a60d1, PSL_RULE },
+    { "lier.no", 0xe87c60d2, PSL_RULE },
+    { "aya.miyazaki.jp", 0x1f1c20d3, PSL_RULE },
+    { "is-a-techie.com", 0x85b2a0d3, PSL_RULE },
+    { "kamijima.ehime.jp", 0x2a51e0d4, PSL_RULE },
+    { "kvanangen.no", 0x0e7ee0d3, PSL_RULE },
+    { "gov.is", 0xa67e60d7, PSL_RULE },
+    { "ro.eu.org", 0x2c57e0d2, PSL_RULE },
+    { "scalebook.scw.cloud", 0xc55de0d6, PSL_RULE },
+    { "froland.no", 0xdfa960da, PSL_RULE },
+    { "halden.no", 0x6557e0da, PSL_RULE },
+    { "sula.no", 0xbd91e0cf, PSL_RULE },
+    { "tsuno.miyazaki.jp", 0xfc2020dd, PSL_RULE },
+    { "xn--nyqy26a", 0xf5e3a0d9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hosting-cluster.nl", 0x26d320e0, PSL_RULE },
+    { "net.ly", 0x2a3060e1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kofu.yamanashi.jp", 0xedbb20e3, PSL_RULE },
+    { "barrell-of-knowledge.info", 0x1fee20e4, PSL_RULE },
+    { "gov.pr", 0xcefce0e5, PSL_RULE },
+    { "schaeffler", 0xdde9a0e4, PSL_RULE },
+    { "edu.ge", 0xd677a0e7, PSL_RULE },
+    { "cleverapps.io", 0xbe41e0e8, PSL_RULE },
+    { "i.ph", 0x86eea0e8, PSL_RULE },
+    { "org.ng", 0xf52c20e8, PSL_RULE },
+    { "kawamata.fukushima.jp", 0x0afb20eb, PSL_RULE },
+    { "otama.fukushima.jp", 0x842e60ec, PSL_RULE },
+    { "tm.se", 0xa9a820e4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kawagoe.mie.jp", 0x5b3420f3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.ee", 0x1ea620f5, PSL_RULE },
+    { "lebtimnetz.de", 0xd91060f6, PSL_RULE },
+    { "co.nz", 0x0f6ca0f7, PSL_RULE },
+    { "us-east-1.elasticbeanstalk.com", 0x7a8d20f6, PSL_RULE },
+    { "website", 0xc69a60f6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "evenassi.no", 0x2c0f60fe, PSL_RULE },
+    { "iz.hr", 0x6c4820fe, PSL_RULE },
+    { "samsung", 0x6146a0ff, PSL_RULE },
+    { NULL, 0, 0 },
+    { "endofinternet.org", 0x7ec36102, PSL_RULE },
+    { "ogliastra.it", 0x4c11a102, PSL_RULE },
+    { "barsy.co.uk", 0x5f6ce104, PSL_RULE },
+    { "blog", 0xf266e105, PSL_RULE },
+    { "cfd", 0xda576104, PSL_RULE },
+    { "ringebu.no", 0x3e4e6106, PSL_RULE },
+    { "us.gov.pl", 0x84b4a107, PSL_RULE },
+    { "mragowo.pl", 0x6bf26109, PSL_RULE },
+    { "shop.pl", 0xdfea6109, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "oyer.no", 0x07a3a10f, PSL_RULE },
+    { "in-vpn.net", 0xca92e110, PSL_RULE },
+    { "tele.amune.org", 0x7e37e10f, PSL_RULE },
+    { "wedeploy.io", 0x41ca2110, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cpa", 0x326aa115, PSL_RULE },
+    { "myqnapcloud.com", 0x5a06a115, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "software", 0xe6e4611a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ca.in", 0xc18d211e, PSL_RULE },
+    { "edu.sa", 0x2233a11f, PSL_RULE },
+    { "net.bt", 0xe54ee11e, PSL_RULE },
+    { "ns.ca", 0x6d792120, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.ua", 0x39416123, PSL_RULE },
+    { "xn--hebda8b.xn--4dbrk0ce", 0x3824a124, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rich", 0x11846127, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nba", 0x1547e12c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "skiptvet.no", 0x4f9d6132, PSL_RULE },
+    { "gov.ms", 0x6e4b6133, PSL_RULE },
+    { "niihama.ehime.jp", 0x437c6134, PSL_RULE },
+    { "om", 0x622e2135, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.ls", 0xa6a96138, PSL_RULE },
+    { "xn--ntso0iqx3a.jp", 0x94396139, PSL_RULE },
+    { "static.land", 0x45bca13a, PSL_RULE },
+    { "64-b.it", 0xf784613b, PSL_RULE },
+    { "murata.miyagi.jp", 0xd290613b, PSL_RULE },
+    { "s3.dualstack.ap-south-1.amazonaws.com", 0x7a7e613c, PSL_RULE },
+    { "toya.hokkaido.jp", 0x1d48a13a, PSL_RULE },
+    { "webview-assets.cloud9.ap-northeast-2.amazonaws.com", 0x6ddb613f, PSL_RULE },
+    { "creditcard", 0x5e1ee140, PSL_RULE },
+    { "fireweb.app", 0x71d72140, PSL_RULE },
+    { "webcam", 0xd8496142, PSL_RULE },
+    { "kasaoka.okayama.jp", 0x7eaea143, PSL_RULE },
+    { "gob.pk", 0x8c70a144, PSL_RULE },
+    { "ikata.ehime.jp", 0x5ccfe145, PSL_RULE },
+    { "kitakata.fukushima.jp", 0x606da144, PSL_RULE },
+    { "net.py", 0x1d51e145, PSL_RULE },
+    { "equipment.aero", 0xd98da148, PSL_RULE },
+    { "toyone.aichi.jp", 0xa9f6e145, PSL_RULE },
+    { "asaka.saitama.jp", 0x45a2e14a, PSL_RULE },
+    { "vodka", 0xf5e2e146, PSL_RULE },
+    { "xn--risa-5na.no", 0x0425a14c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloudflare-ipfs.com", 0x743b6150, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "arts.ve", 0xba9f2156, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rentals", 0x8c1a6160, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "catering.aero", 0xb6352163, PSL_RULE },
+    { "shimonita.gunma.jp", 0x9a652163, PSL_RULE },
+    { "spb.su", 0x28926164, PSL_RULE },
+    { "tadotsu.kagawa.jp", 0x78ec6163, PSL_RULE },
+    { "frog.museum", 0xb877a167, PSL_RULE },
+    { "mutsuzawa.chiba.jp", 0x02472167, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hichiso.gifu.jp", 0x960be16b, PSL_RULE },
+    { "il.eu.org", 0x2360216c, PSL_RULE },
+    { "saroma.hokkaido.jp", 0x7b22616c, PSL_RULE },
+    { "property", 0xe0f3216e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bet", 0xb101e170, PSL_RULE },
+    { "cc.nc.us", 0xc538e170, PSL_RULE },
+    { "farm", 0x73c42171, PSL_RULE },
+    { "gov.mz", 0x73a1e172, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sex.hu", 0x7e2b2176, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "adimo.co.uk", 0x9fa46179, PSL_RULE },
+    { NULL, 0, 0 },
+    { "iizuna.nagano.jp", 0x0358617b, PSL_RULE },
+    { "xn--jrpeland-54a.no", 0x0e6be17b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "daigo.ibaraki.jp", 0xf6e72180, PSL_RULE },
+    { "kunigami.okinawa.jp", 0x43586180, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nuoro.it", 0xa899e185, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is.eu.org", 0x1b12a18b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloud.goog", 0x90b7e18e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kashima.ibaraki.jp", 0x9e0f6190, PSL_RULE },
+    { "nt.ro", 0x7ce22190, PSL_RULE },
+    { "blogspot.in", 0xbe7aa192, PSL_RULE },
+    { "kuji.iwate.jp", 0x9fef2192, PSL_RULE },
+    { "pgfog.com", 0x44142193, PSL_RULE },
+    { "barum.no", 0x437da195, PSL_RULE },
+    { "numata.gunma.jp", 0xff5f2195, PSL_RULE },
+    { "webhare.dev", 0xbf2c2196, PSL_WILDCARD },
+    { "xn--30rr7y", 0x165c2190, PSL_RULE },
+    { "z.bg", 0xe7d6a194, PSL_RULE },
+    { "vapor.cloud", 0xca85619a, PSL_RULE },
+    { "ddns.net", 0xb3ff619b, PSL_RULE },
+    { "sch.ss", 0xdf25619b, PSL_RULE },
+    { "suzu.ishikawa.jp", 0xdf79219b, PSL_RULE },
+    { "gouv.ci", 0xbcee619e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "icbc", 0x458c61a0, PSL_RULE },
+    { "org.pe", 0x0d67a1a0, PSL_RULE },
+    { "zp.gov.pl", 0x7bbce1a1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mochizuki.nagano.jp", 0xbfb361a4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ltd.ua", 0x81bda1a9, PSL_RULE },
+    { "cody.museum", 0xdd4221aa, PSL_RULE },
+    { "ono.fukui.jp", 0x62dba1a9, PSL_RULE },
+    { "org.cu", 0x1c8521a9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cn-north-1.eb.amazonaws.com.cn", 0x1fe561b2, PSL_RULE },
+    { "bykle.no", 0x7f4861b3, PSL_RULE },
+    { "mlb", 0x5dc421b2, PSL_RULE },
+    { "dnsiskinky.com", 0x490d21b5, PSL_RULE },
+    { "berlevag.no", 0xb790e1b6, PSL_RULE },
+    { "or.us", 0x723721b2, PSL_RULE },
+    { "ge.it", 0x4c67a1b8, PSL_RULE },
+    { "iwama.ibaraki.jp", 0xe31da1b9, PSL_RULE },
+    { "koriyama.fukushima.jp", 0x2349a1b9, PSL_RULE },
+    { "minamiuonuma.niigata.jp", 0xfbf8e1ba, PSL_RULE },
+    { "lpusercontent.com", 0x2215e1bc, PSL_RULE },
+    { "orangecloud.tn", 0x42f221ba, PSL_RULE },
+    { "inami.toyama.jp", 0x1153a1be, PSL_RULE },
+    { "mil.ni", 0x93ea21be, PSL_RULE },
+    { "ac.zm", 0x8fa521c0, PSL_RULE },
+    { "posts-and-telecommunications.museum", 0x5e0c21b4, PSL_RULE },
+    { "oldnavy", 0xb4f861c2, PSL_RULE },
+    { "barsy.site", 0x6ceb21c3, PSL_RULE },
+    { "eniwa.hokkaido.jp", 0xabfe21c3, PSL_RULE },
+    { "sayo.hyogo.jp", 0x200a21b7, PSL_RULE },
+    { "sch.ng", 0xfffba1bc, PSL_RULE },
+    { "wiih.gov.pl", 0x7c0c21c4, PSL_RULE },
+    { "mytabit.com", 0x5440a1c8, PSL_RULE },
+    { "anjo.aichi.jp", 0xc8b9a1c9, PSL_RULE },
+    { "crs", 0xd33ce1c9, PSL_RULE },
+    { "jelastic.tsukaeru.net", 0x1e5f61c9, PSL_RULE },
+    { "ts.net", 0x5632e1c9, PSL_RULE },
+    { "nerima.tokyo.jp", 0xfc54a1cd, PSL_RULE },
+    { "yamanobe.yamagata.jp", 0xde1021c2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dental", 0x94c921d1, PSL_RULE },
+    { "saobernardo.br", 0xdd6521d1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "games", 0xaff661d4, PSL_RULE },
+    { "is-an-actor.com", 0xad3161d4, PSL_RULE },
+    { "mil.gh", 0xd78f61d4, PSL_RULE },
+    { "org.cn", 0xf5dfa1d6, PSL_RULE },
+    { "shunan.yamaguchi.jp", 0x45f461d6, PSL_RULE },
+    { "tj.cn", 0x1dab61d6, PSL_RULE },
+    { "vin", 0x27a421da, PSL_RULE },
+    { NULL, 0, 0 },
+    { "video", 0x73c7e1dc, PSL_RULE },
+    { "yazu.tottori.jp", 0x2b50a1dd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "miyada.nagano.jp", 0xa46861e0, PSL_RULE },
+    { "futaba.fukushima.jp", 0xd40c61e1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shiriuchi.hokkaido.jp", 0xacb1e1e5, PSL_RULE },
+    { "aerodrome.aero", 0x4e9361e6, PSL_RULE },
+    { "mydrobo.com", 0x673be1e6, PSL_RULE },
+    { "com.tj", 0x668021e8, PSL_RULE },
+    { "kadogawa.miyazaki.jp", 0xa07221e9, PSL_RULE },
+    { "altervista.org", 0x760021ea, PSL_RULE },
+    { "oregon.museum", 0x6575a1e9, PSL_RULE },
+    { "aridagawa.wakayama.jp", 0xa8bc21ec, PSL_RULE },
+    { "gjemnes.no", 0x5b09e1ed, PSL_RULE },
+    { "hizen.saga.jp", 0xf26d61ed, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-very-sweet.org", 0x4ca2e1f1, PSL_RULE },
+    { "shinjo.yamagata.jp", 0x5ae621f1, PSL_RULE },
+    { "xn--fpcrj9c3d", 0xb3b221f3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "svizzera.museum", 0x6518e1f7, PSL_RULE },
+    { "blogspot.md", 0x07d2a1f8, PSL_RULE },
+    { "net.bs", 0x990461f9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "s3.eu-west-3.amazonaws.com", 0x68f6e1fb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tokyo.jp", 0xcf18a1ff, PSL_RULE },
+    { NULL, 0, 0 },
+    { "onza.mythic-beasts.com", 0xba012201, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rifu.miyagi.jp", 0x25aae203, PSL_RULE },
+    { "xn--o1ach.xn--90a3ac", 0xe1246204, PSL_RULE },
+    { "gov.tn", 0xfc846205, PSL_RULE },
+    { "fujikawaguchiko.yamanashi.jp", 0x54486206, PSL_RULE },
+    { "mt.us", 0x743ba206, PSL_RULE },
+    { "asahi.ibaraki.jp", 0x4205a208, PSL_RULE },
+    { "bo.nordland.no", 0xe042a209, PSL_RULE },
+    { "frogn.no", 0xa121e20a, PSL_RULE },
+    { "dp.ua", 0x6cef620b, PSL_RULE },
+    { "lilly", 0xf815e209, PSL_RULE },
+    { "myfast.space", 0xb6c1e205, PSL_RULE },
+    { "priv.hu", 0x4014a205, PSL_RULE },
+    { NULL, 0, 0 },
+    { "123webseite.de", 0x03fda210, PSL_RULE },
+    { "limited", 0x6a1b6211, PSL_RULE },
+    { "maringa.br", 0x0c5d6210, PSL_RULE },
+    { "transurl.eu", 0x85a8a212, PSL_WILDCARD },
+    { "geometre-expert.fr", 0x78f66214, PSL_RULE },
+    { "metacentrum.cz", 0xb6a3a215, 0 },
+    { "xn--j1aef.xn--p1acf", 0xbdd12215, PSL_RULE },
+    { "keliweb.cloud", 0xacd56217, PSL_RULE },
+    { NULL, 0, 0 },
+    { "deloitte", 0xcdb2e219, PSL_RULE },
+    { "is-found.org", 0x24db221a, PSL_RULE },
+    { "k12.ec", 0x48332219, PSL_RULE },
+    { "org.tr", 0xfc04e21b, PSL_RULE },
+    { "couchpotatofries.org", 0x84de621d, PSL_RULE },
+    { "trentin-sudtirol.it", 0xb768221d, PSL_RULE },
+    { "umaji.kochi.jp", 0x69b6a21f, PSL_RULE },
+    { "icu", 0x2bba2220, PSL_RULE },
+    { NULL, 0, 0 },
+    { "001www.com", 0xbd856222, PSL_RULE },
+    { "uk.reclaim.cloud", 0xbb65a223, PSL_RULE },
+    { "la-spezia.it", 0x0ac76224, PSL_RULE },
+    { "translate.goog", 0x5040a225, PSL_RULE },
+    { "xn--pgbs0dh", 0x1a5fe225, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "johana.toyama.jp", 0xc8336229, PSL_RULE },
+    { "firestone", 0x5ddea22a, PSL_RULE },
+    { "koori.fukushima.jp", 0xe1a0222a, PSL_RULE },
+    { "natuurwetenschappen.museum", 0x41d86229, PSL_RULE },
+    { "dnsfor.me", 0x3ff5a22d, PSL_RULE },
+    { "sina", 0xc3de222a, PSL_RULE },
+    { "aga.niigata.jp", 0xfdd3222f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pro.mv", 0xa0bb6231, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dyn-vpn.de", 0xa055e234, PSL_RULE },
+    { "va.no", 0xb5bf6235, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.st", 0xdb2fe237, PSL_RULE },
+    { "mcdir.ru", 0xccbf6237, PSL_RULE },
+    { "naruto.tokushima.jp", 0x13aa6237, PSL_RULE },
+    { "xn--rvc1e0am3e", 0xc2d76238, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ohtawara.tochigi.jp", 0x3b69223d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dagestan.ru", 0x557ce241, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kuki.saitama.jp", 0x16662243, PSL_RULE },
+    { "lviv.ua", 0x758c2244, PSL_RULE },
+    { "yokkaichi.mie.jp", 0x2e9aa244, PSL_RULE },
+    { "nrw", 0x09b4e246, PSL_RULE },
+    { "gov.cm", 0x34fe6247, PSL_RULE },
+    { "kui.hiroshima.jp", 0x96ec6248, PSL_RULE },
+    { "yame.fukuoka.jp", 0xcfc6e247, PSL_RULE },
+    { "ikeda.gifu.jp", 0x314a624a, PSL_RULE },
+    { "madrid", 0xf0a8624a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloud9.us-west-1.amazonaws.com", 0xcfd3224d, 0 },
+    { "uk", 0x5c3d224d, PSL_RULE },
+    { "fussa.tokyo.jp", 0xba91624f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "furukawa.miyagi.jp", 0xa8b96253, PSL_RULE },
+    { "s3.dualstack.eu-west-3.amazonaws.com", 0x462fe253, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.ec", 0x849f6257, PSL_RULE },
+    { "gov.mg", 0xd529e257, PSL_RULE },
+    { "cc.nh.us", 0xb7b92259, PSL_RULE },
+    { "labour.museum", 0xac052258, PSL_RULE },
+    { "miyagi.jp", 0xed96625b, PSL_RULE },
+    { "kwpsp.gov.pl", 0x5634a25c, PSL_RULE },
+    { "togane.chiba.jp", 0x98b9225c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "graz.museum", 0xb1dae25f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "higashikawa.hokkaido.jp", 0x333de262, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "for-the.biz", 0x30356265, PSL_RULE },
+    { "md.ci", 0x9f416266, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "biz.ls", 0x6f9f2269, PSL_RULE },
+    { "dovre.no", 0xabf6e26a, PSL_RULE },
+    { "dualstack.ca-central-1.amazonaws.com", 0xaa5ce26b, 0 },
+    { "valleedaoste.it", 0xd072e26b, PSL_RULE },
+    { "cloud9.ap-northeast-1.amazonaws.com", 0x600ba26d, 0 },
+    { "taranto.it", 0xe5a4e26d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--mgba3a3ejt", 0x964a2270, PSL_RULE },
+    { "porsangu.no", 0x36046271, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "moo.jp", 0x6fad2274, PSL_RULE },
+    { "bialystok.pl", 0x0902e275, PSL_RULE },
+    { "nc", 0x6129a274, PSL_RULE },
+    { "does-it.net", 0x09aba277, PSL_RULE },
+    { "nakagawa.tokushima.jp", 0x8dee2277, PSL_RULE },
+    { "kumamoto.kumamoto.jp", 0xc9b26279, PSL_RULE },
+    { "veterinaire.fr", 0x69702277, PSL_RULE },
+    { "tagajo.miyagi.jp", 0x81e1e27b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ingatlan.hu", 0x7d96e27e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "wme", 0x698aa280, PSL_RULE },
+    { "beagleboard.io", 0xa7ba2281, PSL_RULE },
+    { "hagi.yamaguchi.jp", 0x6fd3a282, PSL_RULE },
+    { "omigawa.chiba.jp", 0x71a9e283, PSL_RULE },
+    { "vegas", 0x59ac6281, PSL_RULE },
+    { "control.aero", 0x5e652285, PSL_RULE },
+    { "hawaii.museum", 0x0f216286, PSL_RULE },
+    { "org.so", 0x8830e287, PSL_RULE },
+    { "mc.ax", 0x43352288, PSL_RULE },
+    { "tabuse.yamaguchi.jp", 0x80ae6285, PSL_RULE },
+    { "is-a-anarchist.com", 0x5030e28a, PSL_RULE },
+    { "ski.museum", 0x6beb228a, PSL_RULE },
+    { "yuasa.wakayama.jp", 0xb4576284, PSL_RULE },
+    { "nabu.casa", 0xc369e28d, 0 },
+    { NULL, 0, 0 },
+    { "ac.tj", 0xc40e228f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "choshi.chiba.jp", 0x37a62292, PSL_RULE },
+    { "digitaloceanspaces.com", 0x5c9ce293, PSL_WILDCARD },
+    { "etnedal.no", 0x95b2a293, PSL_RULE },
+    { "gloomy.jp", 0x2a202292, PSL_RULE },
+    { "kouhoku.saga.jp", 0xf6bbe295, PSL_RULE },
+    { "misato.shimane.jp", 0x42f02293, PSL_RULE },
+    { "org.co", 0x7948a297, PSL_RULE },
+    { "bnpparibas", 0xb5aba299, PSL_RULE },
+    { "gov.mr", 0x9ba4629a, PSL_RULE },
+    { "nieruchomosci.pl", 0x4af8a29b, PSL_RULE },
+    { "sor-varanger.no", 0x85366297, PSL_RULE },
+    { "xn--langevg-jxa.no", 0xf3c9229a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.mk", 0x2686e2a0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chrome", 0xdc61e2a3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.bh", 0x3b6b22a5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "is-a-therapist.com", 0x8cdae2a7, PSL_RULE },
+    { "xn--1ctwo.jp", 0xdf42e2a7, PSL_RULE },
+    { "senasa.ar", 0xe315e2a9, PSL_RULE },
+    { "s3-website.eu-west-2.amazonaws.com", 0xb952e2aa, PSL_RULE },
+    { "accenture", 0xdeb6a2ab, PSL_RULE },
+    { "bplaced.com", 0x174be2ab, PSL_RULE },
+    { "com.jo", 0x668e22ab, PSL_RULE },
+    { "lillesand.no", 0x3865a2ae, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "adobeaemcloud.net", 0x3b6362b3, PSL_RULE },
+    { "gujo.gifu.jp", 0x5007a2b3, PSL_RULE },
+    { "northflank.app", 0x61e9e2b3, PSL_WILDCARD },
+    { "trentinosud-tirol.it", 0x55ea62b6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sanda.hyogo.jp", 0x136de2bc, PSL_RULE },
+    { "verbania.it", 0x20e5e2bc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "a.prod.fastly.net", 0x4d18e2bf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "forum", 0xf76fa2c2, PSL_RULE },
+    { "com.tm", 0x9846e2c3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ngrok.io", 0x6719e2c6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.ca.us", 0x3c85e2c8, PSL_RULE },
+    { "myspreadshop.no", 0x3d4f62c9, PSL_RULE },
+    { "time.museum", 0xc76ba2ca, PSL_RULE },
+    { "barsy.pro", 0x1aa4e2cb, PSL_RULE },
+    { "gov.lc", 0x3b3962cc, PSL_RULE },
+    { "edu.qa", 0x2b2ca2cd, PSL_RULE },
+    { "af-south-1.amazonaws.com", 0xa857e2ce, 0 },
+    { "oracle", 0x95efa2cf, PSL_RULE },
+    { "barrel-of-knowledge.info", 0x1b7e22d0, PSL_RULE },
+    { "wolomin.pl", 0xc05322ca, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "go.gov.br", 0x0c61a2d5, PSL_RULE },
+    { "mikasa.hokkaido.jp", 0x9df762d5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "web.nf", 0xaec822d9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "barsy.de", 0x699da2db, PSL_RULE },
+    { "pc.it", 0x5761a2db, PSL_RULE },
+    { "north-kazakhstan.su", 0xbf17a2dd, PSL_RULE },
+    { "from-al.com", 0xcb30e2de, PSL_RULE },
+    { "shibuya.tokyo.jp", 0xf0a3a2dc, PSL_RULE },
+    { "tur.br", 0x4cebe2e0, PSL_RULE },
+    { "turek.pl", 0x13d622dc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kommune.no", 0x99f4e2e4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.mk", 0xe0a262e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vfs.cloud9.us-west-2.amazonaws.com", 0xe2c562e9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.bo", 0xbe7f62ee, PSL_RULE },
+    { "leitungsen.de", 0x760622ee, PSL_RULE },
+    { "xn--mgbpl2fh", 0x98f7e2ef, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-slick.com", 0x6689a2f3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ibxos.it", 0x5cc862f7, PSL_RULE },
+    { "kitahiroshima.hokkaido.jp", 0x1da662f8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "verisign", 0xfc69e2fa, PSL_RULE },
+    { "shiki.saitama.jp", 0x99b722fb, PSL_RULE },
+    { "nra", 0x356f22fc, PSL_RULE },
+    { "fauske.no", 0xcfc262fd, PSL_RULE },
+    { "te.ua", 0x7ebba2fe, PSL_RULE },
+    { "xn--nvuotna-hwa.no", 0x041962fe, PSL_RULE },
+    { "edu.ve", 0xc4d06300, PSL_RULE },
+    { "museum.mw", 0x2db0a301, PSL_RULE },
+    { "coop.ht", 0xfb976302, PSL_RULE },
+    { "rochester.museum", 0x08e2a300, PSL_RULE },
+    { "us.com", 0x2fb6a300, PSL_RULE },
+    { "naganohara.gunma.jp", 0xf3762305, PSL_RULE },
+    { NULL, 0, 0 },
+    { "schmidt", 0x44962307, PSL_RULE },
+    { "oz.au", 0xa47f2308, PSL_RULE },
+    { "corporation.museum", 0x65796309, PSL_RULE },
+    { "mandal.no", 0x9e342309, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hidaka.saitama.jp", 0xd1c2e30f, PSL_RULE },
+    { "cloudns.pro", 0x89c2e310, PSL_RULE },
+    { "travel.pl", 0x018b2311, PSL_RULE },
+    { "kazo.saitama.jp", 0x197a2312, PSL_RULE },
+    { "herokuapp.com", 0x295ea313, PSL_RULE },
+    { "ac.ls", 0xbb672314, PSL_RULE },
+    { "lib.tn.us", 0xedf1e312, PSL_RULE },
+    { "riobranco.br", 0x3ea96314, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kushima.miyazaki.jp", 0xd948631a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rauma.no", 0xd356e31c, PSL_RULE },
+    { "sa.edu.au", 0x1544a31d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yakumo.shimane.jp", 0xf248a320, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.qa", 0x8c5e6322, PSL_RULE },
+    { "teramo.it", 0x0f4fa322, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "futuremailing.at", 0x4b1fa328, PSL_RULE },
+    { NULL, 0, 0 },
+    { "eu-west-1.elasticbeanstalk.com", 0x8fb3632a, PSL_RULE },
+    { "mlbfan.org", 0x427ae32b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "notogawa.shiga.jp", 0x7069632d, PSL_RULE },
+    { "cool", 0xeeef632e, PSL_RULE },
+    { "hu.eu.org", 0x3e21e32e, PSL_RULE },
+    { "kerrylogistics", 0x04dca32f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "coldwar.museum", 0x1f11e333, PSL_RULE },
+    { "neues.museum", 0xb080a333, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vao.it", 0x44f82336, PSL_RULE },
+    { "aeroport.fr", 0x15b4a337, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "isa-geek.org", 0x22b2a33b, PSL_RULE },
+    { "or.mu", 0x30a6233c, PSL_RULE },
+    { "berlin.museum", 0x570c233d, PSL_RULE },
+    { "org.pn", 0x298c633b, PSL_RULE },
+    { "trentinos-tirol.it", 0x36a5633f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xs4all.space", 0xebf0e343, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "myspreadshop.se", 0xfe076346, PSL_RULE },
+    { "lib.ny.us", 0x00a5e347, PSL_RULE },
+    { "or.pw", 0x0662e347, PSL_RULE },
+    { "umbria.it", 0xd351a348, PSL_RULE },
+    { "viva", 0xe793e349, PSL_RULE },
+    { "fe.it", 0x4d67a34b, PSL_RULE },
+    { "hotels", 0x2364e34c, PSL_RULE },
+    { "org.vn", 0xff1da34d, PSL_RULE },
+    { "bihar.in", 0x5813e34e, PSL_RULE },
+    { "chips.jp", 0x3e25e34e, PSL_RULE },
+    { "xn--90a3ac", 0x74e8634e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "paba.se", 0xe863e353, 0 },
+    { "cust.testing.thingdust.io", 0xf304e354, PSL_RULE },
+    { "sirdal.no", 0x9b8ee353, PSL_RULE },
+    { "avellino.it", 0x626fa356, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kawagoe.saitama.jp", 0x24352358, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.com.uy", 0x1f6fa35a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "banzai.cloud", 0x40d3a35d, PSL_WILDCARD },
+    { "shichinohe.aomori.jp", 0x52d3a35e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gn", 0x5a366362, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gea", 0x1e3b2364, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sendai.jp", 0xc4a0e367, PSL_WILDCARD },
+    { "kpmg", 0xea792368, PSL_RULE },
+    { NULL, 0, 0 },
+    { "photos", 0xb2f2a36a, PSL_RULE },
+    { "co.om", 0x9af9e36b, PSL_RULE },
+    { "wales", 0x0c39636b, PSL_RULE },
+    { "win", 0x28a4236d, PSL_RULE },
+    { "giize.com", 0x1e3e636e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ac.ke", 0xd0bbe371, PSL_RULE },
+    { "certification.aero", 0xf0fb6372, PSL_RULE },
+    { "disrec.thingdust.io", 0x6fefe371, 0 },
+    { "norton", 0x7daaa371, PSL_RULE },
+    { "selfip.net", 0x6e4ee373, PSL_RULE },
+    { "toyota.aichi.jp", 0x8316e373, PSL_RULE },
+    { "xn--uc0ay4a.hk", 0xba42e371, PSL_RULE },
+    { NULL, 0, 0 },
+    { "homebuilt.aero", 0x359fa379, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pu.it", 0x633f237d, PSL_RULE },
+    { "net.tr", 0xf09da37e, PSL_RULE },
+    { "ap-south-1.elasticbeanstalk.com", 0x0b4d237f, PSL_RULE },
+    { "net.ci", 0xec58a380, PSL_RULE },
+    { NULL, 0, 0 },
+    { "civilization.museum", 0x4d1f2382, PSL_RULE },
+    { "scot", 0x3e6a6382, PSL_RULE },
+    { "educational.museum", 0x98c2e384, PSL_RULE },
+    { "is-a-patsfan.org", 0xa7022385, PSL_RULE },
+    { "london.cloudapps.digital", 0xed0f6384, PSL_RULE },
+    { "taiji.wakayama.jp", 0x821fe382, PSL_RULE },
+    { "za.org", 0x7cb96382, PSL_RULE },
+    { "cc.mi.us", 0x33982389, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.nd.us", 0x2a1a238d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "akamaiedge.net", 0x2d002391, PSL_RULE },
+    { "bomlo.no", 0x031ce391, PSL_RULE },
+    { "itayanagi.aomori.jp", 0x2b1f6391, PSL_RULE },
+    { "gov.za", 0x4d6fe394, PSL_RULE },
+    { "kongsvinger.no", 0xb181a395, PSL_RULE },
+    { "ford", 0xb7a5a396, PSL_RULE },
+    { "ind.in", 0x4c336397, PSL_RULE },
+    { "s3-ap-south-1.amazonaws.com", 0x20cba391, PSL_RULE },
+    { "scholarships", 0xba76e396, PSL_RULE },
+    { "usa.oita.jp", 0x2e2a2397, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "money.museum", 0x70dbe39f, PSL_RULE },
+    { "ed.jp", 0x939f63a0, PSL_RULE },
+    { "is-an-entertainer.com", 0xb751a3a0, PSL_RULE },
+    { "pg.it", 0x4f6c239f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "riik.ee", 0x30a563a4, PSL_RULE },
+    { "spdns.de", 0x580ce3a4, PSL_RULE },
+    { "gb", 0x3a2ba3a6, PSL_RULE },
+    { "rj.gov.br", 0x116ce3a7, PSL_RULE },
+    { "tatsuno.nagano.jp", 0x3eb4e3a5, PSL_RULE },
+    { "tm.dz", 0xb78a63a6, PSL_RULE },
+    { "sytes.net", 0x99c263aa, PSL_RULE },
+    { "canada.museum", 0x484a23ab, PSL_RULE },
+    { NULL, 0, 0 },
+    { "museum.tt", 0xc8fc23ad, PSL_RULE },
+    { "midsund.no", 0xb68963ae, PSL_RULE },
+    { "fujimi.nagano.jp", 0x882063af, PSL_RULE },
+    { "thd", 0xd56663af, PSL_RULE },
+    { "xn--kranghke-b0a.no", 0xd5a7e3ad, PSL_RULE },
+    { "ringsaker.no", 0xc82ea3b2, PSL_RULE },
+    { "ap.it", 0x3633a3b3, PSL_RULE },
+    { "hashima.gifu.jp", 0x6a65e3b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ryuoh.shiga.jp", 0x313263b6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "jewishart.museum", 0x4b01a3b8, PSL_RULE },
+    { "kuleuven.cloud", 0x2604a3b9, PSL_RULE },
+    { "gov.in", 0xc92be3ba, PSL_RULE },
+    { "coupon", 0x768d63bb, PSL_RULE },
+    { "sakae.nagano.jp", 0x845a63b8, PSL_RULE },
+    { "saveincloud.net", 0x7c3ce3b9, 0 },
+    { "xn--nry-yla5g.no", 0x06a763b8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--frya-hra.no", 0x74ea63c0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.ml", 0x3b39a3c3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nishiarita.saga.jp", 0x8a8523c5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "yugawara.kanagawa.jp", 0xdfcc63c7, PSL_RULE },
+    { "citi", 0xc14163c8, PSL_RULE },
+    { "toyama.jp", 0x5fc523c8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "go.th", 0xe26923cb, PSL_RULE },
+    { "iwakuni.yamaguchi.jp", 0xfc2a23cb, PSL_RULE },
+    { "alaheadju.no", 0xfafca3cd, PSL_RULE },
+    { "kita.kyoto.jp", 0xf6d5a3cc, PSL_RULE },
+    { "is-into-games.com", 0xa53623cf, PSL_RULE },
+    { "rec.co", 0xd1eea3cf, PSL_RULE },
+    { "valle-aosta.it", 0x4237a3cf, PSL_RULE },
+    { "walter", 0xe95823cc, PSL_RULE },
+    { "yandexcloud.net", 0x2a9de3d0, PSL_RULE },
+    { "boehringer", 0x4045e3d4, PSL_RULE },
+    { "us", 0x4c5223d5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "roma.it", 0xd43663d7, PSL_RULE },
+    { "us.kg", 0xc8c323d7, PSL_RULE },
+    { "co.ua", 0x59a363d9, PSL_RULE },
+    { "cdn-edges.net", 0xbb34a3da, PSL_RULE },
+    { "mythic-beasts.com", 0x7d5ae3d9, 0 },
+    { "qcx.io", 0x9b7ce3db, PSL_RULE },
+    { "chintai", 0xc44363dd, PSL_RULE },
+    { "kinko.kagoshima.jp", 0xb3a223dd, PSL_RULE },
+    { "net.mx", 0xab3563df, PSL_RULE },
+    { "retrosnub.co.uk", 0xc45563db, 0 },
+    { "xn--gk3at1e", 0x30b363df, PSL_RULE },
+    { "giehtavuoatna.no", 0xec8ea3e2, PSL_RULE },
+    { "pymnt.uk", 0x9038e3e3, PSL_RULE },
+    { "webhop.me", 0x8031a3e4, PSL_RULE },
+    { "webview-assets.cloud9.sa-east-1.amazonaws.com", 0x334263e2, PSL_RULE },
+    { "fm.br", 0xbc8463e6, PSL_RULE },
+    { "minowa.nagano.jp", 0xfffa23e6, PSL_RULE },
+    { "sch.qa", 0xa0d123e7, PSL_RULE },
+    { "webhop.biz", 0xed0523e7, PSL_RULE },
+    { "wskr.gov.pl", 0x6a04a3ea, PSL_RULE },
+    { "in.net", 0x44eb63eb, PSL_RULE },
+    { "is-a-player.com", 0xf281e3ec, PSL_RULE },
+    { "aus.basketball", 0xcdf5e3ed, PSL_RULE },
+    { "dualstack.eu-west-2.amazonaws.com", 0x9b9ce3ee, 0 },
+    { "instantcloud.cn", 0x343b63ee, PSL_RULE },
+    { "square7.ch", 0x264ae3ee, PSL_RULE },
+    { "video.hu", 0x333023f1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cpa.pro", 0xc7ff63f4, PSL_RULE },
+    { "id.ir", 0x535263f5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kikugawa.shizuoka.jp", 0x7eb5a3f7, PSL_RULE },
+    { "me", 0x401a63f7, PSL_RULE },
+    { "katsushika.tokyo.jp", 0xa0d323f9, PSL_RULE },
+    { "rocher", 0xe2ace3f8, PSL_RULE },
+    { "insure", 0x02cfa3fb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pr", 0x4d5463ff, PSL_RULE },
+    { "higashiyodogawa.osaka.jp", 0x3f432400, PSL_RULE },
+    { "shiroishi.miyagi.jp", 0xc793a3ff, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cam.it", 0x78c9a403, PSL_RULE },
+    { "gs.rl.no", 0xc8df2404, PSL_RULE },
+    { "locker", 0xb352e405, PSL_RULE },
+    { "republican", 0xa0d46404, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shijonawate.osaka.jp", 0x3d57e409, PSL_RULE },
+    { "quebec.museum", 0x73afa40a, PSL_RULE },
+    { "sj", 0x5e3f640a, PSL_RULE },
+    { "ruhr", 0x66af640c, PSL_RULE },
+    { "nyc", 0x1060e40d, PSL_RULE },
+    { "xn--mxtq1m", 0x0824e409, PSL_RULE },
+    { "imperia.it", 0xbfaf640f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.bn", 0xff802414, PSL_RULE },
+    { "osen.no", 0x93c62415, PSL_RULE },
+    { "thingdustdata.com", 0x00d8a414, PSL_RULE },
+    { "vicenza.it", 0x43342414, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bulsan.it", 0x0004e419, PSL_RULE },
+    { "gov.af", 0xca4fe41a, PSL_RULE },
+    { "6g.in", 0x1692241b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pol.tr", 0xa01ee41e, PSL_RULE },
+    { "kyoto", 0x9e89e41f, PSL_RULE },
+    { "ind.kw", 0xa44fe420, PSL_RULE },
+    { "case", 0xc5dd2421, PSL_RULE },
+    { "go.cr", 0xd786e422, PSL_RULE },
+    { "dualstack.eu-west-1.amazonaws.com", 0xb74ae423, 0 },
+    { "on-rancher.cloud", 0xcd766423, PSL_WILDCARD },
+    { "reggiocalabria.it", 0x2edfe41e, PSL_RULE },
+    { "suifu.ibaraki.jp", 0x07422426, PSL_RULE },
+    { "dsmynas.com", 0x40fd6427, PSL_RULE },
+    { "obuse.nagano.jp", 0x0b742427, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "trentinoaadige.it", 0x71e4242c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "unjarga.no", 0x1a45e42e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "skygearapp.com", 0xa32da433, PSL_RULE },
+    { "ap-south-1.amazonaws.com", 0xac3fe434, 0 },
+    { "vagsoy.no", 0x84cae433, PSL_RULE },
+    { "poivron.org", 0xd97ba436, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "balsfjord.no", 0x5ecba43d, PSL_RULE },
+    { "kayabe.hokkaido.jp", 0xa59fa43e, PSL_RULE },
+    { "sport", 0xb5a8243d, PSL_RULE },
+    { "no-ip.info", 0x9af7e440, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hokuto.yamanashi.jp", 0x7de1a442, PSL_RULE },
+    { "org.ba", 0x323d2442, PSL_RULE },
+    { "ngo.za", 0x2a266444, PSL_RULE },
+    { "academy", 0x7515a445, PSL_RULE },
+    { "food", 0x15f5a445, PSL_RULE },
+    { "brussel.museum", 0x16bea447, PSL_RULE },
+    { "londrina.br", 0xe4682448, PSL_RULE },
+    { "org.sn", 0xc79da446, PSL_RULE },
+    { "aws", 0xcd49a44a, PSL_RULE },
+    { "lib.mt.us", 0xc409244b, PSL_RULE },
+    { "cesena-forli.it", 0x8f5ae44c, PSL_RULE },
+    { "sumida.tokyo.jp", 0x414f6444, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shell", 0xccc46451, PSL_RULE },
+    { NULL, 0, 0 },
+    { "readmyblog.org", 0x526ca453, PSL_RULE },
+    { NULL, 0, 0 },
+    { "batsfjord.no", 0xd562a455, PSL_RULE },
+    { "nowruz", 0xbcade456, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cleaning", 0x581aa458, PSL_RULE },
+    { "tjeldsund.no", 0x97776459, PSL_RULE },
+    { "ochi.kochi.jp", 0xe35fe45a, PSL_RULE },
+    { "am", 0x642e245b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "urawa.saitama.jp", 0x1aa3245f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--unup4y", 0xcbffe466, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "morioka.iwate.jp", 0x4b03e469, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "caltanissetta.it", 0x481a246e, PSL_RULE },
+    { "from-id.com", 0x62b5a46e, PSL_RULE },
+    { "visa", 0x16aea46e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pasadena.museum", 0xd7e0a472, PSL_RULE },
+    { "undersea.museum", 0x5989e472, PSL_RULE },
+    { "webview-assets.cloud9.us-east-1.amazonaws.com", 0x46b8a472, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.jo", 0xf414e478, PSL_RULE },
+    { "nedre-eiker.no", 0xdc48e479, PSL_RULE },
+    { "pro.vn", 0x57042478, PSL_RULE },
+    { "goldpoint", 0xbe26647b, PSL_RULE },
+    { "friuli-venezia-giulia.it", 0x3ff4647c, PSL_RULE },
+    { "kopervik.no", 0xdef7e47d, PSL_RULE },
+    { "kg.kr", 0xbe6aa47e, PSL_RULE },
+    { "oppegard.no", 0x81d1a47c, PSL_RULE },
+    { "asmatart.museum", 0xe8d3e480, PSL_RULE },
+    { "padua.it", 0x1090e47b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.cw", 0xe53aa484, PSL_RULE },
+    { "lolipopmc.jp", 0x22d86484, PSL_RULE },
+    { "sandcats.io", 0x5f2b6484, PSL_RULE },
+    { "go.ci", 0xc5576487, PSL_RULE },
+    { "gonohe.aomori.jp", 0x5f8ca488, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mil.by", 0x122ba48a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "botanicalgarden.museum", 0xf769648d, PSL_RULE },
+    { "edgesuite-staging.net", 0x6078e48d, PSL_RULE },
+    { "in.ua", 0x83a5e48e, PSL_RULE },
+    { "lel.br", 0xdb49248e, PSL_RULE },
+    { "feste-ip.net", 0xb10ea491, PSL_RULE },
+    { "mediatech.by", 0xbfbda490, PSL_RULE },
+    { "boo", 0x99292493, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "miyawaka.fukuoka.jp", 0x858e2497, PSL_RULE },
+    { "cherkassy.ua", 0xa9f66498, PSL_RULE },
+    { "anthropology.museum", 0xaa73a499, PSL_RULE },
+    { "blogspot.lt", 0x799da499, PSL_RULE },
+    { "elvendrell.museum", 0xbc892498, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.pn", 0x1e25249e, PSL_RULE },
+    { "repair", 0x5b9d649e, PSL_RULE },
+    { "net.sy", 0x30b1a4a0, PSL_RULE },
+    { "pl", 0x5931e4a1, PSL_RULE },
+    { "toon.ehime.jp", 0x24cf249f, PSL_RULE },
+    { "xn--hcesuolo-7ya35b.no", 0x91d9649e, PSL_RULE },
+    { "zw", 0x5547a4a4, PSL_RULE },
+    { "miho.ibaraki.jp", 0x70e164a5, PSL_RULE },
+    { "sakawa.kochi.jp", 0x25aee4a5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "friuliveneziagiulia.it", 0xf7cea4a8, PSL_RULE },
+    { "hokksund.no", 0x6c5664a9, PSL_RULE },
+    { "rishirifuji.hokkaido.jp", 0xf87ba4a9, PSL_RULE },
+    { "pagefrontapp.com", 0x9a5064ab, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gs.ol.no", 0xa022e4ad, PSL_RULE },
+    { "loten.no", 0x162124ae, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cdn77-ssl.net", 0x0704e4b0, PSL_RULE },
+    { "khmelnitskiy.ua", 0x040924b1, PSL_RULE },
+    { "nasushiobara.tochigi.jp", 0x006fa4b0, PSL_RULE },
+    { "tm.no", 0xb3b664b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "minamiminowa.nagano.jp", 0xd130a4b5, PSL_RULE },
+    { "daegu.kr", 0xfec664b6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yasu.shiga.jp", 0xd012a4b9, PSL_RULE },
+    { "x.bg", 0xe9d6a4ba, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ms.it", 0x623aa4bc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dds", 0xd824e4c2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "freetls.fastly.net", 0xd61f24c4, PSL_RULE },
+    { "lecce.it", 0x35eb24c4, PSL_RULE },
+    { "targi.pl", 0x0728a4c4, PSL_RULE },
+    { "cust.prod.thingdust.io", 0x0f8324c7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "akamaized-staging.net", 0x363fe4c9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "meguro.tokyo.jp", 0x5b65e4cc, PSL_RULE },
+    { "edu.kw", 0x355764cd, PSL_RULE },
+    { "cocotte.jp", 0x87f7a4ce, PSL_RULE },
+    { "deno-staging.dev", 0x44e3a4ce, PSL_RULE },
+    { "newspaper.museum", 0xc12364cc, PSL_RULE },
+    { "sch.zm", 0x3575a4ce, PSL_RULE },
+    { "akamai.net", 0xa80d24d2, PSL_RULE },
+    { "org.sz", 0x9bb3e4d2, PSL_RULE },
+    { "sv", 0x5649e4ce, PSL_RULE },
+    { "virginia.museum", 0xca39a4d0, PSL_RULE },
+    { "xn--gckr3f0f", 0x9f7564d1, PSL_RULE },
+    { "anquan", 0x9c5a64d7, PSL_RULE },
+    { "ar.us", 0x743724d8, PSL_RULE },
+    { "cc.ak.us", 0xbfd8a4d7, PSL_RULE },
+    { "minamiawaji.hyogo.jp", 0xed30e4d8, PSL_RULE },
+    { "onavstack.net", 0x982da4d8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "wakayama.wakayama.jp", 0x559ca4df, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ong.br", 0xe01ea4e1, PSL_RULE },
+    { "scienceandhistory.museum", 0x422124e2, PSL_RULE },
+    { "patria.bo", 0x685ee4e3, PSL_RULE },
+    { "omega", 0x46e5a4e4, PSL_RULE },
+    { "ddnsgeek.com", 0xd488a4e5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.sy", 0xeacd24e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nanyo.yamagata.jp", 0x28f9a4e9, PSL_RULE },
+    { "malselv.no", 0x0e74a4ea, PSL_RULE },
+    { NULL, 0, 0 },
+    { "beauxarts.museum", 0xe545e4ec, PSL_RULE },
+    { "xn--mori-qsa.nz", 0x3301e4ec, PSL_RULE },
+    { "iida.nagano.jp", 0x50d164ee, PSL_RULE },
+    { "ybo.trade", 0x080724ef, PSL_RULE },
+    { "baghdad.museum", 0x070e64f0, PSL_RULE },
+    { "toga.toyama.jp", 0x6f3524f1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kuriyama.hokkaido.jp", 0x06f0a4f4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pohl", 0x63b6a4f6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "googleapis.com", 0xa451e4fa, PSL_RULE },
+    { "owani.aomori.jp", 0x877664fa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.mx", 0xbfd8e4fe, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "levanger.no", 0xd5ff2504, PSL_RULE },
+    { "kharkov.ua", 0xe87ba505, PSL_RULE },
+    { "is-a-bookkeeper.com", 0xee2fa506, PSL_RULE },
+    { "mircloud.ru", 0x75d5a507, PSL_RULE },
+    { "wow", 0x22e8e504, PSL_RULE },
+    { "countryestate.museum", 0xbcf02509, PSL_RULE },
+    { "chanel", 0x44aaa50a, PSL_RULE },
+    { "kwp.gov.pl", 0x944aa50b, PSL_RULE },
+    { "myshopblocks.com", 0x0cc8650c, PSL_RULE },
+    { "mytuleap.com", 0x15efa50d, PSL_RULE },
+    { "doesntexist.com", 0xe02ba50e, PSL_RULE },
+    { "mr.no", 0xca90250f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--dyry-ira.no", 0x6cc52511, PSL_RULE },
+    { "suginami.tokyo.jp", 0x0d3ea512, PSL_RULE },
+    { "penne.jp", 0xadad6513, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "institute", 0xac69e51c, PSL_RULE },
+    { "trogstad.no", 0x19a0e51c, PSL_RULE },
+    { "brussels", 0xff8de51e, PSL_RULE },
+    { "myspreadshop.be", 0xa80fa51f, PSL_RULE },
+    { "dyn53.io", 0x43b2e520, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.kw", 0x96892522, PSL_RULE },
+    { "edu.pl", 0xcf12e523, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.bs", 0xfbe82527, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.mo", 0x555b6529, PSL_RULE },
+    { NULL, 0, 0 },
+    { "natural.bo", 0x08dda52b, PSL_RULE },
+    { "homesense", 0x3ab1e52c, PSL_RULE },
+    { "sciencecenters.museum", 0x4099a52d, PSL_RULE },
+    { "xn--vrggt-xqad.no", 0xc1a9e52b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "indian.museum", 0x56ca6530, PSL_RULE },
+    { "bplaced.de", 0x89072531, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.uk", 0xd0902533, PSL_RULE },
+    { "hitachinaka.ibaraki.jp", 0x98f5a533, PSL_RULE },
+    { "me.so", 0x860da535, PSL_RULE },
+    { "ip6.arpa", 0x6bd1a536, PSL_RULE },
+    { "soc.dz", 0xfe5de536, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "red.sv", 0xd612e53b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.kg", 0xcc6fe53d, PSL_RULE },
+    { "gov.py", 0x4b4ee53e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edgekey-staging.net", 0x65ab6542, PSL_RULE },
+    { "webview-assets.cloud9.eu-north-1.amazonaws.com", 0xd3fae542, PSL_RULE },
+    { "ghost.io", 0x438ba544, PSL_RULE },
+    { "gojome.akita.jp", 0xc6f36544, PSL_RULE },
+    { "xn--efvy88h", 0x0812a545, PSL_RULE },
+    { "latina.it", 0x6d212547, PSL_RULE },
+    { "xn--krager-gya.no", 0x9c6ca542, PSL_RULE },
+    { "ac.se", 0xaaa3a549, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.network", 0xc771254b, PSL_RULE },
+    { "k12.vt.us", 0x3f3ca54b, PSL_RULE },
+    { "cyou", 0x6a1f654d, PSL_RULE },
+    { "est-a-la-maison.com", 0x0615a54e, PSL_RULE },
+    { "gushikami.okinawa.jp", 0x27f9a54f, PSL_RULE },
+    { "valley.museum", 0x3382e550, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dedibox.fr", 0xe8912552, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nayoro.hokkaido.jp", 0xd60c6559, PSL_RULE },
+    { "hinode.tokyo.jp", 0x23d9255a, PSL_RULE },
+    { "toyo.kochi.jp", 0x7396e55a, PSL_RULE },
+    { "ap-northeast-3.elasticbeanstalk.com", 0xacc0e55c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fnd.br", 0x4c9aa55f, PSL_RULE },
+    { "net.al", 0xd9e0e55f, PSL_RULE },
+    { "pvt.ge", 0x34316561, PSL_RULE },
+    { "cc.ny.us", 0xc515e562, PSL_RULE },
+    { "co.ca", 0x8247a563, PSL_RULE },
+    { "xn--stjrdal-s1a.no", 0xec52e560, PSL_RULE },
+    { "site.transip.me", 0x29686565, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.hk", 0x375d6568, PSL_RULE },
+    { "my.eu.org", 0x432ae569, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dz", 0x4967e56b, PSL_RULE },
+    { "hl.cn", 0x15b1656c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tamaki.mie.jp", 0xe116e571, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "realtor", 0xe997e576, PSL_RULE },
+    { "cn.vu", 0xc92ee577, PSL_RULE },
+    { "se.leg.br", 0x4e412577, PSL_RULE },
+    { "name.na", 0x49326579, PSL_RULE },
+    { "lipsy", 0x8e80257a, PSL_RULE },
+    { "geology.museum", 0xf3f1e57b, PSL_RULE },
+    { "bajddar.no", 0x3623e57c, PSL_RULE },
+    { "cab", 0x67b7657d, PSL_RULE },
+    { "is-into-anime.com", 0x0437a57c, PSL_RULE },
+    { "code.run", 0x0f59e57f, PSL_WILDCARD },
+    { "krakow.pl", 0x6d94e580, PSL_RULE },
+    { "floppy.jp", 0x8f95e581, PSL_RULE },
+    { "forgerock.io", 0x0e046581, 0 },
+    { "living.museum", 0xa7e2e57a, PSL_RULE },
+    { "blogspot.mx", 0x50952584, PSL_RULE },
+    { "sf.no", 0xb8c1a585, PSL_RULE },
+    { "vix.br", 0xdcace580, PSL_RULE },
+    { "kagawa.jp", 0x22b1a587, PSL_RULE },
+    { "wedeploy.sh", 0x13b1e577, PSL_RULE },
+    { "campaign.gov.uk", 0x96b42589, PSL_RULE },
+    { "ne", 0x411a658a, PSL_RULE },
+    { "xn--8y0a063a", 0x7f48e583, PSL_RULE },
+    { "barsycenter.com", 0x9916658c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sr", 0x4e546592, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--frde-gra.no", 0x8ea6a594, PSL_RULE },
+    { "ch.tc", 0xe170a595, PSL_RULE },
+    { "club", 0x6f39e595, PSL_RULE },
+    { "code.com", 0x39f8a597, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lc", 0x6329a59a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dyn-ip24.de", 0x2089659d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "elasticbeanstalk.com", 0x0e0aa5a0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ipifony.net", 0x7e95a5a4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "takazaki.miyazaki.jp", 0x89e125a8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "definima.io", 0x7e3125aa, PSL_RULE },
+    { "eco.br", 0x309b25aa, PSL_RULE },
+    { "prato.it", 0x95d365ac, PSL_RULE },
+    { NULL, 0, 0 },
+    { "5g.in", 0x179225ae, PSL_RULE },
+    { "com.bz", 0xc17665ae, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.so", 0xdf9065b2, PSL_RULE },
+    { "k12.ok.us", 0x44c0e5b3, PSL_RULE },
+    { "fuel.aero", 0xc00de5b4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "guitars", 0x0e6065bc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "california.museum", 0x61d265bf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "futsu.nagasaki.jp", 0xee19a5c1, PSL_RULE },
+    { "slupsk.pl", 0xf54d65c1, PSL_RULE },
+    { "mimata.miyazaki.jp", 0xb3d4e5c3, PSL_RULE },
+    { "xn--srum-gra.no", 0x23e525c4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "al.leg.br", 0x542fe5c8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fuoisku.no", 0x6a4de5cc, PSL_RULE },
+    { "homesecuritypc.com", 0x41c625cc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.id", 0x001e65cf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bilbao.museum", 0xf13b65d4, PSL_RULE },
+    { "xn--mgbca7dzdo", 0xd232e5d5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.ba", 0x0d0725d8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jdf.br", 0x4943a5db, PSL_RULE },
+    { "org.sc", 0xc88425db, PSL_RULE },
+    { "xn--lesund-hua.no", 0x6bd8a5dc, PSL_RULE },
+    { "aisai.aichi.jp", 0xc90f65de, PSL_RULE },
+    { "aurland.no", 0x365fa5df, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ath.cx", 0x9b1c25e1, PSL_RULE },
+    { "my.id", 0x06a365e2, PSL_RULE },
+    { "au", 0x544325e3, PSL_RULE },
+    { "forsale", 0x852665e3, PSL_RULE },
+    { "mba", 0x1847e5e5, PSL_RULE },
+    { "tochigi.tochigi.jp", 0xabc025e3, PSL_RULE },
+    { "kawanehon.shizuoka.jp", 0xdbf8e5e7, PSL_RULE },
+    { "miami", 0xa74ca5e8, PSL_RULE },
+    { "abbott", 0x3ac625e9, PSL_RULE },
+    { "pippu.hokkaido.jp", 0x0e40e5e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.me", 0x185f25ed, PSL_RULE },
+    { "bm", 0x652e25ee, PSL_RULE },
+    { "safe", 0x2e29e5ee, PSL_RULE },
+    { "scaleforce.net", 0x394965ed, 0 },
+    { "kurgan.su", 0xa71e25f1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "woodside", 0xf302a5f3, PSL_RULE },
+    { "miyashiro.saitama.jp", 0xb2a3e5f4, PSL_RULE },
+    { "shimogo.fukushima.jp", 0xd25925f4, PSL_RULE },
+    { "cloud", 0xd67425f6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "misawa.aomori.jp", 0xa0e465f8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu", 0x57bca5fb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "s3-website.us-east-2.amazonaws.com", 0xc30025fe, PSL_RULE },
+    { "xn--lt-liac.no", 0xe9fa65fe, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rc.it", 0x5961a601, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.jp", 0x99aaa605, PSL_RULE },
+    { "society.museum", 0x205ba605, PSL_RULE },
+    { "swinoujscie.pl", 0xefa0a606, PSL_RULE },
+    { "com.pf", 0x3b4f6608, PSL_RULE },
+    { "komaki.aichi.jp", 0x8b346609, PSL_RULE },
+    { "motorcycle.museum", 0x594ea60a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nordkapp.no", 0xfeaea60d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "coastaldefence.museum", 0x931ca612, PSL_RULE },
+    { NULL, 0, 0 },
+    { "reservd.testing.thingdust.io", 0x58946614, PSL_RULE },
+    { "izumizaki.fukushima.jp", 0x46ca2615, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "no-ip.org", 0xb063a618, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "maniwa.okayama.jp", 0xb00aa61b, PSL_RULE },
+    { "top", 0x5533661c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kawasaki.jp", 0x7568261f, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "uenohara.yamanashi.jp", 0x425d2623, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--mix082f", 0xb4122625, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.tw", 0x37ea2628, PSL_RULE },
+    { "oiso.kanagawa.jp", 0xb1136628, PSL_RULE },
+    { NULL, 0, 0 },
+    { "memorial", 0x2375e62b, PSL_RULE },
+    { "ud.it", 0x5a63e62b, PSL_RULE },
+    { "virtual-user.de", 0xceb7662d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "viking", 0xd955a62f, PSL_RULE },
+    { "medical.museum", 0x03bc6630, PSL_RULE },
+    { "furniture.museum", 0xd087e631, PSL_RULE },
+    { NULL, 0, 0 },
+    { "jellybean.jp", 0x88cb2633, PSL_RULE },
+    { "is-a-celticsfan.org", 0xfbe82634, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--hxt814e", 0x0cdaa63b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tomioka.gunma.jp", 0x17b6263f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bern.museum", 0xc04da642, PSL_RULE },
+    { "co.at", 0x5e00a642, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sakaki.nagano.jp", 0x114aa645, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "biz.ss", 0x455c2648, PSL_RULE },
+    { NULL, 0, 0 },
+    { "im.it", 0x4a7b264a, PSL_RULE },
+    { "hyogo.jp", 0x7254264b, PSL_RULE },
+    { "lolipop.io", 0xd3a0264a, PSL_RULE },
+    { "sling", 0x58b5664a, PSL_RULE },
+    { "com.ki", 0x5643664e, PSL_RULE },
+    { "stripper.jp", 0x6654e64c, PSL_RULE },
+    { "y.bg", 0xead6a64d, PSL_RULE },
+    { "ny-2.paas.massivegrid.net", 0xcfc76651, PSL_RULE },
+    { "akamaihd-staging.net", 0xfce16652, PSL_RULE },
+    { "hannan.osaka.jp", 0xc14fa652, PSL_RULE },
+    { "glitch.me", 0xa1b0a654, PSL_RULE },
+    { "lardal.no", 0x98a26652, PSL_RULE },
+    { "tula.su", 0x181aa651, PSL_RULE },
+    { NULL, 0, 0 },
+    { "omiya.saitama.jp", 0xd9cde658, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "freemyip.com", 0x9363665b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloud9.eu-south-1.amazonaws.com", 0xad9da65d, 0 },
+    { "to", 0x5b34265e, PSL_RULE },
+    { "trani-barletta-andria.it", 0xea99e65e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "witd.gov.pl", 0xb2552663, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ed.ao", 0x1f72e666, PSL_RULE },
+    { NULL, 0, 0 },
+    { "developer.app", 0x123d6668, PSL_WILDCARD },
+    { "nishiwaki.hyogo.jp", 0x5c576668, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sch.ly", 0x9728266c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "miyoshi.tokushima.jp", 0x3e4de670, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mydissent.net", 0x87daa672, PSL_RULE },
+    { "sampa.br", 0x3a64a673, PSL_RULE },
+    { NULL, 0, 0 },
+    { "123hjemmeside.dk", 0x0c346675, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "clock.museum", 0xd9866679, PSL_RULE },
+    { "hitachiomiya.ibaraki.jp", 0x23bce679, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kunstsammlung.museum", 0xf66aa67c, PSL_RULE },
+    { "lovesick.jp", 0x1ca0e67d, PSL_RULE },
+    { "omi.nagano.jp", 0xe3c6a67c, PSL_RULE },
+    { "org.al", 0xee84667e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "contractors", 0x35bbe683, PSL_RULE },
+    { "dallas.museum", 0xd96ca684, PSL_RULE },
+    { "ann-arbor.mi.us", 0x22c52685, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.nc.tr", 0x2ac4a688, PSL_RULE },
+    { "in", 0x5c366688, PSL_RULE },
+    { "kamaishi.iwate.jp", 0xcdf8e68a, PSL_RULE },
+    { "xn--hgebostad-g3a.no", 0x698da68b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gallo", 0x941da68e, PSL_RULE },
+    { "komoro.nagano.jp", 0x0a7f668e, PSL_RULE },
+    { "toyota", 0x5ee0668f, PSL_RULE },
+    { "fire", 0x3ead6691, PSL_RULE },
+    { "int.is", 0xc9456692, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.gu", 0x35852697, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.la", 0xff622699, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "go.it", 0x4c7fa69e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "leangaviika.no", 0xb3c566a2, PSL_RULE },
+    { "nu.it", 0x653f26a3, PSL_RULE },
+    { "akadns.net", 0x0af926a4, PSL_RULE },
+    { "broadcast.museum", 0x7807e6a4, PSL_RULE },
+    { "niigata.jp", 0x6e1626a6, PSL_RULE },
+    { "ikeda.nagano.jp", 0xf80b66a7, PSL_RULE },
+    { "com.dz", 0xdc13a6a8, PSL_RULE },
+    { "lig.it", 0xf474e6a8, PSL_RULE },
+    { "ambulance.aero", 0xbea7e6aa, PSL_RULE },
+    { "nango.fukushima.jp", 0x7b6126ab, PSL_RULE },
+    { "pub.sa", 0xa65266a4, PSL_RULE },
+    { "yamamoto.miyagi.jp", 0xd19426ac, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "endofinternet.net", 0x0a1026b3, PSL_RULE },
+    { "holtalen.no", 0xff9126b3, PSL_RULE },
+    { "higashimurayama.tokyo.jp", 0x626f66b5, PSL_RULE },
+    { "claims", 0x537a26b6, PSL_RULE },
+    { "dad", 0xe74f26b6, PSL_RULE },
+    { "luzern.museum", 0x34e6e6b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dyndns.ddnss.de", 0xd74f66ba, PSL_RULE },
+    { "mazowsze.pl", 0xe00f66bb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aktyubinsk.su", 0xc24726be, PSL_RULE },
+    { "lyngdal.no", 0x7faa66bf, PSL_RULE },
+    { "vfs.cloud9.us-east-2.amazonaws.com", 0x274e66bf, PSL_RULE },
+    { "zaporizhzhe.ua", 0x6a5326c1, PSL_RULE },
+    { "hedmark.no", 0xc60d26c2, 0 },
+    { "flier.jp", 0x9c5b66c3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nakano.tokyo.jp", 0x2f19e6c5, PSL_RULE },
+    { "paas.datacenter.fi", 0x613426c6, PSL_RULE },
+    { "rg.it", 0x516c26c5, PSL_RULE },
+    { "yatsushiro.kumamoto.jp", 0xae62a6c5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ama.aichi.jp", 0xf56da6ca, PSL_RULE },
+    { "communication.museum", 0xf5aae6cb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "catania.it", 0x7f5926cd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sor-odal.no", 0x8e60e6d1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "store.ro", 0xa41ee6d3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hidaka.hokkaido.jp", 0x44cc26d7, PSL_RULE },
+    { "repl.run", 0x5bfaa6d7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "glass.museum", 0x904aa6db, PSL_RULE },
+    { "ch", 0x5e3ae6dc, PSL_RULE },
+    { "kaisei.kanagawa.jp", 0xf57c66dc, PSL_RULE },
+    { "canva-apps.com", 0x0e7166de, PSL_RULE },
+    { NULL, 0, 0 },
+    { "iliadboxos.it", 0xde6266e0, PSL_RULE },
+    { "isa.us", 0x6e4266e0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--mgbi4ecexp", 0xccc9a6e3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogsyte.com", 0xde14a6e5, PSL_RULE },
+    { "homesklep.pl", 0xab70a6e5, PSL_RULE },
+    { "contemporaryart.museum", 0xfeb966e7, PSL_RULE },
+    { "za.bz", 0x9cc466e6, PSL_RULE },
+    { "kashima.saga.jp", 0xe6cc66e9, PSL_RULE },
+    { "blogspot.rs", 0x5f99e6ea, PSL_RULE },
+    { "kashiwa.chiba.jp", 0x9fe2e6ea, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kota.aichi.jp", 0x493326ee, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "diskstation.me", 0xf455e6f2, PSL_RULE },
+    { "haibara.shizuoka.jp", 0x993ba6f3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kamikawa.hokkaido.jp", 0xf8e666f9, PSL_RULE },
+    { "tmp.br", 0x87a9e6fa, PSL_RULE },
+    { "africa.bj", 0x978a66fb, PSL_RULE },
+    { "hisamitsu", 0xf8ece6fc, PSL_RULE },
+    { "kuzumaki.iwate.jp", 0x220e26fc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "schule", 0x298026ff, PSL_RULE },
+    { "co.ro", 0x51f32700, PSL_RULE },
+    { "lib.gu.us", 0x5c9ea700, PSL_RULE },
+    { "serveblog.net", 0x47b66701, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "skydiving.aero", 0x4fc16708, PSL_RULE },
+    { "sevastopol.ua", 0xcdb26709, PSL_RULE },
+    { "pe.leg.br", 0x4f41270a, PSL_RULE },
+    { "web.in", 0xd4be6708, PSL_RULE },
+    { "wiki.bo", 0x11cce70a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mircloud.host", 0xd0d32710, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.bo", 0x522ea713, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gorlice.pl", 0x7b6be718, PSL_RULE },
+    { "vik.no", 0x2d5be718, PSL_RULE },
+    { "folldal.no", 0x5af4e71a, PSL_RULE },
+    { "zip", 0x5b40e718, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bananarepublic", 0x3aa1e71e, PSL_RULE },
+    { "fin.ci", 0x03bd671e, PSL_RULE },
+    { "caracal.mythic-beasts.com", 0x35042720, PSL_RULE },
+    { "sg-1.paas.massivegrid.net", 0x07bda71f, PSL_RULE },
+    { "xn--mgb9awbf", 0x18f1271e, PSL_RULE },
+    { "edu.nr", 0xd93da723, PSL_RULE },
+    { "com.bh", 0x84326724, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "seirou.niigata.jp", 0xd83aa729, PSL_RULE },
+    { "alp1.ae.flow.ch", 0x0efde72a, PSL_RULE },
+    { "xn--lgbbat1ad8j", 0x118ae72b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "balsan.it", 0x37e7272d, PSL_RULE },
+    { "mc", 0x6429a72d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "genting", 0x9e756731, PSL_RULE },
+    { "cc.id.us", 0xd751a732, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "taketomi.okinawa.jp", 0xa9a82735, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "s3.cn-north-1.amazonaws.com.cn", 0x4ca72739, PSL_RULE },
+    { "wakkanai.hokkaido.jp", 0xa8dfa73a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--leagaviika-52b.no", 0x0d4ee73e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "agrar.hu", 0x9f26e747, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--ostery-fya.no", 0xc84ae749, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "from-ma.com", 0xefdb274d, PSL_RULE },
+    { "oirase.aomori.jp", 0x9dbc674d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bingo", 0x57136750, PSL_RULE },
+    { "net.gu", 0xbacaa750, PSL_RULE },
+    { "university.museum", 0xe532a751, PSL_RULE },
+    { "sn.cn", 0x18b5e753, PSL_RULE },
+    { NULL, 0, 0 },
+    { "instances.scw.cloud", 0x2a8da755, 0 },
+    { "base.shop", 0x88a8a756, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ky.us", 0x6e43e759, PSL_RULE },
+    { NULL, 0, 0 },
+    { "uol", 0x4d51675b, PSL_RULE },
+    { "pccw", 0xb3e6275c, PSL_RULE },
+    { "freebox-os.fr", 0xc122675d, PSL_RULE },
+    { "mangyshlak.su", 0x1f01275e, PSL_RULE },
+    { "stg.dev", 0xe827a75e, PSL_WILDCARD },
+    { "bradesco", 0x33f96760, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloudns.biz", 0xc7242762, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "malopolska.pl", 0xd85aa768, PSL_RULE },
+    { "sld.do", 0x794aa769, PSL_RULE },
+    { "television.museum", 0x63936769, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "takanezawa.tochigi.jp", 0x8897a76f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.jo", 0xe0412775, PSL_RULE },
+    { "teckids.org", 0x1d2ae776, 0 },
+    { "kharkiv.ua", 0xd22ee777, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dsmynas.net", 0x1c5ce779, PSL_RULE },
+    { "xn--tjme-hra.no", 0xb730e77a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "one", 0x618e677f, PSL_RULE },
+    { "rss.my.id", 0x80d8e780, PSL_WILDCARD },
+    { "cm", 0x662e2781, PSL_RULE },
+    { "com.ni", 0x221e6781, PSL_RULE },
+    { "edu.ly", 0x8f622782, PSL_RULE },
+    { "sar.it", 0xf4796782, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.lr", 0x829de786, PSL_RULE },
+    { "okazaki.aichi.jp", 0xd6f1a787, PSL_RULE },
+    { "hachirogata.akita.jp", 0x51dda788, PSL_RULE },
+    { "vaapste.no", 0x9dff2788, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "he.cn", 0x3bc7678d, PSL_RULE },
+    { "vanylven.no", 0xf936a78d, PSL_RULE },
+    { "jcloud.ik-server.com", 0xce62278f, PSL_RULE },
+    { "filegear-gb.me", 0xba076790, PSL_RULE },
+    { NULL, 0, 0 },
+    { "js.wpenginepowered.com", 0x27c36792, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aid.pl", 0x11076795, PSL_RULE },
+    { "cc.tn.us", 0x80bb2795, PSL_RULE },
+    { "matsubushi.saitama.jp", 0x42e2e796, PSL_RULE },
+    { "vpndns.net", 0x46882797, PSL_RULE },
+    { "med.ec", 0x1fb6e799, PSL_RULE },
+    { "firm.ro", 0x71fd279a, PSL_RULE },
+    { "suwalki.pl", 0x199e279b, PSL_RULE },
+    { "taiki.hokkaido.jp", 0xb710e79b, PSL_RULE },
+    { "baths.museum", 0x8339a79d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kviteseid.no", 0xe40467a0, PSL_RULE },
+    { "shiso.hyogo.jp", 0x77f2a7a1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "jelenia-gora.pl", 0x1691a7a3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "servegame.org", 0x72dae7a6, PSL_RULE },
+    { "xn--90amc.xn--p1acf", 0x8ba0a7a6, PSL_RULE },
+    { "cloud-fr1.unispace.io", 0x311ae7a8, PSL_RULE },
+    { "arvo.network", 0x9e1027a9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "campinas.br", 0x44e627ab, PSL_RULE },
+    { "small-web.org", 0xf86767ab, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yamagata.gifu.jp", 0x8e8227af, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "iraq.museum", 0x60aa27b2, PSL_RULE },
+    { "jondal.no", 0x7f24e7b2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "beget.app", 0x3978e7b5, PSL_WILDCARD },
+    { "sjc.br", 0x173c67b5, PSL_RULE },
+    { "xn--hery-ira.nordland.no", 0x177d27b7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "andebu.no", 0x979327bd, PSL_RULE },
+    { "yahiko.niigata.jp", 0x0d9527bd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.to", 0x5dfd67c1, PSL_RULE },
+    { "xn--srreisa-q1a.no", 0xee7267c1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "oseto.nagasaki.jp", 0x080a27c6, PSL_RULE },
+    { "sakuho.nagano.jp", 0x73a3e7c6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "exchange", 0x3c1fa7ca, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pa.leg.br", 0x474ba7ce, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "university", 0x784627d1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "revista.bo", 0x9d5ca7d4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mckinsey", 0x99f967d6, PSL_RULE },
+    { "sopot.pl", 0x157727d6, PSL_RULE },
+    { "kanra.gunma.jp", 0xc25167d8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogsite.xyz", 0x15dbe7df, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "go.leg.br", 0x2a28e7e5, PSL_RULE },
+    { "mysecuritycamera.com", 0xb11a67e5, PSL_RULE },
+    { "tuxfamily.org", 0x10a127e6, PSL_RULE },
+    { "okawa.fukuoka.jp", 0xcd7b67e8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "money.bj", 0xc086a7eb, PSL_RULE },
+    { "cloudns.in", 0x9ad867ec, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chosei.chiba.jp", 0x2ffc27f1, PSL_RULE },
+    { "nobeoka.miyazaki.jp", 0x8baf27f1, PSL_RULE },
+    { "tome.miyagi.jp", 0xf27627f2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "info.tt", 0xf41ae7f5, PSL_RULE },
+    { "koryo.nara.jp", 0x21d727f5, PSL_RULE },
+    { "blogspot.qa", 0x1fbca7f7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.nz", 0x594067f9, PSL_RULE },
+    { "shinkamigoto.nagasaki.jp", 0x0e51e7f9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tabayama.yamanashi.jp", 0x49c067fc, PSL_RULE },
+    { "xn--eckvdtc9d", 0x190127fc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fedoraproject.org", 0x403fa801, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ce.it", 0x5067a804, PSL_RULE },
+    { "etajima.hiroshima.jp", 0x1d63a804, PSL_RULE },
+    { "gov.et", 0xcad4e804, PSL_RULE },
+    { "kakuda.miyagi.jp", 0x7361e806, PSL_RULE },
+    { "casino", 0x046c2808, PSL_RULE },
+    { "ind.tn", 0x2a1b6808, PSL_RULE },
+    { "is-a-conservative.com", 0x4136a808, PSL_RULE },
+    { "kitagata.gifu.jp", 0x408de806, PSL_RULE },
+    { "or.ke", 0xcae52806, PSL_RULE },
+    { "saotome.st", 0x798ee80c, PSL_RULE },
+    { "scrapper-site.net", 0x6b6da806, PSL_RULE },
+    { "ac.gov.br", 0x0e7e280f, PSL_RULE },
+    { "hkt", 0xb7066810, PSL_RULE },
+    { "cooperativa.bo", 0xc76ae811, PSL_RULE },
+    { "estate", 0x80166811, PSL_RULE },
+    { "impertrixcdn.com", 0xd6bde813, PSL_RULE },
+    { "kitakyushu.jp", 0xf9f62813, PSL_WILDCARD },
+    { "ryukyu", 0xb08c2810, PSL_RULE },
+    { "edu.vc", 0x99a42816, PSL_RULE },
+    { "komagane.nagano.jp", 0x7dea6816, PSL_RULE },
+    { "nfshost.com", 0x30306817, PSL_RULE },
+    { "toki.gifu.jp", 0x6e84a815, PSL_RULE },
+    { "xn--45brj9c", 0x3b4ea810, PSL_RULE },
+    { "hn", 0x5d36681b, PSL_RULE },
+    { "agro.bj", 0xeb7aa81c, PSL_RULE },
+    { "blogspot.ru", 0x5a8ba81c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gob.pa", 0x2705e822, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "express", 0x79822827, PSL_RULE },
+    { "torino.museum", 0x907ba828, PSL_RULE },
+    { "otake.hiroshima.jp", 0x8fc22829, PSL_RULE },
+    { "xn--holtlen-hxa.no", 0xf3cf6828, PSL_RULE },
+    { "xn--kltp7d.jp", 0xfddd282b, PSL_RULE },
+    { "kumatori.osaka.jp", 0xf6ece82c, PSL_RULE },
+    { "de.md", 0x5ea5a82d, PSL_RULE },
+    { "database.museum", 0xbcd9e82e, PSL_RULE },
+    { "engineer", 0x3665682e, PSL_RULE },
+    { "gitapp.si", 0x1952a830, PSL_RULE },
+    { "gov.qa", 0xbc3ee82d, PSL_RULE },
+    { "akershus.no", 0xb0aca832, 0 },
+    { "jcloud.kz", 0xbd5be82d, PSL_RULE },
+    { "kamoenai.hokkaido.jp", 0x8ceea830, PSL_RULE },
+    { "mil.br", 0xdc65a835, PSL_RULE },
+    { "mobi.ke", 0x322e2836, PSL_RULE },
+    { "akdn", 0xbe1e6837, PSL_RULE },
+    { "chikujo.fukuoka.jp", 0x4020a838, PSL_RULE },
+    { "dynalias.net", 0x43c32839, PSL_RULE },
+    { "net.ir", 0x92eb282d, PSL_RULE },
+    { "s3-website-ap-southeast-1.amazonaws.com", 0xfaeaa834, PSL_RULE },
+    { "xn--rskog-uua.no", 0xd978a83c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cars", 0x22d2a840, PSL_RULE },
+    { "xn--qxam", 0x8102a840, PSL_RULE },
+    { "communications.museum", 0x33132842, PSL_RULE },
+    { "nl.ca", 0x8f43e843, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "wakayama.jp", 0xb052e847, PSL_RULE },
+    { "humanities.museum", 0x1ce2e848, PSL_RULE },
+    { "hungry.jp", 0x057b2848, PSL_RULE },
+    { "takikawa.hokkaido.jp", 0xef15284a, PSL_RULE },
+    { "testing.thingdust.io", 0x43f76849, 0 },
+    { "def.br", 0x2141284c, PSL_RULE },
+    { "chillout.jp", 0x0051a84d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mitaka.tokyo.jp", 0xbee02854, PSL_RULE },
+    { "ortsinfo.at", 0x3f0b2854, 0 },
+    { "czeladz.pl", 0x932be856, PSL_RULE },
+    { "kvitsoy.no", 0xfd196857, PSL_RULE },
+    { "nishiaizu.fukushima.jp", 0x78546856, PSL_RULE },
+    { "ouda.nara.jp", 0x9244a856, PSL_RULE },
+    { "pb.gov.br", 0x0381e855, PSL_RULE },
+    { "royken.no", 0xe62c685a, PSL_RULE },
+    { "shimizu.hokkaido.jp", 0xb3efe85c, PSL_RULE },
+    { "co.mu", 0x1c72285d, PSL_RULE },
+    { "tc.br", 0xce6ae856, PSL_RULE },
+    { "cesenaforli.it", 0x8376a85f, PSL_RULE },
+    { "pl-waw.scw.cloud", 0xb328285f, 0 },
+    { NULL, 0, 0 },
+    { "george", 0x7aeb6862, PSL_RULE },
+    { "memset.net", 0x7470a863, PSL_RULE },
+    { "ancona.it", 0x23ace864, PSL_RULE },
+    { "elb.amazonaws.com.cn", 0x8a322865, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "sanok.pl", 0xf3532867, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.ac", 0x5252a869, PSL_RULE },
+    { "iopsys.se", 0x5662286a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bh", 0x5f3ae86f, PSL_RULE },
+    { "sosnowiec.pl", 0xed9ae86f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "slattum.no", 0x57ade872, PSL_RULE },
+    { "cc.ca.us", 0xa12ae873, PSL_RULE },
+    { "blogspot.cf", 0x0bd9e874, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "build", 0xcd83687b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "okayama.jp", 0xf8296880, PSL_RULE },
+    { "yamada.iwate.jp", 0x469fa880, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ac.sz", 0xfdb5e884, PSL_RULE },
+    { "edu.eu.org", 0x0a4e2885, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cistron.nl", 0xb258288b, PSL_RULE },
+    { "nl.ci", 0x9e54e88b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jl.cn", 0x17b16892, PSL_RULE },
+    { "it1.jenv-aruba.cloud", 0x51d82893, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ogawara.miyagi.jp", 0x9f1c6895, PSL_RULE },
+    { "panasonic", 0x510aa895, PSL_RULE },
+    { "abr.it", 0xf272a897, PSL_RULE },
+    { "net.gr", 0x312b6897, PSL_RULE },
+    { "xn--btsfjord-9za.no", 0xf5666899, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.tn.us", 0x013ca89b, PSL_RULE },
+    { "kosai.shizuoka.jp", 0x6ef1289c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "am.br", 0xbf84689f, PSL_RULE },
+    { "cloud9.ca-central-1.amazonaws.com", 0x2f76a89f, 0 },
+    { "firewall-gateway.net", 0x02e7689f, PSL_RULE },
+    { "mail.pl", 0xa45068a0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "wv.us", 0x7a4028a6, PSL_RULE },
+    { "biz.az", 0x4d7b28a7, PSL_RULE },
+    { "xn--rovu88b", 0x23cc28a7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--rlingen-mxa.no", 0xbec8a8aa, PSL_RULE },
+    { "dgca.aero", 0x9702e8ab, PSL_RULE },
+    { "toscana.it", 0x619da8ab, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pe", 0x431a68b0, PSL_RULE },
+    { "lease", 0xcc24a8b1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "stufftoread.com", 0x27db68b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tendo.yamagata.jp", 0x2318a8b6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "me-south-1.amazonaws.com", 0x8459e8b9, 0 },
+    { "xn--55qx5d.cn", 0x8420a8ba, PSL_RULE },
+    { NULL, 0, 0 },
+    { "media.aero", 0x56f6e8bc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "stryn.no", 0xf0cb68be, PSL_RULE },
+    { "serveftp.net", 0xb9a828bf, PSL_RULE },
+    { "fr.it", 0x3b3828c0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jpmorgan", 0x5937a8c3, PSL_RULE },
+    { "stuttgart.museum", 0x613a28c3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "aland.fi", 0xc79328c6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "burghof.museum", 0x4f7328c8, PSL_RULE },
+    { "now-dns.org", 0x376ca8c9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kagamiishi.fukushima.jp", 0x7a1fe8cb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "infiniti", 0x807ea8cd, PSL_RULE },
+    { "research.museum", 0xd8a128ce, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.eg", 0x6ad568d2, PSL_RULE },
+    { "reclaim.cloud", 0x929968d3, 0 },
+    { "toyosato.shiga.jp", 0xeda028d3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dyndns-server.com", 0x925ce8da, PSL_RULE },
+    { "sayama.osaka.jp", 0xee9da8da, PSL_RULE },
+    { "dyndns.dappnode.io", 0x36e7e8dc, PSL_RULE },
+    { "org.cy", 0x65f4a8dd, PSL_RULE },
+    { "xn--fl-zia.no", 0x5982e8db, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.st", 0x5cade8e0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "juedisches.museum", 0xa6ab28e4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.zm", 0x7033a8e8, PSL_RULE },
+    { "can.museum", 0xf78568e9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sasebo.nagasaki.jp", 0x04fd28eb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ambulance.museum", 0x79fca8ed, PSL_RULE },
+    { "bulsan-sudtirol.it", 0x269d28ee, PSL_RULE },
+    { "fashion", 0x0509a8ef, PSL_RULE },
+    { "promo", 0xdbade8f0, PSL_RULE },
+    { "uchinada.ishikawa.jp", 0x8916a8ef, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pisz.pl", 0x16c868f3, PSL_RULE },
+    { "miyakonojo.miyazaki.jp", 0xc193a8f4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.tj", 0xaca968f7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "trentinsuedtirol.it", 0x9a36e8f9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.ge", 0x1e0528fb, PSL_RULE },
+    { "verse.jp", 0xd8d268fc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "from-md.com", 0x22a66902, PSL_RULE },
+    { "career", 0xeef76903, PSL_RULE },
+    { "christmas", 0x74796903, PSL_RULE },
+    { "nakagusuku.okinawa.jp", 0xa2c5a902, PSL_RULE },
+    { "shopitsite.com", 0x25c06902, PSL_RULE },
+    { "net.il", 0xb117e907, PSL_RULE },
+    { "circus.museum", 0x3449e908, PSL_RULE },
+    { "cu", 0x56432909, PSL_RULE },
+    { NULL, 0, 0 },
+    { "arendal.no", 0x260fe90b, PSL_RULE },
+    { "cba", 0x1a47e90b, PSL_RULE },
+    { "kurotaki.nara.jp", 0xa973690b, PSL_RULE },
+    { "norfolk.museum", 0x258e290e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "game-host.org", 0xfd99e910, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edgestack.me", 0x4aefe912, PSL_RULE },
+    { "tobishima.aichi.jp", 0xdfc02913, PSL_RULE },
+    { "dm", 0x672e2914, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sphinx.mythic-beasts.com", 0xaa402917, PSL_RULE },
+    { "org.ly", 0x6a2c2918, PSL_RULE },
+    { "boldlygoingnowhere.org", 0x921f6919, PSL_RULE },
+    { NULL, 0, 0 },
+    { "koganei.tokyo.jp", 0xd410291b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "heritage.museum", 0xa73e291e, PSL_RULE },
+    { "ri.us", 0x851b691e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hayakawa.yamanashi.jp", 0x4ded6925, PSL_RULE },
+    { "krellian.net", 0xf78ea926, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "reservd.disrec.thingdust.io", 0xfb01292c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "center", 0xde7de92e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gv.vc", 0xad69e935, PSL_RULE },
+    { "chuo.tokyo.jp", 0xc4812936, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kitashiobara.fukushima.jp", 0x43576938, PSL_RULE },
+    { "whaling.museum", 0x50b22939, PSL_RULE },
+    { "massivegrid.com", 0xae6b693a, 0 },
+    { NULL, 0, 0 },
+    { "detroit.museum", 0x17baa93c, PSL_RULE },
+    { "info.pk", 0x0a62a93c, PSL_RULE },
+    { "org.pa", 0xe726a93c, PSL_RULE },
+    { "servehumour.com", 0x5790e93f, PSL_RULE },
+    { "pub", 0x5cd56940, PSL_RULE },
+    { "turystyka.pl", 0x1e86293f, PSL_RULE },
+    { "uto.kumamoto.jp", 0x727de93e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nature.museum", 0x5ebbe944, PSL_RULE },
+    { "habmer.no", 0x912be945, PSL_RULE },
+    { "nov.su", 0x89ad2944, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloudns.pw", 0x0d8ae94a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "goo", 0x9c29294c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pisa.it", 0xaa01e951, PSL_RULE },
+    { NULL, 0, 0 },
+    { "date.hokkaido.jp", 0xb57d6953, PSL_RULE },
+    { "gangaviika.no", 0x5a802954, PSL_RULE },
+    { "wloclawek.pl", 0xaa492954, PSL_RULE },
+    { "xn--brnny-wuac.no", 0x45dce954, PSL_RULE },
+    { "cloudns.asia", 0xb2d3e957, PSL_RULE },
+    { "ditchyourip.com", 0xc4b1e958, PSL_RULE },
+    { "dedyn.io", 0x7c3aa959, PSL_RULE },
+    { "yokote.akita.jp", 0xe0996956, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.kr", 0xc657295e, PSL_RULE },
+    { "fi.cloudplatform.fi", 0x12c0695f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "riopreto.br", 0xcf1f2963, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "town.museum", 0xf851a969, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.cv", 0x42e9296c, PSL_RULE },
+    { "info.ki", 0xfc33696d, PSL_RULE },
+    { "org.tm", 0x1229a96c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "romskog.no", 0x79c32970, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.dm", 0x89542973, PSL_RULE },
+    { "mymailer.com.tw", 0xed956973, PSL_RULE },
+    { "am.gov.br", 0x12662975, PSL_RULE },
+    { "com.br", 0x61802976, PSL_RULE },
+    { "sch.tf", 0x2bc26977, PSL_RULE },
+    { "sogne.no", 0xe0d0a974, PSL_RULE },
+    { NULL, 0, 0 },
+    { "enna.it", 0x7500297a, PSL_RULE },
+    { "belluno.it", 0x7232e97b, PSL_RULE },
+    { "lu.eu.org", 0x4221e97a, PSL_RULE },
+    { "somna.no", 0xb09b297a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rollag.no", 0x6459e97f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "numazu.shizuoka.jp", 0xf6d5e981, PSL_RULE },
+    { "sortland.no", 0x3f4ae981, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ro", 0x5d342984, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tv", 0x5949e987, PSL_RULE },
+    { "higashishirakawa.gifu.jp", 0xfa6f2988, PSL_RULE },
+    { "mytabit.co.il", 0x16fb2988, PSL_RULE },
+    { "oishida.yamagata.jp", 0x1a7fe989, PSL_RULE },
+    { NULL, 0, 0 },
+    { "wpmucdn.com", 0x0d36298c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "barsyonline.com", 0x4922a98e, PSL_RULE },
+    { "xn--mre-og-romsdal-qqb.no", 0xa6ab698f, 0 },
+    { "globo", 0x849ee990, PSL_RULE },
+    { "building.museum", 0x4da2e991, PSL_RULE },
+    { "xn--j1adp.xn--p1acf", 0x32e9a992, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "loginline.dev", 0x005b6995, PSL_RULE },
+    { "piw.gov.pl", 0x1413a995, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "idv.hk", 0x0d72e999, PSL_RULE },
+    { "com.is", 0x4e2e699a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jpn.com", 0xfed869a0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ddns.me", 0x15cda9a2, PSL_RULE },
+    { "in-dsl.org", 0x6a1929a2, PSL_RULE },
+    { "servebbs.com", 0x7528e9a4, PSL_RULE },
+    { "watches", 0x4bbee9a4, PSL_RULE },
+    { "web.tj", 0xf8f3e9a3, PSL_RULE },
+    { "mc.eu.org", 0x3f39e9a7, PSL_RULE },
+    { "saarland", 0x027129a7, PSL_RULE },
+    { "zamami.okinawa.jp", 0x1289e9a2, PSL_RULE },
+    { "aosta-valley.it", 0xf87d69aa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.fl.us", 0xceb469ad, PSL_RULE },
+    { "kn", 0x5e3669ae, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "media", 0xed1269b3, PSL_RULE },
+    { "shinjo.okayama.jp", 0x624b29b3, PSL_RULE },
+    { "from-tn.com", 0xe89d69b5, PSL_RULE },
+    { "edu.py", 0xa2aae9b6, PSL_RULE },
+    { "atm.pl", 0x2982a9b7, PSL_RULE },
+    { "gbiz", 0xc139a9b7, PSL_RULE },
+    { "gov.iq", 0x720829b5, PSL_RULE },
+    { "maison", 0xd56b69b8, PSL_RULE },
+    { "net.cn", 0x5eb2e9b7, PSL_RULE },
+    { "mizusawa.iwate.jp", 0x13af29bc, PSL_RULE },
+    { "perso.sn", 0x42ac69bd, PSL_RULE },
+    { "isa-hockeynut.com", 0xb65229be, PSL_RULE },
+    { "xn--55qx5d", 0xe26b29b7, PSL_RULE },
+    { "interhostsolutions.be", 0x920ee9c0, 0 },
+    { NULL, 0, 0 },
+    { "from-me.org", 0xf559a9c2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ao.it", 0x4e7fa9c4, PSL_RULE },
+    { "dsmynas.org", 0x9690e9c4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "meet", 0xc306a9c8, PSL_RULE },
+    { "lu.it", 0x673f29c9, PSL_RULE },
+    { "madrid.museum", 0x1f83e9ca, PSL_RULE },
+    { "wakasa.tottori.jp", 0x609469c8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hosting.ovh.net", 0x5eb5e9cd, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "oxa.cloud", 0xf654e9d2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "aizubange.fukushima.jp", 0xab93a9d4, PSL_RULE },
+    { "church", 0x859ca9d4, PSL_RULE },
+    { "nf", 0x6322e9d5, PSL_RULE },
+    { "moonscale.net", 0x0f5769d7, PSL_RULE },
+    { "auto.pl", 0xe64529d8, PSL_RULE },
+    { "net.ki", 0xd1f969d8, PSL_RULE },
+    { "jelastic.regruhosting.ru", 0x311e29da, PSL_RULE },
+    { "paderborn.museum", 0x9f14a9d6, PSL_RULE },
+    { "tas.au", 0x92a6e9d9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dnsupdater.de", 0xfa17e9de, PSL_RULE },
+    { NULL, 0, 0 },
+    { "yalta.ua", 0x4a39e9e0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sakyo.kyoto.jp", 0x4489e9e2, PSL_RULE },
+    { "citic", 0xed3069e3, PSL_RULE },
+    { "ru.com", 0x2ea929e3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.tx.us", 0xf84ae9e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ad.jp", 0x979f69ec, PSL_RULE },
+    { "buyshop.jp", 0xeba3e9ed, PSL_RULE },
+    { "cyon.link", 0x75f9a9ee, PSL_RULE },
+    { "swidnica.pl", 0xa110a9ef, PSL_RULE },
+    { "res.in", 0x5c5929f0, PSL_RULE },
+    { "redstone", 0x0aac29f1, PSL_RULE },
+    { "ringerike.no", 0x2e1c69f2, PSL_RULE },
+    { "finearts.museum", 0xf64029f3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.ca.us", 0x3b8269f5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dd-dns.de", 0xaa11aa00, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.kz", 0xd4ffaa04, PSL_RULE },
+    { NULL, 0, 0 },
+    { "indianapolis.museum", 0xf4332a06, PSL_RULE },
+    { "design", 0xfc6baa07, PSL_RULE },
+    { "vestre-slidre.no", 0x90cd2a07, PSL_RULE },
+    { NULL, 0, 0 },
+    { "conference.aero", 0x7a286a0a, PSL_RULE },
+    { "giske.no", 0x125aaa0b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "volvo", 0x4cab6a0d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chichibu.saitama.jp", 0xa1916a10, PSL_RULE },
+    { "kerryproperties", 0x80edea11, PSL_RULE },
+    { "kuroishi.aomori.jp", 0x35ef2a12, PSL_RULE },
+    { "more-og-romsdal.no", 0x0a8caa11, 0 },
+    { "plus", 0x4028ea11, PSL_RULE },
+    { "de.com", 0x4480aa15, PSL_RULE },
+    { "blogspot.lu", 0xef292a16, PSL_RULE },
+    { "co.th", 0xe6692a17, PSL_RULE },
+    { "est.pr", 0xca2baa15, PSL_RULE },
+    { "gov.sc", 0xda82ea19, PSL_RULE },
+    { "gs.of.no", 0xebcc2a17, PSL_RULE },
+    { "lomza.pl", 0xe0ae6a16, PSL_RULE },
+    { "donostia.museum", 0x2af2aa1c, PSL_RULE },
+    { "hanno.saitama.jp", 0x0fdfea1d, PSL_RULE },
+    { "brasilia.me", 0x5dd8aa1e, PSL_RULE },
+    { "org.za", 0xe1e5ea1a, PSL_RULE },
+    { "ashgabad.su", 0xa6d0aa20, PSL_RULE },
+    { "stockholm", 0x4c4c2a1b, PSL_RULE },
+    { "bashkiria.ru", 0x2c73aa22, PSL_RULE },
+    { "broker.aero", 0x25276a23, PSL_RULE },
+    { "az", 0x4c67ea24, PSL_RULE },
+    { "med.ht", 0xaa2c6a25, PSL_RULE },
+    { "rade.no", 0x5a62aa24, PSL_RULE },
+    { "blush.jp", 0xe5fbea27, PSL_RULE },
+    { "webview-assets.cloud9.eu-central-1.amazonaws.com", 0x1ebcea28, PSL_RULE },
+    { "bamble.no", 0xf153ea29, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ap-southeast-2.elasticbeanstalk.com", 0x938cea2b, PSL_RULE },
+    { "tottori.tottori.jp", 0x7fdfea2b, PSL_RULE },
+    { "gov.kw", 0xc669aa2d, PSL_RULE },
+    { "org.pk", 0xc33bea2e, PSL_RULE },
+    { "alt.za", 0x63de2a2f, PSL_RULE },
+    { "ski.no", 0xfb696a2f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "transip.me", 0x2c95aa32, 0 },
+    { "fyi", 0x7618aa33, PSL_RULE },
+    { "alvdal.no", 0x0ceb6a34, PSL_RULE },
+    { "swiebodzin.pl", 0x25686a33, PSL_RULE },
+    { "bolzano-altoadige.it", 0x56072a36, PSL_RULE },
+    { NULL, 0, 0 },
+    { "restaurant", 0x93532a38, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--uisz3g.jp", 0xacc0aa3c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "square7.de", 0x50902a3e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.ua", 0xe9b76a41, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--j1ael8b.xn--p1acf", 0xa79baa45, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "courses", 0xada2aa49, PSL_RULE },
+    { "vfs.cloud9.eu-south-1.amazonaws.com", 0x15e6aa4a, PSL_RULE },
+    { "xn--l-1fa.no", 0x1a122a49, PSL_RULE },
+    { "xn--drbak-wua.no", 0x2b3e6a4c, PSL_RULE },
+    { "artanddesign.museum", 0x259daa4d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "honjo.saitama.jp", 0x6961aa4f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rs.leg.br", 0x3d6e2a52, PSL_RULE },
+    { "gr.it", 0x3c382a53, PSL_RULE },
+    { "kepno.pl", 0x46c4aa54, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.al.us", 0xae12aa57, PSL_RULE },
+    { "aukra.no", 0x60476a58, PSL_RULE },
+    { "bible", 0xebd1ea59, PSL_RULE },
+    { "gitpage.si", 0x8800aa58, PSL_RULE },
+    { "name.tr", 0xe0fcaa5a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.om", 0x94a02a5d, PSL_RULE },
+    { "xn--y9a3aq", 0xb96b6a5d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gent", 0xb73dea63, PSL_RULE },
+    { "ogaki.gifu.jp", 0x6939ea63, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pro.az", 0xaf666a69, PSL_RULE },
+    { NULL, 0, 0 },
+    { "csx.cc", 0x89c0ea6b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lovepop.jp", 0xf3bc2a6e, PSL_RULE },
+    { "lamborghini", 0x37fdaa6f, PSL_RULE },
+    { "mihama.aichi.jp", 0x2e336a70, PSL_RULE },
+    { "murakami.niigata.jp", 0x0efd6a6f, PSL_RULE },
+    { "ovre-eiker.no", 0xd962aa71, PSL_RULE },
+    { "stc", 0xf353ea73, PSL_RULE },
+    { "tawaramoto.nara.jp", 0x45d1ea72, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "florida.museum", 0xd435ea7a, PSL_RULE },
+    { "tm.hu", 0x981dea7b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nanmoku.gunma.jp", 0xb622aa7e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kashihara.nara.jp", 0x420d6a81, PSL_RULE },
+    { "net.mu", 0x74f66a82, PSL_RULE },
+    { "vlaanderen.museum", 0x5fa5aa83, PSL_RULE },
+    { "org.bw", 0x0b88ea84, PSL_RULE },
+    { NULL, 0, 0 },
+    { "noticias.bo", 0x75dfaa86, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.bt", 0x93f62a89, PSL_RULE },
+    { "yamanouchi.nagano.jp", 0x97a1ea89, PSL_RULE },
+    { "yuki.ibaraki.jp", 0xa7492a8a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kouyama.kagoshima.jp", 0x680eea90, PSL_RULE },
+    { "steiermark.museum", 0x8488ea90, PSL_RULE },
+    { "konan.shiga.jp", 0x31d6aa92, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mil.no", 0x55812a94, PSL_RULE },
+    { "namsskogan.no", 0xacee2a94, PSL_RULE },
+    { "k12.ny.us", 0x680cea96, PSL_RULE },
+    { "xn--valle-d-aoste-ehb.it", 0x2b14aa96, PSL_RULE },
+    { NULL, 0, 0 },
+    { "trust.museum", 0x7ac62a99, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pages.torproject.net", 0x9d67ea9e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--stfold-9xa.no", 0x62336aa5, 0 },
+    { "iyo.ehime.jp", 0x1c992aa6, PSL_RULE },
+    { "krasnik.pl", 0x9247aaa6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "myspreadshop.ca", 0x9f30aaaa, PSL_RULE },
+    { "fujiidera.osaka.jp", 0xa954aaab, PSL_RULE },
+    { "at.eu.org", 0x1b23eaac, PSL_RULE },
+    { "amfam", 0x859e6aad, PSL_RULE },
+    { "bytom.pl", 0x5a2aeaac, PSL_RULE },
+    { "heroy.nordland.no", 0x2edd6aab, PSL_RULE },
+    { "historisches.museum", 0x22a26aaf, PSL_RULE },
+    { "lug.org.uk", 0xf85b2aab, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gg", 0x3a206ab3, PSL_RULE },
+    { "salat.no", 0x7820eab3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "barcelona.museum", 0x2539eab6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.so", 0x0f70eabd, PSL_RULE },
+    { "nflfan.org", 0x37ffeabe, PSL_RULE },
+    { "shop.hu", 0x660eaabe, PSL_RULE },
+    { "edu.za", 0xae8c6ac0, PSL_RULE },
+    { "tec.mi.us", 0x39852ac1, PSL_RULE },
+    { "elverum.no", 0x6555eac2, PSL_RULE },
+    { "meldal.no", 0x736baac3, PSL_RULE },
+    { "minamiechizen.fukui.jp", 0x01446ac4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "resindevice.io", 0x6c0e6acc, PSL_RULE },
+    { "xn--sgne-gra.no", 0x8bb52acc, PSL_RULE },
+    { "filatelia.museum", 0x05cf2ace, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tarama.okinawa.jp", 0x6817ead5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mazeplay.com", 0x243dead7, PSL_RULE },
+    { "gateway.dev", 0x42ff6ad8, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "foo", 0x9d292adf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eco.bj", 0x66d66ae2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gob.do", 0xa440eae4, PSL_RULE },
+    { "pd.it", 0x5d63eae4, PSL_RULE },
+    { "computer", 0xbec0eae6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gyeongnam.kr", 0x58a3aae9, PSL_RULE },
+    { "klabu.no", 0xe60b6ae9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "museum.om", 0xba25aaed, PSL_RULE },
+    { "quest", 0x9cce6aed, PSL_RULE },
+    { "capoo.jp", 0xa310eaef, PSL_RULE },
+    { "afjord.no", 0x2ad86af0, PSL_RULE },
+    { "tl", 0x5d31eaed, PSL_RULE },
+    { "xn--nmesjevuemie-tcba.no", 0xf2f92af2, PSL_RULE },
+    { "mysecuritycamera.net", 0xb2a4aaf3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kamikoani.akita.jp", 0x42206af5, PSL_RULE },
+    { "com.nf", 0x902baaf6, PSL_RULE },
+    { "ferrari", 0xb5e26af6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "asso.eu.org", 0xa3f66af9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.mk", 0x282feafb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mongolian.jp", 0x9fc0aafd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vlaanderen", 0xf2b92b03, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.rw", 0xfa672b05, PSL_RULE },
+    { "for-some.biz", 0x8b10ab06, PSL_RULE },
+    { "tosashimizu.kochi.jp", 0xe2eaeb05, PSL_RULE },
+    { "tv.in", 0xd2686b08, PSL_RULE },
+    { NULL, 0, 0 },
+    { "biei.hokkaido.jp", 0x5fab2b0a, PSL_RULE },
+    { "twmail.org", 0xc43eab0b, PSL_RULE },
+    { "toei.aichi.jp", 0x9a116b0c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fhv.se", 0x663d6b0f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "int.mv", 0x59956b13, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "so", 0x5e342b17, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bmw", 0xffed2b19, PSL_RULE },
+    { "com.mg", 0x7cd9eb1a, PSL_RULE },
+    { "fly.dev", 0x8ab72b1b, PSL_RULE },
+    { "net.lv", 0xe803ab1a, PSL_RULE },
+    { "salem.museum", 0x18a8ab19, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ed.cr", 0xb56c6b1f, PSL_RULE },
+    { "tires", 0xedeb6b20, PSL_RULE },
+    { "org.fj", 0x12fc2b21, PSL_RULE },
+    { "vbrplsbx.io", 0x6fc76b22, 0 },
+    { "is-a-geek.net", 0xfd2aeb23, PSL_RULE },
+    { "stat.no", 0xac1dab24, PSL_RULE },
+    { "palmas.br", 0x0fdd2b25, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shari.hokkaido.jp", 0x28492b2e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mugi.tokushima.jp", 0x29306b32, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "total", 0x58212b35, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vang.no", 0xa9be2b38, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "resinstaging.io", 0x63d7eb3b, 0 },
+    { NULL, 0, 0 },
+    { "hasura-app.io", 0x9a7bab3d, PSL_RULE },
+    { "blogspot.com.co", 0x4cb7eb3e, PSL_RULE },
+    { "higashikagawa.kagawa.jp", 0x22596b3e, PSL_RULE },
+    { "com.uy", 0xcc56eb40, PSL_RULE },
+    { "ostrowiec.pl", 0xd8b3eb3e, PSL_RULE },
+    { "actor", 0xd99f6b42, PSL_RULE },
+    { "bolzano.it", 0x02b4ab43, PSL_RULE },
+    { "british.museum", 0xfbc12b44, PSL_RULE },
+    { "onthewifi.com", 0x14982b45, PSL_RULE },
+    { "tokuyama.yamaguchi.jp", 0x4b65ab40, PSL_RULE },
+    { "xn--w4r85el8fhu5dnra", 0x880b6b3d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sch.uk", 0x71c56b49, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "xn--bdddj-mrabd.no", 0x1129eb4b, PSL_RULE },
+    { "dr.in", 0xb25dab4c, PSL_RULE },
+    { "ketrzyn.pl", 0xb8692b4c, PSL_RULE },
+    { "xn--karmy-yua.no", 0xda04ab4e, PSL_RULE },
+    { "jaguar", 0xe5ea2b4f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hobby-site.org", 0xee28eb55, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tenri.nara.jp", 0x371fab5b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tech", 0x0f8eeb5d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cs.keliweb.cloud", 0xb487ab61, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "niyodogawa.kochi.jp", 0x55beab65, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pagespeedmobilizer.com", 0xa2ecab67, PSL_RULE },
+    { "af", 0x6422eb68, PSL_RULE },
+    { "wios.gov.pl", 0xdf30eb69, PSL_RULE },
+    { "xn--mgbgu82a", 0xf183ab68, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.jo", 0x0e3e2b6e, PSL_RULE },
+    { "higashiyamato.tokyo.jp", 0x24e6eb6f, PSL_RULE },
+    { "mg.leg.br", 0x503cab6f, PSL_RULE },
+    { "firm.ht", 0x460deb71, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "emb.kw", 0x36552b75, PSL_RULE },
+    { "stream", 0xf2202b75, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "onna.okinawa.jp", 0x064deb79, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--9dbhblg6di.museum", 0xcf3cab7c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kolobrzeg.pl", 0xd7426b84, PSL_RULE },
+    { "bb", 0x3f2bab85, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.ru", 0x16576b88, PSL_RULE },
+    { "jor.br", 0x62b5eb88, PSL_RULE },
+    { "oita.oita.jp", 0x9eaa6b89, PSL_RULE },
+    { "tateshina.nagano.jp", 0x94d7eb88, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ens.tn", 0x0daceb8d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nishi.osaka.jp", 0xfb10eb93, PSL_RULE },
+    { "streamlitapp.com", 0xbcae2b94, PSL_RULE },
+    { "education", 0x1bbbeb95, PSL_RULE },
+    { "nishiokoppe.hokkaido.jp", 0x1bd46b96, PSL_RULE },
+    { "hirokawa.fukuoka.jp", 0xf9f56b97, PSL_RULE },
+    { "glogow.pl", 0xc2beab98, PSL_RULE },
+    { "weatherchannel", 0xab33eb98, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "datsun", 0x73022b9e, PSL_RULE },
+    { "gallup", 0x0c682b9e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "honefoss.no", 0x6a5b2ba1, PSL_RULE },
+    { "cuneo.it", 0x6bb3eba2, PSL_RULE },
+    { "zara", 0x9e062ba1, PSL_RULE },
+    { "fashionstore.jp", 0x930eeba4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nagoya", 0x63c3eba6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "naturalhistorymuseum.museum", 0x4e93eba8, PSL_RULE },
+    { "com.gr", 0x7a15eba9, PSL_RULE },
+    { "jelastic.saveincloud.net", 0xa094ebaa, PSL_RULE },
+    { "reg.dk", 0x37046baa, PSL_RULE },
+    { "gr.jp", 0x95b76bac, PSL_RULE },
+    { "nanjo.okinawa.jp", 0x118b2bad, PSL_RULE },
+    { "westfalen.museum", 0x19c66baa, PSL_RULE },
+    { "xn--ogbpf8fl", 0xa7c62bad, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tv.na", 0xf2dc6bba, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.cv", 0xf5a66bbe, PSL_RULE },
+    { "mil.ae", 0x2e7aabbf, PSL_RULE },
+    { "observableusercontent.com", 0xf3542bbf, 0 },
+    { "salon", 0xe20dabbe, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lolitapunk.jp", 0xdfd7abc4, PSL_RULE },
+    { "clerkstage.app", 0xb402abc5, PSL_RULE },
+    { "sklep.pl", 0xbb9c2bc4, PSL_RULE },
+    { "yoka.hyogo.jp", 0x6c9d6bc7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.pe", 0x24ddabca, PSL_RULE },
+    { "netflix", 0xdcd0abcb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "yao.osaka.jp", 0x4c6cabcd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "atami.shizuoka.jp", 0x66ab6bcf, PSL_RULE },
+    { "stg-builder.code.com", 0xd71a6bcf, PSL_WILDCARD },
+    { "lib.sd.us", 0xbde22bd1, PSL_RULE },
+    { "us-west-1.amazonaws.com", 0xa8022bd1, 0 },
+    { "ushuaia.museum", 0xde1f6bd3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "re", 0x451a6bd6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hgtv", 0x1485ebd8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "landes.museum", 0xa9386bda, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fun", 0x17726bde, PSL_RULE },
+    { "tuva.su", 0x769eabdf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "info.tn", 0x3e302be3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pythonanywhere.com", 0x6303ebe5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.vi", 0x0dbeebe9, PSL_RULE },
+    { "paroch.k12.ma.us", 0x7091abea, PSL_RULE },
+    { "paywhirl.com", 0x1c01ebea, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "amscompute.com", 0x87436bf0, PSL_RULE },
+    { "dyn-berlin.de", 0x20e46bf0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kautokeino.no", 0x90e12bf8, PSL_RULE },
+    { "nagano.jp", 0xcb38abf9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "arida.wakayama.jp", 0xa3c46bfc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "roan.no", 0x3b316bfe, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sd", 0x461cac00, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yachiyo.chiba.jp", 0x8263ec04, PSL_RULE },
+    { NULL, 0, 0 },
+    { "enscaled.us", 0x944f6c06, 0 },
+    { "schulplattform.de", 0xb39d2c06, PSL_RULE },
+    { "ecommerce-shop.pl", 0x4be76c08, PSL_RULE },
+    { "fujimi.saitama.jp", 0xa6826c09, PSL_RULE },
+    { "xn--aroport-bya.ci", 0x10836c09, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hirono.iwate.jp", 0xb55bac0c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "biz.tt", 0xaff82c0e, PSL_RULE },
+    { "rr.leg.br", 0x3f706c0f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "works", 0x89166c11, PSL_RULE },
+    { "florist", 0x1a476c12, PSL_RULE },
+    { "ny.us", 0x7143ec12, PSL_RULE },
+    { "xn--vre-eiker-k8a.no", 0x2e002c13, PSL_RULE },
+    { "s3.dualstack.ca-central-1.amazonaws.com", 0xbc8aac15, PSL_RULE },
+    { "upper.jp", 0xecba2c15, PSL_RULE },
+    { "hosp.uk", 0x78ae6c17, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.ca", 0xa5dbac19, PSL_RULE },
+    { "googlecode.com", 0x8b1c2c1a, PSL_RULE },
+    { "loabat.no", 0x3c096c1b, PSL_RULE },
+    { "lg.ua", 0x82b72c1c, PSL_RULE },
+    { "suisse.museum", 0x9f24ec19, PSL_RULE },
+    { "in-brb.de", 0x341bec1e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bookonline.app", 0x14152c20, PSL_RULE },
+    { "123paginaweb.pt", 0x9287ec21, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--rhqv96g", 0xbff5ac24, PSL_RULE },
+    { "gov.lv", 0xe5426c25, PSL_RULE },
+    { "wpdevcloud.com", 0x302fac25, PSL_RULE },
+    { NULL, 0, 0 },
+    { "paragliding.aero", 0x9c8c2c28, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vps.mcdir.ru", 0x8b1aec2a, PSL_RULE },
+    { "eu-4.evennode.com", 0x62b26c2b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eu", 0x58432c2f, PSL_RULE },
+    { "movie", 0x27fe2c2f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "worse-than.tv", 0xbb126c33, PSL_RULE },
+    { "gov.scot", 0x5c46ac34, PSL_RULE },
+    { "oketo.hokkaido.jp", 0x82182c35, PSL_RULE },
+    { "info.mv", 0x47b8ec36, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sx.cn", 0x18cdec39, PSL_RULE },
+    { "ac.rw", 0x57d02c3a, PSL_RULE },
+    { "fm", 0x692e2c3a, PSL_RULE },
+    { "sauda.no", 0x916b2c3a, PSL_RULE },
+    { "xn--1lqs71d.jp", 0x3a24ec3a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ena.gifu.jp", 0x5c11ec40, PSL_RULE },
+    { "sardegna.it", 0x9fb56c41, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kanoya.kagoshima.jp", 0x2fc1ac44, PSL_RULE },
+    { "nhs.uk", 0x7308ac44, PSL_RULE },
+    { "direct.quickconnect.to", 0x61a6ac46, PSL_RULE },
+    { NULL, 0, 0 },
+    { "esq", 0x09eeec48, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pz.it", 0x614bec4a, PSL_RULE },
+    { "spectrum.myjino.ru", 0xf7b3ac4b, PSL_WILDCARD },
+    { "is-a-linux-user.org", 0xa957ac4c, PSL_RULE },
+    { "vc.it", 0x5d61ac4d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "diskussionsbereich.de", 0x3b99ac4f, PSL_RULE },
+    { "natura", 0x5abc2c50, PSL_RULE },
+    { "zapto.org", 0xd77d6c51, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shintomi.miyazaki.jp", 0x8a4aec53, PSL_RULE },
+    { "warabi.saitama.jp", 0x60bb6c53, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shiftcrypto.dev", 0xf5d8ac57, PSL_RULE },
+    { "or.tz", 0x89632c58, PSL_RULE },
+    { NULL, 0, 0 },
+    { "muenchen.museum", 0xa4d3ac5a, PSL_RULE },
+    { "theworkpc.com", 0x82b56c5b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogdns.net", 0xad6d2c5d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kiyose.tokyo.jp", 0x5b442c63, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "maizuru.kyoto.jp", 0xebedac66, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.in", 0xb9a6ac6c, PSL_RULE },
+    { "yasugi.shimane.jp", 0xbb482c6c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.co.at", 0x72d62c70, PSL_RULE },
+    { "motorcycles", 0x11306c71, PSL_RULE },
+    { "ac.zw", 0x8d51ec72, PSL_RULE },
+    { "rio.br", 0x3b8c2c71, PSL_RULE },
+    { NULL, 0, 0 },
+    { "syncloud.it", 0x60c36c75, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "macapa.br", 0x3e4eec7a, PSL_RULE },
+    { "mycloud.by", 0xa2332c7b, PSL_RULE },
+    { "xn--klbu-woa.no", 0x5d6bac7c, PSL_RULE },
+    { "lanxess", 0x9efeec7d, PSL_RULE },
+    { "nebraska.museum", 0x4452ac7e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.ug", 0x9c3bac82, PSL_RULE },
+    { "gw", 0x5a47ac83, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lighting", 0x94e42c85, PSL_RULE },
+    { "foundation.museum", 0x0bc06c86, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fukuchiyama.kyoto.jp", 0x1fb42c8a, PSL_RULE },
+    { "ms.gov.br", 0xf256ec8b, PSL_RULE },
+    { "groks-this.info", 0xd9242c8c, PSL_RULE },
+    { "tiaa", 0x6ffeec8a, PSL_RULE },
+    { "fldrv.com", 0x45b0ec8e, PSL_RULE },
+    { "gdansk.pl", 0x199e6c8f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "finance", 0x99b06c91, PSL_RULE },
+    { "kawaba.gunma.jp", 0xe256ec92, PSL_RULE },
+    { NULL, 0, 0 },
+    { "selfip.org", 0x78732c94, PSL_RULE },
+    { "hikari.yamaguchi.jp", 0x4b7d2c95, PSL_RULE },
+    { "service.one", 0x23526c96, PSL_RULE },
+    { "shonai.fukuoka.jp", 0x92aeec97, PSL_RULE },
+    { "asahi.yamagata.jp", 0x4ab56c98, PSL_RULE },
+    { "asso.nc", 0xaf072c98, PSL_RULE },
+    { "kilo.jp", 0x7ee92c98, PSL_RULE },
+    { "od.ua", 0x85bdec9a, PSL_RULE },
+    { "tcp4.me", 0x35eaac98, PSL_RULE },
+    { "umi.fukuoka.jp", 0xf5eaec94, PSL_RULE },
+    { "webthings.io", 0x3d852c94, PSL_RULE },
+    { "london", 0x63e4ac9f, PSL_RULE },
+    { "xn--koluokta-7ya57h.no", 0x49c16ca0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "radom.pl", 0xaa1faca4, PSL_RULE },
+    { "arao.kumamoto.jp", 0x19d06ca5, PSL_RULE },
+    { "nyuzen.toyama.jp", 0x004a2ca5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yakumo.hokkaido.jp", 0x9b9aaca9, PSL_RULE },
+    { "from-ut.com", 0x82b62caa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ninomiya.kanagawa.jp", 0x280dacb0, PSL_RULE },
+    { "nishimera.miyazaki.jp", 0xa140ecb0, PSL_RULE },
+    { "shiftcrypto.io", 0x6b1becb2, PSL_RULE },
+    { "shikokuchuo.ehime.jp", 0xd2fcacb2, PSL_RULE },
+    { "diskstation.org", 0x3fe92cb4, PSL_RULE },
+    { "tomigusuku.okinawa.jp", 0x6fa22cb4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eat", 0x97f72cb9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kosei.shiga.jp", 0xf6d6acbc, PSL_RULE },
+    { "call", 0x1ef4ecbd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "magnet.page", 0xd06cecc0, PSL_RULE },
+    { "wsa.gov.pl", 0x63fc2cc0, PSL_RULE },
+    { "donna.no", 0xf5602cc2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "main.jp", 0x813f2cc4, PSL_RULE },
+    { "kunneppu.hokkaido.jp", 0x5ebfecc5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "is-a-blogger.com", 0x0417ecc7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "honjo.akita.jp", 0x59066cc9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dyndns-at-work.com", 0x1410ecce, PSL_RULE },
+    { "xn--j1amh", 0xec7c6cce, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "soo.kagoshima.jp", 0x18772cd2, PSL_RULE },
+    { "traniandriabarletta.it", 0xa609acd2, PSL_RULE },
+    { "mn", 0x60366cd4, PSL_RULE },
+    { "kyotanabe.kyoto.jp", 0x478c6cd5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "k12.sc.us", 0xef282cd7, PSL_RULE },
+    { "dyndns-work.com", 0x7901acd8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "myspreadshop.com", 0xf0da2cdb, PSL_RULE },
+    { "shimotsuma.ibaraki.jp", 0xed716cdc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "er.in", 0xb35dacdf, PSL_RULE },
+    { "eu-north-1.amazonaws.com", 0x79996cdf, 0 },
+    { "valle-daosta.it", 0x43986cdf, PSL_RULE },
+    { "texas.museum", 0xb2932ce2, PSL_RULE },
+    { "xbox", 0xd3f26ce2, PSL_RULE },
+    { "grainger", 0xeb17ace4, PSL_RULE },
+    { "santacruz.museum", 0x0efc2ce4, PSL_RULE },
+    { "zone", 0x982c2cdf, PSL_RULE },
+    { "k12.nh.us", 0xe6ef2ce7, PSL_RULE },
+    { "gifts", 0xf285ace8, PSL_RULE },
+    { "plumbing", 0xcbe1ece9, PSL_RULE },
+    { "co.it", 0x507facea, PSL_RULE },
+    { "miasta.pl", 0xb74c2cea, PSL_RULE },
+    { "from-ar.com", 0xbdd92cec, PSL_RULE },
+    { "omachi.saga.jp", 0x4b112cea, PSL_RULE },
+    { "trentino-altoadige.it", 0xef2aecec, PSL_RULE },
+    { "zuerich", 0x66476ce9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "map.fastly.net", 0x0f406cf1, PSL_RULE },
+    { "s3.ap-northeast-2.amazonaws.com", 0xe16becf2, PSL_RULE },
+    { "montreal.museum", 0xc74eecf3, PSL_RULE },
+    { "stranda.no", 0x4cd46cf1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.gy", 0x423aecfb, PSL_RULE },
+    { "gov.sy", 0x325aacfb, PSL_RULE },
+    { "org.gu", 0x3ac3ecfd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "forgot.his.name", 0x23ea2d01, PSL_RULE },
+    { "kamitonda.wakayama.jp", 0x6fff2d01, PSL_RULE },
+    { "xn--12c1fe0br.xn--o3cw4h", 0x904d2d01, PSL_RULE },
+    { "crown", 0x39aa2d04, PSL_RULE },
+    { "mie.jp", 0xc24aad04, PSL_RULE },
+    { "com.ci", 0xab6e2d06, PSL_RULE },
+    { "foundation", 0x9ed3ed06, PSL_RULE },
+    { "carrara-massa.it", 0x20b62d08, PSL_RULE },
+    { "from-la.net", 0xb5c8ad06, PSL_RULE },
+    { "ik-server.com", 0x6634ed08, 0 },
+    { "nakatombetsu.hokkaido.jp", 0x65766d05, PSL_RULE },
+    { "canon", 0xef03ed0c, PSL_RULE },
+    { "utsunomiya.tochigi.jp", 0x5bb56d08, PSL_RULE },
+    { "community", 0x4fbfed0e, PSL_RULE },
+    { "blog.kg", 0x5da8ed0f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bar1.net", 0x79542d12, PSL_RULE },
+    { "analytics", 0x06406d13, PSL_RULE },
+    { "cloud9.sa-east-1.amazonaws.com", 0xefc86d13, 0 },
+    { "cambridge.museum", 0x4bc36d15, PSL_RULE },
+    { "creation.museum", 0x91002d12, PSL_RULE },
+    { "mielec.pl", 0xdfce2d14, PSL_RULE },
+    { "blogspot.kr", 0x77aeed18, PSL_RULE },
+    { "takahama.fukui.jp", 0xef136d17, PSL_RULE },
+    { "karuizawa.nagano.jp", 0xcc646d1a, PSL_RULE },
+    { "target", 0x6a5eed12, PSL_RULE },
+    { "hita.oita.jp", 0x9faa6d1c, PSL_RULE },
+    { "xn--vestvgy-ixa6o.no", 0x9bf82d1c, PSL_RULE },
+    { "xn--8pvr4u.jp", 0x0f9f2d1e, PSL_RULE },
+    { "qualifioapp.com", 0x46452d1f, PSL_RULE },
+    { "xn--wgbh1c", 0x7c03ad15, PSL_RULE },
+    { "ato.br", 0x4ccf2d21, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "smola.no", 0x83ad2d24, PSL_RULE },
+    { NULL, 0, 0 },
+    { "soni.nara.jp", 0x33b4ad26, PSL_RULE },
+    { NULL, 0, 0 },
+    { "capebreton.museum", 0xabc0ad28, PSL_RULE },
+    { NULL, 0, 0 },
+    { "is-a-libertarian.com", 0xf3a12d2a, PSL_RULE },
+    { "airtraffic.aero", 0x776ced2b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "webhop.org", 0xdbb22d32, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "boomla.net", 0x2888ed36, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "med.om", 0x27fced39, PSL_RULE },
+    { "trentinostirol.it", 0xee79ad3a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ind.br", 0x519aad3e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "services.aero", 0xab4c2d40, PSL_RULE },
+    { "eu-west-3.amazonaws.com", 0xc8a46d41, 0 },
+    { "livorno.it", 0xf504ed41, PSL_RULE },
+    { "farmequipment.museum", 0xac012d43, PSL_RULE },
+    { "minami.tokushima.jp", 0x45e0ad43, PSL_RULE },
+    { "nosegawa.nara.jp", 0xc2836d42, PSL_RULE },
+    { "townnews-staging.com", 0x79c2ad45, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "alfaromeo", 0x98ce2d49, PSL_RULE },
+    { "chiropractic.museum", 0x89e4ad4a, PSL_RULE },
+    { "cz", 0x4e67ed4a, PSL_RULE },
+    { "is-into-cars.com", 0x85856d49, PSL_RULE },
+    { "shinto.gunma.jp", 0x708ced4a, PSL_RULE },
+    { "pharmacy", 0x28906d4e, PSL_RULE },
+    { "trendhosting.cloud", 0x2ef92d4d, 0 },
+    { "us.ax", 0x2b0ded50, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gokase.miyazaki.jp", 0x6efd2d54, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "leka.no", 0x6b472d57, PSL_RULE },
+    { "xn--blt-elab.no", 0xff912d57, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hara.nagano.jp", 0x0e1f6d5b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ieee", 0xb3d32d65, PSL_RULE },
+    { "kamo.kyoto.jp", 0x5bf7ad65, PSL_RULE },
+    { "preservation.museum", 0xd362ad67, PSL_RULE },
+    { "cloud66.ws", 0xe6b22d68, PSL_RULE },
+    { "romsa.no", 0x0a5bad68, PSL_RULE },
+    { "se", 0x461a6d69, PSL_RULE },
+    { "tohnosho.chiba.jp", 0x1808ad68, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mamurogawa.yamagata.jp", 0xbe3fed6d, PSL_RULE },
+    { "cloud9.ap-southeast-2.amazonaws.com", 0x8eb0ad6e, 0 },
+    { "pay", 0x69a9ed6d, PSL_RULE },
+    { "tananger.no", 0x14e6ad70, PSL_RULE },
+    { "pavia.it", 0x4a70ed71, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "no-ip.net", 0xda0d2d75, PSL_RULE },
+    { "misato.saitama.jp", 0x8a0bed76, PSL_RULE },
+    { "gv.at", 0x49e92d77, PSL_RULE },
+    { "railroad.museum", 0xc5576d77, PSL_RULE },
+    { "school.nz", 0x56c06d79, PSL_RULE },
+    { "cbg.ru", 0x56f7ed7a, PSL_RULE },
+    { "shopselect.net", 0xdac72d7a, PSL_RULE },
+    { "soja.okayama.jp", 0x55092d7b, PSL_RULE },
+    { "marumori.miyagi.jp", 0x44d1ed7d, PSL_RULE },
+    { "gjovik.no", 0x2c78ad7e, PSL_RULE },
+    { "surgery", 0x9e42ed78, PSL_RULE },
+    { "teva", 0xe59e6d7f, PSL_RULE },
+    { "iglesias-carbonia.it", 0x3144ad81, PSL_RULE },
+    { "kred", 0xaaff6d81, PSL_RULE },
+    { "orkanger.no", 0x0eeaed81, PSL_RULE },
+    { "bahn.museum", 0x0df2ed84, PSL_RULE },
+    { "cc.hn", 0xbf75ad85, PSL_RULE },
+    { "voorloper.cloud", 0x7241ad86, PSL_RULE },
+    { "xn--czrw28b.tw", 0x1d6e2d7e, PSL_RULE },
+    { "xn--f6qx53a.jp", 0x40c5ad75, PSL_RULE },
+    { "srht.site", 0x1f66ed89, PSL_RULE },
+    { "yoshida.shizuoka.jp", 0xf8f02d78, PSL_RULE },
+    { "rv.ua", 0x7ae06d8b, PSL_RULE },
+    { "agano.niigata.jp", 0xc60b6d8c, PSL_RULE },
+    { "civilwar.museum", 0x79c5ad8c, PSL_RULE },
+    { "imari.saga.jp", 0xf887ed8d, PSL_RULE },
+    { "xn--32vp30h.jp", 0xda042d8d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "inatsuki.fukuoka.jp", 0xebf3ad91, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ap.gov.br", 0x1e5ded94, PSL_RULE },
+    { NULL, 0, 0 },
+    { "machida.tokyo.jp", 0x60ec2d96, PSL_RULE },
+    { "map.fastlylb.net", 0xc28ead97, PSL_RULE },
+    { "us-west-1.elasticbeanstalk.com", 0x9bc0ed98, PSL_RULE },
+    { "higashikurume.tokyo.jp", 0x48e62d99, PSL_RULE },
+    { "sky", 0x66c1ed9a, PSL_RULE },
+    { "ustka.pl", 0x0741ad97, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--3ds443g", 0x1efd6d9d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ca.reclaim.cloud", 0xc956ada3, PSL_RULE },
+    { "itoman.okinawa.jp", 0xbb2d2da3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloudplatform.fi", 0x91d32da6, 0 },
+    { "chiryu.aichi.jp", 0x6f37eda7, PSL_RULE },
+    { "aizumisato.fukushima.jp", 0xf514eda8, PSL_RULE },
+    { "tst.site", 0x7f202da9, PSL_WILDCARD },
+    { "team", 0xe4aeedaa, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dvrdns.org", 0xbe53adac, PSL_RULE },
+    { "edu.co", 0x4c9aedad, PSL_RULE },
+    { "no-ip.ca", 0x1033edac, PSL_RULE },
+    { "mypets.ws", 0x23f6edaf, PSL_RULE },
+    { "org.bm", 0xfc122dae, PSL_RULE },
+    { "tanabe.kyoto.jp", 0x0d8eedb0, PSL_RULE },
+    { "markets", 0xe0a62db2, PSL_RULE },
+    { "viking.museum", 0x08312daf, PSL_RULE },
+    { "org.kp", 0x7a88adb4, PSL_RULE },
+    { "wassamu.hokkaido.jp", 0x1b47edae, PSL_RULE },
+    { NULL, 0, 0 },
+    { "casadelamoneda.museum", 0xaec5edb7, PSL_RULE },
+    { "ac.ni", 0x856aedb8, PSL_RULE },
+    { "tokke.no", 0x5616adb8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "omura.nagasaki.jp", 0x6855adbc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--forl-cesena-fcb.it", 0xea7e2dc3, PSL_RULE },
+    { "cheap", 0x85186dc4, PSL_RULE },
+    { "gov.lk", 0xa17eedc4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kasuga.fukuoka.jp", 0xff98edc7, PSL_RULE },
+    { "scaleforce.com.cy", 0x72782dc7, 0 },
+    { "simplesite.com", 0x4929edc7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.tt", 0xe3342dcb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gm", 0x6a2e2dcd, PSL_RULE },
+    { "info.bo", 0xc063adce, PSL_RULE },
+    { "url.tw", 0xb7da6dcd, PSL_RULE },
+    { "xn--mgbt3dhd", 0xe60badce, PSL_RULE },
+    { "cosenza.it", 0x62f72dd1, PSL_RULE },
+    { "toyama.toyama.jp", 0x9e6e2dd1, PSL_RULE },
+    { "privatelink.snowflake.app", 0xef472dd3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bc.platform.sh", 0x30222dd6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eg", 0x3c206dd9, PSL_RULE },
+    { "nesseby.no", 0xcd436dd9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "haus", 0x4a1c2ddc, PSL_RULE },
+    { "kawazu.shizuoka.jp", 0xb7646ddc, PSL_RULE },
+    { "sologne.museum", 0x81d26dde, PSL_RULE },
+    { NULL, 0, 0 },
+    { "association.museum", 0x9a6b2de0, PSL_RULE },
+    { "e.se", 0x98786de0, PSL_RULE },
+    { "ikoma.nara.jp", 0x38ee2de2, PSL_RULE },
+    { "manno.kagawa.jp", 0xbbea2de2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hair", 0xf64e2de5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kutno.pl", 0xf0e72de8, PSL_RULE },
+    { "inami.wakayama.jp", 0xee702de9, PSL_RULE },
+    { "friuli-v-giulia.it", 0x9be8edea, PSL_RULE },
+    { "wales.museum", 0xcd226deb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "naval.museum", 0x5383edef, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mk.ua", 0x63ac6df3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tondabayashi.osaka.jp", 0x5b8e2df5, PSL_RULE },
+    { "toyotomi.hokkaido.jp", 0x6ee5adf5, PSL_RULE },
+    { "bruxelles.museum", 0xc6ef2df7, PSL_RULE },
+    { "flights", 0x5144edf8, PSL_RULE },
+    { "ichinomiya.aichi.jp", 0x3d272df9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tw.cn", 0x2bf46dfb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tsubata.ishikawa.jp", 0x014fadfe, PSL_RULE },
+    { "za.com", 0x3e8b2dff, PSL_RULE },
+    { "k12.mn.us", 0xa6f56e00, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.co", 0xadccae02, PSL_RULE },
+    { NULL, 0, 0 },
+    { "al.eu.org", 0x2b602e04, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fi", 0x39386e06, PSL_RULE },
+    { "co.bn", 0x0e4a2e07, PSL_RULE },
+    { "app.os.stg.fedoraproject.org", 0xfd566e08, PSL_RULE },
+    { "dualstack.us-east-1.amazonaws.com", 0x57c4ae07, 0 },
+    { "chita.aichi.jp", 0xa42c6e0a, PSL_RULE },
+    { "edu.pn", 0xcccc6e09, PSL_RULE },
+    { "lv.eu.org", 0x441fae09, PSL_RULE },
+    { "ohira.miyagi.jp", 0x398e6e0a, PSL_RULE },
+    { "prgmr.com", 0xbe93ae0c, 0 },
+    { "nakayama.yamagata.jp", 0x051f6e0f, PSL_RULE },
+    { "docs", 0xe3002e10, PSL_RULE },
+    { "eus", 0xd54e2e10, PSL_RULE },
+    { "homeunix.org", 0x7d892e12, PSL_RULE },
+    { "furubira.hokkaido.jp", 0xf7fbae13, PSL_RULE },
+    { "mb.ca", 0x8c52ee14, PSL_RULE },
+    { "bio", 0xc1386e15, PSL_RULE },
+    { "prd.mg", 0x3b556e11, PSL_RULE },
+    { "rj.leg.br", 0x4f35ee17, PSL_RULE },
+    { "se.gov.br", 0x1079ae07, PSL_RULE },
+    { NULL, 0, 0 },
+    { "higashihiroshima.hiroshima.jp", 0x8a33ae1a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "naklo.pl", 0xd93bae1c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nokia", 0xf6446e25, PSL_RULE },
+    { "com.ge", 0xd8f5ae26, PSL_RULE },
+    { "vic.edu.au", 0xb14e6e25, PSL_RULE },
+    { "muncie.museum", 0x2f8dee28, PSL_RULE },
+    { "s3-eu-west-1.amazonaws.com", 0x17232e28, PSL_RULE },
+    { "western.museum", 0x02cb2e29, PSL_RULE },
+    { "championship.aero", 0x6382ae2b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "oyodo.nara.jp", 0xc91e6e2d, PSL_RULE },
+    { "art.pl", 0x4b742e2e, PSL_RULE },
+    { "cs.it", 0x683aae2e, PSL_RULE },
+    { "spy.museum", 0x39756e2d, PSL_RULE },
+    { "ericsson", 0x48396e31, PSL_RULE },
+    { "wpmudev.host", 0x97f5ee31, PSL_RULE },
+    { "tsugaru.aomori.jp", 0xe97eae33, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "customer.speedpartner.de", 0xd3fd6e37, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "flakstad.no", 0x0a01ee3a, PSL_RULE },
+    { "nogi.tochigi.jp", 0xbcd1ee3b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fukusaki.hyogo.jp", 0xf5f02e40, PSL_RULE },
+    { "modern.museum", 0x0d066e40, PSL_RULE },
+    { "stavanger.no", 0x12052e41, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "susaki.kochi.jp", 0x36862e45, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tm.ro", 0x74f96e47, PSL_RULE },
+    { "wellbeingzone.co.uk", 0xf9732e48, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "omitama.ibaraki.jp", 0x8db02e4e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "asuke.aichi.jp", 0x91b96e50, PSL_RULE },
+    { "sunagawa.hokkaido.jp", 0xfc2e2e50, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gran.no", 0x3051ae58, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vfs.cloud9.ap-northeast-1.amazonaws.com", 0x1d71ae5a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mock.pstmn.io", 0x18f8ae5d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "principe.st", 0x95622e60, PSL_RULE },
+    { "hitachi", 0xd445ee61, PSL_RULE },
+    { "hostyhosting.io", 0x43826e62, PSL_RULE },
+    { "shop.brendly.rs", 0x7e922e62, PSL_RULE },
+    { "soma.fukushima.jp", 0x3280ae60, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "appspaceusercontent.com", 0xd345ee69, PSL_RULE },
+    { NULL, 0, 0 },
+    { "monzaebrianza.it", 0xb88bae6b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "n4t.co", 0xaf582e6f, PSL_RULE },
+    { "kushiro.hokkaido.jp", 0x69fbae70, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tomiya.miyagi.jp", 0x45416e74, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gob.gt", 0x6ecfae7a, PSL_RULE },
+    { "edu.km", 0x70e66e7b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bo.it", 0x517fae7d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.bt", 0x0747ae80, PSL_RULE },
+    { "mil.zw", 0xc7016e80, PSL_RULE },
+    { "com.cu", 0xa6666e82, PSL_RULE },
+    { "k12.mt.us", 0x54d4ae82, PSL_RULE },
+    { "yamatsuri.fukushima.jp", 0xb78f6e81, PSL_RULE },
+    { "am.leg.br", 0x302d6e85, PSL_RULE },
+    { "um.gov.pl", 0x78876e85, PSL_RULE },
+    { "yaese.okinawa.jp", 0x7bc66e86, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.oh.us", 0xdb576e89, PSL_RULE },
+    { "vision", 0xc226ae89, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ostre-toten.no", 0x8af62e8c, PSL_RULE },
+    { "otaki.nagano.jp", 0xdd6b2e8d, PSL_RULE },
+    { "cf", 0x6622ee8e, PSL_RULE },
+    { "xn--tysvr-vra.no", 0x264e2e8c, PSL_RULE },
+    { "tosu.saga.jp", 0x2fd4ee90, PSL_RULE },
+    { "mielno.pl", 0x908dee91, PSL_RULE },
+    { "seranishi.hiroshima.jp", 0x62bdee91, PSL_RULE },
+    { "otago.museum", 0x23d4ee93, PSL_RULE },
+    { "trading.aero", 0xe82e2e91, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "owariasahi.aichi.jp", 0x5298ee9d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "friulivegiulia.it", 0x6b2e2ea1, PSL_RULE },
+    { "uscountryestate.museum", 0xc4502ea1, PSL_RULE },
+    { "higashitsuno.kochi.jp", 0x7aeeeea3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "osasco.br", 0x9313eea5, PSL_RULE },
+    { "realestate", 0x3eb02ea5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.cm", 0x3a236eaa, PSL_RULE },
+    { "lb", 0x412baeab, PSL_RULE },
+    { "sagae.yamagata.jp", 0xc8b4aeab, PSL_RULE },
+    { "xn--trentinsd-tirol-6vb.it", 0xc44feead, PSL_RULE },
+    { NULL, 0, 0 },
+    { "framer.photos", 0x61096eaf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rawa-maz.pl", 0xf907eeb1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "redirectme.net", 0x65e46eb4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lpl", 0x368b2eb7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "murayama.yamagata.jp", 0xb92c6ebd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--trna-woa.no", 0xc0d36ebf, PSL_RULE },
+    { "maibara.shiga.jp", 0xed6beec0, PSL_RULE },
+    { "osoyro.no", 0x3b49aec1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "uchinomi.kagawa.jp", 0x4fc5aec5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-a-geek.com", 0x38536ec9, PSL_RULE },
+    { "mymediapc.net", 0xeba9eec9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "higashisumiyoshi.osaka.jp", 0xc736aecd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shell.museum", 0x8dad6ed1, PSL_RULE },
+    { "pimienta.org", 0x8d07aed2, PSL_RULE },
+    { "schweiz.museum", 0xd84eaed2, PSL_RULE },
+    { "gov.ve", 0x63b56ed4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ravenna.it", 0xdf9baed7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "higashiomi.shiga.jp", 0x8d6deed9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nesset.no", 0x91d32edc, PSL_RULE },
+    { "bz", 0x4f67eedd, PSL_RULE },
+    { "army", 0x108aaede, PSL_RULE },
+    { "ichihara.chiba.jp", 0xc10c6edf, PSL_RULE },
+    { "date.fukushima.jp", 0x02472ee0, PSL_RULE },
+    { "intuit", 0xcbe22ede, PSL_RULE },
+    { "bologna.it", 0xb49a6ee2, PSL_RULE },
+    { "us-3.evennode.com", 0x3603eede, PSL_RULE },
+    { NULL, 0, 0 },
+    { "beebyte.io", 0xd27caee5, 0 },
+    { "edu.jo", 0x26392ee6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "is-an-anarchist.com", 0xa5b7aee8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hermes", 0x35ec6eeb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "historichouses.museum", 0xc908aeed, PSL_RULE },
+    { "newyork.museum", 0xcb46aeee, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shimizu.shizuoka.jp", 0x5335aef0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tajimi.gifu.jp", 0xf8066ef2, PSL_RULE },
+    { "streamlit.app", 0x031eeef3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "windmill.museum", 0x343daef5, PSL_RULE },
+    { "book", 0xae23aef6, PSL_RULE },
+    { "gov.zw", 0x9ea9aef6, PSL_RULE },
+    { "mx.na", 0xd7b9aef7, PSL_RULE },
+    { "si.it", 0x5870aef8, PSL_RULE },
+    { "monmouth.museum", 0x4b3ceefa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ed.ci", 0xa7416efe, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ikusaka.nagano.jp", 0x23132f00, PSL_RULE },
+    { "de.cool", 0xef54af01, PSL_RULE },
+    { "nyaa.am", 0x4139ef02, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bearalvahki.no", 0xa0c9af04, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "podzone.net", 0x1b6bef07, PSL_RULE },
+    { "lodingen.no", 0xee18af08, PSL_RULE },
+    { "nexus", 0x6214ef08, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "br.it", 0x3f382f0c, PSL_RULE },
+    { "kochi.jp", 0xb916ef0d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "trentin-sud-tirol.it", 0xe261af10, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mo-siemens.io", 0x5429ef14, PSL_RULE },
+    { "hyatt", 0x2d6aef15, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ogori.fukuoka.jp", 0xe7f92f17, PSL_RULE },
+    { "gs.nt.no", 0x41adef18, PSL_RULE },
+    { "compute.amazonaws.com.cn", 0x0b692f19, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "taxi", 0xd1236f21, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.ge", 0x533eef25, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "us-2.evennode.com", 0x40632f2f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "missile.museum", 0xb3fdaf33, PSL_RULE },
+    { NULL, 0, 0 },
+    { "funkfeuer.at", 0x2782ef35, 0 },
+    { "haebaru.okinawa.jp", 0x2b742f35, PSL_RULE },
+    { "pr.leg.br", 0x41706f35, PSL_RULE },
+    { "us-west-2.elasticbeanstalk.com", 0x3c20ef35, PSL_RULE },
+    { "community-pro.net", 0x6381af39, PSL_RULE },
+    { "komvux.se", 0x6ac1ef39, PSL_RULE },
+    { "paris.eu.org", 0x127baf3a, PSL_RULE },
+    { "xn--mgbai9azgqp6j", 0x300e2f37, PSL_RULE },
+    { "steinkjer.no", 0x4224af3d, PSL_RULE },
+    { "yachimata.chiba.jp", 0x39c0af39, PSL_RULE },
+    { NULL, 0, 0 },
+    { "recipes", 0x4ff5ef40, PSL_RULE },
+    { "barclaycard", 0x080daf41, PSL_RULE },
+    { "sohu", 0x4fbdef42, PSL_RULE },
+    { "tana.no", 0x926c6f40, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chieti.it", 0x3549ef46, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sigdal.no", 0xbcce2f48, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "namegata.ibaraki.jp", 0x4a472f50, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kids.us", 0xe6d1af52, PSL_RULE },
+    { "trani-andria-barletta.it", 0x71112f52, PSL_RULE },
+    { "presidio.museum", 0xb0442f54, PSL_RULE },
+    { "gu", 0x5a432f55, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gamo.shiga.jp", 0xec502f57, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloud.metacentrum.cz", 0xc7fc6f5a, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "lom.it", 0x81ce2f5c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "homeftp.org", 0xbda8af60, PSL_RULE },
+    { "blogspot.si", 0xbfe3af61, PSL_RULE },
+    { "lt.it", 0x413caf60, PSL_RULE },
+    { "s3.dualstack.eu-central-1.amazonaws.com", 0x8f05ef63, PSL_RULE },
+    { "booking", 0xf8402f64, PSL_RULE },
+    { "edu.ws", 0x2e63af65, PSL_RULE },
+    { "cloud9.ap-south-1.amazonaws.com", 0xca546f66, 0 },
+    { "axa", 0x40572f67, PSL_RULE },
+    { "oe.yamagata.jp", 0x2e276f68, PSL_RULE },
+    { "takahagi.ibaraki.jp", 0x309e6f60, PSL_RULE },
+    { "edu.la", 0x770e6f6a, PSL_RULE },
+    { "from-ri.com", 0x4be02f6a, PSL_RULE },
+    { "bg", 0x3d206f6c, PSL_RULE },
+    { "karlsoy.no", 0x94c6af6d, PSL_RULE },
+    { "mukawa.hokkaido.jp", 0x1368af6d, PSL_RULE },
+    { "vi.us", 0x891b6f6a, PSL_RULE },
+    { "kujukuri.chiba.jp", 0x65dfef70, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "d.se", 0x99786f73, PSL_RULE },
+    { "gob.ni", 0x779b6f74, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vgs.no", 0xb6b76f76, PSL_RULE },
+    { "of.je", 0xeeefaf77, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.ma", 0xb8f02f79, PSL_RULE },
+    { "cc.vi.us", 0x9ce3af7a, PSL_RULE },
+    { "coop.km", 0xbba42f7a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "qc.ca", 0x8c50af7d, PSL_RULE },
+    { "sandnes.no", 0x3db12f7e, PSL_RULE },
+    { "valer.ostfold.no", 0xe12d2f7d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "elastx.net", 0x0f7bef81, 0 },
+    { "ishikawa.jp", 0xe8d32f82, PSL_RULE },
+    { "lib.vt.us", 0xd0082f82, PSL_RULE },
+    { "watari.miyagi.jp", 0x86c86f81, PSL_RULE },
+    { "barefoot", 0xe0e42f85, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tamayu.shimane.jp", 0x7d90af87, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dyndns-office.com", 0x49f2ef89, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.mu", 0xa4d6ef8d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "imb.br", 0x9a07af8f, PSL_RULE },
+    { "atlanta.museum", 0xbc7f6f90, PSL_RULE },
+    { "cards", 0x2d286f90, PSL_RULE },
+    { "estate.museum", 0xaef1ef91, PSL_RULE },
+    { "framer.website", 0xea1a6f93, PSL_RULE },
+    { "mil.ac", 0x2e696f91, PSL_RULE },
+    { "rec.br", 0x2026af91, PSL_RULE },
+    { "tokai.ibaraki.jp", 0x4c57af94, PSL_RULE },
+    { "hokuto.hokkaido.jp", 0xd9a3ef97, PSL_RULE },
+    { "kitami.hokkaido.jp", 0x40cc6f98, PSL_RULE },
+    { "gi", 0x3a386f99, PSL_RULE },
+    { "k12.wa.us", 0x251f2f99, PSL_RULE },
+    { "msd", 0xcc236f97, PSL_RULE },
+    { "pe.gov.br", 0x1179af9a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hinohara.tokyo.jp", 0x65276fa1, PSL_RULE },
+    { "cd.eu.org", 0x3d4b2fa2, PSL_RULE },
+    { "hakuba.nagano.jp", 0x08216fa3, PSL_RULE },
+    { "ikano", 0x06042fa3, PSL_RULE },
+    { "ibaraki.osaka.jp", 0x40c62fa5, PSL_RULE },
+    { "bloxcms.com", 0x4a556fa6, PSL_RULE },
+    { "loginto.me", 0x81262fa1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.business", 0x31562fa9, PSL_RULE },
+    { "go.kr", 0xca572faa, PSL_RULE },
+    { "ballooning.aero", 0x636c2fab, PSL_RULE },
+    { "ecologia.bo", 0x9dcdefab, PSL_RULE },
+    { "muroto.kochi.jp", 0xf816efa9, PSL_RULE },
+    { "nakasatsunai.hokkaido.jp", 0xdaf12fac, PSL_RULE },
+    { "sanofi", 0x4d04afab, PSL_RULE },
+    { "tb-hosting.com", 0xfce7afaf, 0 },
+    { "xn--8ltr62k.jp", 0x12f5afae, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bandai.fukushima.jp", 0x8507afbf, PSL_RULE },
+    { "fast", 0xddc2efbf, PSL_RULE },
+    { "bs.it", 0x693aafc1, PSL_RULE },
+    { "free.hr", 0x286a2fc1, PSL_RULE },
+    { "la", 0x3f24efc0, PSL_RULE },
+    { "mil.uy", 0x42d02fbf, PSL_RULE },
+    { "takayama.gunma.jp", 0x0899efc4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chase", 0xdd046fc9, PSL_RULE },
+    { "hayashima.okayama.jp", 0x200befc9, PSL_RULE },
+    { "filegear-sg.me", 0xd18dafcb, PSL_RULE },
+    { "co.hu", 0x7d17afcc, PSL_RULE },
+    { "film.museum", 0x4d596fcb, PSL_RULE },
+    { "s3.eu-west-2.amazonaws.com", 0x2cb4afce, PSL_RULE },
+    { "saiki.oita.jp", 0xc802efcf, PSL_RULE },
+    { "no", 0x61342fd0, PSL_RULE },
+    { "ulvik.no", 0xbae7afcb, PSL_RULE },
+    { "chernigov.ua", 0xd76b2fd2, PSL_RULE },
+    { "entertainment.aero", 0x70686fd2, PSL_RULE },
+    { "friuli-vegiulia.it", 0x9805afd2, PSL_RULE },
+    { "gs.cn", 0x0ce9afd2, PSL_RULE },
+    { "marylhurst.museum", 0x0638efd4, PSL_RULE },
+    { "narashino.chiba.jp", 0x90bf2fd5, PSL_RULE },
+    { "wegrow.pl", 0x8765afd4, PSL_RULE },
+    { "holdings", 0x8a3b6fd9, PSL_RULE },
+    { "oga.akita.jp", 0xcbf0afda, PSL_RULE },
+    { "xn--45q11c", 0x9cbbefce, PSL_RULE },
+    { "law.za", 0xaeae6fdc, PSL_RULE },
+    { "xn--laheadju-7ya.no", 0x301cefd8, PSL_RULE },
+    { "deca.jp", 0x990cefde, PSL_RULE },
+    { "cat", 0x99f72fdf, PSL_RULE },
+    { "fastvps.host", 0x7e81afe0, PSL_RULE },
+    { "kurume.fukuoka.jp", 0x41e72fde, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.ro", 0x60702fe3, PSL_RULE },
+    { "xn--rht3d.jp", 0x69542fe4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "s3-website.eu-central-1.amazonaws.com", 0xf122afe7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "web.pk", 0x9c61afea, PSL_RULE },
+    { "lib.dc.us", 0x3f896feb, PSL_RULE },
+    { "med.pro", 0x7b7aafec, PSL_RULE },
+    { "nic.tj", 0x83546feb, PSL_RULE },
+    { "nombre.bo", 0x72126fed, PSL_RULE },
+    { "pesaro-urbino.it", 0x3d66efee, PSL_RULE },
+    { "varese.it", 0x4393aff0, PSL_RULE },
+    { "ap-northeast-1.amazonaws.com", 0x01216ff1, 0 },
+    { "whm.fr-par.scw.cloud", 0x3103aff1, PSL_RULE },
+    { "xn--kvitsy-fya.no", 0xc0bf2fed, PSL_RULE },
+    { "andria-trani-barletta.it", 0xea8e6ff4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--d1at.xn--90a3ac", 0x1a1f6ff6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aca.pro", 0x9229eff9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloudns.cc", 0x8cc2affb, PSL_RULE },
+    { "co.ag", 0xf3592ffb, PSL_RULE },
+    { "name.jo", 0x18b42ffb, PSL_RULE },
+    { "siracusa.it", 0xf29aeffb, PSL_RULE },
+    { "toshiba", 0xd7f72ffb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "s3-website.pl-waw.scw.cloud", 0xcc383001, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bentley", 0x451d7004, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "biratori.hokkaido.jp", 0x61723007, PSL_RULE },
+    { "mil.vc", 0xc82f7008, PSL_RULE },
+    { "how", 0x29e8f009, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "opoczno.pl", 0xae0ff00d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "trentinosued-tirol.it", 0x76d5b013, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bungotakada.oita.jp", 0xe7307017, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "minamiise.mie.jp", 0x19cb701a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sx", 0x4e63701c, PSL_RULE },
+    { "wlocl.pl", 0x6989701c, PSL_RULE },
+    { "museum.mv", 0x0ceff01e, PSL_RULE },
+    { "airbus", 0xacf8b01f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bf", 0x6722f021, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.mk", 0xe3207026, PSL_RULE },
+    { NULL, 0, 0 },
+    { "azure", 0xc229b028, PSL_RULE },
+    { "firewall-gateway.com", 0x9ead7029, PSL_RULE },
+    { "ohkura.yamagata.jp", 0xf8e8702a, PSL_RULE },
+    { "onfabrica.com", 0x948f702b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "anamizu.ishikawa.jp", 0xd60fb031, PSL_RULE },
+    { "lutsk.ua", 0x0a5b3032, PSL_RULE },
+    { "drr.ac", 0x17fb3033, PSL_RULE },
+    { "armenia.su", 0x8d1b3034, PSL_RULE },
+    { "fortworth.museum", 0x26017034, PSL_RULE },
+    { "bibai.hokkaido.jp", 0x66143036, PSL_RULE },
+    { "hamburg", 0x40d23033, PSL_RULE },
+    { "fed.us", 0x9cc67038, PSL_RULE },
+    { "is-a-liberal.com", 0x0a8b7036, PSL_RULE },
+    { "morimachi.shizuoka.jp", 0xb8e9b03a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-an-engineer.com", 0xe5857042, PSL_RULE },
+    { NULL, 0, 0 },
+    { "osaka.jp", 0xca00b044, PSL_RULE },
+    { "lucerne.museum", 0xb7b33045, PSL_RULE },
+    { "gov.mn", 0xa4fd3046, PSL_RULE },
+    { NULL, 0, 0 },
+    { "anz", 0xb47eb048, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--80aswg", 0x6ab5f04b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "moskenes.no", 0xe60fb04d, PSL_RULE },
+    { "cuisinella", 0x9f57304e, PSL_RULE },
+    { "mh", 0x643af04e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "wiki", 0x46523051, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ap-northeast-1.elasticbeanstalk.com", 0x3455f056, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dtv", 0x725b3059, PSL_RULE },
+    { "playstation", 0x1eed7059, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xfinity", 0xc611f05c, PSL_RULE },
+    { "info.bj", 0xbbe1305d, PSL_RULE },
+    { "matsumoto.kagoshima.jp", 0x68a0705e, PSL_RULE },
+    { "pa.gov.br", 0x0984305e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chiba.jp", 0x067e7062, PSL_RULE },
+    { NULL, 0, 0 },
+    { "toray", 0xd6977064, PSL_RULE },
+    { "rogers", 0x3bbd3065, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ikaruga.nara.jp", 0xe56df067, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ocelot.mythic-beasts.com", 0x040e7069, PSL_RULE },
+    { "store", 0x1777306a, PSL_RULE },
+    { "ritto.shiga.jp", 0x651f306b, PSL_RULE },
+    { "chtr.k12.ma.us", 0x84ccb06c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kobayashi.miyazaki.jp", 0xe1a0706f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "works.aero", 0xbde8f072, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tozsde.hu", 0x989df075, PSL_RULE },
+    { NULL, 0, 0 },
+    { "jewish.museum", 0xdb66f077, PSL_RULE },
+    { NULL, 0, 0 },
+    { "newjersey.museum", 0xc2ce3079, PSL_RULE },
+    { "city.sendai.jp", 0xb1fb707a, PSL_EXCEPTION },
+    { "hospital", 0x7b66b07b, PSL_RULE },
+    { "yoro.gifu.jp", 0xc8adb07b, PSL_RULE },
+    { "nanao.ishikawa.jp", 0xd9f6307d, PSL_RULE },
+    { "kikuchi.kumamoto.jp", 0x5e86b07e, PSL_RULE },
+    { "vercel.app", 0xa061f07f, PSL_RULE },
+    { "be.eu.org", 0x1448b080, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kyiv.ua", 0x9cb13082, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fukaya.saitama.jp", 0xc28ff086, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ri.it", 0x5970b08b, PSL_RULE },
+    { "urbino-pesaro.it", 0x3e7e708c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.vu", 0x2233b090, PSL_RULE },
+    { NULL, 0, 0 },
+    { "jele.cloud", 0x10c9f092, PSL_RULE },
+    { "tsk.tr", 0xfe757093, PSL_RULE },
+    { "mattel", 0x0a5a3094, PSL_RULE },
+    { "utah.museum", 0x73b5b095, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ddnss.org", 0xb9caf097, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ca.us", 0x6607b099, PSL_RULE },
+    { "co.am", 0x1d4a7099, PSL_RULE },
+    { "forgeblocks.com", 0x388a3099, PSL_RULE },
+    { "smartlabeling.scw.cloud", 0x93b3b09a, PSL_RULE },
+    { "stdlib.com", 0x83c3709c, 0 },
+    { NULL, 0, 0 },
+    { "alto-adige.it", 0x6df4b09f, PSL_RULE },
+    { "cr.it", 0x4038309f, PSL_RULE },
+    { "xn--1qqw23a", 0x6f44f09f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.ua", 0x2d8a70a6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "barueri.br", 0x3c3d70a9, PSL_RULE },
+    { "xn--ygbi2ammx", 0x450e30a9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "center.museum", 0x0d5970ae, PSL_RULE },
+    { "aquarelle", 0xd5ccb0af, PSL_RULE },
+    { "byen.site", 0x7a9370b0, PSL_RULE },
+    { "anan.nagano.jp", 0x4494b0b1, PSL_RULE },
+    { "nes.buskerud.no", 0xe1d730b1, PSL_RULE },
+    { "tailscale.net", 0xedb930b2, 0 },
+    { "uwu.ai", 0xf14370ae, PSL_RULE },
+    { "whm.nl-ams.scw.cloud", 0xa1e0b0af, PSL_RULE },
+    { "engine.aero", 0x81c7b0b6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tvs", 0xd44770b8, PSL_RULE },
+    { "gratangen.no", 0x362db0b9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.mt", 0x0761b0bb, PSL_RULE },
+    { "snaase.no", 0xda56f0bb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mozilla-iot.org", 0x5a6eb0be, PSL_RULE },
+    { "wtc", 0xf753f0bf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "izumiotsu.osaka.jp", 0x0cf770c1, PSL_RULE },
+    { "kep.tr", 0xbfe770c1, PSL_RULE },
+    { "budejju.no", 0x014e70c3, PSL_RULE },
+    { "fla.no", 0x6f2e30c3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "abo.pa", 0x566870c6, PSL_RULE },
+    { "art.museum", 0x6713f0c6, PSL_RULE },
+    { "kishiwada.osaka.jp", 0x7798b0c7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "higashiizumo.shimane.jp", 0xe41770cb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "from-mt.com", 0x165b70d2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "withyoutube.com", 0xc97830d5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "stjordal.no", 0x1df170d7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "matsue.shimane.jp", 0xff3bb0d9, PSL_RULE },
+    { "bar", 0x56ff30da, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "typeform.com", 0x25eb30de, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "shinanomachi.nagano.jp", 0x91d230e1, PSL_RULE },
+    { "icurus.jp", 0xbfa230e2, PSL_RULE },
+    { "nesodden.no", 0x7426b0e2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.sg", 0x5d0f30e5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hu", 0x5b4330e8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "weather", 0x3372b0eb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mine.nu", 0xfd1770ed, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bronnoy.no", 0xa6cdb0f3, PSL_RULE },
+    { "caxias.br", 0xecbd30f4, PSL_RULE },
+    { "doomdns.org", 0x447c70f3, PSL_RULE },
+    { "mt.it", 0x423cb0f3, PSL_RULE },
+    { "cooking", 0xf94030f7, PSL_RULE },
+    { "mt.eu.org", 0x1f23f0f8, PSL_RULE },
+    { "select", 0xa465b0f5, PSL_RULE },
+    { "tingvoll.no", 0x8bc830f3, PSL_RULE },
+    { "haram.no", 0x692b30fb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "wi.us", 0x8a1b70fd, PSL_RULE },
+    { "biz.vn", 0x3384b0fe, PSL_RULE },
+    { "cg", 0x3e2070ff, PSL_RULE },
+    { "tsubame.niigata.jp", 0x638930ff, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "linde", 0x6527b103, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "g.se", 0x9a787106, PSL_RULE },
+    { "xn--80au.xn--90a3ac", 0x9c1eb106, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "backplaneapp.io", 0xfb41f10b, PSL_RULE },
+    { "angry.jp", 0x7024710c, PSL_RULE },
+    { "audible", 0x0d25310d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rec.nf", 0x4ed23111, PSL_RULE },
+    { "rankoshi.hokkaido.jp", 0xb9d23112, PSL_RULE },
+    { "s3.dualstack.sa-east-1.amazonaws.com", 0x21dab111, PSL_RULE },
+    { "reserve-online.com", 0xfa4ab114, PSL_RULE },
+    { "ac.vn", 0xe533f115, PSL_RULE },
+    { "firm.nf", 0x32dfb115, PSL_RULE },
+    { "uni5.net", 0x7e5cb115, PSL_RULE },
+    { "xn--6qq986b3xl", 0xa1de7117, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kitakata.miyazaki.jp", 0x9369b11a, PSL_RULE },
+    { "edu.cu", 0x170a311b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloudcontrolled.com", 0xe7f7b11f, PSL_RULE },
+    { "botanical.museum", 0xf09ff120, PSL_RULE },
+    { "kamikawa.hyogo.jp", 0x4f6cf121, PSL_RULE },
+    { "odate.akita.jp", 0x1d8c7122, PSL_RULE },
+    { "kanuma.tochigi.jp", 0xbd8db123, PSL_RULE },
+    { "mol.it", 0xf6957124, PSL_RULE },
+    { "oshima.yamaguchi.jp", 0xf4b2b122, PSL_RULE },
+    { "zt.ua", 0x72e67121, PSL_RULE },
+    { "miyake.nara.jp", 0x40c5f127, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "iizuka.fukuoka.jp", 0x83d1b12a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "broadway", 0xc0f1312c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jelastic.vps-host.net", 0x6049312f, 0 },
+    { "support", 0x190f7130, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nesoddtangen.no", 0x5aa9b132, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ashoro.hokkaido.jp", 0x2f237135, PSL_RULE },
+    { "ham-radio-op.net", 0x8dbf3136, PSL_RULE },
+    { "flowers", 0x4ccbb137, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bw", 0x5d47b13c, PSL_RULE },
+    { "monster", 0x4c48f13d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "assur.bj", 0xf6a73141, PSL_RULE },
+    { NULL, 0, 0 },
+    { "maceio.br", 0xdb33b143, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nikko.tochigi.jp", 0x303cb146, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vfs.cloud9.eu-west-3.amazonaws.com", 0x369f714a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "anan.tokushima.jp", 0xfe82714c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rm.it", 0x517b314f, PSL_RULE },
+    { "gol.no", 0x4f873150, PSL_RULE },
+    { "gs.oslo.no", 0x4408f151, PSL_RULE },
+    { "now-dns.net", 0xa22cb150, PSL_RULE },
+    { "ma", 0x4024f153, PSL_RULE },
+    { "sukagawa.fukushima.jp", 0xb21bb150, PSL_RULE },
+    { "trentin-sued-tirol.it", 0xe584b155, PSL_RULE },
+    { "com.cy", 0x0799f156, PSL_RULE },
+    { "carrier.museum", 0x3bd17157, PSL_RULE },
+    { "siteleaf.net", 0x20967157, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dualstack.ap-northeast-2.amazonaws.com", 0x8bda315a, 0 },
+    { "ist", 0xb819f15b, PSL_RULE },
+    { "izumozaki.niigata.jp", 0xa365315b, PSL_RULE },
+    { "ismaili", 0x4c5d315d, PSL_RULE },
+    { "lds", 0xe024f15a, PSL_RULE },
+    { "xx.gl", 0x177a715e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--sndre-land-0cb.no", 0x0d4bf162, PSL_RULE },
+    { "k12.me.us", 0x3e893163, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "idrett.no", 0x1579b166, PSL_RULE },
+    { "dyndns1.de", 0x9818f167, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gy", 0x5a5fb169, PSL_RULE },
+    { "nowaruda.pl", 0x48f5716a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lifeinsurance", 0xf00b716d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "thruhere.net", 0xb717b16f, PSL_RULE },
+    { "botanicgarden.museum", 0xf64cb170, PSL_RULE },
+    { "storebase.store", 0x00443170, PSL_RULE },
+    { "fot.br", 0x17c63172, PSL_RULE },
+    { "gwangju.kr", 0x24957173, PSL_RULE },
+    { "tienda", 0xd433b170, PSL_RULE },
+    { "kunohe.iwate.jp", 0x6368b175, PSL_RULE },
+    { "tui", 0x87fab175, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fujioka.gunma.jp", 0xab3cf17e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "torahime.shiga.jp", 0x554cb180, PSL_RULE },
+    { "info", 0x1012f181, PSL_RULE },
+    { NULL, 0, 0 },
+    { "larsson.museum", 0xf9ceb183, PSL_RULE },
+    { "lclstage.dev", 0x0a7f7183, PSL_WILDCARD },
+    { "s3.dualstack.ap-southeast-2.amazonaws.com", 0x69c53184, PSL_RULE },
+    { NULL, 0, 0 },
+    { "design.museum", 0x2b473187, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rivne.ua", 0xa4d0b189, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "allstate", 0xceeab18d, PSL_RULE },
+    { "realestate.pl", 0xa421318d, PSL_RULE },
+    { "ngo", 0xc53cf18f, PSL_RULE },
+    { "cc.de.us", 0x18617190, PSL_RULE },
+    { "kusu.oita.jp", 0x91a8f190, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eu-3.evennode.com", 0x41fdf194, PSL_RULE },
+    { "kurate.fukuoka.jp", 0x78cd3195, PSL_RULE },
+    { "page", 0xa1e77194, PSL_RULE },
+    { "zj.cn", 0x27ab7194, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--mgba3a4fra.ir", 0x5a97719c, PSL_RULE },
+    { "americanexpress", 0xd266719d, PSL_RULE },
+    { "blogspot.ug", 0x0b84319d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fet.no", 0xf766f1a1, PSL_RULE },
+    { "from-or.com", 0x64a4f1a2, PSL_RULE },
+    { "go.dyndns.org", 0x6a8571a1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aaa.pro", 0xc62431a7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "yamatokoriyama.nara.jp", 0x5e3471a9, PSL_RULE },
+    { "qld.au", 0x068071aa, PSL_RULE },
+    { "teo.br", 0x3da8b1ab, PSL_RULE },
+    { "crafting.xyz", 0x3930f1ac, PSL_RULE },
+    { "xn--nqv7f", 0x2a6931ab, PSL_RULE },
+    { "law.pro", 0x61f031ae, PSL_RULE },
+    { "baidar.no", 0xbcb671af, PSL_RULE },
+    { "co.mw", 0x34b471af, PSL_RULE },
+    { "hapmir.no", 0xe203f1af, PSL_RULE },
+    { "tn.oxa.cloud", 0x9b4231ae, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "merseine.nu", 0x25ca31b6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "biz.tr", 0x346db1b8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.sv", 0x112571bc, PSL_RULE },
+    { "ote.bj", 0xd83431bd, PSL_RULE },
+    { "broker", 0xcedd31be, PSL_RULE },
+    { NULL, 0, 0 },
+    { "id.au", 0x7e8df1c0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mifune.kumamoto.jp", 0x924031c2, PSL_RULE },
+    { "namdalseid.no", 0x2a71b1c2, PSL_RULE },
+    { "ct.us", 0x7e3bb1c4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bydgoszcz.pl", 0xd6f1f1c6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--rsta-fra.no", 0x1a7371c8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jcloud-ver-jpc.ik-server.com", 0x983eb1cd, PSL_RULE },
+    { "demo.datacenter.fi", 0xddcef1ce, PSL_RULE },
+    { "genova.it", 0x1ff571ce, PSL_RULE },
+    { "juif.museum", 0x539571cf, PSL_RULE },
+    { "mil.id", 0x9a0631ce, PSL_RULE },
+    { "biz.mw", 0x03fbb1d2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bib.ve", 0x1555b1d9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "www.ck", 0x5a3671de, PSL_EXCEPTION },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "farsund.no", 0xb212f1e1, PSL_RULE },
+    { "matsumae.hokkaido.jp", 0x562cf1e2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "avocat.pro", 0x8a0371e6, PSL_RULE },
+    { "blog.bo", 0x59a071e6, PSL_RULE },
+    { "gob.pe", 0xe69c71e6, PSL_RULE },
+    { "typedream.app", 0xe80cf1e9, PSL_RULE },
+    { "venezia.it", 0x3125f1e8, PSL_RULE },
+    { "senseering.net", 0x438231eb, PSL_RULE },
+    { "alpha-myqnapcloud.com", 0x9ba271ec, PSL_RULE },
+    { "iwata.shizuoka.jp", 0x5fbd71ed, PSL_RULE },
+    { "seika.kyoto.jp", 0xe61131ec, PSL_RULE },
+    { "oci.customer-oci.com", 0xed3af1ef, PSL_WILDCARD },
+    { "webredirect.org", 0x8b3431ed, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nospamproxy.com", 0x9150b1f6, 0 },
+    { "poa.br", 0x4d23b1f7, PSL_RULE },
+    { "ca-central-1.elasticbeanstalk.com", 0x7925f1f8, PSL_RULE },
+    { "ukiha.fukuoka.jp", 0x6d87b1f9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "framercanvas.com", 0x94d1b1fb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nagasaki.nagasaki.jp", 0xf2a071fd, PSL_RULE },
+    { "tateyama.toyama.jp", 0x18cc31fe, PSL_RULE },
+    { "info.au", 0x203d31ff, PSL_RULE },
+    { "ap-southeast-1.elasticbeanstalk.com", 0x655a3200, PSL_RULE },
+    { "webview-assets.cloud9.me-south-1.amazonaws.com", 0x653db200, PSL_RULE },
+    { "com.mo", 0xdf3cb202, PSL_RULE },
+    { "or.ci", 0xbd147202, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nanto.toyama.jp", 0x08a27206, PSL_RULE },
+    { "yokaichiba.chiba.jp", 0xcda73206, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "koya.wakayama.jp", 0x4f8b320f, PSL_RULE },
+    { "shizuoka.jp", 0xbce4f20f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "info.ec", 0xe38c7215, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mo-i-rana.no", 0xadfb321b, PSL_RULE },
+    { "edu.kn", 0x1249721c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.ky", 0xc1f6b21e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "meinforum.net", 0x8f3c3220, PSL_RULE },
+    { "mobi.tz", 0xeeecb220, PSL_RULE },
+    { "chitose.hokkaido.jp", 0x7c447222, PSL_RULE },
+    { "ve", 0x491a7222, PSL_RULE },
+    { "ven.it", 0xeabfb221, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.sy", 0xed4b3226, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hikawa.shimane.jp", 0x572df22b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "webview-assets.cloud9.us-west-2.amazonaws.com", 0x89a3722d, PSL_RULE },
+    { "lexus", 0x6414f22e, PSL_RULE },
+    { "org.ee", 0x7bf1f22f, PSL_RULE },
+    { "xn--berlevg-jxa.no", 0x505af22f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ltd.co.im", 0xdba03233, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "emergency.aero", 0x5f3b323d, PSL_RULE },
+    { "hioki.kagoshima.jp", 0x1d80723d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "takaharu.miyazaki.jp", 0xedcb3241, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--mgbtf8fl", 0x11103247, PSL_RULE },
+    { NULL, 0, 0 },
+    { "penza.su", 0x4cf67249, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chambagri.fr", 0x6411324f, PSL_RULE },
+    { "kamifurano.hokkaido.jp", 0xb29bf250, PSL_RULE },
+    { "yoita.niigata.jp", 0xc2d77250, PSL_RULE },
+    { "artgallery.museum", 0x32c7b252, PSL_RULE },
+    { "datacenter.fi", 0xb68fb253, 0 },
+    { "psi.br", 0x9c14b253, PSL_RULE },
+    { "biz.ni", 0x05ec7255, PSL_RULE },
+    { "sunnyday.jp", 0xa0ae3252, PSL_RULE },
+    { "luster.no", 0x9cb1f257, PSL_RULE },
+    { "williamsburg.museum", 0x6113f255, PSL_RULE },
+    { "miners.museum", 0x655e7259, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sites.static.land", 0x418eb25c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nodebalancer.linode.com", 0xa517325f, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "panama.museum", 0x4ed6f261, PSL_RULE },
+    { "pomorskie.pl", 0x21023262, PSL_RULE },
+    { "ueno.gunma.jp", 0x3852f262, PSL_RULE },
+    { NULL, 0, 0 },
+    { "info.vn", 0x7ac1b265, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "paris", 0xd395f268, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "0e.vc", 0xe849f26b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "car", 0x57ff326d, PSL_RULE },
+    { "depot.museum", 0xa288726d, PSL_RULE },
+    { "cb.it", 0x605f726f, PSL_RULE },
+    { "gov", 0x8f21726f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "psp.gov.pl", 0xa5403272, PSL_RULE },
+    { "reliance", 0x8c19b272, PSL_RULE },
+    { "xn--vuq861b", 0x22143272, PSL_RULE },
+    { "xn--11b4c3d", 0xc2bb7275, PSL_RULE },
+    { "xn--cckwcxetd", 0x635af275, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "science-fiction.museum", 0x2e40727c, PSL_RULE },
+    { "chuo.chiba.jp", 0x1a90727d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "christiansburg.museum", 0xc2ee327f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dualstack.us-east-2.amazonaws.com", 0x251b3282, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.ua", 0x61bff285, PSL_RULE },
+    { NULL, 0, 0 },
+    { "wiardweb.com", 0x1e117287, 0 },
+    { NULL, 0, 0 },
+    { "market", 0x4155f289, PSL_RULE },
+    { "gg.ax", 0x2d2a728a, PSL_RULE },
+    { "lt.eu.org", 0x2023f28b, PSL_RULE },
+    { "lublin.pl", 0x3db6b28b, PSL_RULE },
+    { "koga.fukuoka.jp", 0xdd9bf28d, PSL_RULE },
+    { "shoparena.pl", 0xac22728c, PSL_RULE },
+    { "asahi.nagano.jp", 0xf6adb28f, PSL_RULE },
+    { "hi.us", 0x8b1b7290, PSL_RULE },
+    { "akagi.shimane.jp", 0xdd47f291, PSL_RULE },
+    { "art.br", 0x1f0f3292, PSL_RULE },
+    { "lgbt", 0xa0dcf290, PSL_RULE },
+    { "portal.museum", 0x094bf293, PSL_RULE },
+    { "sebastopol.ua", 0xf1347295, PSL_RULE },
+    { "xn--mot-tla.no", 0x0d51b290, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "f.se", 0x9b787299, PSL_RULE },
+    { "heimatunduhren.museum", 0xca67729a, PSL_RULE },
+    { "bounty-full.com", 0x42f6b29b, PSL_RULE },
+    { "dnsdojo.net", 0x5d5f329b, PSL_RULE },
+    { "net.gl", 0xba29f29d, PSL_RULE },
+    { "shopping", 0x545ab29d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.il", 0x2cbe72a2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tas.edu.au", 0xef9132a7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "idf.il", 0x5524f2a9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "aure.no", 0x9f2ef2ab, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dali.museum", 0xf8fff2ad, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.ar.us", 0x1ab172b0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "musashimurayama.tokyo.jp", 0x765a72b6, PSL_RULE },
+    { "tec.br", 0x2226b2b7, PSL_RULE },
+    { "pilots.museum", 0x8d5d32b8, PSL_RULE },
+    { "fr-1.paas.massivegrid.net", 0xf4a1b2b9, PSL_RULE },
+    { "gov.ae", 0xb5e772b9, PSL_RULE },
+    { "trentinosudtirol.it", 0x806232bb, PSL_RULE },
+    { "enf.br", 0x425d32bc, PSL_RULE },
+    { "kawaminami.miyazaki.jp", 0x599c32bd, PSL_RULE },
+    { "servebbs.net", 0x97e4b2be, PSL_RULE },
+    { "ai", 0x3c3872bf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mil.nz", 0x75a5b2c1, PSL_RULE },
+    { "nyny.museum", 0x31f8b2c1, PSL_RULE },
+    { "ug.gov.pl", 0x749672c3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "academy.museum", 0xb8abf2c5, PSL_RULE },
+    { "rocks", 0x419632c5, PSL_RULE },
+    { "kashiwazaki.niigata.jp", 0x444b72c7, PSL_RULE },
+    { "travel.in", 0x4e8cf2c6, PSL_RULE },
+    { "4lima.at", 0xce59f2c9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hashikami.aomori.jp", 0xd5ef32cb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nb.ca", 0x8f52f2cd, PSL_RULE },
+    { "barsy.io", 0x6038f2ce, PSL_RULE },
+    { "cw", 0x5e47b2cf, PSL_RULE },
+    { "xn--h2breg3eve", 0x115a72d0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.by", 0x780af2d4, PSL_RULE },
+    { "isernia.it", 0x023132d5, PSL_RULE },
+    { "com.om", 0x364572d6, PSL_RULE },
+    { "gru.br", 0xbc80f2d7, PSL_RULE },
+    { "muosat.no", 0x09de32d5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "isla.pr", 0x934232da, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "easypanel.host", 0x4430b2dd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nz.eu.org", 0x222872df, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "na", 0x4124f2e6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gotdns.org", 0xaaa2b2ea, PSL_RULE },
+    { "oshu.iwate.jp", 0x377372ea, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "official.ec", 0xb5adf2ee, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "midori.gunma.jp", 0xe7edb2f3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hatsukaichi.hiroshima.jp", 0x936af2f5, PSL_RULE },
+    { "movimiento.bo", 0x4bc6f2f5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vfs.cloud9.eu-central-1.amazonaws.com", 0x7e4332fa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vfs.cloud9.ap-southeast-1.amazonaws.com", 0x5031f300, PSL_RULE },
+    { "pagexl.com", 0xaf81f301, PSL_RULE },
+    { "blogspot.li", 0xdacbf302, PSL_RULE },
+    { "makinohara.shizuoka.jp", 0x59b0b302, PSL_RULE },
+    { "meiwa.gunma.jp", 0xfe00b302, PSL_RULE },
+    { "biz.id", 0x697bf305, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "profesional.bo", 0x0ff6330c, PSL_RULE },
+    { "gov.co", 0xddad330d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "trv", 0x7e55330f, PSL_RULE },
+    { "iwi.nz", 0xb582b310, PSL_RULE },
+    { "eu-central-1.amazonaws.com", 0x0d66f311, 0 },
+    { "naturhistorisches.museum", 0xb8e8f311, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "toys", 0xf678731a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mil.ng", 0xc626731c, PSL_RULE },
+    { "unicloud.pl", 0x71df731c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "clinique", 0xa39ef321, PSL_RULE },
+    { "giessen.museum", 0x2cf77321, PSL_RULE },
+    { "fh.se", 0xadb4f323, PSL_RULE },
+    { "hsbc", 0x6663f323, PSL_RULE },
+    { "mil.sy", 0x67947325, PSL_RULE },
+    { "kuroiso.tochigi.jp", 0xc97eb326, PSL_RULE },
+    { "mq", 0x604c3323, PSL_RULE },
+    { "obninsk.su", 0x2fc03327, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.com.au", 0x2a7a332a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "paas.massivegrid.com", 0xb518f32d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "matsudo.chiba.jp", 0x5df0b32f, PSL_RULE },
+    { "now", 0x2be8f32f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.id.us", 0xc5563337, PSL_RULE },
+    { "lundbeck", 0x1c663337, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.fl.us", 0xb52c333a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cim.br", 0x6984b33c, PSL_RULE },
+    { "vevelstad.no", 0x4a0b333c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fem.jp", 0x5651b341, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rugby", 0xb0343344, PSL_RULE },
+    { "in-dsl.net", 0x1137f345, PSL_RULE },
+    { "lib.nh.us", 0xbc623346, PSL_RULE },
+    { "sc.cn", 0x18c2b346, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rocky.page", 0xd939734a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "inderoy.no", 0x3ea8f34c, PSL_RULE },
+    { "xn--ngbe9e0a", 0x5528b34c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "abruzzo.it", 0x730c334f, PSL_RULE },
+    { "agency", 0xb5693350, PSL_RULE },
+    { "gov.pk", 0x1e8b3350, PSL_RULE },
+    { "hirado.nagasaki.jp", 0x13be734f, PSL_RULE },
+    { "k12.wy.us", 0xc6773351, PSL_RULE },
+    { "katori.chiba.jp", 0x68253354, PSL_RULE },
+    { "nakamichi.yamanashi.jp", 0xd10ab351, PSL_RULE },
+    { "uslivinghistory.museum", 0xa1377354, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "canva-apps.cn", 0x7c36735a, PSL_RULE },
+    { "dnsalias.com", 0x9ff5f35b, PSL_RULE },
+    { "eun.eg", 0xda7d735b, PSL_RULE },
+    { "ggee", 0xb5ceb35d, PSL_RULE },
+    { "shima.mie.jp", 0xae70335e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "konsulat.gov.pl", 0xd59e3360, PSL_RULE },
+    { NULL, 0, 0 },
+    { "narusawa.yamanashi.jp", 0xce3e3362, PSL_RULE },
+    { NULL, 0, 0 },
+    { "alstahaug.no", 0xefdd7364, PSL_RULE },
+    { "dclk", 0x028db365, PSL_RULE },
+    { "hirara.okinawa.jp", 0x64063364, PSL_RULE },
+    { "agro.bo", 0x4a833367, PSL_RULE },
+    { "mypi.co", 0x160eb364, PSL_RULE },
+    { "mit", 0xc00af369, PSL_RULE },
+    { "naustdal.no", 0x41d8f36a, PSL_RULE },
+    { "or.bi", 0xef91b367, PSL_RULE },
+    { "lorenskog.no", 0x03a3336c, PSL_RULE },
+    { "honda", 0xabbd736d, PSL_RULE },
+    { "xn--nttery-byae.no", 0x16f4b36e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "6.bg", 0x1bd6f370, PSL_RULE },
+    { "intelligence.museum", 0x047af370, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kh", 0x663af374, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "barsy.menu", 0xa558b377, PSL_RULE },
+    { "west1-us.cloudjiffy.net", 0x02a1b378, PSL_RULE },
+    { "xn--k7yn95e.jp", 0x08447377, PSL_RULE },
+    { "land", 0xaa29f37a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "architectes.bj", 0x1f23737c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "altoadige.it", 0x5c1af380, PSL_RULE },
+    { "cloudns.us", 0x31d53381, PSL_RULE },
+    { "nom.pe", 0x7ee7f380, PSL_RULE },
+    { "gs.ah.no", 0xa6647383, PSL_RULE },
+    { "hidaka.wakayama.jp", 0x4891f383, PSL_RULE },
+    { "science", 0x45973381, PSL_RULE },
+    { "shoo.okayama.jp", 0x57467381, PSL_RULE },
+    { NULL, 0, 0 },
+    { "frontdoor", 0x979ef388, PSL_RULE },
+    { "nittedal.no", 0xf732b389, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eaton.mi.us", 0xbaffb38e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dlugoleka.pl", 0xc78c7395, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kiyama.saga.jp", 0xd3013397, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--czr694b", 0xf1973399, PSL_RULE },
+    { "lib.nd.us", 0xb650339a, PSL_RULE },
+    { "fukushima.fukushima.jp", 0x9eb5b39b, PSL_RULE },
+    { "namie.fukushima.jp", 0xf565339a, PSL_RULE },
+    { "sec.ps", 0x51be339d, PSL_RULE },
+    { "publ.pt", 0xf727b39e, PSL_RULE },
+    { "tim.it", 0x7ddd339a, 0 },
+    { "xn--w4rs40l", 0x9584339f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shika.ishikawa.jp", 0x4707b3a2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mima.tokushima.jp", 0x1851f3a4, PSL_RULE },
+    { "map", 0x5255f3a5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "inc", 0x118a33a7, PSL_RULE },
+    { "tab", 0x70b773a8, PSL_RULE },
+    { "cc.sc.us", 0x1cc6f3a9, PSL_RULE },
+    { "org.ml", 0x2d9eb3aa, PSL_RULE },
+    { NULL, 0, 0 },
+    { "parachuting.aero", 0xfc3b73ac, PSL_RULE },
+    { "xn--i1b6b1a6a2e", 0xef1433ad, PSL_RULE },
+    { "podzone.org", 0x594a73ae, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "furniture", 0xd978b3b1, PSL_RULE },
+    { "pi.it", 0x5b70b3b1, PSL_RULE },
+    { "realm.cz", 0xdbb633b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "debian.net", 0x2b14f3b5, PSL_RULE },
+    { "ichikawa.chiba.jp", 0x831a73b5, PSL_RULE },
+    { "is-into-cartoons.com", 0x89adb3b5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.vn", 0xa621b3bb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "store.st", 0xc47633bf, PSL_RULE },
+    { "bjugn.no", 0x187d73c0, PSL_RULE },
+    { "blogspot.com.mt", 0xac43f3c1, PSL_RULE },
+    { "gob.ve", 0x185a33c0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ar.it", 0x423833c5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "stage.nodeart.io", 0x9619f3ca, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "indigena.bo", 0x5398b3cd, PSL_RULE },
+    { "bond", 0xac2e73ce, PSL_RULE },
+    { "other.nf", 0xaf3ef3cd, PSL_RULE },
+    { "serveirc.com", 0xafe433cf, PSL_RULE },
+    { "coop.py", 0x6d86b3d1, PSL_RULE },
+    { "ventures", 0x3fc833cd, PSL_RULE },
+    { "vote", 0x27aef3cd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "okawa.kochi.jp", 0xb92c33d6, PSL_RULE },
+    { "com.gh", 0x326bb3d7, PSL_RULE },
+    { "statebank", 0x5c14b3d8, PSL_RULE },
+    { "uy.com", 0x33c5b3d6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "from-mo.com", 0x1aafb3db, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--rland-uua.no", 0x978f73e5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "aizuwakamatsu.fukushima.jp", 0x7d4533e7, PSL_RULE },
+    { "higashimatsushima.miyagi.jp", 0xd02033e8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "int.tj", 0x4a4c73ec, PSL_RULE },
+    { "spydeberg.no", 0x917333ed, PSL_RULE },
+    { "koto.shiga.jp", 0x2ce5f3ee, PSL_RULE },
+    { "engineer.aero", 0x2766b3ef, PSL_RULE },
+    { "tsumagoi.gunma.jp", 0x56df73f0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "is-a-photographer.com", 0xd9d373f2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.lv", 0x1f0b73f4, PSL_RULE },
+    { "eu.platform.sh", 0x370a33f5, PSL_RULE },
+    { "eng.pro", 0x2ab433f6, PSL_RULE },
+    { "k12.oh.us", 0xe45af3f4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bplaced.net", 0x599af3f9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hasama.oita.jp", 0x1558b3ff, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mihara.kochi.jp", 0xcd16b40d, PSL_RULE },
+    { "discordsez.com", 0x7c10f40e, PSL_RULE },
+    { "xxx", 0xcca4340f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nom.tm", 0xa346f414, PSL_RULE },
+    { "skaun.no", 0x55f7f414, PSL_RULE },
+    { "rag-cloud-ch.hosteur.com", 0xf01af416, PSL_RULE },
+    { "des.br", 0xe26e3417, PSL_RULE },
+    { "s3-website.eu-west-3.amazonaws.com", 0xdee8b417, PSL_RULE },
+    { "ot.it", 0x443cb419, PSL_RULE },
+    { "shop.ht", 0xe385f419, PSL_RULE },
+    { "withgoogle.com", 0xb16d3419, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "london.museum", 0x92c0341f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dyn.cosidns.de", 0x6edb7422, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ag", 0x40207425, PSL_RULE },
+    { "stor-elvdal.no", 0x54a4f425, PSL_RULE },
+    { NULL, 0, 0 },
+    { "voting", 0x48587428, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "morotsuka.miyazaki.jp", 0xc20ff42b, PSL_RULE },
+    { "a.se", 0x9c78742c, PSL_RULE },
+    { "com.ml", 0xe766b42d, PSL_RULE },
+    { "bihoro.hokkaido.jp", 0x340b742e, PSL_RULE },
+    { "opole.pl", 0xff89742c, PSL_RULE },
+    { "poniatowa.pl", 0x1229742d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "media.museum", 0xadfb7433, PSL_RULE },
+    { "gemological.museum", 0x05883434, PSL_RULE },
+    { "priv.at", 0xfc667433, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kamiizumi.saitama.jp", 0x60c27437, PSL_RULE },
+    { "kppsp.gov.pl", 0x362db437, PSL_RULE },
+    { "ovh.net", 0x905b7439, 0 },
+    { "barsy.org", 0x13a2b43a, PSL_RULE },
+    { "xn--bjddar-pta.no", 0x0d383439, PSL_RULE },
+    { "blogspot.tw", 0xd4f7f43c, PSL_RULE },
+    { "sciences.museum", 0x3227743c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "holiday", 0x79c63443, PSL_RULE },
+    { "xn--mgberp4a5d4a87g", 0xa7cd7443, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cri.br", 0xc512b447, PSL_RULE },
+    { "cc.pa.us", 0x13cff448, PSL_RULE },
+    { "home-webserver.de", 0xe849b447, PSL_RULE },
+    { "gliding.aero", 0x6ea6344a, PSL_RULE },
+    { "algard.no", 0x68c8f44b, PSL_RULE },
+    { "imdb", 0x10517449, PSL_RULE },
+    { "is-a-hunter.com", 0x973af44b, PSL_RULE },
+    { "jus.br", 0xf845b449, PSL_RULE },
+    { "maif", 0x96cff44a, PSL_RULE },
+    { "muko.kyoto.jp", 0xec71744d, PSL_RULE },
+    { "blogspot.mk", 0x5de5f451, PSL_RULE },
+    { "bi", 0x3d387452, PSL_RULE },
+    { "org.ht", 0x14ddf451, PSL_RULE },
+    { "net", 0xbd01f454, PSL_RULE },
+    { "dy.fi", 0x9957f455, PSL_RULE },
+    { "cc.md.us", 0x65bd7456, PSL_RULE },
+    { "sumy.ua", 0xf2eaf451, PSL_RULE },
+    { "xn--mgba3a4f16a", 0xbb1a744c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "siena.it", 0x4601f45a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kuokgroup", 0x9749f45e, PSL_RULE },
+    { "national.museum", 0xb5c0f45f, PSL_RULE },
+    { "kanazawa.ishikawa.jp", 0xdb2f7460, PSL_RULE },
+    { "tysvar.no", 0x285eb461, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--eveni-0qa01ga.no", 0x06d07465, PSL_RULE },
+    { NULL, 0, 0 },
+    { "cloud.interhostsolutions.be", 0x84e47467, PSL_RULE },
+    { "vfs.cloud9.sa-east-1.amazonaws.com", 0x3cd13468, PSL_RULE },
+    { NULL, 0, 0 },
+    { "wine", 0x9b27b46a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yasuda.kochi.jp", 0xee4d746e, PSL_RULE },
+    { "lesja.no", 0x7ed3346f, PSL_RULE },
+    { "us.eu.org", 0x2712b46f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloud9.eu-north-1.amazonaws.com", 0x30c3b473, 0 },
+    { "xn--4it168d.jp", 0x472e7473, PSL_RULE },
+    { NULL, 0, 0 },
+    { "haugesund.no", 0xc4d17476, PSL_RULE },
+    { "hashimoto.wakayama.jp", 0x2a6ff477, PSL_RULE },
+    { "uk.com", 0x3fa33478, PSL_RULE },
+    { "vega.no", 0xc0833479, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ebino.miyazaki.jp", 0xbbce747b, PSL_RULE },
+    { "gov.ls", 0x24c6347c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.gi", 0x7fa5f47f, PSL_RULE },
+    { "koeln", 0xa2ffb480, PSL_RULE },
+    { "servebbs.org", 0x83dd7481, PSL_RULE },
+    { "kunst.museum", 0x36fdb482, PSL_RULE },
+    { "vanguard", 0xa87cf483, PSL_RULE },
+    { "viajes", 0xe11b3483, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mulhouse.museum", 0x91067487, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mo", 0x64343489, PSL_RULE },
+    { "eiheiji.fukui.jp", 0x55de748a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "choyo.kumamoto.jp", 0x5752b48c, PSL_RULE },
+    { "scale.virtualcloud.com.br", 0x62c4b48c, 0 },
+    { "selfip.info", 0xb6c4f48c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "alabama.museum", 0x19453490, PSL_RULE },
+    { "open", 0x47c9f491, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "berg.no", 0xd9223494, PSL_RULE },
+    { "dapps.earth", 0xa3d97495, PSL_WILDCARD },
+    { "eu-1.evennode.com", 0x78d63496, PSL_RULE },
+    { "koka.shiga.jp", 0x2746b495, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--nqv7fs00ema", 0xd412f499, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.ae", 0x8573749b, PSL_RULE },
+    { "contact", 0x406df49b, PSL_RULE },
+    { "edu.mo", 0x4fe0749b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.to", 0x681f34a0, PSL_RULE },
+    { "raffleentry.org.uk", 0x57feb4a1, PSL_RULE },
+    { "sk.eu.org", 0x354ef4a1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hk", 0x3f3cf4a6, PSL_RULE },
+    { "takamori.nagano.jp", 0xe1a374a7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "otaki.chiba.jp", 0xa600f4aa, PSL_RULE },
+    { "kuchinotsu.nagasaki.jp", 0x77e234ab, PSL_RULE },
+    { NULL, 0, 0 },
+    { "elementor.cloud", 0x39d134ad, PSL_RULE },
+    { "box", 0xdc6bf4ae, PSL_RULE },
+    { "9guacu.br", 0xff96f4af, PSL_RULE },
+    { "611.to", 0x500474b0, PSL_RULE },
+    { "edu.ki", 0x7cb434af, PSL_RULE },
+    { "garden", 0xd31e74ae, PSL_RULE },
+    { "edu.ht", 0x018f34b3, PSL_RULE },
+    { "beppu.oita.jp", 0x3f9634b4, PSL_RULE },
+    { "geisei.kochi.jp", 0x328ab4b3, PSL_RULE },
+    { "hida.gifu.jp", 0xca5b34b6, PSL_RULE },
+    { "firm.co", 0x1efcb4b7, PSL_RULE },
+    { "phoenix.museum", 0x25d3b4b4, PSL_RULE },
+    { "flynnhosting.net", 0x625a34b9, PSL_RULE },
+    { "int.pt", 0xcdbb34ba, PSL_RULE },
+    { "com.mv", 0x896234bb, PSL_RULE },
+    { "pid", 0xeb62b4ba, PSL_RULE },
+    { "plaza.museum", 0x9f54b4ad, PSL_RULE },
+    { "utsira.no", 0x04fb74b6, PSL_RULE },
+    { "godo.gifu.jp", 0x106db4bf, PSL_RULE },
+    { "ui.nabu.casa", 0x21c6b4bf, PSL_RULE },
+    { "vegarshei.no", 0x6ea8b4be, PSL_RULE },
+    { "vladikavkaz.su", 0xd1e6f4ad, PSL_RULE },
+    { "oslo.no", 0x4032b4c3, PSL_RULE },
+    { "xj.cn", 0x29ab74ba, PSL_RULE },
+    { "xn--ksnes-uua.no", 0x9d07b4be, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--kpry57d", 0x320334c9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kariya.aichi.jp", 0x9cb234cc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "srcf.net", 0x00d6f4ce, 0 },
+    { "tuleap-partners.com", 0x52ce74cf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--brum-voa.no", 0x60f134d1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "schoolbus.jp", 0x38a634d3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-a-guru.com", 0xff75f4d8, PSL_RULE },
+    { "bible.museum", 0xacbaf4d9, PSL_RULE },
+    { "daisen.akita.jp", 0x547eb4d9, PSL_RULE },
+    { "gf", 0x6a22f4da, PSL_RULE },
+    { "rackmaze.com", 0x9b4a34d8, PSL_RULE },
+    { "handcrafted.jp", 0x7710f4dd, PSL_RULE },
+    { "edu.gl", 0x2f8474de, PSL_RULE },
+    { "blockbuster", 0xfd88b4df, PSL_RULE },
+    { "ca.it", 0x385cf4e0, PSL_RULE },
+    { "xn--cesena-forl-mcb.it", 0x616474da, PSL_RULE },
+    { "xn--xkc2al3hye2a", 0x5d7a34da, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ac.kr", 0xcc73b4e4, PSL_RULE },
+    { "ashiya.fukuoka.jp", 0x9f0334e4, PSL_RULE },
+    { "deci.jp", 0x5892b4e6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "keisen.fukuoka.jp", 0x1a7ab4ea, PSL_RULE },
+    { "vfs.cloud9.eu-west-2.amazonaws.com", 0x1d2a34eb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hakone.kanagawa.jp", 0xb8b274f2, PSL_RULE },
+    { "is.gov.pl", 0x68b474f3, PSL_RULE },
+    { "clickrising.net", 0xf03774f4, PSL_RULE },
+    { "paas.beebyte.io", 0xbb0034f4, PSL_RULE },
+    { "quickconnect.cn", 0xc1fa34f5, 0 },
+    { "maintenance.aero", 0x08a274f7, PSL_RULE },
+    { "seki.gifu.jp", 0x679e34f6, PSL_RULE },
+    { "shiga.jp", 0x41dbf4f3, PSL_RULE },
+    { "is-an-actress.com", 0x574834fa, PSL_RULE },
+    { "kamisato.saitama.jp", 0xbb0f74fa, PSL_RULE },
+    { "ozu.kumamoto.jp", 0x063a74fc, PSL_RULE },
+    { "bronnoysund.no", 0x34d2f4fd, PSL_RULE },
+    { "jc.neen.it", 0x8c8534fd, PSL_RULE },
+    { "shopware.store", 0x349a74ff, PSL_RULE },
+    { "silk.museum", 0xa58ab4f6, PSL_RULE },
+    { "biz.et", 0x0329f501, PSL_RULE },
+    { "tonosho.kagawa.jp", 0x098174f3, PSL_RULE },
+    { "7.bg", 0x1cd6f503, PSL_RULE },
+    { "us.org", 0x73e674f5, PSL_RULE },
+    { "xn--55qx5d.xn--j6w193g", 0x1279b502, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nishio.aichi.jp", 0x83ad3507, PSL_RULE },
+    { NULL, 0, 0 },
+    { "reit", 0x5c51b509, PSL_RULE },
+    { "odda.no", 0x4b24350a, PSL_RULE },
+    { "sango.nara.jp", 0xc7df3509, PSL_RULE },
+    { "com.qa", 0xc660b50c, PSL_RULE },
+    { "bellevue.museum", 0xc05c350d, PSL_RULE },
+    { "nis.za", 0x6320b50e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "beebyteapp.io", 0x6e02b512, 0 },
+    { "s3-eu-west-3.amazonaws.com", 0x1b357512, PSL_RULE },
+    { "tickets.io", 0xe6877512, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tsu.mie.jp", 0xc71bf516, PSL_RULE },
+    { "valle.no", 0x8b7e3516, PSL_RULE },
+    { "fr-par-1.baremetal.scw.cloud", 0xd1677518, PSL_RULE },
+    { "glas.museum", 0x48f1b518, PSL_RULE },
+    { "karaganda.su", 0x511b3519, PSL_RULE },
+    { "kongsberg.no", 0x8ea3f51a, PSL_RULE },
+    { "weir", 0xf745351c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "from-wy.com", 0x85a1f51f, PSL_RULE },
+    { "loginline.services", 0xb3597520, PSL_RULE },
+    { "cloud.nospamproxy.com", 0xf5b0f521, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "limo", 0xd05cb524, PSL_RULE },
+    { "denmark.museum", 0xb1d37525, PSL_RULE },
+    { "net.eg", 0xa3e87524, PSL_RULE },
+    { "cy.eu.org", 0x4d2af527, PSL_RULE },
+    { "taxi.br", 0x2c987525, PSL_RULE },
+    { "xn--mk0axi.hk", 0x5e6b7524, PSL_RULE },
+    { "statefarm", 0x68eff52a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "bill.museum", 0xa7ebb532, PSL_RULE },
+    { "ae.org", 0x5bb03533, PSL_RULE },
+    { "erni", 0x05977533, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mihama.fukui.jp", 0x09e47538, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "harvestcelebration.museum", 0xfad3753c, PSL_RULE },
+    { "obira.hokkaido.jp", 0x818fb53c, PSL_RULE },
+    { "edu.tm", 0x27c1353e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--frna-woa.no", 0xdca47541, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.cv", 0xab5ef544, PSL_RULE },
+    { "gov.ee", 0x902ef545, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "us-4.evennode.com", 0x66adf549, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "utazas.hu", 0x92e5754c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "er", 0x58547550, PSL_WILDCARD },
+    { "at.vg", 0x018ab551, PSL_RULE },
+    { "gs.nl.no", 0x8a35b550, PSL_RULE },
+    { "amune.org", 0xc3747553, 0 },
+    { "hagebostad.no", 0x9d9d3550, PSL_RULE },
+    { "org.la", 0xe4153550, PSL_RULE },
+    { "s3.dualstack.us-east-2.amazonaws.com", 0x756c3552, PSL_RULE },
+    { "s3.teckids.org", 0xf7e23556, PSL_RULE },
+    { "com.ye", 0x8c5d3558, PSL_RULE },
+    { "sakahogi.gifu.jp", 0x56ec7555, PSL_RULE },
+    { "station.museum", 0xfee2b553, PSL_RULE },
+    { "dj", 0x693f755b, PSL_RULE },
+    { "takasago.hyogo.jp", 0x16283550, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.tr", 0x890fb55f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "inzai.chiba.jp", 0x1cb27561, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tm.km", 0x5abc7564, PSL_RULE },
+    { "yasuoka.nagano.jp", 0x2b07f564, PSL_RULE },
+    { NULL, 0, 0 },
+    { "clerk.app", 0x5527f567, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kvam.no", 0x1412f56f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gs.aa.no", 0x160c7574, PSL_RULE },
+    { "annefrank.museum", 0xaaf1f575, PSL_RULE },
+    { "jambyl.su", 0x090b7574, PSL_RULE },
+    { "komatsushima.tokushima.jp", 0x69ccb574, PSL_RULE },
+    { "homedepot", 0xc9697578, PSL_RULE },
+    { "gotdns.ch", 0xe2b0b579, PSL_RULE },
+    { "groundhandling.aero", 0x1100757a, PSL_RULE },
+    { "mansion.museum", 0xf40c357a, PSL_RULE },
+    { "name.mk", 0x95f97578, PSL_RULE },
+    { "takatsuki.osaka.jp", 0x5cccf57b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fedorainfracloud.org", 0x17a2757f, PSL_RULE },
+    { "f.bg", 0xcbd67580, PSL_RULE },
+    { "wajima.ishikawa.jp", 0x3c743581, PSL_RULE },
+    { "int.mw", 0x080a3582, PSL_RULE },
+    { "sue.fukuoka.jp", 0x398db582, PSL_RULE },
+    { "xn--kprw13d", 0x2495757f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--12cfi8ixb8l.xn--o3cw4h", 0x2471758b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "int.tt", 0x1d5bf58e, PSL_RULE },
+    { "isa-geek.com", 0x6484758e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.ct.us", 0xa57c3591, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sciencecenter.museum", 0xa480b598, PSL_RULE },
+    { "banamex", 0x3a31f599, PSL_RULE },
+    { "from-nd.com", 0x2cc73599, PSL_RULE },
+    { "zentsuji.kagawa.jp", 0x1c3b3599, PSL_RULE },
+    { NULL, 0, 0 },
+    { "agdenes.no", 0x458e359d, PSL_RULE },
+    { "eurovision", 0x3cf1f59e, PSL_RULE },
+    { "goupile.fr", 0xd0fd759e, PSL_RULE },
+    { "airforce", 0xf4e975a0, PSL_RULE },
+    { "xn--sr-varanger-ggb.no", 0x7e6bf59f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--5rtq34k.jp", 0x2190b5a5, PSL_RULE },
+    { "dc.us", 0x6b0c35a6, PSL_RULE },
+    { "washtenaw.mi.us", 0x6bcd75a7, PSL_RULE },
+    { "ikawa.akita.jp", 0x7c33b5a8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.com.cy", 0x1c44f5ac, PSL_RULE },
+    { "edu.to", 0xf9b135ac, PSL_RULE },
+    { "protonet.io", 0x93e175ae, PSL_RULE },
+    { NULL, 0, 0 },
+    { "onl", 0x5753b5b0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "unzen.nagasaki.jp", 0x009375b6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ng", 0x412075b8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "frana.no", 0xc6c235bc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hamada.shimane.jp", 0x6778b5c0, PSL_RULE },
+    { "xn--mxtq1m.hk", 0x94cab5c0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rest", 0x01cdb5c7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "apigee.io", 0xceb7b5cc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dynalias.org", 0xb08635ce, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "empresa.bo", 0x29b835d1, PSL_RULE },
+    { "gov.lb", 0x33e775d1, PSL_RULE },
+    { "log.br", 0xc320b5d1, PSL_RULE },
+    { "project.museum", 0x27def5d2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gb.net", 0x430975d9, PSL_RULE },
+    { "edu.gh", 0xe9bf35da, PSL_RULE },
+    { "irish", 0x99daf5da, PSL_RULE },
+    { "mus.br", 0xf945b5dc, PSL_RULE },
+    { "nom.ad", 0x0433b5da, PSL_RULE },
+    { "com.sa", 0x975d35de, PSL_RULE },
+    { "blogspot.nl", 0xad46f5df, PSL_RULE },
+    { "otsu.shiga.jp", 0xe1e4f5da, PSL_RULE },
+    { "lukow.pl", 0x4dfef5e1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "aurskog-holand.no", 0x986775e3, PSL_RULE },
+    { "fi.cr", 0xd88cf5e3, PSL_RULE },
+    { "ci", 0x3e3875e5, PSL_RULE },
+    { "ooo", 0xa42935e4, PSL_RULE },
+    { "firenze.it", 0x31d7f5e7, PSL_RULE },
+    { "kaneyama.yamagata.jp", 0x4dc975e7, PSL_RULE },
+    { "vlog.br", 0xd37df5e5, PSL_RULE },
+    { "showa.yamanashi.jp", 0x6905f5ea, PSL_RULE },
+    { "theater", 0x3458b5ea, PSL_RULE },
+    { "xn--sknit-yqa.no", 0x139675eb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vefsn.no", 0x956f35ee, PSL_RULE },
+    { NULL, 0, 0 },
+    { "oy.lc", 0x8a4035f0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shibecha.hokkaido.jp", 0x940e75f2, PSL_RULE },
+    { "ivgu.no", 0x9046b5f3, PSL_RULE },
+    { "mil.pe", 0x310bb5f4, PSL_RULE },
+    { "aw", 0x6047b5f5, PSL_RULE },
+    { "folionetwork.site", 0x4fa0b5f5, PSL_RULE },
+    { "fuchu.toyama.jp", 0x5c7775f7, PSL_RULE },
+    { "augustow.pl", 0xb35735f8, PSL_RULE },
+    { "kai.yamanashi.jp", 0xa1c2f5f9, PSL_RULE },
+    { "ne.pw", 0xe77cf5f7, PSL_RULE },
+    { "vip.jelastic.cloud", 0x319775f2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.me", 0x5bc435fd, PSL_RULE },
+    { "direct.quickconnect.cn", 0x0cde35fe, PSL_RULE },
+    { "magentosite.cloud", 0xac44b5fe, PSL_WILDCARD },
+    { "it.hs-heilbronn.de", 0x0c577600, 0 },
+    { "oygarden.no", 0x575075fd, PSL_RULE },
+    { "search", 0xf3b175fd, PSL_RULE },
+    { "xn--bjarky-fya.no", 0xf6f53600, PSL_RULE },
+    { "xn--slat-5na.no", 0xae603601, PSL_RULE },
+    { "edu.cw", 0x9eec3605, PSL_RULE },
+    { "gov.dm", 0x7ba73606, PSL_RULE },
+    { "hoteles", 0x2cb4f605, PSL_RULE },
+    { "xn--zf0ao64a.tw", 0x4e40f5ff, PSL_RULE },
+    { "dualstack.ap-northeast-1.amazonaws.com", 0xf6bef609, 0 },
+    { NULL, 0, 0 },
+    { "lib.ne.us", 0x1e83760b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "zgora.pl", 0x2779f60e, PSL_RULE },
+    { "poznan.pl", 0x4eabb60f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "appchizi.com", 0x41a5b612, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sande.xn--mre-og-romsdal-qqb.no", 0x0e18f614, PSL_RULE },
+    { NULL, 0, 0 },
+    { "snasa.no", 0x498af616, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "anani.br", 0x43b0761c, PSL_RULE },
+    { "jo", 0x6534361c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "flap.id", 0x360db621, PSL_RULE },
+    { "by", 0x5d5fb622, PSL_RULE },
+    { "takino.hyogo.jp", 0x24517623, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gliwice.pl", 0x9112f625, PSL_RULE },
+    { NULL, 0, 0 },
+    { "charter.aero", 0x77f5b627, PSL_RULE },
+    { "ostfold.no", 0x94d4f627, 0 },
+    { NULL, 0, 0 },
+    { "kiwa.mie.jp", 0x4147b62a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.cm", 0x32b5f62c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "twmail.net", 0x0da3b630, PSL_RULE },
+    { "muni.il", 0x97d53631, PSL_RULE },
+    { "gouv.fr", 0x2f1a3632, PSL_RULE },
+    { "namegawa.saitama.jp", 0xa2e4b632, PSL_RULE },
+    { "wada.nagano.jp", 0x4ae67634, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "macys", 0x36ffb638, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shikabe.hokkaido.jp", 0xcc9b363a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "port.fr", 0xe453763c, PSL_RULE },
+    { "birthplace.museum", 0x8a96763d, PSL_RULE },
+    { "kami.miyagi.jp", 0xafa1b63d, PSL_RULE },
+    { "render.com", 0xa2ab363c, 0 },
+    { NULL, 0, 0 },
+    { "gs.tm.no", 0x6746f641, PSL_RULE },
+    { NULL, 0, 0 },
+    { "onflashdrive.app", 0x47b77643, PSL_RULE },
+    { "edu.sn", 0x248f3644, PSL_RULE },
+    { "mil.mz", 0x1e727644, PSL_RULE },
+    { "new", 0x0bd9b645, PSL_RULE },
+    { "online.th", 0x9d52b644, PSL_RULE },
+    { "tech.orange", 0xe494f643, PSL_RULE },
+    { "xn--muost-0qa.no", 0xa4463649, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.education", 0xa616b64b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.et", 0xb6d6764d, PSL_RULE },
+    { "embroidery.museum", 0x6e2b364d, PSL_RULE },
+    { "ftr", 0x44cfb64f, PSL_RULE },
+    { "stalowa-wola.pl", 0x8b9c3650, PSL_RULE },
+    { "xn--io0a7i.hk", 0x85c33651, PSL_RULE },
+    { "accesscam.org", 0xd406b652, PSL_RULE },
+    { NULL, 0, 0 },
+    { "convent.museum", 0x65b7b654, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.tz", 0x7d1bb659, PSL_RULE },
+    { "akabira.hokkaido.jp", 0x3569b65a, PSL_RULE },
+    { "from-ca.com", 0x13fbf65b, PSL_RULE },
+    { "hamaroy.no", 0x5d02b65b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "scienceandindustry.museum", 0xf7653662, PSL_RULE },
+    { "iron.museum", 0x3b6e7663, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hippy.jp", 0x70637667, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "guru", 0xf0aaf66a, PSL_RULE },
+    { "tahara.aichi.jp", 0xb8dfb66a, PSL_RULE },
+    { "post.in", 0x4197f66c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "goodyear", 0x32ac3671, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ba.it", 0x395cf673, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fresenius", 0xd1207675, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aetna", 0xe3443678, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "porsanger.no", 0x7dbc767b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "francaise.museum", 0x4018367d, PSL_RULE },
+    { "tunk.org", 0xbc54b67d, PSL_RULE },
+    { "valleaosta.it", 0xc17ef67e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "from-vt.com", 0xd385b681, PSL_RULE },
+    { "gob.bo", 0x4926f682, PSL_RULE },
+    { "shoes", 0x650ef683, PSL_RULE },
+    { "co.st", 0x9693f684, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "drive", 0xd2d6f687, PSL_RULE },
+    { "xn--5dbhl8d.xn--4dbrk0ce", 0x15a93687, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sannohe.aomori.jp", 0xf094368c, PSL_RULE },
+    { "xyz", 0xa3a9768c, PSL_RULE },
+    { "com.ms", 0x1dfb768e, PSL_RULE },
+    { "hammarfeasta.no", 0x21dcf68e, PSL_RULE },
+    { "rovigo.it", 0xd4dc3690, PSL_RULE },
+    { "goog", 0xfd603691, PSL_RULE },
+    { "info.la", 0xb3b93692, PSL_RULE },
+    { "xn--mgbaakc7dvf", 0xe132368e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "val-d-aosta.it", 0x1fcbb695, PSL_RULE },
+    { "4.bg", 0x1dd6f696, PSL_RULE },
+    { "rec.ve", 0x91f53696, PSL_RULE },
+    { "diadem.cloud", 0x8eb9f698, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kilatiron.com", 0x5e12769f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hokkaido.jp", 0x48fdb6a3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "conf.lv", 0x6b1236a5, PSL_RULE },
+    { "name.hr", 0x9753f6a6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "pro.tt", 0x1651b6a8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "noda.chiba.jp", 0x861476ac, PSL_RULE },
+    { "ssl.fastly.net", 0x74d9b6ad, 0 },
+    { "sdscloud.pl", 0x400076ae, PSL_RULE },
+    { "ca.eu.org", 0x3d3ff6af, PSL_RULE },
+    { "jele.io", 0x65fd36af, PSL_RULE },
+    { "123miweb.es", 0xb17976b1, PSL_RULE },
+    { "makeup", 0x956936b0, PSL_RULE },
+    { "sci.eg", 0x2d3d36b2, PSL_RULE },
+    { "hiratsuka.kanagawa.jp", 0xd7c236b4, PSL_RULE },
+    { "online", 0x805676b4, PSL_RULE },
+    { "showa.fukushima.jp", 0x722036b4, PSL_RULE },
+    { "trentinoalto-adige.it", 0x7b4db6b4, PSL_RULE },
+    { "yamakita.kanagawa.jp", 0xd87676b3, PSL_RULE },
+    { "yokawa.hyogo.jp", 0x321436af, PSL_RULE },
+    { "agric.za", 0x2ed5b6ba, PSL_RULE },
+    { "beeldengeluid.museum", 0xaed7f6ba, PSL_RULE },
+    { "s3-website-sa-east-1.amazonaws.com", 0xa59f76bc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "iiyama.nagano.jp", 0xdb88f6bf, PSL_RULE },
+    { "ybo.science", 0xd914f6bf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kasuga.hyogo.jp", 0x2e95b6c3, PSL_RULE },
+    { "s3.dualstack.ap-northeast-1.amazonaws.com", 0xddf3b6c3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.ci", 0xa675b6c7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "homeip.net", 0xb2ecf6cc, PSL_RULE },
+    { "api.gov.uk", 0x8d2f36cd, PSL_RULE },
+    { "juegos", 0x7292b6cc, PSL_RULE },
+    { "name.et", 0xef4936cd, PSL_RULE },
+    { "gov.bm", 0x576176d0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--tiq49xqyj", 0xe12bb6d2, PSL_RULE },
+    { "bt", 0x374536d3, PSL_RULE },
+    { "larvik.no", 0x9bab36d3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vi.it", 0x5d70b6d7, PSL_RULE },
+    { "jeju.kr", 0x384eb6d8, PSL_RULE },
+    { "xn--elqq16h.jp", 0x47ebf6d9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ye", 0x4c1a76db, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "itano.tokushima.jp", 0x7773b6df, PSL_RULE },
+    { "ichikai.tochigi.jp", 0x31e536e0, PSL_RULE },
+    { "k12.tx.us", 0xf71476e1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "diher.solutions", 0x5e4776e3, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "ga.us", 0x6a07b6e5, PSL_RULE },
+    { "kaszuby.pl", 0xf4c4b6e6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.mw", 0xe88d36ea, PSL_RULE },
+    { "or.it", 0x443836eb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "heguri.nara.jp", 0x80d676ed, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rebun.hokkaido.jp", 0x022fb6ef, PSL_RULE },
+    { "yatsuka.shimane.jp", 0xfa0776f0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hikone.shiga.jp", 0x28e0b6f3, PSL_RULE },
+    { "help", 0xd9d4f6f4, PSL_RULE },
+    { "hiroo.hokkaido.jp", 0x2d07b6f4, PSL_RULE },
+    { "co.com", 0x3d9a36f6, PSL_RULE },
+    { "shinagawa.tokyo.jp", 0x55c2b6f6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "caravan", 0x95d9f6f9, PSL_RULE },
+    { "kherson.ua", 0xf1d3b6f9, PSL_RULE },
+    { "vestfold.no", 0x9c30b6f9, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "management", 0x3f2d3704, PSL_RULE },
+    { "homeftp.net", 0x034db705, PSL_RULE },
+    { "s3-website.ca-central-1.amazonaws.com", 0x5bda3705, PSL_RULE },
+    { "td", 0x4d1cb705, PSL_RULE },
+    { "xn--bhcavuotna-s4a.no", 0x101bb704, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pupu.jp", 0x69b0370b, PSL_RULE },
+    { "com.kw", 0xd08b770c, PSL_RULE },
+    { "hra.health", 0x3e4f770c, PSL_RULE },
+    { "iruma.saitama.jp", 0x711d770d, PSL_RULE },
+    { "okagaki.fukuoka.jp", 0xf572370c, PSL_RULE },
+    { "sandvikcoromant", 0xde66370e, PSL_RULE },
+    { "i.ng", 0x8685f711, PSL_RULE },
+    { "reviews", 0xb5577712, PSL_RULE },
+    { "g.bg", 0xccd67713, PSL_RULE },
+    { "massivegrid.net", 0xc7027714, 0 },
+    { "traeumtgerade.de", 0xd00e7712, PSL_RULE },
+    { "dynamisches-dns.de", 0x51fb3716, PSL_RULE },
+    { "urbinopesaro.it", 0xdfadb70b, PSL_RULE },
+    { "gov.gr", 0x1153f718, PSL_RULE },
+    { "hiv", 0x70123718, PSL_RULE },
+    { "yn.cn", 0x22b5f711, PSL_RULE },
+    { "ayabe.kyoto.jp", 0x8bb4771b, PSL_RULE },
+    { "rindal.no", 0x8720771c, PSL_RULE },
+    { "steam.museum", 0x9949771b, PSL_RULE },
+    { "test-iserv.de", 0x7062b71c, PSL_RULE },
+    { "org.ws", 0x28d5371f, PSL_RULE },
+    { "ap.gov.pl", 0x60bcb720, PSL_RULE },
+    { "xn--d5qv7z876c.jp", 0x5f47371e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "macerata.it", 0xd49bb724, PSL_RULE },
+    { "oshino.yamanashi.jp", 0xb3537724, PSL_RULE },
+    { "se.net", 0x4f05b726, PSL_RULE },
+    { "123hjemmeside.no", 0x981cb727, PSL_RULE },
+    { "web.za", 0x1205b726, PSL_RULE },
+    { "costume.museum", 0xb7d07729, PSL_RULE },
+    { "skjak.no", 0xd70ab72a, PSL_RULE },
+    { "trentinsud-tirol.it", 0x4f22f72b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "from-pr.com", 0xedf6f72d, PSL_RULE },
+    { "co.cz", 0xad43772e, PSL_RULE },
+    { "hasami.nagasaki.jp", 0xa7e6b72d, PSL_RULE },
+    { "is-not-certified.com", 0xa50d7730, PSL_RULE },
+    { "torino.it", 0x2b9a772d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lu", 0x5f433734, PSL_RULE },
+    { "ando.nara.jp", 0x6318f735, PSL_RULE },
+    { "arteducation.museum", 0x44083736, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "info.ke", 0x6d1a3739, PSL_RULE },
+    { "bolivia.bo", 0x35aff73a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "eigersund.no", 0xfe8b373c, PSL_RULE },
+    { "hosting", 0xaf3bf73d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vologda.su", 0x46be373f, PSL_RULE },
+    { "from-in.com", 0x73f2b740, PSL_RULE },
+    { "xn--valle-aoste-ebb.it", 0x06237741, PSL_RULE },
+    { "college", 0x34223742, PSL_RULE },
+    { "ascolipiceno.it", 0xcc06f743, PSL_RULE },
+    { "it.eu.org", 0x2323f744, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "soc.lk", 0xa4717747, PSL_RULE },
+    { "now-dns.top", 0xdc29f748, PSL_RULE },
+    { "skierva.no", 0x25c27749, PSL_RULE },
+    { "gov.ng", 0x3e27f74a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "c.se", 0x9e787752, PSL_RULE },
+    { "jolster.no", 0x1de43753, PSL_RULE },
+    { "barletta-trani-andria.it", 0xe7527754, PSL_RULE },
+    { "knx-server.net", 0xb257f755, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ino.kochi.jp", 0x77fbf757, PSL_RULE },
+    { "kfh", 0xe5b23758, PSL_RULE },
+    { "veneto.it", 0xaa9bb757, PSL_RULE },
+    { "x.mythic-beasts.com", 0x04d8f757, PSL_RULE },
+    { NULL, 0, 0 },
+    { "higashiyama.kyoto.jp", 0x98a1f75c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--gnstigliefern-wob.de", 0x5662375e, PSL_RULE },
+    { "immo", 0xd565b75f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "journalist.aero", 0xbe81b763, PSL_RULE },
+    { "org.ye", 0x363a3763, PSL_RULE },
+    { "from-mi.com", 0xabd03765, PSL_RULE },
+    { "pb.ao", 0x286e7763, PSL_RULE },
+    { "production.aero", 0x55d8b765, PSL_RULE },
+    { "mil.rw", 0xb0c77768, PSL_RULE },
+    { "east-kazakhstan.su", 0x145c7769, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lidl", 0x97163770, PSL_RULE },
+    { "vallee-aoste.it", 0x31507770, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "from-wv.com", 0xada03776, PSL_RULE },
+    { NULL, 0, 0 },
+    { "co.rw", 0x2dda7778, PSL_RULE },
+    { "li", 0x3f387778, PSL_RULE },
+    { NULL, 0, 0 },
+    { "onrender.com", 0x4bc0f77b, PSL_RULE },
+    { "immobilien", 0x7fc6777c, PSL_RULE },
+    { "sapporo.jp", 0xcfd6777b, PSL_WILDCARD },
+    { "pilot.aero", 0x8f5f377e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edgecompute.app", 0xf5eb7780, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ap.leg.br", 0x3c767784, PSL_RULE },
+    { NULL, 0, 0 },
+    { "office-on-the.net", 0x122e3786, PSL_RULE },
+    { "bukhara.su", 0x0a5ef787, PSL_RULE },
+    { "oguni.kumamoto.jp", 0x59857788, PSL_RULE },
+    { "post", 0xffe5b787, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.fm", 0x8ccab78b, PSL_RULE },
+    { "lima-city.rocks", 0xdf47f78c, PSL_RULE },
+    { "cloud9.eu-central-1.amazonaws.com", 0x2451b78d, 0 },
+    { "himi.toyama.jp", 0xa074f78d, PSL_RULE },
+    { "eu-west-2.elasticbeanstalk.com", 0x4811f78f, PSL_RULE },
+    { "ibigawa.gifu.jp", 0x4ef8b790, PSL_RULE },
+    { "oyama.tochigi.jp", 0x0c78378f, PSL_RULE },
+    { "sayama.saitama.jp", 0xdc16f78b, PSL_RULE },
+    { "sv.it", 0x48413793, PSL_RULE },
+    { "tourism.pl", 0xb3067792, PSL_RULE },
+    { "eidfjord.no", 0x34b5f795, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cz.eu.org", 0x25287798, PSL_RULE },
+    { "med.ly", 0xd45df798, PSL_RULE },
+    { "lillehammer.no", 0x610fb79a, PSL_RULE },
+    { "oizumi.gunma.jp", 0xdd15b798, PSL_RULE },
+    { "shimoji.okinawa.jp", 0x282db798, PSL_RULE },
+    { "unnan.shimane.jp", 0xe71d779a, PSL_RULE },
+    { "clinton.museum", 0xfeee779e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "emiliaromagna.it", 0xc811b7a0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "free", 0xc6b2f7a3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gamagori.aichi.jp", 0xa4b137a6, PSL_RULE },
+    { "org.ru", 0x2b1eb7a6, PSL_RULE },
+    { "mini", 0x2db1f7a8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fujikawa.shizuoka.jp", 0x443d37ab, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "js.cn", 0x11e9b7b1, PSL_RULE },
+    { "xn--ryrvik-bya.no", 0xad09b7b2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cy", 0x5e5fb7b5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.hu", 0x28dd77b8, PSL_RULE },
+    { "webview-assets.cloud9.eu-west-3.amazonaws.com", 0x76b5f7b8, PSL_RULE },
+    { "wanouchi.gifu.jp", 0xc2b837ba, PSL_RULE },
+    { "forsand.no", 0xb75537bb, PSL_RULE },
+    { "leczna.pl", 0x9142b7bc, PSL_RULE },
+    { "museumvereniging.museum", 0xd85377bb, PSL_RULE },
+    { "lat", 0x9ef737be, PSL_RULE },
+    { "co.mg", 0x1c40b7bf, PSL_RULE },
+    { "blogspot.com.eg", 0x3c34f7c0, PSL_RULE },
+    { "north.museum", 0xd76637bc, PSL_RULE },
+    { "srv.br", 0x05f8b7c2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "moscow", 0xeeb237c5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "uk.eu.org", 0x374ef7c7, PSL_RULE },
+    { "space-to-rent.com", 0xbe86b7c8, PSL_RULE },
+    { "regruhosting.ru", 0x6bcbb7c9, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "georgia.su", 0x10b6b7cf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gen.nz", 0x36cd37d1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "minami.fukuoka.jp", 0x4a3ef7d4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mil.cn", 0x4b4477d6, PSL_RULE },
+    { "southcarolina.museum", 0xbcf3b7d7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "int.lk", 0xbbf1b7d9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.kp", 0xc11477db, PSL_RULE },
+    { "cruises", 0x06fdf7db, PSL_RULE },
+    { "beta.bounty-full.com", 0xbf0ff7dd, PSL_RULE },
+    { "bigv.io", 0x45c6b7dd, 0 },
+    { "delta", 0xca0eb7dd, PSL_RULE },
+    { "edu.ac", 0x4cd7b7db, PSL_RULE },
+    { "from-ct.com", 0x1710f7dc, PSL_RULE },
+    { "fukui.fukui.jp", 0x4d7937df, PSL_RULE },
+    { "guernsey.museum", 0x565437e3, PSL_RULE },
+    { "netlify.app", 0xd0c8b7e3, PSL_RULE },
+    { "oi.kanagawa.jp", 0x6223b7e2, PSL_RULE },
+    { "opensocial.site", 0xbbb3b7e3, PSL_RULE },
+    { "skien.no", 0x493eb7dc, PSL_RULE },
+    { "cq.cn", 0x38e577e8, PSL_RULE },
+    { "parts", 0xed0777e9, PSL_RULE },
+    { "transport.museum", 0xabec37de, PSL_RULE },
+    { "tako.chiba.jp", 0x835637eb, PSL_RULE },
+    { "freesite.host", 0x1980b7ec, PSL_RULE },
+    { "trysil.no", 0xec8e77db, PSL_RULE },
+    { "xn--lten-gra.no", 0x421a77dc, PSL_RULE },
+    { "campinagrande.br", 0xffb5b7ef, PSL_RULE },
+    { "filegear.me", 0x472137f0, PSL_RULE },
+    { "miyama.fukuoka.jp", 0x3065b7f1, PSL_RULE },
+    { "blogspot.mr", 0x564cf7f2, PSL_RULE },
+    { "limanowa.pl", 0x2afd37f3, PSL_RULE },
+    { "aseral.no", 0xc2d1b7f4, PSL_RULE },
+    { "roma.museum", 0xe07837f2, PSL_RULE },
+    { "sc", 0x462977f3, PSL_RULE },
+    { "cc.wy.us", 0x27af77f7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "assassination.museum", 0x379837f9, PSL_RULE },
+    { "agents.aero", 0x488af7fa, PSL_RULE },
+    { "travelersinsurance", 0x1d15f7f9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ohira.tochigi.jp", 0x27b2b7fd, PSL_RULE },
+    { "cbn", 0x149737fe, PSL_RULE },
+    { "stordal.no", 0x8c4477fd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "umig.gov.pl", 0x3e6a3801, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ing", 0x57197803, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kakamigahara.gifu.jp", 0xa4a43806, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ternopil.ua", 0x6e9c7808, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "prod.thingdust.io", 0x9a7cf80c, 0 },
+    { NULL, 0, 0 },
+    { "credit", 0x744ab80e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nyan.to", 0x5d48b812, PSL_RULE },
+    { "xn--trentinosdtirol-7vb.it", 0x9c50f812, PSL_RULE },
+    { NULL, 0, 0 },
+    { "zp.ua", 0x7aef7815, PSL_RULE },
+    { "xn--bearalvhki-y4a.no", 0xf2603816, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tokashiki.okinawa.jp", 0xde21381a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "s5y.io", 0x2834381c, PSL_WILDCARD },
+    { "academia.bo", 0x816fb81d, PSL_RULE },
+    { "lotto", 0xa37fb81d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fiat", 0x1939b821, PSL_RULE },
+    { "transurl.nl", 0x68bd3822, PSL_WILDCARD },
+    { "konyvelo.hu", 0xfa3ab823, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sarl", 0xd5ef3827, PSL_RULE },
+    { NULL, 0, 0 },
+    { "5.bg", 0x1ed6f829, PSL_RULE },
+    { "fujinomiya.shizuoka.jp", 0x6eaf782a, PSL_RULE },
+    { "azimuth.network", 0x5458782b, PSL_RULE },
+    { "nagato.yamaguchi.jp", 0x8dc3382b, PSL_RULE },
+    { "orange", 0xe245f82b, PSL_RULE },
+    { "org.az", 0x0f4cf82c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "higashiizu.shizuoka.jp", 0xd29f7832, PSL_RULE },
+    { "village.museum", 0x0f487833, PSL_RULE },
+    { "philadelphia.museum", 0xd3637834, PSL_RULE },
+    { "bestbuy", 0x86827835, PSL_RULE },
+    { "barcelona", 0x2e2ab836, PSL_RULE },
+    { "tokushima.jp", 0xa8423836, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lakas.hu", 0x5a74f83a, PSL_RULE },
+    { "com.sh", 0xc238783b, PSL_RULE },
+    { "wuoz.gov.pl", 0x09ac783c, PSL_RULE },
+    { "kiyosu.aichi.jp", 0xa635b83d, PSL_RULE },
+    { "xn--80ao21a", 0x14cf383b, PSL_RULE },
+    { "field.museum", 0x1497b83f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eur.aruba.jenv-aruba.cloud", 0x717bb842, 0 },
+    { "info.pr", 0xb1deb843, PSL_RULE },
+    { "jele.site", 0xf37d3844, PSL_RULE },
+    { "net.nz", 0x1e5f7844, PSL_RULE },
+    { "or.jp", 0x9db77844, PSL_RULE },
+    { "reservd.com", 0x17e67843, PSL_RULE },
+    { "storfjord.no", 0x15d6f843, PSL_RULE },
+    { "xn--forlcesena-c8a.it", 0x0a20b845, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.kz", 0xc101384d, PSL_RULE },
+    { "akamai-staging.net", 0x22f2f84e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--d1acj3b", 0x3333b851, PSL_RULE },
+    { "kimitsu.chiba.jp", 0x90e6b852, PSL_RULE },
+    { "go.ke", 0xc29db853, PSL_RULE },
+    { NULL, 0, 0 },
+    { "info.gu", 0x34137855, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "masuda.shimane.jp", 0x8d64b859, PSL_RULE },
+    { "xn--yfro4i67o", 0x2706b85a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "taira.toyama.jp", 0x37afb85d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.iq", 0xbaf0785f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cri.nz", 0xaf8af863, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "at", 0x38453866, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mywire.org", 0x4849b868, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "2000.hu", 0xd300786c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.im", 0xa7e3b86e, PSL_RULE },
+    { "from-wi.com", 0x42c0386f, PSL_RULE },
+    { "jotelulu.cloud", 0x0ce5f870, PSL_RULE },
+    { "2ix.ch", 0xcd7ab871, PSL_RULE },
+    { "ezproxy.kuleuven.be", 0x2d4f3872, PSL_RULE },
+    { "skedsmo.no", 0x39207872, PSL_RULE },
+    { "vestre-toten.no", 0xbba3f874, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gr", 0x5a547876, PSL_RULE },
+    { "hirata.fukushima.jp", 0xee83f877, PSL_RULE },
+    { "onga.fukuoka.jp", 0xb99df878, PSL_RULE },
+    { "xn--j1aef", 0xab57f878, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ayagawa.kagawa.jp", 0xb24d787c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "omihachiman.shiga.jp", 0x6540387f, PSL_RULE },
+    { "pcloud.host", 0xd2b27880, PSL_RULE },
+    { "atsugi.kanagawa.jp", 0x7cb2b881, PSL_RULE },
+    { "fj", 0x6b3f7881, PSL_RULE },
+    { "meraker.no", 0x4d993881, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blog.vu", 0x48b1b888, PSL_RULE },
+    { "hanyu.saitama.jp", 0xb0caf888, PSL_RULE },
+    { "kazimierz-dolny.pl", 0x1e59788a, PSL_RULE },
+    { "tn.us", 0x892cb88b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cologne", 0x4e3c388e, PSL_RULE },
+    { "ddnslive.com", 0xb935388f, PSL_RULE },
+    { "kv.ua", 0x81e07890, PSL_RULE },
+    { NULL, 0, 0 },
+    { "toolforge.org", 0x21c4b892, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--ehqz56n.jp", 0x7c377894, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mmafan.biz", 0xf4f77896, PSL_RULE },
+    { "ng.eu.org", 0x40447896, PSL_RULE },
+    { "hashbang.sh", 0x9f427898, PSL_RULE },
+    { NULL, 0, 0 },
+    { "homeoffice.gov.uk", 0x856ef89a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "brussels.museum", 0xe52b789e, PSL_RULE },
+    { "org.sg", 0x5780b89f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "research.aero", 0x79fb78a3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "d.bg", 0xcdd678a6, PSL_RULE },
+    { "jorpeland.no", 0xc69438a7, PSL_RULE },
+    { "aeg", 0x5f0cb8a8, PSL_RULE },
+    { "s3-website-us-west-2.amazonaws.com", 0x8143b8a9, PSL_RULE },
+    { "site.tb-hosting.com", 0xdf9df8a6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "otsuki.kochi.jp", 0x6bbd38ac, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hanawa.fukushima.jp", 0xf9c238ae, PSL_RULE },
+    { NULL, 0, 0 },
+    { "firm.ve", 0x052af8b0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "olayangroup", 0xef95b8b2, PSL_RULE },
+    { "rana.no", 0x986c78b2, PSL_RULE },
+    { "engineering", 0x992038b4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "med.ee", 0xa1a9f8b7, PSL_RULE },
+    { "u.channelsdvr.net", 0x103fb8b7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "servegame.com", 0xf355b8bd, PSL_RULE },
+    { "brasil.museum", 0xe67b38be, PSL_RULE },
+    { "dev.static.land", 0x2c2678bf, PSL_RULE },
+    { "rsvp", 0x26d2b8be, PSL_RULE },
+    { "austevoll.no", 0x1fe1b8c1, PSL_RULE },
+    { "odessa.ua", 0x110eb8c2, PSL_RULE },
+    { "shiraoka.saitama.jp", 0xe97fb8bf, PSL_RULE },
+    { "textile.museum", 0xf33d78c2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "s3-website.ap-northeast-2.amazonaws.com", 0x373a78c6, PSL_RULE },
+    { "mu", 0x604338c7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bip.sh", 0x5f3c78c9, PSL_RULE },
+    { "uozu.toyama.jp", 0x59f138c9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "biz.zm", 0x59e638cd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fund", 0xa047f8d0, PSL_RULE },
+    { "kitamoto.saitama.jp", 0xd4a238d1, PSL_RULE },
+    { "aosta.it", 0xa0b5b8d2, PSL_RULE },
+    { "fbx-os.fr", 0x0837b8d2, PSL_RULE },
+    { "bsb.br", 0xa2efb8d4, PSL_RULE },
+    { "firewalledreplit.co", 0x662b38d4, PSL_RULE },
+    { "his.name", 0x0d6678d6, 0 },
+    { "my-firewall.org", 0x4ee0f8d2, PSL_RULE },
+    { "pordenone.it", 0x152ab8d8, PSL_RULE },
+    { "topology.museum", 0xf10af8d6, PSL_RULE },
+    { "xn--lgrd-poac.no", 0x4e4938d1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "asahi.chiba.jp", 0x89fe38dc, PSL_RULE },
+    { "juniper", 0xf9cf78dc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "logistics.aero", 0xe0f278df, PSL_RULE },
+    { "ac.ru", 0x607e78e0, PSL_RULE },
+    { "gangwon.kr", 0x3805b8e1, PSL_RULE },
+    { "weeklylottery.org.uk", 0x7eb278df, PSL_RULE },
+    { "izu.shizuoka.jp", 0xa435b8e3, PSL_RULE },
+    { "localhost.daplie.me", 0xb5cab8e3, PSL_RULE },
+    { "b.se", 0x9f7878e5, PSL_RULE },
+    { "net.et", 0x0aaaf8e3, PSL_RULE },
+    { "goip.de", 0xb35d38e7, PSL_RULE },
+    { "uk.oxa.cloud", 0x984ef8e8, PSL_RULE },
+    { "historicalsociety.museum", 0xb69e38e9, PSL_RULE },
+    { "santamaria.br", 0x8f4ab8ea, PSL_RULE },
+    { "reisen", 0x439a78eb, PSL_RULE },
+    { "ric.jelastic.vps-host.net", 0xa1adb8eb, PSL_RULE },
+    { "s3.dualstack.eu-west-1.amazonaws.com", 0xfa9638ed, PSL_RULE },
+    { "watson.jp", 0x4a42f8e7, PSL_RULE },
+    { "web.co", 0x4bac38e7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "usr.cloud.muni.cz", 0x170578f2, PSL_RULE },
+    { "on-rio.io", 0x955e78f3, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "okuizumo.shimane.jp", 0x86a078f5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sch.jo", 0xbc8138f8, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xerox", 0x6ede78fb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mil.to", 0xcd4eb8fe, PSL_RULE },
+    { "or.th", 0xda39b8fe, PSL_RULE },
+    { "sannan.hyogo.jp", 0x1763f8fe, PSL_RULE },
+    { "shinjo.nara.jp", 0xc93ef8fe, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sa.com", 0x458b3904, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dnsdojo.org", 0xec30f906, PSL_RULE },
+    { "itakura.gunma.jp", 0x2465f906, PSL_RULE },
+    { "inf.br", 0x465d3908, PSL_RULE },
+    { "manx.museum", 0xe716b909, PSL_RULE },
+    { "otsuchi.iwate.jp", 0x371af908, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ferrero", 0xba96790c, PSL_RULE },
+    { "iheya.okinawa.jp", 0x4f6a790d, PSL_RULE },
+    { "mods.jp", 0xdc50f90c, PSL_RULE },
+    { "parti.se", 0xed83f90f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "na4u.ru", 0xf5fcf912, PSL_RULE },
+    { "interactive.museum", 0x0bedb913, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nikaho.akita.jp", 0x6ac1b919, PSL_RULE },
+    { "deta.app", 0x121e791a, PSL_RULE },
+    { "group.aero", 0xdfdc391b, PSL_RULE },
+    { "okinawa", 0x4809791b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fujishiro.ibaraki.jp", 0x780ab921, PSL_RULE },
+    { "balsan-sudtirol.it", 0x1eceb922, PSL_RULE },
+    { "kochi.kochi.jp", 0x20f43923, PSL_RULE },
+    { "nec", 0x107ef921, PSL_RULE },
+    { "oguni.yamagata.jp", 0x9e957924, PSL_RULE },
+    { "pv.it", 0x49413926, PSL_RULE },
+    { "mypsx.net", 0xa1f13927, PSL_RULE },
+    { "velvet.jp", 0x587ef921, PSL_RULE },
+    { "sbs", 0xc315b929, PSL_RULE },
+    { "me.tc", 0xc756392a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "editorx.io", 0x83437930, PSL_RULE },
+    { NULL, 0, 0 },
+    { "and.museum", 0x9f613932, PSL_RULE },
+    { "gouv.sn", 0xd3573933, PSL_RULE },
+    { "nishihara.okinawa.jp", 0x35a63934, PSL_RULE },
+    { "cns.joyent.com", 0x2e533935, PSL_WILDCARD },
+    { "ro.leg.br", 0x3528f936, PSL_RULE },
+    { "leclerc", 0x1eef7937, PSL_RULE },
+    { "noip.us", 0xd7f7b937, PSL_RULE },
+    { "funagata.yamagata.jp", 0x2d5a7939, PSL_RULE },
+    { "minobu.yamanashi.jp", 0xb74b793a, PSL_RULE },
+    { "association.aero", 0x4f1b793b, PSL_RULE },
+    { "xn--mli-tla.no", 0xeee8793c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "alibaba", 0xb1bb793f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "k12.ne.us", 0x3ab9b942, PSL_RULE },
+    { "2.azurestaticapps.net", 0x72d87943, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ly", 0x5f5fb948, PSL_RULE },
+    { "tado.mie.jp", 0x51a97948, PSL_RULE },
+    { "k12.ut.us", 0x9f34f94a, PSL_RULE },
+    { "krodsherad.no", 0x6faff94b, PSL_RULE },
+    { "co.krd", 0xd31db94c, PSL_RULE },
+    { "samukawa.kanagawa.jp", 0x4343394c, PSL_RULE },
+    { "bozen-suedtirol.it", 0x99b8f94e, PSL_RULE },
+    { "lazio.it", 0x12bef94f, PSL_RULE },
+    { "xn--cesenaforl-i8a.it", 0x2bb3b94b, PSL_RULE },
+    { "xn--p1ai", 0xd551f94a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kikonai.hokkaido.jp", 0x0c7df953, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hadano.kanagawa.jp", 0xc0b0f957, PSL_RULE },
+    { "com.my", 0xa0b2b958, PSL_RULE },
+    { "rn.it", 0x577d7958, PSL_RULE },
+    { "santoandre.br", 0xa324f95a, PSL_RULE },
+    { "gov.ph", 0xae67b95b, PSL_RULE },
+    { "it.com", 0x43a5795b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "radoy.no", 0x4600b961, PSL_RULE },
+    { "drammen.no", 0xb3703962, PSL_RULE },
+    { "asso.mc", 0x5ad6f963, PSL_RULE },
+    { "gov.rs", 0x9b903962, PSL_RULE },
+    { "partners", 0x678b7964, PSL_RULE },
+    { "co.pw", 0xda967966, PSL_RULE },
+    { "triton.zone", 0x947eb961, PSL_WILDCARD },
+    { "vfs.cloud9.ap-east-1.amazonaws.com", 0x37c5b965, PSL_RULE },
+    { NULL, 0, 0 },
+    { "westus2.azurestaticapps.net", 0x4774b96a, PSL_RULE },
+    { "pvt.k12.ma.us", 0x1fc9f96b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gos.pk", 0xd676796f, PSL_RULE },
+    { "gov.gy", 0x799fb96f, PSL_RULE },
+    { "iq", 0x644c396f, PSL_RULE },
+    { "otaru.hokkaido.jp", 0x90257972, PSL_RULE },
+    { "seg.br", 0xcc11b972, PSL_RULE },
+    { "dualstack.ap-south-1.amazonaws.com", 0xa374b974, 0 },
+    { "org.uk", 0x15f63975, PSL_RULE },
+    { "war.museum", 0x16f57971, PSL_RULE },
+    { NULL, 0, 0 },
+    { "matsushige.tokushima.jp", 0x62f23978, PSL_RULE },
+    { "jenv-aruba.cloud", 0x094d7979, 0 },
+    { "lapy.pl", 0x09cbb979, PSL_RULE },
+    { "sc.ke", 0xdebbf97b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "naie.hokkaido.jp", 0x12fc397e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-very-good.org", 0x48603984, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--flw351e", 0x9c117986, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mantova.it", 0x42ff7988, PSL_RULE },
+    { NULL, 0, 0 },
+    { "web.do", 0xb431f98a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fnwk.site", 0xa515398c, PSL_RULE },
+    { "org.bb", 0xfc16798d, PSL_RULE },
+    { "babia-gora.pl", 0xff5ab98e, PSL_RULE },
+    { "sakura.tochigi.jp", 0xc76f798d, PSL_RULE },
+    { "jp.net", 0x66353990, PSL_RULE },
+    { "forlicesena.it", 0x2344f991, PSL_RULE },
+    { "miki.hyogo.jp", 0x579db991, PSL_RULE },
+    { "ollo", 0x64b97993, PSL_RULE },
+    { "hino.tottori.jp", 0xa5e3f994, PSL_RULE },
+    { "carrd.co", 0x2797f995, PSL_RULE },
+    { "tsushima.aichi.jp", 0x280e3991, PSL_RULE },
+    { NULL, 0, 0 },
+    { "divtasvuodna.no", 0x58543998, PSL_RULE },
+    { "univ.bj", 0x4dbab999, PSL_RULE },
+    { NULL, 0, 0 },
+    { "usercontent.goog", 0x800df99b, PSL_WILDCARD },
+    { "xn--vgsy-qoa0j.no", 0xaaccb99b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "construction", 0x22d2799e, PSL_RULE },
+    { "kamakura.kanagawa.jp", 0x2359b99f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ass.km", 0xce68b9a6, PSL_RULE },
+    { "kobierzyce.pl", 0xfac979a6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fg.it", 0x5d6c39a9, PSL_RULE },
+    { "from-nm.com", 0x020e79aa, PSL_RULE },
+    { "memorial.museum", 0x091379ab, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "castle.museum", 0xdfacb9b1, PSL_RULE },
+    { "floripa.br", 0x9e6439b2, PSL_RULE },
+    { "aip.ee", 0xae94f9b3, PSL_RULE },
+    { "net.za", 0x4accb9b3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gmx", 0xe17079bb, PSL_RULE },
+    { "2.bg", 0x1fd6f9bc, PSL_RULE },
+    { "archi", 0x11b179bc, PSL_RULE },
+    { "akashi.hyogo.jp", 0x5525b9be, PSL_RULE },
+    { "badaddja.no", 0x111b39bf, PSL_RULE },
+    { "diet", 0x9c10f9bf, PSL_RULE },
+    { "konin.pl", 0x6bdc79bc, PSL_RULE },
+    { "nakano.nagano.jp", 0x0350b9bf, PSL_RULE },
+    { "playstation-cloud.com", 0x500039be, PSL_RULE },
+    { "sellsyourhome.org", 0x69b379be, PSL_RULE },
+    { "tec.ve", 0x93f539bc, PSL_RULE },
+    { "takaishi.osaka.jp", 0xfbb239c6, PSL_RULE },
+    { "aeroclub.aero", 0xe8bab9c7, PSL_RULE },
+    { "hopto.me", 0x607339c7, PSL_RULE },
+    { "xn--5js045d.jp", 0x2b2679c0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lima.zone", 0xfee6b9cc, PSL_RULE },
+    { "tm.za", 0xe84ab9cd, PSL_RULE },
+    { "cloudapp.net", 0xebf579ce, PSL_RULE },
+    { "erimo.hokkaido.jp", 0xa38879cf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "trondheim.no", 0x31e039d2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tranibarlettaandria.it", 0x31e8b9d6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ruovat.no", 0xbcc2b9d9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--wcvs22d.xn--j6w193g", 0x1b8879df, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gallery", 0xbe9279e1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ex.ortsinfo.at", 0x852fb9e5, PSL_WILDCARD },
+    { "if.ua", 0x63b939e6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mill.museum", 0xaaebb9eb, PSL_RULE },
+    { "ciencia.bo", 0xa90839ec, PSL_RULE },
+    { "tokorozawa.saitama.jp", 0xd5b2b9ec, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hiranai.aomori.jp", 0xafb339f0, PSL_RULE },
+    { "ice", 0x7b72b9f0, PSL_RULE },
+    { "de.eu.org", 0x1a48b9f2, PSL_RULE },
+    { "tenei.fukushima.jp", 0x0ca6b9f1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "isehara.kanagawa.jp", 0x2c1f39f7, PSL_RULE },
+    { "ltda", 0x32b039f8, PSL_RULE },
+    { "narvik.no", 0x9dab39f9, PSL_RULE },
+    { "xn--andy-ira.no", 0x610139f7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "accident-prevention.aero", 0xeb5afa00, PSL_RULE },
+    { "astronomy.museum", 0x0eafba01, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.ms", 0x3c737a05, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fool.jp", 0x242d3a07, PSL_RULE },
+    { "grondar.za", 0x4f0b7a07, PSL_RULE },
+    { "fr", 0x5b547a09, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ia.us", 0x6c07ba0b, PSL_RULE },
+    { "flatanger.no", 0xf33ffa0c, PSL_RULE },
+    { "matera.it", 0x476fba0c, PSL_RULE },
+    { "sassari.it", 0xd971ba0c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nome.pt", 0xf0007a12, PSL_RULE },
+    { NULL, 0, 0 },
+    { "myftp.biz", 0x2c21ba14, PSL_RULE },
+    { "org.vc", 0xf695ba14, PSL_RULE },
+    { NULL, 0, 0 },
+    { "likescandy.com", 0x1adfba17, PSL_RULE },
+    { "przeworsk.pl", 0x7944fa18, PSL_RULE },
+    { "ac.th", 0xd05e7a19, PSL_RULE },
+    { NULL, 0, 0 },
+    { "grozny.ru", 0xd37efa1b, PSL_RULE },
+    { "gub.uy", 0xdf22fa1b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nissay", 0x66163a1e, PSL_RULE },
+    { "party", 0x39f33a1f, PSL_RULE },
+    { "iwatsuki.saitama.jp", 0xb02d7a20, PSL_RULE },
+    { "vaksdal.no", 0x4793fa1e, PSL_RULE },
+    { "orland.no", 0x9cdcba22, PSL_RULE },
+    { "vfs.cloud9.me-south-1.amazonaws.com", 0xb34e7a22, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ome.tokyo.jp", 0x07a5fa26, PSL_RULE },
+    { NULL, 0, 0 },
+    { "redumbrella", 0x8a54ba28, PSL_RULE },
+    { NULL, 0, 0 },
+    { "trentin-suedtirol.it", 0xa14e3a2a, PSL_RULE },
+    { "mod.gi", 0x79c1ba2b, PSL_RULE },
+    { "nagano.nagano.jp", 0x4f16fa2b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.ma.us", 0xa89a7a31, PSL_RULE },
+    { "dr.tr", 0x4aabfa31, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--hnefoss-q1a.no", 0x2504ba36, PSL_RULE },
+    { "km.ua", 0x69a7fa37, PSL_RULE },
+    { "isahaya.nagasaki.jp", 0x9c3c3a38, PSL_RULE },
+    { "e.bg", 0xced67a39, PSL_RULE },
+    { "name.vn", 0x32e5fa38, PSL_RULE },
+    { "creditunion", 0x3f347a3b, PSL_RULE },
+    { "pyatigorsk.ru", 0xde9c3a3b, PSL_RULE },
+    { "kawanishi.yamagata.jp", 0xf8e33a3d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ru.eu.org", 0x2421ba40, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dellogliastra.it", 0x7e647a43, PSL_RULE },
+    { "iki.fi", 0x66a57a43, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jcb", 0x76bbfa48, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ltd", 0xcd34ba4b, PSL_RULE },
+    { "k12.ct.us", 0x130dfa4c, PSL_RULE },
+    { "pantheonsite.io", 0x91f33a4d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "press.se", 0x242ffa50, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nishihara.kumamoto.jp", 0x25d6ba53, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nu", 0x61433a5a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "from-mn.com", 0x105d3a5c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sakura", 0xd7783a5e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com", 0xe49e7a62, PSL_RULE },
+    { "kariwa.niigata.jp", 0x79acfa63, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "coloradoplateau.museum", 0xa2bcfa68, PSL_RULE },
+    { "greta.fr", 0xc59d7a68, PSL_RULE },
+    { "xn--fct429k", 0x1f09ba68, PSL_RULE },
+    { "mesaverde.museum", 0x10d57a6b, PSL_RULE },
+    { "saltdal.no", 0xf6b03a6b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "firm.ng", 0x267e3a6e, PSL_RULE },
+    { "mi.us", 0x901b7a6f, PSL_RULE },
+    { "org.yt", 0xef0aba6e, PSL_RULE },
+    { "com.sv", 0x989b3a71, PSL_RULE },
+    { "mg", 0x44207a71, PSL_RULE },
+    { "raindrop.jp", 0x43da7a72, PSL_RULE },
+    { "utashinai.hokkaido.jp", 0xa18b7a6f, PSL_RULE },
+    { "ibara.okayama.jp", 0x39b97a75, PSL_RULE },
+    { "cya.gg", 0xee8dfa76, PSL_RULE },
+    { "beer", 0xe0e8ba77, PSL_RULE },
+    { "friulivgiulia.it", 0x5637fa76, PSL_RULE },
+    { "m.se", 0xa0787a78, PSL_RULE },
+    { "onagawa.miyagi.jp", 0x0dfb7a79, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "int.vn", 0xa0e87a7e, PSL_RULE },
+    { "kawachinagano.osaka.jp", 0x72feba7e, PSL_RULE },
+    { "org.gh", 0xb3e9ba80, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sochi.su", 0x470d7a87, PSL_RULE },
+    { "a.ssl.fastly.net", 0xac4c7a88, PSL_RULE },
+    { "hasvik.no", 0x21ee7a88, PSL_RULE },
+    { "freeddns.org", 0xed0d7a8a, PSL_RULE },
+    { "4lima.de", 0xc0943a8b, PSL_RULE },
+    { "ac.cr", 0xb97dba8c, PSL_RULE },
+    { "inagi.tokyo.jp", 0xb37ffa8b, PSL_RULE },
+    { "org.ro", 0xd7d6fa8c, PSL_RULE },
+    { "pulawy.pl", 0xa0f5fa89, PSL_RULE },
+    { "xn--balsan-sdtirol-nsb.it", 0x53663a8b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "c.cdn77.org", 0x1a4b3a99, PSL_RULE },
+    { "kuwana.mie.jp", 0xe67a3a99, PSL_RULE },
+    { "my-router.de", 0x78cffa9a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.vc", 0x3fcdba9e, PSL_RULE },
+    { "ni", 0x41387a9e, PSL_RULE },
+    { "zushi.kanagawa.jp", 0x86087a9f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ashibetsu.hokkaido.jp", 0xb29f3aa3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "corvette.museum", 0x65cb3aa5, PSL_RULE },
+    { "pgafan.net", 0xb0bebaa5, PSL_RULE },
+    { "industries", 0x3b2b7aa7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "internet.in", 0x1067faa9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jio", 0xc9387aad, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tarnobrzeg.pl", 0x8d4d7aaf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "k12.vi", 0x26a87ab2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "k12.mi.us", 0xf939bab7, PSL_RULE },
+    { "urausu.hokkaido.jp", 0x68f87ab8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sibenik.museum", 0x984bbaba, PSL_RULE },
+    { "lotte", 0x8d22babb, PSL_RULE },
+    { "tips", 0x1f14fabb, PSL_RULE },
+    { "de.ls", 0x9c597abd, PSL_RULE },
+    { "xn--moreke-jua.no", 0x5f95faba, PSL_RULE },
+    { "certmgr.org", 0x27b8fabf, PSL_RULE },
+    { "familyds.com", 0x89283abf, PSL_RULE },
+    { "goshiki.hyogo.jp", 0x62acbac1, PSL_RULE },
+    { "kitagata.saga.jp", 0x4c4b7abf, PSL_RULE },
+    { "ok.us", 0x921ffac3, PSL_RULE },
+    { "tennis", 0x6ffa3ac0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "recht.pro", 0xc695fac8, PSL_RULE },
+    { "bozen-sudtirol.it", 0x8fe03ac9, PSL_RULE },
+    { "wzmiuw.gov.pl", 0x4b31faca, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "honjyo.akita.jp", 0xbe05bace, PSL_RULE },
+    { NULL, 0, 0 },
+    { "biz.ua", 0xb405bad0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dynathome.net", 0x479e7ad3, PSL_RULE },
+    { NULL, 0, 0 },
+    { "io", 0x68343ad5, PSL_RULE },
+    { "1.azurestaticapps.net", 0x73d87ad6, PSL_RULE },
+    { "obu.aichi.jp", 0x697fbad7, PSL_RULE },
+    { "com.am", 0xcf5e3ad8, PSL_RULE },
+    { "yodobashi", 0x1d92bad9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "my", 0x605fbadb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.ms.us", 0x2271fae0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.kz", 0x14d5bae3, PSL_RULE },
+    { "ralingen.no", 0x5295fae4, PSL_RULE },
+    { "tr.eu.org", 0x2c14fae5, PSL_RULE },
+    { "ceo", 0x9842bae6, PSL_RULE },
+    { "historyofscience.museum", 0x5438fae6, PSL_RULE },
+    { "deals", 0xeba13ae8, PSL_RULE },
+    { "able", 0xbd947ae9, PSL_RULE },
+    { "clicketcloud.com", 0x26017aea, PSL_RULE },
+    { "embaixada.st", 0xfd9c7ae8, PSL_RULE },
+    { "myspreadshop.fr", 0x453d7ae6, PSL_RULE },
+    { "narita.chiba.jp", 0xb4007ae9, PSL_RULE },
+    { "torsken.no", 0x2e833aea, PSL_RULE },
+    { "gov.km", 0xa84b3aef, PSL_RULE },
+    { "watch-and-clock.museum", 0x95f5baeb, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lk", 0x433cfaf2, PSL_RULE },
+    { "hs-heilbronn.de", 0xd851baf3, 0 },
+    { "nsw.edu.au", 0x27567af3, PSL_RULE },
+    { "rn.leg.br", 0x372b3af3, PSL_RULE },
+    { "sekd1.beebyteapp.io", 0x8299baf6, PSL_RULE },
+    { "xn--czru2d", 0x4bd7baf7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fido", 0xc6b07af9, PSL_RULE },
+    { "fox", 0xe06bfafa, PSL_RULE },
+    { "mw.gov.pl", 0x8cbf3afb, PSL_RULE },
+    { "shishikui.tokushima.jp", 0x4138fafb, PSL_RULE },
+    { "k12.gu.us", 0x5ad4bafd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--2scrj9c", 0x40a37aff, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "charity", 0xbce13b03, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "doshi.yamanashi.jp", 0x345b7b0b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--rhkkervju-01af.no", 0x007efb0d, PSL_RULE },
+    { "polkowice.pl", 0x528dbb0e, PSL_RULE },
+    { "uz.ua", 0x7fd77b0e, PSL_RULE },
+    { "yaizu.shizuoka.jp", 0xe9fafb0d, PSL_RULE },
+    { "trade", 0x0d913b11, PSL_RULE },
+    { NULL, 0, 0 },
+    { "s3-us-east-2.amazonaws.com", 0xb905bb13, PSL_RULE },
+    { "aruba.jenv-aruba.cloud", 0x7829bb14, 0 },
+    { "xn--mgb2ddes", 0x64c2fb15, PSL_RULE },
+    { NULL, 0, 0 },
+    { "volyn.ua", 0xfde9bb17, PSL_RULE },
+    { "priv.me", 0xbedbfb18, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "is-a-chef.net", 0xf2143b1b, PSL_RULE },
+    { "blogdns.org", 0x85467b1c, PSL_RULE },
+    { "ohi.fukui.jp", 0xb4cf3b1d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "livinghistory.museum", 0x08b17b20, PSL_RULE },
+    { "xn--fhbei", 0xbfdefb21, PSL_RULE },
+    { "xn--rny31h.jp", 0xd88c7b20, PSL_RULE },
+    { NULL, 0, 0 },
+    { "info.at", 0x5538bb24, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gok.pk", 0x8006bb27, PSL_RULE },
+    { "winners", 0xc3babb27, PSL_RULE },
+    { NULL, 0, 0 },
+    { "krasnodar.su", 0x575c3b2a, PSL_RULE },
+    { "asakawa.fukushima.jp", 0xedacfb2b, PSL_RULE },
+    { "dell", 0x07ea3b2c, PSL_RULE },
+    { "gen.in", 0xcd9ebb2c, PSL_RULE },
+    { "quickconnect.to", 0x2ef8bb2d, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "vladimir.ru", 0x8ee13b32, PSL_RULE },
+    { "fra1-de.cloudjiffy.net", 0xc4ca3b33, PSL_RULE },
+    { "kawatana.nagasaki.jp", 0x707e3b34, PSL_RULE },
+    { "vibo-valentia.it", 0xf3fc7b33, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--e1a4c", 0x5049bb37, PSL_RULE },
+    { NULL, 0, 0 },
+    { "loginline.site", 0x2258fb39, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ag.it", 0x5e6c3b3c, PSL_RULE },
+    { "blogspot.pt", 0xe7523b3d, PSL_RULE },
+    { "gateway.museum", 0x0a7fbb3d, PSL_RULE },
+    { "gitlab.io", 0x21127b3c, PSL_RULE },
+    { "takayama.nagano.jp", 0xf31b7b40, PSL_RULE },
+    { "xn--lrenskog-54a.no", 0x8226fb3e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dell-ogliastra.it", 0xfd1fbb44, PSL_RULE },
+    { "tv.im", 0x31e13b45, PSL_RULE },
+    { "furudono.fukushima.jp", 0x12f27b46, PSL_RULE },
+    { NULL, 0, 0 },
+    { "fit", 0xc50afb48, PSL_RULE },
+    { NULL, 0, 0 },
+    { "schlesisches.museum", 0x30d7bb4a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "delhi.in", 0xc9b43b4c, PSL_RULE },
+    { "perma.jp", 0x111e3b4c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "3.bg", 0x20d6fb4f, PSL_RULE },
+    { "software.aero", 0x19317b4f, PSL_RULE },
+    { "gov.tj", 0x76e87b51, PSL_RULE },
+    { "yokohama.jp", 0xf13dfb52, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "net.gy", 0xa7803b54, PSL_RULE },
+    { "tsukaeru.net", 0xdedf7b54, 0 },
+    { "takehara.hiroshima.jp", 0xe4ff3b56, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shibata.niigata.jp", 0xc514bb58, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "myvnc.com", 0xec7d3b5b, PSL_RULE },
+    { "ichinomiya.chiba.jp", 0xb67e7b5c, PSL_RULE },
+    { "apps.lair.io", 0xef503b5d, PSL_RULE },
+    { "shimane.shimane.jp", 0x086d3b5b, PSL_RULE },
+    { "aizumi.tokushima.jp", 0x17843b5f, PSL_RULE },
+    { "xn--vermgensberatung-pwb", 0x7fb73b60, PSL_RULE },
+    { "her.name", 0xa2677b61, 0 },
+    { "cx.ua", 0x81dbfb62, PSL_RULE },
+    { "org.mw", 0x3ecafb61, PSL_RULE },
+    { "org.my", 0x4a8fbb63, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "nishikata.tochigi.jp", 0xf5bc7b68, PSL_RULE },
+    { "versus.jp", 0x7fa97b69, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--bidr-5nac.no", 0x59e37b6b, PSL_RULE },
+    { "higashiura.aichi.jp", 0x3923bb6c, PSL_RULE },
+    { "barsy.mobi", 0x82ba7b6d, PSL_RULE },
+    { "ricoh", 0x538fbb6e, PSL_RULE },
+    { "gob.es", 0xc38efb6f, PSL_RULE },
+    { "med.sd", 0x2540bb70, PSL_RULE },
+    { "eu.meteorapp.com", 0x8641bb71, PSL_RULE },
+    { "taishi.hyogo.jp", 0xbd4cfb6f, PSL_RULE },
+    { "here", 0x308f3b73, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.ky", 0x2020fb75, PSL_RULE },
+    { "savona.it", 0x30d17b76, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gdn", 0x189bbb78, PSL_RULE },
+    { "decorativearts.museum", 0x142e7b79, PSL_RULE },
+    { "funabashi.chiba.jp", 0xb9b13b79, PSL_RULE },
+    { "daemon.panel.gg", 0xd2c13b7b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "saikai.nagasaki.jp", 0x84f5fb80, PSL_RULE },
+    { "net.sl", 0x63cabb81, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sd.us", 0x8e14bb84, PSL_RULE },
+    { "ee.eu.org", 0x1b48bb85, PSL_RULE },
+    { "sos.pl", 0x62657b84, PSL_RULE },
+    { "observer", 0x5724fb87, PSL_RULE },
+    { "compare", 0x59b27b88, PSL_RULE },
+    { "osakikamijima.hiroshima.jp", 0x47ccfb87, PSL_RULE },
+    { "org.lk", 0xd3b87b8a, PSL_RULE },
+    { "gets-it.net", 0xa9cffb8b, PSL_RULE },
+    { "gt", 0x3a453b8c, PSL_RULE },
+    { "ryokami.saitama.jp", 0x6ef3fb8d, PSL_RULE },
+    { "chino.nagano.jp", 0xb711fb8e, PSL_RULE },
+    { "ina.saitama.jp", 0xdfd8fb8f, PSL_RULE },
+    { "nodes.k8s.pl-waw.scw.cloud", 0x1033fb8e, PSL_RULE },
+    { "saves-the-whales.com", 0x1c7bfb8b, PSL_RULE },
+    { "shirakawa.gifu.jp", 0x5613bb8d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "verdal.no", 0xae97fb98, PSL_RULE },
+    { NULL, 0, 0 },
+    { "far.br", 0x6eba7b9a, PSL_RULE },
+    { "rackmaze.net", 0xf34a3b9a, PSL_RULE },
+    { "ar", 0x5c547b9c, PSL_RULE },
+    { "lib.ak.us", 0x2367fb9c, PSL_RULE },
+    { "hakui.ishikawa.jp", 0xbc113b9e, PSL_RULE },
+    { "azurestaticapps.net", 0x1095fb9f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "watchandclock.museum", 0x66e37ba1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "es.leg.br", 0x486e3ba3, PSL_RULE },
+    { "agematsu.nagano.jp", 0x9b2f3ba4, PSL_RULE },
+    { "os.stg.fedoraproject.org", 0xceba7ba5, 0 },
+    { "secure", 0xbc91fba6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "abkhazia.su", 0x4964bbaa, PSL_RULE },
+    { "internet-dns.de", 0x4b687bab, PSL_RULE },
+    { "bounceme.net", 0x36b13bac, PSL_RULE },
+    { "mitake.gifu.jp", 0x7364fbad, PSL_RULE },
+    { "re.kr", 0xd764bbab, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--h2brj9c8c", 0x82503bb2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.pr", 0x08c77bb4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "from-dc.com", 0xe3253bb6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "vet.br", 0x37dffbb8, PSL_RULE },
+    { "showtime", 0xd6b57bb9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kamogawa.chiba.jp", 0x2a7dbbbc, PSL_RULE },
+    { "org.ec", 0x89dfbbbd, PSL_RULE },
+    { "palermo.it", 0x8afe7bbe, PSL_RULE },
+    { "county.museum", 0xc2197bbf, PSL_RULE },
+    { "piemonte.it", 0xf81d7bbd, PSL_RULE },
+    { "sumoto.kumamoto.jp", 0x4671bbbf, PSL_RULE },
+    { "kitayama.wakayama.jp", 0xf561bbc2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kiev.ua", 0x9020fbc6, PSL_RULE },
+    { "ashikaga.tochigi.jp", 0x1d29bbc7, PSL_RULE },
+    { "vfs.cloud9.ap-northeast-2.amazonaws.com", 0x34343bc7, PSL_RULE },
+    { "xn--od0alg.cn", 0x190e3bc7, PSL_RULE },
+    { "ardal.no", 0xe179bbca, PSL_RULE },
+    { NULL, 0, 0 },
+    { "b.bg", 0xcfd67bcc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.sg", 0x27b4fbcf, PSL_RULE },
+    { "dscloud.me", 0x0bb67bcf, PSL_RULE },
+    { "blogspot.td", 0x8a23fbd1, PSL_RULE },
+    { "meloy.no", 0xb5a23bd0, PSL_RULE },
+    { "pro.na", 0xe6a1bbcf, PSL_RULE },
+    { "xn--mgbcpq6gpa1a", 0x841dbbcf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "chikuho.fukuoka.jp", 0xdffffbd6, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sydney", 0x2e44fbd9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gorizia.it", 0xe3c8fbdd, PSL_RULE },
+    { "koga.ibaraki.jp", 0xab3e3bde, PSL_RULE },
+    { "onion", 0x86163bde, PSL_RULE },
+    { "boats", 0x5146bbe0, PSL_RULE },
+    { "fishing", 0xde14fbe1, PSL_RULE },
+    { "mb.it", 0x665f7be1, PSL_RULE },
+    { "xn--nit225k.jp", 0x74137bde, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.fm", 0x5ab3bbe5, PSL_RULE },
+    { "lund.no", 0xe9c4bbe5, PSL_RULE },
+    { "est-le-patron.com", 0xa9cf3be7, PSL_RULE },
+    { "awsmppl.com", 0xa476bbe8, PSL_RULE },
+    { "kagoshima.kagoshima.jp", 0x31573be7, PSL_RULE },
+    { "blogspot.no", 0xe075bbea, PSL_RULE },
+    { "nes.akershus.no", 0x32b4fbea, PSL_RULE },
+    { "s3.eu-central-1.amazonaws.com", 0x8ab33beb, PSL_RULE },
+    { "org.ph", 0x07653bed, PSL_RULE },
+    { "prvcy.page", 0x16463bee, PSL_RULE },
+    { "shimokawa.hokkaido.jp", 0xc8bdfbeb, PSL_RULE },
+    { "webview-assets.cloud9.ap-southeast-1.amazonaws.com", 0xbebafbea, PSL_RULE },
+    { "webview-assets.cloud9.ap-east-1.amazonaws.com", 0xacbcbbf1, PSL_RULE },
+    { "whitesnow.jp", 0x41c73bef, PSL_RULE },
+    { "net.sb", 0xe8a07bf3, PSL_RULE },
+    { "rennebu.no", 0x6fe33bf3, PSL_RULE },
+    { "bom", 0xe59e7bf5, PSL_RULE },
+    { "clothing", 0x059fbbf5, PSL_RULE },
+    { "com.ba", 0xeeaffbf5, PSL_RULE },
+    { "al.gov.br", 0xf6683bf8, PSL_RULE },
+    { "energy", 0x20c53bf9, PSL_RULE },
+    { "trentinoa-adige.it", 0x43847bf5, PSL_RULE },
+    { "childrens.museum", 0xdfdb7bfb, PSL_RULE },
+    { "hazu.aichi.jp", 0x6063fbfb, PSL_RULE },
+    { "xn--rde-ula.no", 0xec837bea, PSL_RULE },
+    { "yamagata.ibaraki.jp", 0xafb2bbe9, PSL_RULE },
+    { "niigata.niigata.jp", 0x4eb3fbff, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kvinesdal.no", 0xabc1fc05, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bale.museum", 0x6e75bc07, PSL_RULE },
+    { "kumakogen.ehime.jp", 0x36f03c07, PSL_RULE },
+    { "obi", 0x9cdefc07, PSL_RULE },
+    { "ski", 0x98f4bc0a, PSL_RULE },
+    { "l.se", 0xa1787c0b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "dscloud.mobi", 0xd16bfc0e, PSL_RULE },
+    { "fudai.iwate.jp", 0x28437c0e, PSL_RULE },
+    { "ivano-frankivsk.ua", 0x5f023c10, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "development.run", 0x47a0fc15, PSL_RULE },
+    { "kamisunagawa.hokkaido.jp", 0x7ea6bc16, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dnsup.net", 0x22e1fc18, PSL_RULE },
+    { "stcgroup", 0x011a7c18, PSL_RULE },
+    { "noto.ishikawa.jp", 0x16c67c1a, PSL_RULE },
+    { "ayase.kanagawa.jp", 0x6b7efc1b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.kg", 0x3abe3c1d, PSL_RULE },
+    { "nisshin.aichi.jp", 0x9b117c1d, PSL_RULE },
+    { "servehttp.com", 0xb8d4bc1f, PSL_RULE },
+    { "xn--trentin-sd-tirol-rzb.it", 0x2738bc1e, PSL_RULE },
+    { "massacarrara.it", 0xf356fc21, PSL_RULE },
+    { "virtualuser.de", 0xe8adbc22, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.nl", 0x33e3bc25, PSL_RULE },
+    { "org.bz", 0xdfeffc25, PSL_RULE },
+    { "stg.fedoraproject.org", 0x69a9bc27, 0 },
+    { "riodejaneiro.museum", 0x352c7c28, PSL_RULE },
+    { "xnbay.com", 0x53fbfc26, PSL_RULE },
+    { "io.in", 0xc3a6bc2a, PSL_RULE },
+    { "net.bh", 0xac9cfc2a, PSL_RULE },
+    { "pesarourbino.it", 0x36477c2b, PSL_RULE },
+    { "bergbau.museum", 0xb64e7c2d, PSL_RULE },
+    { "garden.museum", 0x01f9fc2e, PSL_RULE },
+    { "sys.qcx.io", 0xdeacfc2c, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ureshino.mie.jp", 0x3119fc33, PSL_RULE },
+    { "edu.gr", 0xc270fc34, PSL_RULE },
+    { "mint", 0xc15a7c35, PSL_RULE },
+    { "linkyard-cloud.ch", 0x64e37c36, PSL_RULE },
+    { "org.ps", 0x0a6c7c36, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.sb", 0xf934bc3d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "mw", 0x6447bc41, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ju.mp", 0x2a8fbc47, PSL_RULE },
+    { NULL, 0, 0 },
+    { "econo.bj", 0xa7e83c49, PSL_RULE },
+    { "gs.st.no", 0x4b83fc49, PSL_RULE },
+    { "mombetsu.hokkaido.jp", 0xbea87c49, PSL_RULE },
+    { "vv.it", 0x4b413c4c, PSL_RULE },
+    { "net.pa", 0x248afc4d, PSL_RULE },
+    { "edu.dm", 0xf32a7c4e, PSL_RULE },
+    { "motoyama.kochi.jp", 0x00fd7c4e, PSL_RULE },
+    { "static-access.net", 0x1849bc4d, PSL_RULE },
+    { "ubs", 0xc515bc4f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "firmdale", 0x10c9bc55, PSL_RULE },
+    { "myspreadshop.ch", 0x3bccbc55, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tsuwano.shimane.jp", 0x6093bc59, PSL_RULE },
+    { NULL, 0, 0 },
+    { "okayama.okayama.jp", 0x62083c5b, PSL_RULE },
+    { "to.leg.br", 0x3728fc5c, PSL_RULE },
+    { "gotpantheon.com", 0xc82e7c5d, PSL_RULE },
+    { "int.cv", 0xe5f33c5d, PSL_RULE },
+    { "alstom", 0x86a4bc5f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "s3-ap-northeast-1.amazonaws.com", 0x80d9fc62, PSL_RULE },
+    { "or.na", 0xf9d37c63, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fo", 0x69343c68, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hjelmeland.no", 0xf44c3c6a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.mu", 0xaef8bc6c, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "caa.li", 0x2096fc71, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "blogspot.com.ee", 0xd67cbc76, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "diy", 0x45bd3c79, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ve.it", 0x5d67bc7b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pn.it", 0x597d7c7e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.pn", 0x42637c81, PSL_RULE },
+    { NULL, 0, 0 },
+    { "soeda.fukuoka.jp", 0x26ce3c83, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mk", 0x443cfc85, PSL_RULE },
+    { "brand.se", 0x9165bc86, PSL_RULE },
+    { NULL, 0, 0 },
+    { "hs.zone", 0x0c163c88, PSL_RULE },
+    { "vana", 0xb0ca7c89, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fr-par.scw.cloud", 0xa17f7c8d, 0 },
+    { "a.run.app", 0x1049fc8e, PSL_RULE },
+    { "obama.fukui.jp", 0xcc7dfc8d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "lib.ia.us", 0x25db7c92, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yanagawa.fukuoka.jp", 0x2c647c96, PSL_RULE },
+    { "nishinomiya.hyogo.jp", 0xdd8cbc97, PSL_RULE },
+    { NULL, 0, 0 },
+    { "izumisano.osaka.jp", 0xbbc33c99, PSL_RULE },
+    { "higashine.yamagata.jp", 0xed72fc9a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "midtre-gauldal.no", 0x03567c9e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "rep.br", 0x71963ca0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "yashiro.hyogo.jp", 0xe901fca2, PSL_RULE },
+    { "kazuno.akita.jp", 0xa2b9fca3, PSL_RULE },
+    { "cal.it", 0x04867ca4, PSL_RULE },
+    { "ftpaccess.cc", 0x45ca3ca5, PSL_RULE },
+    { "go.tz", 0x811bbca5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "flir", 0xf6567caa, PSL_RULE },
+    { "gov.br", 0x02267cab, PSL_RULE },
+    { "express.aero", 0x07133cac, PSL_RULE },
+    { "hembygdsforbund.museum", 0x80197cac, PSL_RULE },
+    { "vc", 0x49297cac, PSL_RULE },
+    { "vs.mythic-beasts.com", 0xc07bbcac, PSL_RULE },
+    { "xn--8dbq2a.xn--4dbrk0ce", 0xd7977caa, PSL_RULE },
+    { "xn--o3cw4h", 0xb8a17cb1, PSL_RULE },
+    { "zappos", 0xd71bfcb0, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "naturalsciences.museum", 0x6e063cb5, PSL_RULE },
+    { "is-a-personaltrainer.com", 0x2ee37cb6, PSL_RULE },
+    { "dvag", 0x23657cb7, PSL_RULE },
+    { "cc.az.us", 0x399b7cb8, PSL_RULE },
+    { "edu.tt", 0x992c3cb7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "piedmont.it", 0x8a673cbc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--3e0b707e", 0xc2cbbcbe, PSL_RULE },
+    { "autos", 0x4fcf7cbf, PSL_RULE },
+    { "dot", 0x9310bcc0, PSL_RULE },
+    { "xn--zbx025d.jp", 0x24d63cbe, PSL_RULE },
+    { "care", 0x5199fcc2, PSL_RULE },
+    { "hk.cn", 0x2fadbcc3, PSL_RULE },
+    { "reggioemilia.it", 0x67dcfcc2, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.la", 0x62477cc7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ninja", 0x649ffccb, PSL_RULE },
+    { "blogspot.co.za", 0xb0d67ccc, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "rdv.to", 0x730dfcd0, PSL_RULE },
+    { "from-sc.com", 0xf943bcd1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.tn", 0x364efcd4, PSL_RULE },
+    { "insurance.aero", 0x28b07cd4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "freeboxos.com", 0x8822bcdd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sejny.pl", 0x64213ce0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "0.bg", 0x21d6fce2, PSL_RULE },
+    { "org.am", 0x793b3ce3, PSL_RULE },
+    { "doctor", 0xc7fa3ce4, PSL_RULE },
+    { "nago.okinawa.jp", 0x8679fce4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "maritime.museum", 0x8b253ce7, PSL_RULE },
+    { "paris.museum", 0x947efce8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tomisato.chiba.jp", 0x84efbcea, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ibestad.no", 0xec29fcee, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gov.do", 0x365b7cf0, PSL_RULE },
+    { "farm.museum", 0x0da77cf1, PSL_RULE },
+    { "kotohira.kagawa.jp", 0x651bbcf0, PSL_RULE },
+    { "xn--snase-nra.no", 0x039f7cf0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ah.no", 0xcaa9bcf5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--od0alg.hk", 0xc58afcf7, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "weber", 0xd8e47cfa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yusuhara.kochi.jp", 0x41a77cfd, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ddr.museum", 0xf9ecfd05, PSL_RULE },
+    { "xn--skjk-soa.no", 0xb9c3fd05, PSL_RULE },
+    { "miyoshi.aichi.jp", 0x6f58fd07, PSL_RULE },
+    { "uz", 0x5867fd08, PSL_RULE },
+    { "bryansk.su", 0xed7bbd09, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "s3-website.nl-ams.scw.cloud", 0x51df7d0d, PSL_RULE },
+    { "isa.kagoshima.jp", 0x4ea73d0e, PSL_RULE },
+    { "salvador.br", 0xa7507d0f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "sarufutsu.hokkaido.jp", 0x31fd3d11, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "appspacehosted.com", 0xbe97fd14, PSL_RULE },
+    { "com.ee", 0xc9f7fd14, PSL_RULE },
+    { "asahi.mie.jp", 0x1c0a7d16, PSL_RULE },
+    { "gap", 0x5855fd17, PSL_RULE },
+    { "imabari.ehime.jp", 0xa53b3d18, PSL_RULE },
+    { "nagareyama.chiba.jp", 0xa84d3d18, PSL_RULE },
+    { "on-acorn.io", 0x2390fd1a, PSL_WILDCARD },
+    { "cloud9.ap-southeast-1.amazonaws.com", 0xfb09fd1b, 0 },
+    { "s3.dualstack.ap-southeast-1.amazonaws.com", 0xbc99fd19, PSL_RULE },
+    { "tree.museum", 0x52963d19, PSL_RULE },
+    { "yahaba.iwate.jp", 0xb59f7d15, PSL_RULE },
+    { "usarts.museum", 0xdd95fd1f, PSL_RULE },
+    { "minamiaiki.nagano.jp", 0xad99bd20, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.mv", 0x608a3d25, PSL_RULE },
+    { "hb.cldmail.ru", 0x661dbd26, PSL_RULE },
+    { NULL, 0, 0 },
+    { "writesthisblog.com", 0x976dbd28, PSL_RULE },
+    { NULL, 0, 0 },
+    { "oceanographic.museum", 0xab90bd2a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "blogspot.re", 0xcd193d2c, PSL_RULE },
+    { NULL, 0, 0 },
+    { "incheon.kr", 0x81b03d2e, PSL_RULE },
+    { "yun", 0x22727d2f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ggf.br", 0x24473d33, PSL_RULE },
+    { "from-ny.net", 0xab33bd34, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "123website.be", 0x66dcfd37, PSL_RULE },
+    { "kr.it", 0x48383d37, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gjerdrum.no", 0x7c293d3c, PSL_RULE },
+    { "hotel.hu", 0x3b657d3c, PSL_RULE },
+    { "freemasonry.museum", 0xe501fd3e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mil.tm", 0x161d3d40, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sa.au", 0x8894bd43, PSL_RULE },
+    { "audnedaln.no", 0xe7dc7d44, PSL_RULE },
+    { "lindas.no", 0x1fdafd45, PSL_RULE },
+    { "com.es", 0x73263d46, PSL_RULE },
+    { "chonan.chiba.jp", 0x45907d47, PSL_RULE },
+    { "il", 0x4031bd46, PSL_RULE },
+    { "xn--55qw42g", 0x09613d46, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "miyazaki.miyazaki.jp", 0x8b6abd4d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "eu.org", 0x7fd77d4f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "gov.bs", 0xb6da3d52, PSL_RULE },
+    { NULL, 0, 0 },
+    { "edu.cn", 0xeff87d54, PSL_RULE },
+    { "s3-website.ap-south-1.amazonaws.com", 0xdf3bbd54, PSL_RULE },
+    { "vladikavkaz.ru", 0x89f0fd56, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.sn", 0x790bbd59, PSL_RULE },
+    { "gs.hl.no", 0xa2a3fd5a, PSL_RULE },
+    { "idv.tw", 0x0e013d59, PSL_RULE },
+    { "melbourne", 0x304fbd5c, PSL_RULE },
+    { "cloud9.eu-west-3.amazonaws.com", 0x8447fd5d, 0 },
+    { NULL, 0, 0 },
+    { "c.bg", 0xd0d67d5f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "linodeusercontent.com", 0x6d92fd61, 0 },
+    { "com.se", 0xbac73d62, PSL_RULE },
+    { "stjohn.museum", 0xbb1afd63, PSL_RULE },
+    { NULL, 0, 0 },
+    { "golf", 0xadc7fd65, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "hongo.hiroshima.jp", 0x9c29bd68, PSL_RULE },
+    { NULL, 0, 0 },
+    { "delaware.museum", 0x8863fd6a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chikugo.fukuoka.jp", 0xddec3d6d, PSL_RULE },
+    { NULL, 0, 0 },
+    { "12hp.de", 0xe966fd6f, PSL_RULE },
+    { "net.tt", 0x1e71bd70, PSL_RULE },
+    { NULL, 0, 0 },
+    { "dnstrace.pro", 0x113e7d72, 0 },
+    { "tranby.no", 0xf7767d72, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cincinnati.museum", 0x132dfd77, PSL_RULE },
+    { "city", 0x6d827d78, PSL_RULE },
+    { "from-ms.com", 0x707e7d77, PSL_RULE },
+    { "kim", 0xc48f3d78, PSL_RULE },
+    { "naroy.no", 0x74407d77, PSL_RULE },
+    { "kanna.gunma.jp", 0xdb417d7c, PSL_RULE },
+    { "pics", 0xeafbbd7a, PSL_RULE },
+    { "tempurl.host", 0x9032fd7e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "servequake.com", 0xa74cbd80, PSL_RULE },
+    { "sells-for-u.com", 0xa0d1fd81, PSL_RULE },
+    { "univ.sn", 0xf8cf3d80, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloudns.eu", 0x5c72bd87, PSL_RULE },
+    { "mom", 0xe69e7d88, PSL_RULE },
+    { "net.bj", 0x9672fd88, PSL_RULE },
+    { "sera.hiroshima.jp", 0x6288fd8a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cc.mo.us", 0x9acfbd8f, PSL_RULE },
+    { "gov.cu", 0x4e6efd8f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jeonnam.kr", 0x7f03fd94, PSL_RULE },
+    { "place", 0xb2a3bd94, PSL_RULE },
+    { "kawajima.saitama.jp", 0xcb407d96, PSL_RULE },
+    { "friulivenezia-giulia.it", 0x32c7bd97, PSL_RULE },
+    { "kg", 0x46207d97, PSL_RULE },
+    { "york.museum", 0x5c47fd94, PSL_RULE },
+    { "kanegasaki.iwate.jp", 0xd25e7d9a, PSL_RULE },
+    { "nakadomari.aomori.jp", 0xf777fd9b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "o.se", 0xa2787d9e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jp.kg", 0xcfcb7da1, PSL_RULE },
+    { "s3-fips-us-gov-west-1.amazonaws.com", 0x818e3da2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "shimotsuke.tochigi.jp", 0x3a24fda4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "httpbin.org", 0x39e8fda6, PSL_RULE },
+    { "shichikashuku.miyagi.jp", 0x9fb83da7, PSL_RULE },
+    { "yaita.tochigi.jp", 0x6c74bda8, PSL_RULE },
+    { "s3-ap-southeast-2.amazonaws.com", 0xc3983da9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "coz.br", 0xb273bdab, PSL_RULE },
+    { "abiko.chiba.jp", 0xd7babdac, PSL_RULE },
+    { "k12.pr.us", 0xa9117dab, PSL_RULE },
+    { "org.es", 0x13aa7dad, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "iwanuma.miyagi.jp", 0xf7c43db1, PSL_RULE },
+    { "base.ec", 0x3a1abdb2, PSL_RULE },
+    { "football", 0x731bfdb2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "akamaized.net", 0xb41ffdb5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "s3.amazonaws.com", 0x55e4bdbb, PSL_RULE },
+    { "is-a-student.com", 0x30397dbc, PSL_RULE },
+    { "cc.me.us", 0x13f7fdbd, PSL_RULE },
+    { "lib.nj.us", 0x30d13dbc, PSL_RULE },
+    { "org.cw", 0x995dbdbf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "world", 0x2c9bbdc3, PSL_RULE },
+    { "scrysec.com", 0x9c703dc4, PSL_RULE },
+    { "xn--valledaoste-ebb.it", 0x2b6e7dc4, PSL_RULE },
+    { "kumejima.okinawa.jp", 0x080cbdc6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "zoological.museum", 0x0009bdc8, PSL_RULE },
+    { "versailles.museum", 0xd97abdc9, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "noheji.aomori.jp", 0x5804bdcd, PSL_RULE },
+    { "os.hedmark.no", 0x50363dce, PSL_RULE },
+    { NULL, 0, 0 },
+    { "xn--41a.xn--p1acf", 0xebe27dd0, PSL_RULE },
+    { "user.party.eus", 0x7e4a3dd1, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "trader.aero", 0x631efdd4, PSL_RULE },
+    { "togura.nagano.jp", 0xf7723dd5, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pomorze.pl", 0x15297ddb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ae.flow.ch", 0xb8cf3dde, 0 },
+    { "cn-north-1.amazonaws.com.cn", 0x5f05fddf, 0 },
+    { "ac.il", 0x02c8bde0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lego", 0x8006bde2, PSL_RULE },
+    { "barsy.net", 0x3acd7de3, PSL_RULE },
+    { "org.ar", 0x6f09fde4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "stgstage.dev", 0xabf37de8, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { "s3.us-east-2.amazonaws.com", 0x8a56fdea, PSL_RULE },
+    { "kanan.osaka.jp", 0x5d587deb, PSL_RULE },
+    { "frei.no", 0x3dbffdec, PSL_RULE },
+    { "durban", 0xc61ffded, PSL_RULE },
+    { "franziskaner.museum", 0x75057ded, PSL_RULE },
+    { "furano.hokkaido.jp", 0x02563dee, PSL_RULE },
+    { "nom.br", 0x6e803ded, PSL_WILDCARD },
+    { "org.kn", 0x27e0fdee, PSL_RULE },
+    { "s3-website-us-east-1.amazonaws.com", 0xd5ef7dec, PSL_RULE },
+    { "gen.mi.us", 0x9e22fdf3, PSL_RULE },
+    { "parliament.nz", 0xab173df4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tickets", 0x86a7fdf6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kawara.fukuoka.jp", 0xf1c7bdf8, PSL_RULE },
+    { "xn--mkru45i.jp", 0x5ec9fdf8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "iwaki.fukushima.jp", 0x0f8d3dfb, PSL_RULE },
+    { "edu.do", 0xc7ed7dfc, PSL_RULE },
+    { NULL, 0, 0 },
+    { "impertrix.com", 0x39487dfe, PSL_RULE },
+    { "info.ro", 0x5860bdfe, PSL_RULE },
+    { "aa.no", 0x9ebf3e00, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "discount", 0x480abe04, PSL_RULE },
+    { "axarnet.cloud", 0x84af7e05, 0 },
+    { "ch.eu.org", 0x15557e06, PSL_RULE },
+    { "pages.it.hs-heilbronn.de", 0xb652be06, PSL_RULE },
+    { "trentinsued-tirol.it", 0xa5a17e08, PSL_RULE },
+    { NULL, 0, 0 },
+    { "not.br", 0x1fc63e0a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.technology", 0xb3177e0d, PSL_RULE },
+    { "palmsprings.museum", 0x0f1d7e0d, PSL_RULE },
+    { "toride.ibaraki.jp", 0x8c9ebe0d, PSL_RULE },
+    { "vinnytsia.ua", 0x5eaabe0e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "inf.cu", 0x8b437e14, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kinokawa.wakayama.jp", 0xef7b3e16, PSL_RULE },
+    { "reggio-calabria.it", 0x1cc77e17, PSL_RULE },
+    { "square7.net", 0x6f6f3e16, PSL_RULE },
+    { NULL, 0, 0 },
+    { "resistance.museum", 0x8a84be1a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "123website.nl", 0xf104fe1c, PSL_RULE },
+    { "kaho.fukuoka.jp", 0x1db4fe1c, PSL_RULE },
+    { "org.ir", 0x58013e1c, PSL_RULE },
+    { "supersale.jp", 0xcb60fe1d, PSL_RULE },
+    { "supabase.net", 0xc211be20, PSL_RULE },
+    { "rzgw.gov.pl", 0x4a1ffe21, PSL_RULE },
+    { "modena.it", 0xe4393e22, PSL_RULE },
+    { "udono.mie.jp", 0x4524fe23, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "sosa.chiba.jp", 0x2a1f3e26, PSL_RULE },
+    { "nomi.ishikawa.jp", 0xb3bdfe27, PSL_RULE },
+    { "kpn", 0x2c6a3e28, PSL_RULE },
+    { "ishinomaki.miyagi.jp", 0xb1f37e29, PSL_RULE },
+    { "to.md", 0x4a967e27, PSL_RULE },
+    { NULL, 0, 0 },
+    { "epson", 0x3c7c3e2c, PSL_RULE },
+    { "lima-city.ch", 0x2ce0be2d, PSL_RULE },
+    { "rs.ba", 0x83103e2d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "edu.gp", 0x3c107e32, PSL_RULE },
+    { "kirkenes.no", 0x5be5fe32, PSL_RULE },
+    { "melhus.no", 0x1240fe34, PSL_RULE },
+    { "online.museum", 0xaf31fe34, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "to.it", 0x5b7fbe3b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "histoire.museum", 0xe9f4fe3e, PSL_RULE },
+    { "net.je", 0x75d17e3f, PSL_RULE },
+    { "hdfc", 0xf6d83e40, PSL_RULE },
+    { "net.sc", 0xbaa27e3e, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "navuotna.no", 0xfc773e44, PSL_RULE },
+    { "ravendb.cloud", 0x8ceabe44, PSL_RULE },
+    { "lom.no", 0xa55efe46, PSL_RULE },
+    { NULL, 0, 0 },
+    { "uryu.hokkaido.jp", 0x901d3e48, PSL_RULE },
+    { "from-fl.com", 0xeda1be49, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "val-daosta.it", 0x25827e50, PSL_RULE },
+    { "satosho.okayama.jp", 0xc8143e51, PSL_RULE },
+    { NULL, 0, 0 },
+    { "lib.nm.us", 0x5031be53, PSL_RULE },
+    { "shimane.jp", 0x4ec2be54, PSL_RULE },
+    { NULL, 0, 0 },
+    { "iitate.fukushima.jp", 0x95b7be56, PSL_RULE },
+    { "joboji.iwate.jp", 0x93edfe56, PSL_RULE },
+    { "missoula.museum", 0x35f57e58, PSL_RULE },
+    { "miyazaki.jp", 0xb3a8be58, PSL_RULE },
+    { "simplesite.pl", 0xca17fe5a, PSL_RULE },
+    { "candypop.jp", 0x85137e5b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "cloudycluster.net", 0x1e313e60, PSL_RULE },
+    { "tsurugi.ishikawa.jp", 0xb22cfe61, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "computer.museum", 0xa45e7e66, PSL_RULE },
+    { "info.tz", 0xcab13e67, PSL_RULE },
+    { "si.eu.org", 0x3d537e67, PSL_RULE },
+    { "backyards.banzaicloud.io", 0xe26b7e69, PSL_WILDCARD },
+    { "sch.wf", 0xba507e6a, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fentiger.mythic-beasts.com", 0x77af3e71, PSL_RULE },
+    { "ponpes.id", 0x98e2be71, PSL_RULE },
+    { "uki.kumamoto.jp", 0x37d73e73, PSL_RULE },
+    { NULL, 0, 0 },
+    { "1.bg", 0x22d6fe75, PSL_RULE },
+    { "cremona.it", 0xe00a3e75, PSL_RULE },
+    { "sd.cn", 0x20c4fe75, PSL_RULE },
+    { "hachioji.tokyo.jp", 0x09717e78, PSL_RULE },
+    { "shinonsen.hyogo.jp", 0xeebcbe78, PSL_RULE },
+    { "uwajima.ehime.jp", 0xab52fe75, PSL_RULE },
+    { "tinn.no", 0x90bd7e7b, PSL_RULE },
+    { "yamato.fukushima.jp", 0x48f8be77, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "at-band-camp.net", 0xd4f7fe7f, PSL_RULE },
+    { "ltd.uk", 0x885a3e7f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "fl.us", 0x8b283e83, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kushimoto.wakayama.jp", 0x238dfe86, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "england.museum", 0x943f7e8a, PSL_RULE },
+    { "grane.no", 0x3f02be8b, PSL_RULE },
+    { "catholic", 0x63d03e8c, PSL_RULE },
+    { "rag-cloud.hosteur.com", 0x26037e8a, PSL_RULE },
+    { "edu.pa", 0x99e57e8e, PSL_RULE },
+    { "is-a-socialist.com", 0x64b9fe8e, PSL_RULE },
+    { "compute-1.amazonaws.com", 0x92d93e90, PSL_WILDCARD },
+    { "dynvpn.de", 0x73c6be91, PSL_RULE },
+    { "lib.co.us", 0x30063e92, PSL_RULE },
+    { "mytis.ru", 0xa73efe8e, PSL_RULE },
+    { "lenug.su", 0x7ff6fe94, PSL_RULE },
+    { "lib.wa.us", 0x3e69fe94, PSL_RULE },
+    { "koza.wakayama.jp", 0xff77fe96, PSL_RULE },
+    { "naturbruksgymn.se", 0x6e7abe8f, PSL_RULE },
+    { "ojiya.niigata.jp", 0xd1ee3e8e, PSL_RULE },
+    { "omasvuotna.no", 0x26503e93, PSL_RULE },
+    { "sc.ug", 0x5f25be93, PSL_RULE },
+    { "reggio-emilia.it", 0x42117e9b, PSL_RULE },
+    { "sensiosite.cloud", 0xfaffbe9c, PSL_WILDCARD },
+    { "kagamino.okayama.jp", 0x594abe9d, PSL_RULE },
+    { "kizu.kyoto.jp", 0xd6e4be9e, PSL_RULE },
+    { "co.ke", 0xc69dbe9f, PSL_RULE },
+    { "settsu.osaka.jp", 0x5fc57e9e, PSL_RULE },
+    { "k12.wi.us", 0x35b1bea1, PSL_RULE },
+    { "static.observableusercontent.com", 0xb85e3e99, PSL_RULE },
+    { "cechire.com", 0x78a97ea3, PSL_RULE },
+    { "tz", 0x5967fe9b, PSL_RULE },
+    { "x443.pw", 0x3097fe97, PSL_RULE },
+    { "xn--3hcrj9c", 0x28153e8b, PSL_RULE },
+    { "ce.leg.br", 0x5e413ea7, PSL_RULE },
+    { "zachpomor.pl", 0x09043e94, PSL_RULE },
+    { "liguria.it", 0x2c05fea9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bulsan-suedtirol.it", 0x4194feab, PSL_RULE },
+    { "xn--otu796d", 0x90afbeab, PSL_RULE },
+    { NULL, 0, 0 },
+    { "abira.hokkaido.jp", 0x878fbeae, PSL_RULE },
+    { "me.ke", 0xe8acfeaf, PSL_RULE },
+    { NULL, 0, 0 },
+    { "tobetsu.hokkaido.jp", 0x257cbeb1, PSL_RULE },
+    { "dst.mi.us", 0x41aabeb2, PSL_RULE },
+    { "co.bj", 0x23eebeb3, PSL_RULE },
+    { "et", 0x3c453eb2, PSL_RULE },
+    { "gda.pl", 0x5304beb5, PSL_RULE },
+    { "hamburg.museum", 0x84687eb3, PSL_RULE },
+    { "hoylandet.no", 0xe24cbeb6, PSL_RULE },
+    { "kaluga.su", 0x788afeb8, PSL_RULE },
+    { "damnserver.com", 0x55f83eb9, PSL_RULE },
+    { "freeboxos.fr", 0x3e3f3eba, PSL_RULE },
+    { "pizza", 0xb4b1beb9, PSL_RULE },
+    { "nozawaonsen.nagano.jp", 0xd12f3ebc, PSL_RULE },
+    { "net.az", 0xad12bebd, PSL_RULE },
+    { "engerdal.no", 0xb55fbebe, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "jelastic.open.tim.it", 0x2d957ec1, 0 },
+    { "cr", 0x5e547ec2, PSL_RULE },
+    { "hemsedal.no", 0xa7cafec3, PSL_RULE },
+    { "la.us", 0x6f07bec4, PSL_RULE },
+    { NULL, 0, 0 },
+    { "com.ag", 0xa1d1bec6, PSL_RULE },
+    { NULL, 0, 0 },
+    { "durham.museum", 0x163b3ec8, PSL_RULE },
+    { "inashiki.ibaraki.jp", 0xa0a13ec8, PSL_RULE },
+    { NULL, 0, 0 },
+    { "business", 0x6f4bbecb, PSL_RULE },
+    { "mil.qa", 0x3719becb, PSL_RULE },
+    { "bj", 0x6f3f7ecd, PSL_RULE },
+    { "biz.cy", 0x77803ece, PSL_RULE },
+    { "insurance", 0x66d73ecf, PSL_RULE },
+    { "bnr.la", 0x85c53ed0, PSL_RULE },
+    { "brother", 0xae133ed1, PSL_RULE },
+    { "nt.no", 0xab9efecc, PSL_RULE },
+    { "pe.kr", 0xd964bed1, PSL_RULE },
+    { "computerhistory.museum", 0x33a07ed4, PSL_RULE },
+    { "store.dk", 0xa24fbed1, PSL_RULE },
+    { "etne.no", 0xcbde7ed6, PSL_RULE },
+    { "sdn.gov.pl", 0x3efbbed6, PSL_RULE },
+    { "svelvik.no", 0xbabdbecc, PSL_RULE },
+    { "synology-ds.de", 0x7771bed2, PSL_RULE },
+    { "independent-review.uk", 0x05d73eda, PSL_RULE },
+    { "mobi.na", 0x52043edb, PSL_RULE },
+    { "evennode.com", 0xd53c3edc, 0 },
+    { "washingtondc.museum", 0x550fbed4, PSL_RULE },
+    { "xn--kvnangen-k0a.no", 0x2a507edb, PSL_RULE },
+    { "fylkesbibl.no", 0xe13a7edf, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "yatomi.aichi.jp", 0x6cdb7ee2, PSL_RULE },
+    { "austin.museum", 0x130c3ee3, PSL_RULE },
+    { "id.lv", 0x055abee4, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "chikuma.nagano.jp", 0x4da0feeb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ubank", 0xc823beee, PSL_RULE },
+    { "warszawa.pl", 0xc0fc7eef, PSL_RULE },
+    { "ne.tz", 0xa833fef0, PSL_RULE },
+    { "med.sa", 0x68463ef1, PSL_RULE },
+    { "co.vi", 0xe442fef2, PSL_RULE },
+    { "helsinki", 0xf3f73ef2, PSL_RULE },
+    { "ravendb.run", 0x3c8f7ef0, PSL_RULE },
+    { "alessandria.it", 0x3ff93ef5, PSL_RULE },
+    { "bashkiria.su", 0xc7723ef5, PSL_RULE },
+    { "co.za", 0xe150bef6, PSL_RULE },
+    { "com.lr", 0xe6f23ef8, PSL_RULE },
+    { "tv.bo", 0xda67fef4, PSL_RULE },
+    { "xn--xkc2dl3a5ee0h", 0x84d53eee, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "aquarium.museum", 0x8ba9ff00, PSL_RULE },
+    { "chowder.jp", 0xb11dff01, PSL_RULE },
+    { "koeln.museum", 0x63e8bf00, PSL_RULE },
+    { "net.af", 0x9ca0ff01, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "eu-central-1.elasticbeanstalk.com", 0x6f577f06, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "omuta.fukuoka.jp", 0xdf513f09, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "co.pl", 0x3cb9ff0f, PSL_RULE },
+    { "org.lv", 0xd37e3f0f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "org.fm", 0xa10aff12, PSL_RULE },
+    { "city.nagoya.jp", 0xc9be3f13, PSL_EXCEPTION },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "barsy.ca", 0x9fdf3f16, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nc.us", 0x710c3f18, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "org.gg", 0x6cc4bf1b, PSL_RULE },
+    { "lefrak", 0xa0a8ff1c, PSL_RULE },
+    { "osteroy.no", 0x29df3f1b, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "xn--c1avg.xn--90a3ac", 0xe70dff20, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "government.aero", 0x1bd13f25, PSL_RULE },
+    { "sorreisa.no", 0x9716ff26, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kiyosato.hokkaido.jp", 0x0874ff28, PSL_RULE },
+    { "ikeda.hokkaido.jp", 0xf910bf29, PSL_RULE },
+    { "ne.ug", 0x5a183f2a, PSL_RULE },
+    { "sorocaba.br", 0x4b693f29, PSL_RULE },
+    { "vossevangen.no", 0x780ebf2b, PSL_RULE },
+    { "nabari.mie.jp", 0x7780bf2d, PSL_RULE },
+    { "org.ag", 0x4255ff2d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kumenan.okayama.jp", 0xbb06ff31, PSL_RULE },
+    { "honai.ehime.jp", 0x2a69ff32, PSL_RULE },
+    { "azurecontainer.io", 0x56c7ff33, PSL_WILDCARD },
+    { "n.se", 0xa3787f31, PSL_RULE },
+    { "pacific.museum", 0x50343f34, PSL_RULE },
+    { NULL, 0, 0 },
+    { "microsoft", 0x3cc2bf37, PSL_RULE },
+    { "moss.no", 0xb2947f38, PSL_RULE },
+    { "jnj", 0xbfd63f39, PSL_RULE },
+    { "vardo.no", 0xd9677f3a, PSL_RULE },
+    { "gc.ca", 0x9650bf3b, PSL_RULE },
+    { "point2this.com", 0x53aaff3c, PSL_RULE },
+    { "xn--vgu402c.jp", 0xca727f38, PSL_RULE },
+    { "kuron.jp", 0xc2137f3e, PSL_RULE },
+    { "takanabe.miyazaki.jp", 0x9949bf3f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ac.fj", 0xa2497f41, PSL_RULE },
+    { "b.ssl.fastly.net", 0xaf4c7f41, PSL_RULE },
+    { "xn--mlselv-iua.no", 0x6d22ff43, PSL_RULE },
+    { NULL, 0, 0 },
+    { "moscow.museum", 0x1d8dbf45, PSL_RULE },
+    { "lib.ee", 0x175fbf46, PSL_RULE },
+    { "pol.dz", 0x2bc7ff46, PSL_RULE },
+    { NULL, 0, 0 },
+    { "biz.dk", 0xdd207f49, PSL_RULE },
+    { "botany.museum", 0x3c2f7f4a, PSL_RULE },
+    { "chat", 0xf4373f4b, PSL_RULE },
+    { "gehirn.ne.jp", 0x5d633f4b, PSL_RULE },
+    { "mil.za", 0xe517bf4a, PSL_RULE },
+    { "mobi.gp", 0x85527f4d, PSL_RULE },
+    { "ngo.ph", 0x4f7f7f4b, PSL_RULE },
+    { "press", 0x5a89ff50, PSL_RULE },
+    { "casacam.net", 0xfd1e3f51, PSL_RULE },
+    { "tm.cy", 0x61b7ff50, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "net.sd", 0xd60dbf59, PSL_RULE },
+    { "como.it", 0xdc337f5a, PSL_RULE },
+    { "org.sb", 0x7fbb3f5a, PSL_RULE },
+    { "v.ua", 0x8aaf3f5b, PSL_RULE },
+    { NULL, 0, 0 },
+    { "gjerstad.no", 0x1119bf5e, PSL_RULE },
+    { "sciencehistory.museum", 0x55f4bf5f, PSL_RULE },
+    { NULL, 0, 0 },
+    { "orskog.no", 0x00aa3f61, PSL_RULE },
+    { NULL, 0, 0 },
+    { "wpenginepowered.com", 0x4795ff63, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "kw", 0x6647bf67, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kunden.ortsinfo.at", 0xee8c3f69, PSL_WILDCARD },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "ushiku.ibaraki.jp", 0xf6c2ff6d, PSL_RULE },
+    { "v-info.info", 0xf5e5bf6e, PSL_RULE },
+    { "shizukuishi.iwate.jp", 0xb9be3f6f, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "tv.it", 0x4d413f72, PSL_RULE },
+    { "futtsu.chiba.jp", 0x39133f73, PSL_RULE },
+    { "net.cu", 0x7c4f7f74, PSL_RULE },
+    { "gov.ws", 0xdd727f75, PSL_RULE },
+    { "niimi.okayama.jp", 0x5d8b3f74, PSL_RULE },
+    { "shimada.shizuoka.jp", 0x80edff76, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "barclays", 0x65dc7f7a, PSL_RULE },
+    { "tanabe.wakayama.jp", 0x29aa3f7a, PSL_RULE },
+    { "otofuke.hokkaido.jp", 0x6e7cbf7c, PSL_RULE },
+    { "fhsk.se", 0x48653f7d, PSL_RULE },
+    { "gob.hn", 0xc521bf7d, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "k12.in.us", 0x94aeff84, PSL_RULE },
+    { "mil.ph", 0xe3a17f85, PSL_RULE },
+    { "flesberg.no", 0xa6217f86, PSL_RULE },
+    { "jab.br", 0x7311ff86, PSL_RULE },
+    { "miyama.mie.jp", 0xc33d3f88, PSL_RULE },
+    { "wang", 0xa12c3f84, PSL_RULE },
+    { "bci.dnstrace.pro", 0x9bfbbf8a, PSL_RULE },
+    { "co.ni", 0x8f877f8a, PSL_RULE },
+    { NULL, 0, 0 },
+    { "from-ok.com", 0xd11d7f8d, PSL_RULE },
+    { "do", 0x6b343f8e, PSL_RULE },
+    { NULL, 0, 0 },
+    { "nankoku.kochi.jp", 0xbcf9ff90, PSL_RULE },
+    { "vig", 0x562abf91, PSL_RULE },
+    { "curv.dev", 0xbdee3f92, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ngo.lk", 0x592f3f94, PSL_RULE },
+    { "id.firewalledreplit.co", 0x66003f95, PSL_RULE },
+    { NULL, 0, 0 },
+    { "kawaguchi.saitama.jp", 0x29b2bf97, PSL_RULE },
+    { "srl", 0x4b853f98, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "pr.us", 0x85373f9b, PSL_RULE },
+    { "encoway.cloud", 0x83213f9c, 0 },
+    { "motosu.gifu.jp", 0x6ae43f9d, PSL_RULE },
+    { "hokuryu.hokkaido.jp", 0xaf5bff9e, PSL_RULE },
+    { "fetsund.no", 0x5b383f9f, PSL_RULE },
+    { "bs", 0x3551ffa0, PSL_RULE },
+    { "gov.ye", 0x7adabfa1, PSL_RULE },
+    { "locus", 0x3b967fa1, PSL_RULE },
+    { "medizinhistorisches.museum", 0xe62abfa3, PSL_RULE },
+    { "am.in", 0xc7ab3fa4, PSL_RULE },
+    { "shiogama.miyagi.jp", 0x296e7fa0, PSL_RULE },
+    { "takahashi.okayama.jp", 0x53193f9c, PSL_RULE },
+    { "te.it", 0x5f67bfa1, PSL_RULE },
+    { "dating", 0x56497fa8, PSL_RULE },
+    { "kurobe.toyama.jp", 0x24953fa8, PSL_RULE },
+    { "troitsk.su", 0x681c3f9f, PSL_RULE },
+    { "ck", 0x463cffab, PSL_WILDCARD },
+    { "civilaviation.aero", 0x42e93fac, PSL_RULE },
+    { "hakata.fukuoka.jp", 0x6cd3ffab, PSL_RULE },
+    { "kamagaya.chiba.jp", 0xc4dc7fac, PSL_RULE },
+    { "readthedocs.io", 0xadd23faf, PSL_RULE },
+    { "graphox.us", 0x283e7fb0, PSL_RULE },
+    { "suli.hu", 0x996c7faf, PSL_RULE },
+    { "go.pw", 0xde967fb2, PSL_RULE },
+    { "hanggliding.aero", 0x9ae07fb2, PSL_RULE },
+    { "taketa.oita.jp", 0x95ca3fb4, PSL_RULE },
+    { "ac.ci", 0xbb393fb5, PSL_RULE },
+    { "ujitawara.kyoto.jp", 0x3f063fab, PSL_RULE },
+    { "xn--tckwe", 0x6926ffa9, PSL_RULE },
+    { "ribeirao.br", 0x85e47fb8, PSL_RULE },
+    { "xy.ax", 0x3c1b7f9d, PSL_RULE },
+    { "ybo.review", 0x12e6ffb3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "author.aero", 0x3cf0bfbd, PSL_RULE },
+    { "collection.museum", 0xe6533fbd, PSL_RULE },
+    { "kyonan.chiba.jp", 0x15b97fbe, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "deno.dev", 0x964cbfc2, PSL_RULE },
+    { "fuefuki.yamanashi.jp", 0x782cffc3, PSL_RULE },
+    { "piacenza.it", 0xc266ffc3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "satsumasendai.kagoshima.jp", 0x1fe53fc7, PSL_RULE },
+    { "cdn.prod.atlassian-dev.net", 0xb153ffc8, PSL_RULE },
+    { "games.hu", 0x02787fc9, PSL_RULE },
+    { NULL, 0, 0 },
+    { "ehime.jp", 0x09aa3fcb, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "webview-assets.cloud9.ca-central-1.amazonaws.com", 0x2a2a7fce, PSL_RULE },
+    { "gouv.ml", 0xa2f6bfcf, PSL_RULE },
+    { "cookingchannel", 0xc368bfd0, PSL_RULE },
+    { "dattolocal.com", 0x421cffd1, PSL_RULE },
+    { "tc", 0x4b297fd2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "parasite.jp", 0x4ba5bfd4, PSL_RULE },
+    { "tv.tr", 0x4aa2ffd5, PSL_RULE },
+    { NULL, 0, 0 },
+    { "net.vi", 0xc259ffd7, PSL_RULE },
+    { "troandin.no", 0x9276bfd7, PSL_RULE },
+    { NULL, 0, 0 },
+    { "mil.kz", 0x4a1bbfda, PSL_RULE },
+    { "theshop.jp", 0xee977fda, PSL_RULE },
+    { "losangeles.museum", 0xd97dffdc, PSL_RULE },
+    { "gloppen.no", 0xa0507fdd, PSL_RULE },
+    { NULL, 0, 0 },
+    { "barsyonline.co.uk", 0xce7f7fdf, PSL_RULE },
+    { "edu.bj", 0x008dffdf, PSL_RULE },
+    { "columbia.museum", 0x7dd37fe1, PSL_RULE },
+    { NULL, 0, 0 },
+    { "monza-brianza.it", 0x27febfe3, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "com.co", 0xe7ceffec, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { "filegear-au.me", 0xc36b7fef, PSL_RULE },
+    { "amex", 0x42f2fff0, PSL_RULE },
+    { NULL, 0, 0 },
+    { "eastcoast.museum", 0x88553ff2, PSL_RULE },
+    { NULL, 0, 0 },
+    { "bristol.museum", 0x75c1bff4, PSL_RULE },
+    { "bg.it", 0x616c3ff5, PSL_RULE },
+    { "qld.gov.au", 0x25743ff4, PSL_RULE },
+    { "asso.km", 0x6ca17ff7, PSL_RULE },
+    { "monza.it", 0xadffbff7, PSL_RULE },
+    { "wixsite.com", 0x5f0abff7, PSL_RULE },
+    { "rimini.it", 0x9851fffa, PSL_RULE },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+    { NULL, 0, 0 },
+};
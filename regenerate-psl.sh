@@ -0,0 +1,156 @@
+#!/bin/sh
+
+# Generates public-suffix.c from the Public Suffix List, for
+# Url_domain().  The list can be given as an argument; otherwise, the
+# copy which most Linux distributions install is used.
+
+PSL=${1:-/usr/share/publicsuffix/public_suffix_list.dat}
+
+exec perl -CSD -e '
+    use integer;
+
+    # Punycode (RFC 3492), since Url_domain() is given hosts the way
+    # they appear in URLs, with internationalized labels in ASCII
+    sub adapt {
+        my ($delta, $numPoints, $first) = @_;
+        $delta = ($first ? $delta / 700 : $delta / 2);
+        $delta += $delta / $numPoints;
+        my $k = 0;
+        while ($delta > 455) {
+            $delta /= 35;
+            $k += 36;
+        }
+        return $k + (36 * $delta) / ($delta + 38);
+    }
+
+    sub digit {
+        return chr ($_[0] < 26 ? $_[0] + 97 : $_[0] + 22);
+    }
+
+    sub punycode {
+        my @in = unpack ("U*", $_[0]);
+        my ($n, $delta, $bias) = (128, 0, 72);
+        my $out = join ("", map { chr } grep { $_ < 128 } @in);
+        my $basic = length ($out);
+        my $h = $basic;
+
+        $out .= "-" if ($basic > 0);
+
+        while ($h < @in) {
+            my ($m) = sort { $a <=> $b } grep { $_ >= $n } @in;
+            $delta += ($m - $n) * ($h + 1);
+            $n = $m;
+
+            foreach my $c (@in) {
+                $delta++ if ($c < $n);
+                next unless ($c == $n);
+
+                my $q = $delta;
+                for (my $k = 36; ; $k += 36) {
+                    my $t = ($k <= $bias ? 1 :
+                             $k >= $bias + 26 ? 26 : $k - $bias);
+                    last if ($q < $t);
+                    $out .= digit ($t + ($q - $t) % (36 - $t));
+                    $q = ($q - $t) / (36 - $t);
+                }
+
+                $out .= digit ($q);
+                $bias = adapt ($delta, $h + 1, $h == $basic);
+                $delta = 0;
+                $h++;
+            }
+
+            $delta++;
+            $n++;
+        }
+
+        return $out;
+    }
+
+    # lower case (by code point, not by byte), then each label with
+    # anything but ASCII in its "xn--" form
+    sub to_ascii {
+        return join (".", map { /[^\x00-\x7f]/ ? "xn--" . punycode ($_) : $_ }
+                          split (/\./, lc $_[0], -1));
+    }
+
+    die "punycode is broken\n"
+        unless (to_ascii ("\x{4E2D}\x{56FD}") eq "xn--fiqs8s" &&
+                to_ascii ("b\x{FC}cher.de") eq "xn--bcher-kva.de");
+
+    my %flags;
+
+    while (<>) {
+        s,//.*,,;
+        next unless /^\s*(\S+)/;
+        my $rule = to_ascii ($1);
+        my $flag = "PSL_RULE";
+
+        if ($rule =~ s/^!//) {
+            $flag = "PSL_EXCEPTION";
+        } elsif ($rule =~ s/^\*\.//) {
+            $flag = "PSL_WILDCARD";
+        }
+
+        $flags{$rule}{$flag} = 1;
+
+        # every parent is in the table too, so the search can stop
+        # as soon as a suffix of the host is not
+        my $parent = $rule;
+        while ($parent =~ s/^[^.]*\.//) {
+            $flags{$parent} ||= {};
+        }
+    }
+
+    # FNV-1a of the bytes of the name, from last to first, so that
+    # Url_domain() can add one label at a time
+    sub psl_hash {
+        my $h = 2166136261;
+        foreach my $c (reverse unpack ("C*", $_[0])) {
+            $h = (($h ^ $c) * 16777619) & 0xffffffff;
+        }
+        return $h;
+    }
+
+    my $count = scalar keys %flags;
+    my $size = 1;
+    $size *= 2 while ($size < $count * 3 / 2);
+
+    # open addressing, with linear probing; the names are placed in
+    # sorted order so the output is the same every time
+    my @table;
+    foreach my $name (sort keys %flags) {
+        my $h = psl_hash ($name);
+        my $i = $h & ($size - 1);
+        $i = ($i + 1) & ($size - 1) while (defined $table[$i]);
+        $table[$i] = [$name, $h];
+    }
+
+    print <<"END";
+/* Generated by regenerate-psl.sh from the Public Suffix List
+ * (https://publicsuffix.org/), which is subject to the terms of the
+ * Mozilla Public License, v. 2.0 (https://mozilla.org/MPL/2.0/).
+ * Do not edit.
+ */
+
+#include "whence.h"
+
+const size_t pslTableSize = $size;      /* for $count names */
+
+const PslRule pslTable[$size] = {
+END
+
+    for (my $i = 0; $i < $size; $i++) {
+        if (! defined $table[$i]) {
+            print "    { NULL, 0, 0 },\n";
+            next;
+        }
+
+        my ($name, $h) = @{$table[$i]};
+        my $f = join (" | ", sort keys %{$flags{$name}}) || "0";
+        $name =~ s/([^\x20-\x7e]|["\\\\])/sprintf ("\\%03o", ord $1)/ge;
+        printf ("    { \"%s\", 0x%08x, %s },\n", $name, $h, $f);
+    }
+
+    print "};\n";
+' "$PSL" > public-suffix.c
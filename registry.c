@@ -49,8 +49,7 @@ static char *get_reg (HKEY key, const char *subkey) {
         goto done;
     }
 
-    wresult = malloc (len);
-    CHECK_NULL (wresult);
+    wresult = MY_MALLOC (len);
     st = RegGetValue (key, wsubkey, wvalue,
                       RRF_RT_REG_SZ, NULL, wresult, &len);
     if (st != ERROR_SUCCESS) {
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/* --sample chooses files by a hash of their path, rather than by
+ * calling rand(), so that the same tree always gives the same sample,
+ * and so that which files are chosen doesn't depend on the order the
+ * threads happen to find them in.
+ *
+ * With a RATE, a file is chosen if its hash falls in the lowest RATE
+ * fraction of the hash space, which is decided on the spot.  With a
+ * COUNT, the files with the COUNT lowest hashes are chosen (a "bottom-k"
+ * sample), which can't be known until the whole tree has been seen;
+ * until then, the best COUNT so far are kept in a max-heap.
+ */
+
+#define Z_95 1.959963984540054  /* for 95% confidence intervals */
+#define TOP_DOMAINS 10          /* number of domains in the report */
+
+typedef struct Chosen {
+    uint64_t hash;
+    char *path;                 /* malloced */
+} Chosen;
+
+struct Sample {
+    uint64_t threshold;         /* RATE: choose if hash < threshold... */
+    bool everything;            /* ...or choose every file */
+    size_t count;               /* COUNT, or 0 if sampling at a RATE */
+    atomic_uint_fast64_t nSeen; /* number of files offered */
+    pthread_mutex_t lock;       /* protects everything below */
+    Chosen *heap;               /* COUNT: max-heap of "count" slots */
+    size_t nHeap;
+    uint64_t nSampled;          /* files whose attributes were read */
+    uint64_t nProvenance;       /* ...and which had some attributes */
+    uint64_t nErrors;           /* ...or which couldn't be read */
+    Tally *domains;             /* host of URL (or referrer) -> count */
+};
+
+/* The finalizer from SplitMix64.  hashString() is also used by
+ * --shard, so scramble it further, to keep the files which are sampled
+ * from being correlated with the files in any given shard. */
+static uint64_t mix (uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static Sample *new_sample (void) {
+    Sample *s = MY_MALLOC (sizeof (*s));
+
+    memset (s, 0, sizeof (*s));
+    atomic_init (&s->nSeen, 0);
+    pthread_mutex_init (&s->lock, NULL);
+    s->domains = Tally_new ();
+    return s;
+}
+
+Sample *Sample_newRate (double rate) {
+    Sample *s = new_sample ();
+
+    if (rate >= 1.0) {
+        s->everything = true;
+    } else {
+        /* 2^64 */
+        s->threshold = (uint64_t) (rate * 18446744073709551616.0);
+    }
+
+    return s;
+}
+
+Sample *Sample_newCount (size_t count) {
+    Sample *s = new_sample ();
+
+    s->count = count;
+    s->heap = MY_MALLOC (count * sizeof (Chosen));
+    return s;
+}
+
+void Sample_free (Sample *s) {
+    size_t i;
+
+    for (i = 0; i < s->nHeap; i++) {
+        free (s->heap[i].path);
+    }
+
+    free (s->heap);
+    Tally_free (s->domains);
+    pthread_mutex_destroy (&s->lock);
+    free (s);
+}
+
+static void sift_down (Chosen *heap, size_t n, size_t i) {
+    for ( ; ; ) {
+        const size_t left = 2 * i + 1;
+        const size_t right = left + 1;
+        size_t most = i;
+
+        if (left < n && heap[left].hash > heap[most].hash) {
+            most = left;
+        }
+
+        if (right < n && heap[right].hash > heap[most].hash) {
+            most = right;
+        }
+
+        if (most == i) {
+            return;
+        }
+
+        const Chosen tmp = heap[i];
+        heap[i] = heap[most];
+        heap[most] = tmp;
+        i = most;
+    }
+}
+
+static void sift_up (Chosen *heap, size_t i) {
+    while (i > 0) {
+        const size_t parent = (i - 1) / 2;
+
+        if (heap[parent].hash >= heap[i].hash) {
+            return;
+        }
+
+        const Chosen tmp = heap[i];
+        heap[i] = heap[parent];
+        heap[parent] = tmp;
+        i = parent;
+    }
+}
+
+bool Sample_offer (Sample *s, const char *path) {
+    atomic_fetch_add_explicit (&s->nSeen, 1, memory_order_relaxed);
+
+    const uint64_t h = mix (hashString (path));
+
+    if (s->count == 0) {
+        return (s->everything || h < s->threshold);
+    }
+
+    pthread_mutex_lock (&s->lock);
+
+    if (s->nHeap < s->count) {
+        s->heap[s->nHeap].hash = h;
+        s->heap[s->nHeap].path = MY_STRDUP (path);
+        sift_up (s->heap, s->nHeap++);
+    } else if (h < s->heap[0].hash) {
+        free (s->heap[0].path);
+        s->heap[0].hash = h;
+        s->heap[0].path = MY_STRDUP (path);
+        sift_down (s->heap, s->nHeap, 0);
+    }
+
+    pthread_mutex_unlock (&s->lock);
+    return false;
+}
+
+static int compare_paths (const void *a, const void *b) {
+    return strcmp (*(char *const *) a, *(char *const *) b);
+}
+
+char **Sample_take (Sample *s, size_t *n) {
+    char **paths = MY_MALLOC ((s->nHeap + 1) * sizeof (char *));
+    size_t i;
+
+    for (i = 0; i < s->nHeap; i++) {
+        paths[i] = s->heap[i].path;
+    }
+
+    *n = s->nHeap;
+    s->nHeap = 0;
+
+    qsort (paths, *n, sizeof (char *), compare_paths);
+    return paths;
+}
+
+void Sample_record (Sample *s, const Attributes *attrs, ErrorCode ec) {
+    const char *url = (attrs->url != NULL ? attrs->url : attrs->referrer);
+    const char *host = NULL;
+    size_t hostLen = 0, i;
+    char buf[256];
+
+    pthread_mutex_lock (&s->lock);
+
+    s->nSampled++;
+    if (ec == EC_OK) {
+        s->nProvenance++;
+    } else if (ec != EC_NOATTR) {
+        s->nErrors++;
+    }
+
+    if (ec == EC_OK && url != NULL && Url_host (url, &host, &hostLen) &&
+        hostLen < sizeof (buf)) {
+        for (i = 0; i < hostLen; i++) {
+            buf[i] = tolower ((unsigned char) host[i]);
+        }
+        buf[hostLen] = 0;
+        Tally_add (s->domains, buf, 1);
+    }
+
+    pthread_mutex_unlock (&s->lock);
+}
+
+/* Computes the 95% Wilson score interval for a proportion, given "x"
+ * successes in a sample of "n" drawn without replacement from a
+ * population of "N".  The finite population correction is applied by
+ * scaling z, so that the interval shrinks to exactly x/n as the sample
+ * approaches the whole population.
+ */
+static void wilson (uint64_t x, uint64_t n, uint64_t N,
+                    double *lo, double *hi) {
+    if (n == 0) {
+        *lo = 0.0;
+        *hi = 1.0;
+        return;
+    }
+
+    const double p = (double) x / n;
+    const double fpc = (N > 1 && N >= n ? (double) (N - n) / (N - 1) : 1.0);
+    const double z2 = Z_95 * Z_95 * fpc;
+    const double denom = 1.0 + z2 / n;
+    const double center = (p + z2 / (2.0 * n)) / denom;
+    const double half =
+        sqrt (z2 * (p * (1.0 - p) / n + z2 / (4.0 * n * n))) / denom;
+
+    *lo = (center - half < 0.0 ? 0.0 : center - half);
+    *hi = (center + half > 1.0 ? 1.0 : center + half);
+}
+
+static void report_line (const char *label,
+                         uint64_t x, uint64_t n, uint64_t N) {
+    double lo, hi;
+
+    wilson (x, n, N, &lo, &hi);
+    fprintf (stderr, "  %-30s %10llu %7.3f%%  %7.3f%% - %7.3f%%  "
+             "%12.0f - %.0f\n",
+             label, (unsigned long long) x,
+             (n == 0 ? 0.0 : 100.0 * x / n),
+             100.0 * lo, 100.0 * hi, lo * N, hi * N);
+}
+
+void Sample_report (Sample *s) {
+    const uint64_t N = atomic_load (&s->nSeen);
+    const uint64_t n = s->nSampled;
+    const TallyEntry **sorted = Tally_sorted (s->domains);
+    size_t i;
+
+    fflush (stdout);
+
+    fprintf (stderr, "\nSampled %llu of %llu files.  "
+             "Estimates are given with 95%% confidence intervals.\n\n",
+             (unsigned long long) n, (unsigned long long) N);
+    fprintf (stderr, "  %-30s %10s %8s  %-19s  %s\n",
+             "", "Sampled", "Percent", "Interval", "Estimated files");
+    report_line ("With provenance", s->nProvenance, n, N);
+    report_line ("Errors", s->nErrors, n, N);
+
+    if (sorted[0] != NULL) {
+        fprintf (stderr, "\n  Top domains:\n");
+    }
+
+    for (i = 0; i < TOP_DOMAINS && sorted[i] != NULL; i++) {
+        report_line (sorted[i]->key, sorted[i]->count, n, N);
+    }
+
+    free (sorted);
+}
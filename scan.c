@@ -0,0 +1,1400 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/* The scan is done by a pool of worker threads.  Each worker owns a
+ * deque of jobs, where a job is either a directory to be read, or a
+ * single file named on the command line.  A worker pushes the
+ * subdirectories it finds onto the bottom of its own deque, and pops
+ * jobs from the bottom, so each worker proceeds depth-first.  When a
+ * worker's deque is empty, it steals the oldest job from the top of
+ * some other worker's deque.  The oldest jobs tend to be the ones
+ * nearest the root, and therefore the biggest, so a few steals are
+ * enough to spread even a single huge subtree across all the workers.
+ *
+ * Each worker formats its results into its own StrBuf, and only takes
+ * the output lock (in Output_write()) when the buffer fills up.
+ *
+ * With --checkpoint, a worker instead holds on to the output of a job,
+ * and the subdirectories it finds, until the job is finished, and then
+ * publishes them together (see publish()).  That way, every job is
+ * either finished, with all its output written, or else still in the
+ * frontier, with none of its output written, and a checkpoint only has
+ * to record the frontier.
+ *
+ * With --max-memory, half of the budget is for jobs waiting in the
+ * deques; jobs beyond that go to a spill file on disk, which workers
+ * turn to when there is nothing left to steal.  A quarter is split
+ * between the workers' --inode-order listings, which are processed in
+ * batches when they reach their share, and an eighth between their
+ * output buffers, which are flushed when they reach theirs.  The last
+ * eighth is left for the queue of buffers waiting to be written.
+ */
+
+#define FLUSH_THRESHOLD (64 * 1024)
+#define MIN_FLUSH_THRESHOLD 4096
+#define MIN_LIST_LIMIT (64 * 1024)
+#define CHECKPOINT_INTERVAL 60  /* seconds */
+
+/* For --file-timeout: the most devices remembered as having hung, and
+ * the most lookup threads left behind, blocked, in the whole scan. */
+#define MAX_HUNG 64
+#define MAX_ABANDONED 64
+
+/* For --background: every THROTTLE_INTERVAL seconds, the number of
+ * workers allowed to run is halved if some task was stalled on I/O for
+ * at least PRESSURE_HIGH percent of the last 10 seconds, reduced by one
+ * above PRESSURE_SOME, and increased by one below PRESSURE_LOW. */
+#define THROTTLE_INTERVAL 2     /* seconds */
+#define PRESSURE_HIGH 20.0
+#define PRESSURE_SOME 5.0
+#define PRESSURE_LOW 1.0
+
+/* A directory to be read, or just a file.  This is the same as a job
+ * in a checkpoint. */
+typedef FrontierJob Job;
+
+typedef struct WorkDeque {
+    pthread_mutex_t lock;
+    Job *jobs;                  /* malloced array of "capacity" jobs */
+    size_t top;                 /* oldest job; thieves take from here */
+    size_t bottom;              /* one past newest job; owner uses this end */
+    size_t capacity;
+} WorkDeque;
+
+typedef struct Scan Scan;
+
+typedef struct Worker {
+    Scan *scan;
+    size_t index;               /* index of this worker in scan->workers */
+    pthread_t thread;
+    WorkDeque deque;
+    Cache cache;
+    StrBuf out;                 /* formatted records not yet written */
+    size_t nRecords;            /* number of records in "out" */
+    ErrorCode ec;               /* combination of all files processed */
+    size_t victim;              /* next worker to try stealing from */
+    Job current;                /* --checkpoint: the job in progress... */
+    bool busy;                  /* ...if this is true */
+    WorkDeque children;         /* --checkpoint: directories not yet pushed */
+    Spill *childSpill;          /* ...and those over --max-memory, or NULL */
+    FILE *outSpill;             /* --checkpoint: output over --max-memory */
+    uint64_t outSpillLen;       /* bytes in outSpill */
+    uint64_t jobFiles;          /* files processed for the current job */
+    uint64_t jobEntries;        /* entries of its directory done so far */
+    bool cutShort;              /* the --deadline stopped it mid-file */
+    Prober *prober;             /* --file-timeout or --deadline, or NULL */
+} Worker;
+
+struct Scan {
+    const ScanOptions *opts;
+    Worker *workers;
+    size_t nWorkers;
+    pthread_mutex_t lock;       /* protects "pending" and "idle" */
+    pthread_cond_t cond;        /* signalled when work appears or ends */
+    size_t pending;             /* jobs pushed but not yet finished */
+    size_t idle;                /* workers waiting for a job */
+    InodeSet *inodes;           /* for --dedup, or NULL */
+    bool drawing;               /* reading the files chosen by --sample */
+    bool checkpointing;         /* --checkpoint was given */
+    pthread_mutex_t progress;   /* --checkpoint: protects the frontier */
+    uint64_t nDirs;             /* directories finished (under progress) */
+    uint64_t nFiles;            /* files finished (under progress) */
+    pthread_cond_t cpCond;      /* broadcast when "finished" is set */
+    bool finished;              /* the scan is over (under lock) */
+    Spill *spill;               /* --max-memory: jobs on disk, or NULL */
+    atomic_size_t queuedBytes;  /* memory used by jobs in the deques */
+    size_t queueLimit;          /* ...which spill to disk beyond this */
+    size_t flushThreshold;      /* size at which to flush output */
+    size_t listLimit;           /* size of an --inode-order batch */
+    atomic_bool expired;        /* the --deadline has passed */
+    _Atomic uint64_t hung[MAX_HUNG]; /* devices where a lookup timed out */
+    atomic_size_t nHung;
+    atomic_size_t nAbandoned;   /* Probers left blocked in a lookup */
+    atomic_size_t allowed;      /* workers allowed to run (--background) */
+    pthread_cond_t throttleCond; /* broadcast when "allowed" goes up */
+};
+
+static void Deque_init (WorkDeque *dq) {
+    memset (dq, 0, sizeof (*dq));
+    pthread_mutex_init (&dq->lock, NULL);
+}
+
+static void Deque_cleanup (WorkDeque *dq) {
+    size_t i;
+
+    for (i = dq->top; i < dq->bottom; i++) {
+        free (dq->jobs[i].path);
+    }
+
+    free (dq->jobs);
+    pthread_mutex_destroy (&dq->lock);
+}
+
+static void Deque_push (WorkDeque *dq, Job job) {
+    pthread_mutex_lock (&dq->lock);
+
+    if (dq->bottom >= dq->capacity) {
+        if (dq->top > 0) {
+            /* slide the jobs down to reuse the space at the top */
+            memmove (dq->jobs, dq->jobs + dq->top,
+                     (dq->bottom - dq->top) * sizeof (Job));
+            dq->bottom -= dq->top;
+            dq->top = 0;
+        }
+
+        if (dq->bottom >= dq->capacity) {
+            size_t newCap = dq->capacity * 2;
+            if (newCap < 16) {
+                newCap = 16;
+            }
+            dq->jobs = MY_REALLOC (dq->jobs, newCap * sizeof (Job));
+            dq->capacity = newCap;
+        }
+    }
+
+    dq->jobs[dq->bottom++] = job;
+    pthread_mutex_unlock (&dq->lock);
+}
+
+static bool Deque_pop (WorkDeque *dq, Job *job) {
+    bool ret = false;
+
+    pthread_mutex_lock (&dq->lock);
+    if (dq->bottom > dq->top) {
+        *job = dq->jobs[--dq->bottom];
+        ret = true;
+    }
+    pthread_mutex_unlock (&dq->lock);
+
+    return ret;
+}
+
+static bool Deque_steal (WorkDeque *dq, Job *job) {
+    bool ret = false;
+
+    pthread_mutex_lock (&dq->lock);
+    if (dq->bottom > dq->top) {
+        *job = dq->jobs[dq->top++];
+        ret = true;
+    }
+    pthread_mutex_unlock (&dq->lock);
+
+    return ret;
+}
+
+/* Roughly how much memory a job in a deque takes. */
+static size_t job_cost (const Job *job) {
+    return sizeof (Job) + strlen (job->path) + 1;
+}
+
+/* Adds "job" to the deque of "w", or if the jobs in the deques are
+ * already using their share of --max-memory, to the spill file.  The
+ * caller must already have counted the job as pending.
+ */
+static void enqueue (Worker *w, Job job) {
+    Scan *scan = w->scan;
+    const size_t cost = job_cost (&job);
+
+    if (scan->spill != NULL &&
+        atomic_load (&scan->queuedBytes) + cost > scan->queueLimit &&
+        Spill_push (scan->spill, &job)) {
+        free (job.path);
+        return;
+    }
+
+    atomic_fetch_add (&scan->queuedBytes, cost);
+    Deque_push (&w->deque, job);
+}
+
+static void push_job (Worker *w,
+                      char *path,
+                      bool isDir,
+                      uint64_t rootDevice,
+                      uint64_t skip) {
+    Scan *scan = w->scan;
+    Job job;
+
+    job.path = path;
+    job.isDir = isDir;
+    job.rootDevice = rootDevice;
+    job.skip = skip;
+
+    /* The job must be counted as pending before anyone can steal it,
+     * or the count could drop to zero while there is still work. */
+    pthread_mutex_lock (&scan->lock);
+    scan->pending++;
+    enqueue (w, job);
+    if (scan->idle > 0) {
+        pthread_cond_signal (&scan->cond);
+    }
+    pthread_mutex_unlock (&scan->lock);
+}
+
+/* Pushes a subdirectory found by the current job, or with --checkpoint,
+ * holds on to it until the job is published. */
+static void push_child (Worker *w, char *path, uint64_t rootDevice) {
+    Scan *scan = w->scan;
+
+    if (scan->checkpointing) {
+        Job job;
+
+        job.path = path;
+        job.isDir = true;
+        job.rootDevice = rootDevice;
+        job.skip = 0;
+
+        const size_t cost = job_cost (&job);
+
+        if (scan->spill != NULL &&
+            atomic_load (&scan->queuedBytes) + cost > scan->queueLimit) {
+            if (w->childSpill == NULL) {
+                w->childSpill = Spill_new ();
+            }
+            if (Spill_push (w->childSpill, &job)) {
+                free (path);
+                return;
+            }
+        }
+
+        atomic_fetch_add (&scan->queuedBytes, cost);
+        Deque_push (&w->children, job);
+    } else {
+        push_job (w, path, true, rootDevice, 0);
+    }
+}
+
+/* Wakes every worker waiting for a job, or waiting to be allowed to
+ * run.  Must be called with scan->lock held. */
+static void wake_all (Scan *scan) {
+    pthread_cond_broadcast (&scan->cond);
+    pthread_cond_broadcast (&scan->throttleCond);
+}
+
+/* Returns true if the --deadline has passed.  Must be called with
+ * scan->lock held; the caller should wake any idle workers. */
+static bool past_deadline (Scan *scan) {
+    if (scan->opts->deadline == 0) {
+        return false;
+    } else if (atomic_load (&scan->expired)) {
+        return true;
+    } else if (currentTime () < scan->opts->deadline) {
+        return false;
+    }
+
+    atomic_store (&scan->expired, true);
+    return true;
+}
+
+/* Returns true if the --deadline has passed, in which case the scan
+ * winds down: workers finish the file they are on, and take no more
+ * jobs.  Must not be called with scan->lock held. */
+static bool out_of_time (Scan *scan) {
+    if (scan->opts->deadline == 0) {
+        return false;
+    }
+
+    pthread_mutex_lock (&scan->lock);
+    const bool expired = past_deadline (scan);
+    if (expired) {
+        wake_all (scan);
+    }
+    pthread_mutex_unlock (&scan->lock);
+
+    return expired;
+}
+
+static void finish_job (Worker *w, Job *job) {
+    Scan *scan = w->scan;
+
+    free (job->path);
+
+    pthread_mutex_lock (&scan->lock);
+    scan->pending--;
+    if (scan->pending == 0) {
+        wake_all (scan);
+    }
+    pthread_mutex_unlock (&scan->lock);
+}
+
+static bool try_steal (Worker *w, Job *job) {
+    Scan *scan = w->scan;
+    size_t i;
+
+    for (i = 0; i < scan->nWorkers; i++) {
+        const size_t v = (w->victim + i) % scan->nWorkers;
+        if (v != w->index && Deque_steal (&scan->workers[v].deque, job)) {
+            w->victim = v;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Takes a job from our own deque (if "own" is true) or someone else's.
+ * With --checkpoint, the job is recorded as being in progress in the
+ * same critical section, so that a checkpoint can't miss it.
+ */
+static bool take_job (Worker *w, Job *job, bool own) {
+    Scan *scan = w->scan;
+
+    if (scan->checkpointing) {
+        pthread_mutex_lock (&scan->progress);
+    }
+
+    bool ret = ((own && Deque_pop (&w->deque, job)) || try_steal (w, job));
+
+    if (ret) {
+        atomic_fetch_sub (&scan->queuedBytes, job_cost (job));
+    } else if (scan->spill != NULL) {
+        ret = Spill_pop (scan->spill, job);
+    }
+
+    if (scan->checkpointing) {
+        if (ret) {
+            w->current = *job;
+            w->busy = true;
+        }
+        pthread_mutex_unlock (&scan->progress);
+    }
+
+    return ret;
+}
+
+/* With --background, returns true if "w" isn't one of the workers
+ * which the I/O pressure allows to run. */
+static bool throttled (const Worker *w) {
+    return (w->index >= atomic_load (&w->scan->allowed));
+}
+
+/* Waits on "cond", with scan->lock held, but no later than the
+ * --deadline. */
+static void wait_for (Scan *scan, pthread_cond_t *cond) {
+    if (scan->opts->deadline != 0) {
+        struct timespec ts;
+
+        ts.tv_sec = (time_t) (scan->opts->deadline / 1000000000);
+        ts.tv_nsec = (long) (scan->opts->deadline % 1000000000);
+        pthread_cond_timedwait (cond, &scan->lock, &ts);
+    } else {
+        pthread_cond_wait (cond, &scan->lock);
+    }
+}
+
+/* Gets the next job for worker "w", waiting if necessary.  Returns
+ * false when there is no more work to be done by anyone.
+ */
+static bool get_job (Worker *w, Job *job) {
+    Scan *scan = w->scan;
+
+    if (out_of_time (scan)) {
+        return false;
+    } else if (! throttled (w) && take_job (w, job, true)) {
+        return true;
+    }
+
+    pthread_mutex_lock (&scan->lock);
+
+    for ( ; ; ) {
+        if (scan->pending == 0 || past_deadline (scan)) {
+            wake_all (scan);
+            pthread_mutex_unlock (&scan->lock);
+            return false;
+        }
+
+        if (throttled (w)) {
+            /* not counted as idle, so push_job() doesn't wake us */
+            wait_for (scan, &scan->throttleCond);
+            continue;
+        }
+
+        /* Jobs are pushed before scan->lock is taken to signal us,
+         * so checking again while holding the lock can't miss one. */
+        if (take_job (w, job, false)) {
+            pthread_mutex_unlock (&scan->lock);
+            return true;
+        }
+
+        scan->idle++;
+        wait_for (scan, &scan->cond);
+        scan->idle--;
+    }
+}
+
+static void flush_output (Worker *w) {
+    /* first whatever was put aside by spill_output() */
+    if (w->outSpillLen > 0) {
+        StrBuf buf;
+        uint64_t left = w->outSpillLen;
+
+        SB_init (&buf);
+        seekFile (w->outSpill, 0);
+
+        while (left > 0) {
+            const size_t n = (left < FLUSH_THRESHOLD ? left : FLUSH_THRESHOLD);
+
+            /* Output_write() may swap the buffer for another */
+            SB_reserve (&buf, n);
+            if (fread (buf.buf, 1, n, w->outSpill) != n) {
+                err_printf (CMD_NAME ": could not read temporary file");
+                exit (EC_OTHER);
+            }
+            buf.len = n;
+            Output_write (&buf);
+            left -= n;
+        }
+
+        SB_cleanup (&buf);
+        w->outSpillLen = 0;
+    }
+
+    Output_write (&w->out);
+    w->nRecords = 0;
+}
+
+/* With --checkpoint and --max-memory, moves the output of the current
+ * job to a temporary file, until publish() can write it.  Returns false
+ * if there is no temporary file to move it to. */
+static bool spill_output (Worker *w) {
+    if (w->outSpill == NULL) {
+        w->outSpill = tempFile ();
+        if (w->outSpill == NULL) {
+            return false;
+        }
+    }
+
+    if (! seekFile (w->outSpill, w->outSpillLen) ||
+        fwrite (w->out.buf, 1, w->out.len, w->outSpill) != w->out.len) {
+        err_printf (CMD_NAME ": could not write temporary file");
+        exit (EC_OTHER);
+    }
+
+    w->outSpillLen += w->out.len;
+    SB_clear (&w->out);
+    return true;
+}
+
+static void emit (Worker *w, const char *path, const Attributes *attr) {
+    /* With --summary or --top, the file is only counted. */
+    if (w->scan->opts->summary != NULL) {
+        if (attr->same_as == NULL) {
+            Summary_record (w->scan->opts->summary, w->index, attr);
+        }
+        return;
+    } else if (w->scan->opts->top != NULL) {
+        if (attr->same_as == NULL) {
+            Top_record (w->scan->opts->top, w->index, attr);
+        }
+        return;
+    }
+
+    if (w->nRecords > 0) {
+        SB_add (&w->out, Output_separator ());
+    }
+
+    Attr_print (attr, path, w->scan->opts->style, w->scan->opts->fields,
+                w->scan->opts->format, &w->out);
+    w->nRecords++;
+
+    if (w->scan->checkpointing) {
+        /* wait for publish() */
+        if (w->scan->spill != NULL && w->out.len >= w->scan->flushThreshold) {
+            spill_output (w);
+        }
+        return;
+    }
+
+    if (w->out.len >= w->scan->flushThreshold ||
+        stdoutTerminal.is_terminal) {
+        flush_output (w);
+    }
+}
+
+/* With --checkpoint, writes the output of the job "job", and pushes
+ * the subdirectories it found, in one critical section, so a checkpoint
+ * sees either all or none of it.  If the --deadline cut the job short,
+ * it is put back, in the same critical section, to carry on from
+ * job->skip entries into the directory; so every slice of a scan makes
+ * progress, however big the directory.
+ */
+static void publish (Worker *w, const Job *job, bool finished) {
+    Scan *scan = w->scan;
+    const size_t nChildren = (w->children.bottom - w->children.top +
+                              (w->childSpill == NULL ? 0 :
+                               Spill_count (w->childSpill)));
+    Job child;
+
+    /* as in push_job(), count the children before they can be stolen */
+    pthread_mutex_lock (&scan->lock);
+    scan->pending += nChildren;
+    pthread_mutex_unlock (&scan->lock);
+
+    pthread_mutex_lock (&scan->progress);
+
+    flush_output (w);
+
+    while (Deque_steal (&w->children, &child)) {
+        atomic_fetch_sub (&scan->queuedBytes, job_cost (&child));
+        enqueue (w, child);
+    }
+
+    while (w->childSpill != NULL && Spill_pop (w->childSpill, &child)) {
+        enqueue (w, child);
+    }
+
+    if (! finished) {
+        atomic_fetch_add (&scan->queuedBytes, job_cost (job));
+        Deque_push (&w->deque, *job);
+    } else if (job->isDir) {
+        scan->nDirs++;
+    }
+
+    scan->nFiles += w->jobFiles;
+    w->jobFiles = 0;
+    w->busy = false;
+
+    pthread_mutex_unlock (&scan->progress);
+
+    if (nChildren > 0) {
+        pthread_mutex_lock (&scan->lock);
+        if (scan->idle > 0) {
+            pthread_cond_broadcast (&scan->cond);
+        }
+        pthread_mutex_unlock (&scan->lock);
+    }
+}
+
+/* Prints "errmsg" as the error for "path", and takes ownership of it. */
+static void report_error (Worker *w,
+                          const char *path,
+                          ErrorCode ec,
+                          char *errmsg) {
+    Attributes attr;
+
+    Attr_init (&attr);
+    attr.error = errmsg;
+    emit (w, path, &attr);
+    Attr_cleanup (&attr);
+
+    w->ec = combineErrors (w->ec, ec);
+}
+
+/* The AF_* bits of the fields to read to get "fields", since the
+ * domain comes from the URL. */
+static uint32_t to_read (uint32_t fields) {
+    return ((fields & AF_DOMAIN) ? (fields | AF_URL) : fields);
+}
+
+/* Writes any --blocklist matches for the file.  They are written with
+ * a single fwrite(), which stdio doesn't interleave with writes from
+ * other threads. */
+static void check_blocklist (const ScanOptions *opts,
+                             const char *path,
+                             const Attributes *attr) {
+    StrBuf out;
+
+    SB_init (&out);
+    if (Blocklist_check (opts->blocklist, path, attr, &out) > 0) {
+        fwrite (out.buf, 1, out.len, opts->blocklistOut);
+    }
+    SB_cleanup (&out);
+}
+
+/* Returns whether a lookup on "device" has timed out before.  Like
+ * xattrsUnsupported(), the list is append-only, so it can be read
+ * without taking a lock: each slot is written before nHung is
+ * incremented to include it. */
+static bool is_hung (Scan *scan, uint64_t device) {
+    if (device != 0) {
+        const size_t n = atomic_load (&scan->nHung);
+        size_t i;
+
+        for (i = 0; i < n; i++) {
+            if (atomic_load (&scan->hung[i]) == device) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+static void mark_hung (Scan *scan, uint64_t device) {
+    if (device != 0) {
+        pthread_mutex_lock (&scan->lock);
+
+        const size_t n = atomic_load (&scan->nHung);
+        if (n < MAX_HUNG && ! is_hung (scan, device)) {
+            atomic_store (&scan->hung[n], device);
+            atomic_store (&scan->nHung, n + 1);
+        }
+
+        pthread_mutex_unlock (&scan->lock);
+    }
+}
+
+/* Calls getAttributes(), on a Prober if there is a time limit.  Returns
+ * false if the time ran out first, and the lookup was abandoned. */
+static bool get_attributes (Worker *w,
+                            const char *path,
+                            const AttrQuery *query,
+                            Attributes *attr,
+                            ErrorCode *ec) {
+    const ScanOptions *opts = w->scan->opts;
+
+    if (opts->fileTimeout == 0 && opts->deadline == 0) {
+        *ec = getAttributes (path, query, attr, &w->cache);
+        return true;
+    }
+
+    int64_t limit = opts->deadline;
+
+    if (opts->fileTimeout > 0) {
+        const int64_t t = currentTime () + opts->fileTimeout * INT64_C(1000000);
+        if (limit == 0 || t < limit) {
+            limit = t;
+        }
+    }
+
+    if (w->prober == NULL) {
+        w->prober = Prober_new ();
+    }
+
+    if (Prober_get (w->prober, path, query, limit, attr, ec)) {
+        return true;
+    }
+
+    w->prober = NULL;           /* it has been abandoned */
+    atomic_fetch_add (&w->scan->nAbandoned, 1);
+    return false;
+}
+
+/* Like get_attributes(), but if the time runs out, reports that as an
+ * error for the file (unless the whole scan has run out of time, in
+ * which case the file is left for whoever resumes it).  The device is
+ * then remembered, and its other files fail at once, since each lookup
+ * that hangs leaves a thread behind; past MAX_ABANDONED of those, no
+ * more lookups are tried at all.
+ */
+static bool read_attributes (Worker *w,
+                             const char *path,
+                             const AttrQuery *query,
+                             Attributes *attr,
+                             ErrorCode *ec) {
+    const unsigned long timeout = w->scan->opts->fileTimeout;
+    StrBuf msg;
+
+    SB_init (&msg);
+
+    if (timeout > 0 && is_hung (w->scan, query->device)) {
+        SB_add (&msg, "Skipped, since a file on the same device timed out");
+    } else if (w->prober == NULL &&
+               atomic_load (&w->scan->nAbandoned) >= MAX_ABANDONED) {
+        SB_add (&msg, "Skipped, since too many files timed out");
+    } else if (get_attributes (w, path, query, attr, ec)) {
+        return true;
+    } else {
+        SB_printf (&msg, "Timed out after %lu ms", timeout);
+        if (! out_of_time (w->scan)) {
+            mark_hung (w->scan, query->device);
+        }
+    }
+
+    if (out_of_time (w->scan)) {
+        SB_cleanup (&msg);
+        w->cutShort = true;
+        w->jobFiles--;          /* it wasn't done after all */
+    } else {
+        report_error (w, path, EC_OTHER, msg.buf);
+    }
+
+    return false;
+}
+
+static void process_file (Worker *w,
+                          const char *path,
+                          uint64_t device,
+                          uint64_t inode) {
+    Attributes attr;
+    AttrQuery query;
+    const char *firstPath = NULL;
+
+    /* With --shard, other processes take care of most files. */
+    if (w->scan->opts->shardCount > 0 &&
+        hashString (path) % w->scan->opts->shardCount !=
+        w->scan->opts->shardIndex) {
+        return;
+    }
+
+    /* With --changed-since, skip files whose ctime shows they haven't
+     * been touched, which includes having an attribute set. */
+    if (w->scan->opts->changedOnly) {
+        int64_t ctime;
+        char *errmsg = NULL;
+        const ErrorCode ec = getChangeTime (path, &ctime, &errmsg);
+
+        if (ec != EC_OK) {
+            report_error (w, path, ec, errmsg);
+            return;
+        } else if (ctime < w->scan->opts->changedSince) {
+            return;
+        }
+    }
+
+    /* With --sample, only some files are looked at.  With a COUNT,
+     * they are not known until the end, so draw_sample() comes back
+     * for them. */
+    if (w->scan->opts->sample != NULL && ! w->scan->drawing &&
+        ! Sample_offer (w->scan->opts->sample, path)) {
+        return;
+    }
+
+    Attr_init (&attr);
+    w->jobFiles++;
+
+    /* With --dedup, if we've seen this inode before (by another hard
+     * link, or through a bind mount), just say which path it was. */
+    if (w->scan->inodes != NULL && inode != 0 &&
+        ! InodeSet_add (w->scan->inodes, device, inode, path, &firstPath)) {
+        attr.same_as = MY_STRDUP (firstPath);
+        emit (w, path, &attr);
+        Attr_cleanup (&attr);
+        return;
+    }
+
+    const ScanOptions *opts = w->scan->opts;
+    const Where *where = opts->where;
+    ErrorCode ec;
+
+    /* With --where, first read just the fields it tests, since most
+     * files usually don't match, and the rest would be wasted. */
+    query.device = device;
+    query.presenceOnly = opts->presenceOnly && where == NULL;
+    query.fields = to_read (where == NULL ? opts->fields
+                            : Where_fields (where));
+
+    if (! read_attributes (w, path, &query, &attr, &ec)) {
+        return;
+    }
+
+    bool matched = true;
+
+    if (where != NULL && (ec == EC_OK || ec == EC_NOATTR)) {
+        matched = Where_match (where, &attr);
+        query.fields = (to_read (opts->fields) &
+                        ~to_read (Where_fields (where)));
+
+        if (! matched) {
+            Attr_cleanup (&attr);
+            Attr_init (&attr);
+            ec = EC_NOATTR;
+        } else if (! opts->presenceOnly && query.fields != 0) {
+            Attributes more;
+            ErrorCode ec2;
+
+            Attr_init (&more);
+            if (! read_attributes (w, path, &query, &more, &ec2)) {
+                Attr_cleanup (&attr);
+                return;
+            }
+
+            Attr_merge (&attr, &more);
+            ec = combineErrors (ec, ec2);
+        }
+
+        /* A match is a success, even if nothing was found, as with
+         * "--where '!url'". */
+        if (matched) {
+            ec = combineErrors (ec, EC_OK);
+        }
+    }
+
+    if (opts->sample != NULL) {
+        Sample_record (opts->sample, &attr, ec);
+    }
+
+    /* With --has-provenance, only matching files (and errors) are
+     * printed, since the record is just the path. */
+    if (matched && ! (opts->presenceOnly && ec == EC_NOATTR)) {
+        if (opts->blocklist != NULL) {
+            check_blocklist (opts, path, &attr);
+        }
+        emit (w, path, &attr);
+    }
+    Attr_cleanup (&attr);
+
+    w->ec = combineErrors (w->ec, ec);
+}
+
+/* Handles one entry of the directory "dir".  Subdirectories are pushed
+ * as new jobs, and regular files are processed immediately.  Everything
+ * else is skipped.
+ */
+static void process_entry (Worker *w,
+                           const Job *job,
+                           uint64_t device,
+                           const char *name,
+                           uint64_t inode,
+                           FileType type) {
+    const char *dir = job->path;
+    char *child = joinPath (dir, name);
+
+    if (type == FT_UNKNOWN) {
+        FileInfo info;
+        char *errmsg = NULL;
+        const ErrorCode ec = getFileInfo (child, false, &info, &errmsg);
+        if (ec != EC_OK) {
+            report_error (w, child, ec, errmsg);
+            free (child);
+            return;
+        }
+        type = info.type;
+    }
+
+    if (type == FT_DIR) {
+        /* the new job takes ownership of child */
+        push_child (w, child, job->rootDevice);
+    } else {
+        if (type == FT_FILE) {
+            process_file (w, child, device, inode);
+        }
+        free (child);
+    }
+}
+
+/* Processes an entry of the directory of "job", unless it is one of
+ * the first job->skip, which an earlier slice of the scan already did.
+ * An entry which the --deadline cut short isn't counted as done.
+ */
+static void next_entry (Worker *w,
+                        const Job *job,
+                        uint64_t device,
+                        const char *name,
+                        uint64_t inode,
+                        FileType type) {
+    if (w->jobEntries >= job->skip) {
+        process_entry (w, job, device, name, inode, type);
+    }
+
+    if (! w->cutShort) {
+        w->jobEntries++;
+    }
+}
+
+/* An entry of a directory which has been read in full, for --inode-order.
+ * The name is stored in a separate StrBuf, to avoid a malloc per entry.
+ */
+typedef struct ListedEntry {
+    uint64_t inode;
+    size_t nameOffset;          /* offset of name in the names StrBuf */
+    FileType type;
+} ListedEntry;
+
+static int compare_inodes (const void *a, const void *b) {
+    const ListedEntry *x = (const ListedEntry *) a;
+    const ListedEntry *y = (const ListedEntry *) b;
+
+    if (x->inode < y->inode) {
+        return -1;
+    } else if (x->inode > y->inode) {
+        return 1;
+    } else {
+        return 0;
+    }
+}
+
+/* Processes the entries of a directory in order of inode number.  On
+ * ext4, XFS, and friends, inode numbers follow the on-disk position of
+ * the inodes, so this turns a random walk over the inode table into a
+ * sequential one, which matters a lot with a cold cache on spinning
+ * disks.  The cost is holding the whole listing in memory.  Returns
+ * false if the --deadline stopped it before the end.
+ */
+static bool process_sorted (Worker *w,
+                            const Job *job,
+                            uint64_t device,
+                            DirReader *dr) {
+    ListedEntry *entries = NULL;
+    size_t n = 0, capacity = 0, i = 0;
+    StrBuf names;
+    DirEntry ent;
+    bool more = true;
+
+    SB_init (&names);
+
+    /* With --max-memory, a huge directory is sorted and processed in
+     * batches of listLimit bytes, which keeps most of the benefit. */
+    while (more && ! atomic_load (&w->scan->expired)) {
+        n = 0;
+        SB_clear (&names);
+
+        while ((more = Dir_read (dr, &ent))) {
+            if (n >= capacity) {
+                capacity = (capacity < 64 ? 64 : capacity * 2);
+                entries = MY_REALLOC (entries,
+                                      capacity * sizeof (ListedEntry));
+            }
+
+            entries[n].inode = ent.inode;
+            entries[n].nameOffset = names.len;
+            entries[n].type = ent.type;
+            SB_add_len (&names, ent.name, strlen (ent.name) + 1);
+            n++;
+
+            if (n * sizeof (ListedEntry) + names.len >= w->scan->listLimit) {
+                break;
+            }
+        }
+
+        qsort (entries, n, sizeof (ListedEntry), compare_inodes);
+
+        for (i = 0; i < n && ! atomic_load (&w->scan->expired); i++) {
+            next_entry (w, job, device,
+                        names.buf + entries[i].nameOffset,
+                        entries[i].inode,
+                        entries[i].type);
+        }
+    }
+
+    free (entries);
+    SB_cleanup (&names);
+    return (! more && i == n && ! w->cutShort);
+}
+
+/* Returns false if the --deadline stopped it before the end. */
+static bool process_dir (Worker *w, const Job *job) {
+    DirReader *dr = NULL;
+    char *errmsg = NULL;
+    DirEntry ent;
+    bool finished = true;
+
+    ErrorCode ec = Dir_open (job->path, &dr, &errmsg);
+    if (ec != EC_OK) {
+        report_error (w, job->path, ec, errmsg);
+        return true;
+    }
+
+    /* Every file in a directory is on the same device as the directory
+     * (only a directory can be a mount point), so one fstat() covers
+     * the whole directory. */
+    const uint64_t device = Dir_device (dr);
+
+    if (w->scan->opts->xdev && device != job->rootDevice) {
+        /* a mount point; don't cross it */
+    } else if (w->scan->opts->inodeOrder) {
+        finished = process_sorted (w, job, device, dr);
+    } else {
+        while ((finished = ! atomic_load (&w->scan->expired)) &&
+               Dir_read (dr, &ent)) {
+            next_entry (w, job, device, ent.name, ent.inode, ent.type);
+        }
+        finished = finished && ! w->cutShort;
+    }
+
+    ec = Dir_close (dr, &errmsg);
+    if (ec != EC_OK) {
+        report_error (w, job->path, ec, errmsg);
+    }
+
+    return finished;
+}
+
+/* Processes a file named on the command line.  Unlike files found in
+ * a directory, we don't know its inode, so find out if it's needed.
+ * Returns false if the --deadline stopped it. */
+static bool process_argument (Worker *w, const Job *job) {
+    FileInfo info;
+    char *errmsg = NULL;
+
+    memset (&info, 0, sizeof (info));
+
+    if (w->scan->inodes != NULL &&
+        EC_OK != getFileInfo (job->path, true, &info, &errmsg)) {
+        /* getAttributes() will report the error */
+        free (errmsg);
+    }
+
+    process_file (w, job->path, info.device, info.inode);
+    return ! w->cutShort;
+}
+
+static void *worker_main (void *arg) {
+    Worker *w = (Worker *) arg;
+    Job job;
+
+    while (get_job (w, &job)) {
+        bool finished;
+
+        w->jobEntries = 0;
+        w->cutShort = false;
+
+        if (job.isDir) {
+            finished = process_dir (w, &job);
+        } else {
+            finished = process_argument (w, &job);
+        }
+
+        if (w->scan->checkpointing) {
+            if (! finished) {
+                /* put back, with what was done so far */
+                job.skip = w->jobEntries;
+                publish (w, &job, false);
+                continue;
+            }
+            publish (w, &job, true);
+        }
+
+        finish_job (w, &job);
+    }
+
+    flush_output (w);
+    return NULL;
+}
+
+/* Pushes a command-line argument as a job for worker "w". */
+static void push_argument (Worker *w, const char *fname) {
+    FileInfo info;
+    char *errmsg = NULL;
+
+    if (w->scan->opts->recursive &&
+        EC_OK == getFileInfo (fname, true, &info, &errmsg) &&
+        info.type == FT_DIR) {
+        push_job (w, MY_STRDUP (fname), true, info.device, 0);
+    } else {
+        push_job (w, MY_STRDUP (fname), false, 0, 0);
+    }
+
+    free (errmsg);
+}
+
+/* Copies the frontier of the scan into "cp": the jobs in progress, then
+ * the jobs in each deque, in the order the owner would pop them, and
+ * then the jobs in the spill file.
+ */
+static void take_checkpoint (Scan *scan, Checkpoint *cp) {
+    size_t i, j;
+
+    pthread_mutex_lock (&scan->progress);
+
+    cp->haveOffset = Output_sync (&cp->offset);
+    cp->nDirs = scan->nDirs;
+    cp->nFiles = scan->nFiles;
+
+    for (i = 0; i < scan->nWorkers; i++) {
+        Worker *w = &scan->workers[i];
+
+        if (w->busy) {
+            Checkpoint_add (cp, w->current.path, w->current.isDir,
+                            w->current.rootDevice, w->current.skip);
+        }
+
+        pthread_mutex_lock (&w->deque.lock);
+        for (j = w->deque.bottom; j > w->deque.top; j--) {
+            const Job *job = &w->deque.jobs[j - 1];
+            Checkpoint_add (cp, job->path, job->isDir,
+                            job->rootDevice, job->skip);
+        }
+        pthread_mutex_unlock (&w->deque.lock);
+    }
+
+    if (scan->spill != NULL) {
+        Spill_snapshot (scan->spill, cp);
+    }
+
+    pthread_mutex_unlock (&scan->progress);
+}
+
+static void save_checkpoint (Scan *scan) {
+    Checkpoint cp;
+
+    Checkpoint_init (&cp);
+    take_checkpoint (scan, &cp);
+    Checkpoint_save (&cp, scan->opts->checkpoint);
+    Checkpoint_cleanup (&cp);
+}
+
+/* The thread which saves a checkpoint every CHECKPOINT_INTERVAL seconds,
+ * until the scan is finished. */
+static void *checkpoint_main (void *arg) {
+    Scan *scan = (Scan *) arg;
+    struct timespec deadline;
+
+    clock_gettime (CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += CHECKPOINT_INTERVAL;
+
+    pthread_mutex_lock (&scan->lock);
+
+    while (! scan->finished) {
+        const int err =
+            pthread_cond_timedwait (&scan->cpCond, &scan->lock, &deadline);
+
+        if (err == ETIMEDOUT && ! scan->finished) {
+            pthread_mutex_unlock (&scan->lock);
+            save_checkpoint (scan);
+            pthread_mutex_lock (&scan->lock);
+
+            clock_gettime (CLOCK_REALTIME, &deadline);
+            deadline.tv_sec += CHECKPOINT_INTERVAL;
+        }
+    }
+
+    pthread_mutex_unlock (&scan->lock);
+    return NULL;
+}
+
+/* For --background, the thread which adjusts how many workers are
+ * allowed to run, by the I/O pressure, until the scan is finished.  It
+ * backs off quickly when the system is busy, and speeds up slowly.
+ */
+static void *throttle_main (void *arg) {
+    Scan *scan = (Scan *) arg;
+    struct timespec deadline;
+    double pressure;
+
+    pthread_mutex_lock (&scan->lock);
+
+    while (! scan->finished) {
+        clock_gettime (CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += THROTTLE_INTERVAL;
+
+        const int err =
+            pthread_cond_timedwait (&scan->cpCond, &scan->lock, &deadline);
+
+        if (err != ETIMEDOUT || scan->finished || ! ioPressure (&pressure)) {
+            continue;
+        }
+
+        const size_t old = atomic_load (&scan->allowed);
+        size_t n = old;
+
+        if (pressure >= PRESSURE_HIGH) {
+            n = (n + 1) / 2;
+        } else if (pressure >= PRESSURE_SOME) {
+            n = (n > 1 ? n - 1 : 1);
+        } else if (pressure < PRESSURE_LOW && n < scan->nWorkers) {
+            n++;
+        }
+
+        atomic_store (&scan->allowed, n);
+        if (n > old) {
+            pthread_cond_broadcast (&scan->throttleCond);
+        }
+    }
+
+    pthread_mutex_unlock (&scan->lock);
+    return NULL;
+}
+
+/* Runs worker 0 on the calling thread, and the rest on new threads,
+ * until all the jobs are done. */
+static void run_workers (Scan *scan) {
+    size_t i;
+
+    for (i = 1; i < scan->nWorkers; i++) {
+        Worker *w = &scan->workers[i];
+        if (0 != pthread_create (&w->thread, NULL, worker_main, w)) {
+            err_printf (CMD_NAME ": could not create thread");
+            exit (EC_OTHER);
+        }
+    }
+
+    worker_main (&scan->workers[0]);
+
+    for (i = 1; i < scan->nWorkers; i++) {
+        pthread_join (scan->workers[i].thread, NULL);
+    }
+}
+
+/* For --sample COUNT, reads the attributes of the files which were
+ * chosen, now that the whole tree has been seen. */
+static void draw_sample (Scan *scan) {
+    size_t n, i;
+    char **paths = Sample_take (scan->opts->sample, &n);
+
+    /* deal them out in reverse, so each worker pops them in order */
+    for (i = n; i > 0; i--) {
+        push_job (&scan->workers[(i - 1) % scan->nWorkers],
+                  paths[i - 1], false, 0, 0);
+    }
+
+    free (paths);
+
+    if (n > 0) {
+        scan->drawing = true;
+        run_workers (scan);
+    }
+}
+
+ErrorCode scanFiles (const ScanOptions *opts,
+                     char *const *files,
+                     size_t nFiles) {
+    Scan scan;
+    size_t i;
+
+    memset (&scan, 0, sizeof (scan));
+    scan.opts = opts;
+    scan.nWorkers = (opts->threads < 1 ? 1 : opts->threads);
+    scan.workers = MY_MALLOC (scan.nWorkers * sizeof (Worker));
+    pthread_mutex_init (&scan.lock, NULL);
+    pthread_cond_init (&scan.cond, NULL);
+    pthread_mutex_init (&scan.progress, NULL);
+    pthread_cond_init (&scan.cpCond, NULL);
+    pthread_cond_init (&scan.throttleCond, NULL);
+    scan.checkpointing = (opts->checkpoint != NULL);
+    atomic_store (&scan.allowed, scan.nWorkers);
+    scan.flushThreshold = FLUSH_THRESHOLD;
+    scan.listLimit = SIZE_MAX;
+
+    if (opts->maxMemory > 0) {
+        /* the other eighth is for the queue in output.c */
+        const size_t outShare = opts->maxMemory / 8 / scan.nWorkers;
+        const size_t listShare = opts->maxMemory / 4 / scan.nWorkers;
+
+        scan.spill = Spill_new ();
+        scan.queueLimit = opts->maxMemory / 2;
+        if (outShare < scan.flushThreshold) {
+            scan.flushThreshold = (outShare < MIN_FLUSH_THRESHOLD ?
+                                   MIN_FLUSH_THRESHOLD : outShare);
+        }
+        scan.listLimit =
+            (listShare < MIN_LIST_LIMIT ? MIN_LIST_LIMIT : listShare);
+    }
+
+    if (opts->dedup) {
+        scan.inodes = InodeSet_new ();
+    }
+
+    for (i = 0; i < scan.nWorkers; i++) {
+        Worker *w = &scan.workers[i];
+        memset (w, 0, sizeof (*w));
+        w->scan = &scan;
+        w->index = i;
+        w->victim = i + 1;
+        w->ec = EC_NOATTR;      /* identity element for combineErrors() */
+        Deque_init (&w->deque);
+        Deque_init (&w->children);
+        Cache_init (&w->cache);
+        SB_init (&w->out);
+    }
+
+    /* Push the command-line arguments (or the frontier we are resuming
+     * from) onto the first worker's deque in reverse order, so that they
+     * are popped in the original order. */
+    if (opts->resume != NULL) {
+        scan.nDirs = opts->resume->nDirs;
+        scan.nFiles = opts->resume->nFiles;
+
+        for (i = opts->resume->nJobs; i > 0; i--) {
+            const FrontierJob *job = &opts->resume->jobs[i - 1];
+            push_job (&scan.workers[0], MY_STRDUP (job->path),
+                      job->isDir, job->rootDevice, job->skip);
+        }
+    } else {
+        for (i = nFiles; i > 0; i--) {
+            push_argument (&scan.workers[0], files[i - 1]);
+        }
+    }
+
+    pthread_t cpThread, throttleThread;
+    double pressure;
+    const bool throttling = (opts->background && ioPressure (&pressure));
+
+    if ((scan.checkpointing &&
+         0 != pthread_create (&cpThread, NULL, checkpoint_main, &scan)) ||
+        (throttling &&
+         0 != pthread_create (&throttleThread, NULL, throttle_main, &scan))) {
+        err_printf (CMD_NAME ": could not create thread");
+        exit (EC_OTHER);
+    }
+
+    run_workers (&scan);
+
+    if (opts->sample != NULL && ! atomic_load (&scan.expired)) {
+        draw_sample (&scan);
+    }
+
+    pthread_mutex_lock (&scan.lock);
+    scan.finished = true;
+    pthread_cond_broadcast (&scan.cpCond);
+    pthread_mutex_unlock (&scan.lock);
+
+    if (throttling) {
+        pthread_join (throttleThread, NULL);
+    }
+
+    if (scan.checkpointing) {
+        pthread_join (cpThread, NULL);
+        save_checkpoint (&scan);   /* with what's left of the frontier */
+    }
+
+    ErrorCode ec = EC_NOATTR;
+
+    if (atomic_load (&scan.expired)) {
+        err_printf (CMD_NAME ": --deadline reached; results are incomplete");
+        ec = EC_OTHER;
+    }
+
+    for (i = 0; i < scan.nWorkers; i++) {
+        Worker *w = &scan.workers[i];
+        ec = combineErrors (ec, w->ec);
+        SB_cleanup (&w->out);
+        Cache_cleanup (&w->cache);
+        Deque_cleanup (&w->deque);
+        Deque_cleanup (&w->children);
+        if (w->childSpill != NULL) {
+            Spill_free (w->childSpill);
+        }
+        if (w->outSpill != NULL) {
+            fclose (w->outSpill);
+        }
+        if (w->prober != NULL) {
+            Prober_free (w->prober);
+        }
+    }
+
+    if (scan.spill != NULL) {
+        Spill_free (scan.spill);
+    }
+
+    if (scan.inodes != NULL) {
+        InodeSet_free (scan.inodes);
+    }
+
+    pthread_cond_destroy (&scan.throttleCond);
+    pthread_cond_destroy (&scan.cpCond);
+    pthread_mutex_destroy (&scan.progress);
+    pthread_cond_destroy (&scan.cond);
+    pthread_mutex_destroy (&scan.lock);
+    free (scan.workers);
+
+    return ec;
+}
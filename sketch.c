@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* The SpaceSaving algorithm (Metwally, Agrawal, and El Abbadi, 2005)
+ * for finding the most frequent strings in a stream, in a fixed amount
+ * of memory.  At most "capacity" strings are counted.  When a new
+ * string arrives and they're all in use, the one with the smallest
+ * count is replaced by the new string, which takes over its count
+ * (plus one), and remembers that count as its error.  So every count
+ * is too high by at most its error, and at most total / capacity, and
+ * any string seen more than total / capacity times is in the sketch.
+ *
+ * The counters are kept in a min-heap, so the smallest can be found at
+ * once, and in an open-addressed hash table, so a string can be found.
+ */
+
+typedef struct Counter {
+    SketchEntry e;              /* must be first; see Sketch_sorted() */
+    uint64_t hash;              /* hashString (e.key) */
+    size_t heapPos;             /* index of this counter in "heap" */
+} Counter;
+
+struct Sketch {
+    Counter *counters;          /* "size" of "capacity" in use */
+    size_t *heap;               /* indices of counters, smallest at top */
+    size_t *slots;              /* index of counter + 1, or 0 if empty */
+    size_t nSlots;              /* a power of 2, at least 2 * capacity */
+    size_t size;
+    size_t capacity;
+    uint64_t total;             /* number of strings added */
+};
+
+Sketch *Sketch_new (size_t capacity) {
+    Sketch *s = MY_MALLOC (sizeof (*s));
+
+    memset (s, 0, sizeof (*s));
+    s->capacity = (capacity < 1 ? 1 : capacity);
+    for (s->nSlots = 16; s->nSlots < 2 * s->capacity; s->nSlots *= 2) {
+        /* keep the table no more than half full */
+    }
+
+    s->counters = MY_MALLOC (s->capacity * sizeof (Counter));
+    s->heap = MY_MALLOC (s->capacity * sizeof (size_t));
+    s->slots = MY_MALLOC (s->nSlots * sizeof (size_t));
+    memset (s->slots, 0, s->nSlots * sizeof (size_t));
+    return s;
+}
+
+void Sketch_free (Sketch *s) {
+    size_t i;
+
+    for (i = 0; i < s->size; i++) {
+        free (s->counters[i].e.key);
+    }
+
+    free (s->counters);
+    free (s->heap);
+    free (s->slots);
+    free (s);
+}
+
+/* Returns the slot holding "key", or the empty slot where it belongs. */
+static size_t find_slot (const Sketch *s, const char *key, uint64_t hash) {
+    const size_t mask = s->nSlots - 1;
+    size_t i = (size_t) hash & mask;
+
+    for ( ; s->slots[i] != 0; i = (i + 1) & mask) {
+        const Counter *c = &s->counters[s->slots[i] - 1];
+        if (c->hash == hash && 0 == strcmp (c->e.key, key)) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/* Empties slot "i", moving back any later slots in its run which would
+ * otherwise no longer be found. */
+static void remove_slot (Sketch *s, size_t i) {
+    const size_t mask = s->nSlots - 1;
+    size_t j = i;
+
+    for ( ; ; ) {
+        s->slots[i] = 0;
+
+        for ( ; ; ) {
+            j = (j + 1) & mask;
+            if (s->slots[j] == 0) {
+                return;
+            }
+
+            /* the slot this one would be in, if there were no others */
+            const size_t k =
+                (size_t) s->counters[s->slots[j] - 1].hash & mask;
+            const bool stays = (i <= j ? (i < k && k <= j)
+                                : (i < k || k <= j));
+            if (! stays) {
+                break;
+            }
+        }
+
+        s->slots[i] = s->slots[j];
+        i = j;
+    }
+}
+
+static void swap_heap (Sketch *s, size_t a, size_t b) {
+    const size_t tmp = s->heap[a];
+
+    s->heap[a] = s->heap[b];
+    s->heap[b] = tmp;
+    s->counters[s->heap[a]].heapPos = a;
+    s->counters[s->heap[b]].heapPos = b;
+}
+
+static uint64_t heap_count (const Sketch *s, size_t pos) {
+    return s->counters[s->heap[pos]].e.count;
+}
+
+static void sift_up (Sketch *s, size_t pos) {
+    while (pos > 0 && heap_count (s, (pos - 1) / 2) > heap_count (s, pos)) {
+        swap_heap (s, pos, (pos - 1) / 2);
+        pos = (pos - 1) / 2;
+    }
+}
+
+static void sift_down (Sketch *s, size_t pos) {
+    for ( ; ; ) {
+        const size_t left = 2 * pos + 1, right = left + 1;
+        size_t smallest = pos;
+
+        if (left < s->size &&
+            heap_count (s, left) < heap_count (s, smallest)) {
+            smallest = left;
+        }
+        if (right < s->size &&
+            heap_count (s, right) < heap_count (s, smallest)) {
+            smallest = right;
+        }
+        if (smallest == pos) {
+            return;
+        }
+
+        swap_heap (s, pos, smallest);
+        pos = smallest;
+    }
+}
+
+void Sketch_add (Sketch *s, const char *key) {
+    const uint64_t hash = hashString (key);
+    size_t slot = find_slot (s, key, hash);
+    Counter *c;
+
+    s->total++;
+
+    if (s->slots[slot] != 0) {
+        c = &s->counters[s->slots[slot] - 1];
+        c->e.count++;
+        sift_down (s, c->heapPos);
+        return;
+    }
+
+    if (s->size < s->capacity) {
+        const size_t idx = s->size++;
+        c = &s->counters[idx];
+        c->e.key = MY_STRDUP (key);
+        c->e.count = 1;
+        c->e.error = 0;
+        c->hash = hash;
+        c->heapPos = idx;
+        s->heap[idx] = idx;
+        s->slots[slot] = idx + 1;
+        sift_up (s, idx);
+        return;
+    }
+
+    /* Replace the smallest count with the new key. */
+    const size_t idx = s->heap[0];
+    c = &s->counters[idx];
+    remove_slot (s, find_slot (s, c->e.key, c->hash));
+    free (c->e.key);
+    c->e.key = MY_STRDUP (key);
+    c->hash = hash;
+    c->e.error = c->e.count;
+    c->e.count++;
+    s->slots[find_slot (s, key, hash)] = idx + 1;
+    sift_down (s, 0);
+}
+
+/* Any string not in a sketch was seen at most this many times. */
+static uint64_t min_count (const Sketch *s) {
+    return (s->size < s->capacity ? 0 : heap_count (s, 0));
+}
+
+static int compare_entries (const void *a, const void *b) {
+    const SketchEntry *x = *(const SketchEntry *const *) a;
+    const SketchEntry *y = *(const SketchEntry *const *) b;
+
+    if (x->count != y->count) {
+        return (x->count > y->count ? -1 : 1);
+    }
+
+    return strcmp (x->key, y->key);
+}
+
+static int compare_counters (const void *a, const void *b) {
+    const SketchEntry *x = &((const Counter *) a)->e;
+    const SketchEntry *y = &((const Counter *) b)->e;
+
+    return compare_entries (&x, &y);
+}
+
+void Sketch_merge (Sketch *dest, const Sketch *src) {
+    const uint64_t destMin = min_count (dest), srcMin = min_count (src);
+    Counter *all = MY_MALLOC ((dest->size + src->size) * sizeof (Counter));
+    size_t i, n = 0;
+
+    /* As in Agarwal et al., "Mergeable Summaries" (2012): a string
+     * missing from one sketch may have been seen as many times as the
+     * smallest count there, so that is added to its count and error. */
+    for (i = 0; i < dest->size; i++) {
+        Counter c = dest->counters[i];
+        const size_t slot = find_slot (src, c.e.key, c.hash);
+        if (src->slots[slot] != 0) {
+            const Counter *other = &src->counters[src->slots[slot] - 1];
+            c.e.count += other->e.count;
+            c.e.error += other->e.error;
+        } else {
+            c.e.count += srcMin;
+            c.e.error += srcMin;
+        }
+        all[n++] = c;
+    }
+
+    for (i = 0; i < src->size; i++) {
+        Counter c = src->counters[i];
+        if (dest->slots[find_slot (dest, c.e.key, c.hash)] == 0) {
+            c.e.key = MY_STRDUP (c.e.key);
+            c.e.count += destMin;
+            c.e.error += destMin;
+            all[n++] = c;
+        }
+    }
+
+    /* Keep the biggest counts, and rebuild the table and the heap. */
+    if (n > 1) {
+        qsort (all, n, sizeof (Counter), compare_counters);
+    }
+
+    for (i = dest->capacity; i < n; i++) {
+        free (all[i].e.key);
+    }
+
+    dest->size = (n < dest->capacity ? n : dest->capacity);
+    memset (dest->slots, 0, dest->nSlots * sizeof (size_t));
+
+    for (i = 0; i < dest->size; i++) {
+        /* biggest first, so the heap is built by reversing the order */
+        const size_t idx = dest->size - 1 - i;
+        dest->counters[idx] = all[i];
+        dest->counters[idx].heapPos = idx;
+        dest->heap[idx] = idx;
+        dest->slots[find_slot (dest, all[i].e.key, all[i].hash)] = idx + 1;
+    }
+
+    dest->total += src->total;
+    free (all);
+}
+
+uint64_t Sketch_maxError (const Sketch *s) {
+    /* Each replacement takes the smallest count, which can't be more
+     * than total / capacity. */
+    return s->total / s->capacity;
+}
+
+const SketchEntry **Sketch_sorted (const Sketch *s) {
+    const SketchEntry **sorted =
+        MY_MALLOC ((s->size + 1) * sizeof (SketchEntry *));
+    size_t i;
+
+    for (i = 0; i < s->size; i++) {
+        sorted[i] = &s->counters[i].e;
+    }
+
+    if (s->size > 1) {
+        qsort (sorted, s->size, sizeof (SketchEntry *), compare_entries);
+    }
+
+    sorted[s->size] = NULL;
+    return sorted;
+}
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/* --sort path: the records written by the scanning threads (in
+ * whatever order they finish) are collected here, and written out in
+ * order of path when the scan is over.  Records are collected in
+ * memory until they reach the size of a run; then they are sorted and
+ * written to a temporary file.  At the end, the runs are merged by
+ * mergeRuns().  Records with the same path are ordered by their bytes,
+ * so the output doesn't depend on the order they arrived in.
+ *
+ * Only MAX_RUNS runs are kept at once (each is an open file); when
+ * there are that many, they are merged into one bigger run.
+ */
+
+#define MAX_RUNS 64
+#define GATHER 64               /* records written with one writeGather() */
+
+typedef struct SortRecord {
+    size_t offset;              /* of the record in "records" */
+    size_t len;                 /* of the record, including the newline */
+    size_t pathOffset;          /* of the decoded path in "paths" */
+    size_t pathLen;
+    const char *record;         /* set from the offsets, just for sorting */
+    const char *path;
+} SortRecord;
+
+struct Sorter {
+    StrBuf records;             /* the records of the current run */
+    StrBuf paths;               /* their decoded paths, one after another */
+    StrBuf path;                /* scratch space for Json_path() */
+    SortRecord *index;
+    size_t n;
+    size_t capacity;
+    size_t runSize;             /* bytes of memory for a run */
+    FILE *runs[MAX_RUNS];
+    size_t nRuns;
+    bool failed;                /* couldn't write a run; keep them all */
+};
+
+Sorter *Sorter_new (size_t runSize) {
+    Sorter *s = MY_MALLOC (sizeof (*s));
+
+    memset (s, 0, sizeof (*s));
+    SB_init (&s->records);
+    SB_init (&s->paths);
+    SB_init (&s->path);
+    s->runSize = runSize;
+    return s;
+}
+
+static int compare_bytes (const char *a, size_t aLen,
+                          const char *b, size_t bLen) {
+    const int c = memcmp (a, b, (aLen < bLen ? aLen : bLen));
+
+    if (c != 0) {
+        return c;
+    } else {
+        return (aLen < bLen ? -1 : (aLen > bLen ? 1 : 0));
+    }
+}
+
+/* The same order as heap_less() in merge.c, with "byRecord". */
+static int compare_records (const void *a, const void *b) {
+    const SortRecord *x = (const SortRecord *) a;
+    const SortRecord *y = (const SortRecord *) b;
+    const int c = compare_bytes (x->path, x->pathLen, y->path, y->pathLen);
+
+    if (c != 0) {
+        return c;
+    }
+
+    /* without the newline, as merge.c compares them */
+    return compare_bytes (x->record, x->len - 1, y->record, y->len - 1);
+}
+
+static void sort_run (Sorter *s) {
+    size_t i;
+
+    for (i = 0; i < s->n; i++) {
+        s->index[i].record = s->records.buf + s->index[i].offset;
+        s->index[i].path = s->paths.buf + s->index[i].pathOffset;
+    }
+
+    if (s->n > 1) {
+        qsort (s->index, s->n, sizeof (SortRecord), compare_records);
+    }
+}
+
+/* Writes the records of the current run to "f", in order.  Returns
+ * false on error. */
+static bool write_run (Sorter *s, FILE *f) {
+    OutPiece pieces[GATHER];
+    size_t i, n = 0;
+
+    sort_run (s);
+
+    for (i = 0; i < s->n; i++) {
+        pieces[n].buf = s->index[i].record;
+        pieces[n].len = s->index[i].len;
+        if (++n == GATHER || i + 1 == s->n) {
+            if (! writeGather (f, pieces, n)) {
+                return false;
+            }
+            n = 0;
+        }
+    }
+
+    return true;
+}
+
+static void clear_run (Sorter *s) {
+    SB_clear (&s->records);
+    SB_clear (&s->paths);
+    s->n = 0;
+}
+
+/* Merges all the runs into one. */
+static bool combine_runs (Sorter *s) {
+    FILE *f = tempFile ();
+    size_t i;
+
+    if (f == NULL) {
+        return false;
+    }
+
+    for (i = 0; i < s->nRuns; i++) {
+        if (! seekFile (s->runs[i], 0)) {
+            fclose (f);
+            return false;
+        }
+    }
+
+    if (mergeRuns (s->runs, s->nRuns, f) != EC_OK || fflush (f) != 0) {
+        fclose (f);
+        return false;
+    }
+
+    for (i = 0; i < s->nRuns; i++) {
+        fclose (s->runs[i]);
+    }
+
+    s->runs[0] = f;
+    s->nRuns = 1;
+    return true;
+}
+
+/* Writes the current run to a temporary file, and empties it.  Returns
+ * false if that can't be done, in which case the records are still in
+ * memory. */
+static bool spill_run (Sorter *s) {
+    if (s->nRuns == MAX_RUNS && ! combine_runs (s)) {
+        return false;
+    }
+
+    FILE *f = tempFile ();
+
+    if (f != NULL && write_run (s, f) && fflush (f) == 0) {
+        s->runs[s->nRuns++] = f;
+        clear_run (s);
+        return true;
+    }
+
+    if (f != NULL) {
+        fclose (f);
+    }
+
+    return false;
+}
+
+void Sorter_add (Sorter *s, const char *records, size_t len) {
+    const char *end = records + len;
+
+    while (records < end) {
+        const char *nl = memchr (records, '\n', end - records);
+        const size_t recLen = (nl != NULL ? nl + 1 : end) - records;
+        SortRecord *r;
+
+        if (s->n >= s->capacity) {
+            s->capacity = (s->capacity < 1024 ? 1024 : s->capacity * 2);
+            s->index = MY_REALLOC (s->index,
+                                   s->capacity * sizeof (SortRecord));
+        }
+
+        r = &s->index[s->n++];
+        r->offset = s->records.len;
+        r->len = recLen;
+        SB_add_len (&s->records, records, recLen);
+        if (nl == NULL) {
+            SB_add_char (&s->records, '\n');
+            r->len++;
+        }
+
+        /* A record which isn't one (which shouldn't happen) sorts
+         * first, with an empty path. */
+        if (! Json_path (s->records.buf + r->offset, &s->path)) {
+            SB_clear (&s->path);
+        }
+        r->pathOffset = s->paths.len;
+        r->pathLen = s->path.len;
+        SB_add_len (&s->paths, s->path.buf, s->path.len);
+
+        records += recLen;
+    }
+
+    if (! s->failed && s->records.len + s->paths.len +
+        s->n * sizeof (SortRecord) >= s->runSize && ! spill_run (s)) {
+        err_printf (CMD_NAME ": could not write temporary file; "
+                    "exceeding --max-memory");
+        s->failed = true;
+    }
+}
+
+ErrorCode Sorter_finish (Sorter *s, FILE *out) {
+    size_t i;
+
+    /* If it all fit in memory, there's no need for a temporary file. */
+    if (s->nRuns == 0) {
+        if (! write_run (s, out)) {
+            err_printf ("(stdout): %s", strerror (errno));
+            return EC_OTHER;
+        }
+        return EC_OK;
+    }
+
+    /* Otherwise, whatever is left is the last run. */
+    if (s->n > 0 && ! spill_run (s)) {
+        err_printf (CMD_NAME ": could not write temporary file");
+        return EC_OTHER;
+    }
+
+    for (i = 0; i < s->nRuns; i++) {
+        if (! seekFile (s->runs[i], 0)) {
+            err_printf (CMD_NAME ": could not read temporary file");
+            return EC_OTHER;
+        }
+    }
+
+    return mergeRuns (s->runs, s->nRuns, out);
+}
+
+void Sorter_free (Sorter *s) {
+    size_t i;
+
+    for (i = 0; i < s->nRuns; i++) {
+        fclose (s->runs[i]);
+    }
+
+    SB_cleanup (&s->records);
+    SB_cleanup (&s->paths);
+    SB_cleanup (&s->path);
+    free (s->index);
+    free (s);
+}
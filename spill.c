@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+/* A first-in, first-out queue of jobs, kept in a temporary file, for
+ * when the jobs waiting to be done don't fit in the --max-memory
+ * budget.  Each job is stored as a SpillHeader followed by the path.
+ */
+
+typedef struct SpillHeader {
+    uint64_t rootDevice;
+    uint64_t skip;
+    uint32_t len;               /* length of path, not counting NUL */
+    uint32_t isDir;
+} SpillHeader;
+
+struct Spill {
+    pthread_mutex_t lock;
+    FILE *f;                    /* NULL until the first job is pushed */
+    bool failed;                /* couldn't create or write the file */
+    uint64_t readPos;           /* offset of oldest job */
+    uint64_t writePos;          /* offset just past newest job */
+    size_t count;               /* number of jobs in the file */
+};
+
+Spill *Spill_new (void) {
+    Spill *sp = MY_MALLOC (sizeof (*sp));
+
+    memset (sp, 0, sizeof (*sp));
+    pthread_mutex_init (&sp->lock, NULL);
+    return sp;
+}
+
+void Spill_free (Spill *sp) {
+    if (sp->f != NULL) {
+        fclose (sp->f);
+    }
+
+    pthread_mutex_destroy (&sp->lock);
+    free (sp);
+}
+
+bool Spill_push (Spill *sp, const FrontierJob *job) {
+    SpillHeader hdr;
+    bool ok = false;
+
+    memset (&hdr, 0, sizeof (hdr));
+    hdr.rootDevice = job->rootDevice;
+    hdr.len = (uint32_t) strlen (job->path);
+    hdr.isDir = job->isDir;
+    hdr.skip = job->skip;
+
+    pthread_mutex_lock (&sp->lock);
+
+    if (sp->f == NULL && ! sp->failed) {
+        sp->f = tempFile ();
+        if (sp->f == NULL) {
+            err_printf (CMD_NAME ": could not create temporary file; "
+                        "exceeding --max-memory");
+            sp->failed = true;
+        }
+    }
+
+    if (sp->f != NULL && ! sp->failed) {
+        if (seekFile (sp->f, sp->writePos) &&
+            fwrite (&hdr, sizeof (hdr), 1, sp->f) == 1 &&
+            fwrite (job->path, 1, hdr.len, sp->f) == hdr.len) {
+            sp->writePos += sizeof (hdr) + hdr.len;
+            sp->count++;
+            ok = true;
+        } else {
+            err_printf (CMD_NAME ": could not write temporary file; "
+                        "exceeding --max-memory");
+            sp->failed = true;
+        }
+    }
+
+    pthread_mutex_unlock (&sp->lock);
+    return ok;
+}
+
+/* Reads the job at "*pos" into "job", and advances "*pos" past it.
+ * Must be called with the lock held. */
+static bool read_job (Spill *sp, uint64_t *pos, FrontierJob *job) {
+    SpillHeader hdr;
+
+    if (! seekFile (sp->f, *pos) || fread (&hdr, sizeof (hdr), 1, sp->f) != 1) {
+        return false;
+    }
+
+    job->path = MY_MALLOC (hdr.len + 1);
+    if (fread (job->path, 1, hdr.len, sp->f) != hdr.len) {
+        free (job->path);
+        return false;
+    }
+
+    job->path[hdr.len] = 0;
+    job->isDir = hdr.isDir;
+    job->rootDevice = hdr.rootDevice;
+    job->skip = hdr.skip;
+    *pos += sizeof (hdr) + hdr.len;
+    return true;
+}
+
+bool Spill_pop (Spill *sp, FrontierJob *job) {
+    bool ok = false;
+
+    pthread_mutex_lock (&sp->lock);
+
+    if (sp->count > 0) {
+        if (read_job (sp, &sp->readPos, job)) {
+            ok = true;
+        } else {
+            /* Something is badly wrong; we can't even get back the
+             * jobs we wrote, so there's no finishing the scan. */
+            err_printf (CMD_NAME ": could not read temporary file");
+            exit (EC_OTHER);
+        }
+
+        if (--sp->count == 0) {
+            /* empty, so start again from the beginning of the file */
+            sp->readPos = sp->writePos = 0;
+        }
+    }
+
+    pthread_mutex_unlock (&sp->lock);
+    return ok;
+}
+
+size_t Spill_count (Spill *sp) {
+    pthread_mutex_lock (&sp->lock);
+    const size_t count = sp->count;
+    pthread_mutex_unlock (&sp->lock);
+    return count;
+}
+
+void Spill_snapshot (Spill *sp, Checkpoint *cp) {
+    uint64_t pos;
+    size_t i;
+    FrontierJob job;
+
+    pthread_mutex_lock (&sp->lock);
+
+    for (i = 0, pos = sp->readPos; i < sp->count; i++) {
+        if (! read_job (sp, &pos, &job)) {
+            err_printf (CMD_NAME ": could not read temporary file");
+            exit (EC_OTHER);
+        }
+
+        Checkpoint_add (cp, job.path, job.isDir, job.rootDevice, job.skip);
+        free (job.path);
+    }
+
+    pthread_mutex_unlock (&sp->lock);
+}
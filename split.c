@@ -36,8 +36,7 @@ void split (const char *str, char sep, ArrayList *dest) {
             break;
         } else {
             const size_t len = p - s;
-            char *newStr = malloc (len + 1);
-            CHECK_NULL (newStr);
+            char *newStr = MY_MALLOC (len + 1);
             memcpy (newStr, s, len);
             newStr[len] = 0;
             AL_add_nocopy (dest, newStr);
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+/* Times for --changed-since, and the stamp files for
+ * --changed-since-file, which hold a single time in the format
+ * "2020-06-07T18:30:18.123456789Z".
+ */
+
+#define NANOS 1000000000LL
+
+/* Days since 1970-01-01 of the given date in the proleptic Gregorian
+ * calendar.  (This is the days_from_civil() algorithm from Howard
+ * Hinnant's "chrono-Compatible Low-Level Date Algorithms", which saves
+ * us from needing timegm(), which Windows doesn't have.)
+ */
+static int64_t days_from_civil (int64_t y, unsigned m, unsigned d) {
+    y -= (m <= 2);
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = (unsigned) (y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t) doe - 719468;
+}
+
+/* The inverse of days_from_civil(). */
+static void civil_from_days (int64_t z, int64_t *y, unsigned *m, unsigned *d) {
+    z += 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = (unsigned) (z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+
+    *d = doy - (153 * mp + 2) / 5 + 1;
+    *m = mp + (mp < 10 ? 3 : -9);
+    *y = (int64_t) yoe + era * 400 + (*m <= 2);
+}
+
+/* Parses exactly "n" digits at "*p", and advances "*p" past them. */
+static bool parse_digits (const char **p, int n, unsigned *result) {
+    unsigned r = 0;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        const char c = (*p)[i];
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        r = r * 10 + (c - '0');
+    }
+
+    *p += n;
+    *result = r;
+    return true;
+}
+
+/* Parses "@SECONDS", or all digits, as a UNIX time. */
+static bool parse_unix (const char *s, int64_t *nanos) {
+    char *endptr = NULL;
+
+    if (*s == '@') {
+        s++;
+    }
+
+    if (*s < '0' || *s > '9') {
+        return false;
+    }
+
+    errno = 0;
+    const long long secs = strtoll (s, &endptr, 10);
+    if (errno != 0 || *endptr != 0 || secs > INT64_MAX / NANOS) {
+        return false;
+    }
+
+    *nanos = (int64_t) secs * NANOS;
+    return true;
+}
+
+bool Stamp_parse (const char *s, int64_t *nanos) {
+    const char *p = s;
+    unsigned year, month, day, hour = 0, minute = 0, second = 0;
+    int64_t frac = 0;
+
+    if (parse_unix (s, nanos)) {
+        return true;
+    }
+
+    if (! parse_digits (&p, 4, &year) || *p++ != '-' ||
+        ! parse_digits (&p, 2, &month) || *p++ != '-' ||
+        ! parse_digits (&p, 2, &day) ||
+        month < 1 || month > 12 || day < 1 || day > 31) {
+        return false;
+    }
+
+    if (*p == 'T' || *p == 't' || *p == ' ') {
+        p++;
+        if (! parse_digits (&p, 2, &hour) || *p++ != ':' ||
+            ! parse_digits (&p, 2, &minute) || hour > 23 || minute > 59) {
+            return false;
+        }
+
+        if (*p == ':') {
+            p++;
+            if (! parse_digits (&p, 2, &second) || second > 60) {
+                return false;
+            }
+
+            if (*p == '.' || *p == ',') {
+                int64_t scale = NANOS;
+                p++;
+                if (*p < '0' || *p > '9') {
+                    return false;
+                }
+                for ( ; *p >= '0' && *p <= '9'; p++) {
+                    scale /= 10;
+                    frac += (*p - '0') * scale;
+                }
+            }
+        }
+    }
+
+    int64_t secs = days_from_civil (year, month, day) * 86400 +
+        hour * 3600 + minute * 60 + second;
+
+    if (*p == 'Z' || *p == 'z') {
+        p++;
+    } else if (*p == '+' || *p == '-') {
+        const int sign = (*p++ == '+' ? 1 : -1);
+        unsigned offHour, offMinute = 0;
+
+        if (! parse_digits (&p, 2, &offHour)) {
+            return false;
+        }
+
+        if (*p == ':') {
+            p++;
+        }
+
+        if (*p != 0 && ! parse_digits (&p, 2, &offMinute)) {
+            return false;
+        }
+
+        secs -= sign * (int64_t) (offHour * 3600 + offMinute * 60);
+    } else if (*p == 0) {
+        /* no time zone given, so it's local time */
+        struct tm tm;
+
+        memset (&tm, 0, sizeof (tm));
+        tm.tm_year = year - 1900;
+        tm.tm_mon = month - 1;
+        tm.tm_mday = day;
+        tm.tm_hour = hour;
+        tm.tm_min = minute;
+        tm.tm_sec = second;
+        tm.tm_isdst = -1;
+
+        const time_t t = mktime (&tm);
+        if (t == (time_t) -1) {
+            return false;
+        }
+
+        secs = t;
+    }
+
+    if (*p != 0) {
+        return false;
+    }
+
+    *nanos = secs * NANOS + frac;
+    return true;
+}
+
+ErrorCode Stamp_read (const char *fname, int64_t *nanos) {
+    StrBuf line;
+    ErrorCode ec = EC_OK;
+
+    FILE *f = openFile (fname, "r");
+    if (f == NULL) {
+        if (errno == ENOENT) {
+            return EC_NOFILE;
+        }
+        err_printf ("%s: %s", fname, strerror (errno));
+        return EC_OTHER;
+    }
+
+    SB_init (&line);
+
+    if (! SB_getline (&line, f) || ! Stamp_parse (line.buf, nanos)) {
+        err_printf ("%s: Not a valid time stamp", fname);
+        ec = EC_OTHER;
+    }
+
+    SB_cleanup (&line);
+    fclose (f);
+    return ec;
+}
+
+static void write_stamp (FILE *f, const void *ctx) {
+    const int64_t nanos = *(const int64_t *) ctx;
+    int64_t secs = nanos / NANOS;
+    int64_t frac = nanos % NANOS;
+    int64_t year;
+    unsigned month, day;
+
+    if (frac < 0) {
+        frac += NANOS;
+        secs--;
+    }
+
+    int64_t days = secs / 86400;
+    int64_t rem = secs % 86400;
+    if (rem < 0) {
+        rem += 86400;
+        days--;
+    }
+
+    civil_from_days (days, &year, &month, &day);
+
+    fprintf (f, "%04lld-%02u-%02uT%02u:%02u:%02u.%09lldZ\n",
+             (long long) year, month, day,
+             (unsigned) (rem / 3600), (unsigned) (rem / 60 % 60),
+             (unsigned) (rem % 60), (long long) frac);
+}
+
+ErrorCode Stamp_write (const char *fname, int64_t nanos) {
+    return saveFile (fname, write_stamp, &nanos);
+}
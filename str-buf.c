@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+
+#define MIN_CAP 64
+
+void SB_init (StrBuf *sb) {
+    memset (sb, 0, sizeof (*sb));
+}
+
+void SB_reserve (StrBuf *sb, size_t extra) {
+    const size_t needed = sb->len + extra + 1; /* for NUL terminator */
+
+    if (needed > sb->capacity) {
+        size_t newCap = sb->capacity * 2;
+        if (newCap < MIN_CAP) {
+            newCap = MIN_CAP;
+        }
+        if (newCap < needed) {
+            newCap = needed;
+        }
+        sb->buf = MY_REALLOC (sb->buf, newCap);
+        sb->capacity = newCap;
+    }
+}
+
+void SB_add_len (StrBuf *sb, const char *s, size_t len) {
+    SB_reserve (sb, len);
+    memcpy (sb->buf + sb->len, s, len);
+    sb->len += len;
+    sb->buf[sb->len] = 0;
+}
+
+void SB_add (StrBuf *sb, const char *s) {
+    SB_add_len (sb, s, strlen (s));
+}
+
+void SB_add_char (StrBuf *sb, char c) {
+    SB_reserve (sb, 1);
+    sb->buf[sb->len++] = c;
+    sb->buf[sb->len] = 0;
+}
+
+void SB_printf (StrBuf *sb, const char *fmt, ...) {
+    va_list va;
+
+    va_start (va, fmt);
+    const int n = vsnprintf (NULL, 0, fmt, va);
+    va_end (va);
+
+    if (n <= 0) {
+        return;
+    }
+
+    SB_reserve (sb, n);
+
+    va_start (va, fmt);
+    vsnprintf (sb->buf + sb->len, n + 1, fmt, va);
+    va_end (va);
+
+    sb->len += n;
+}
+
+void SB_color (StrBuf *sb, bool useColor, int color) {
+    if (useColor) {
+        SB_printf (sb, "\e[%dm", color);
+    }
+}
+
+void SB_clear (StrBuf *sb) {
+    sb->len = 0;
+    if (sb->buf != NULL) {
+        sb->buf[0] = 0;
+    }
+}
+
+void SB_cleanup (StrBuf *sb) {
+    free (sb->buf);
+    SB_init (sb);
+}
+
+bool SB_getline (StrBuf *sb, FILE *f) {
+    char chunk[4096];
+    bool any = false;
+
+    SB_clear (sb);
+
+    while (fgets (chunk, sizeof (chunk), f) != NULL) {
+        size_t len = strlen (chunk);
+        any = true;
+
+        if (len > 0 && chunk[len - 1] == '\n') {
+            len--;
+            if (len > 0 && chunk[len - 1] == '\r') {
+                len--;
+            }
+            SB_add_len (sb, chunk, len);
+            return true;
+        }
+
+        SB_add_len (sb, chunk, len);
+    }
+
+    if (sb->buf == NULL) {
+        SB_add_len (sb, "", 0);  /* so buf is never NULL on return */
+    }
+
+    return any;
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+/* --summary counts files, rather than printing them.  Each worker
+ * thread counts into a part of its own, so no locking is needed, and
+ * the parts are merged when the scan is over.  Memory is proportional
+ * to the number of distinct domains, applications, and combinations of
+ * fields, not to the number of files.
+ */
+
+#define NO_KEY "(none)"
+
+typedef struct SummaryPart {
+    uint64_t nFiles;
+    uint64_t nProvenance;       /* files with some attributes */
+    uint64_t nErrors;           /* files which couldn't be read */
+    Tally *domains;             /* domain of URL (or referrer) -> count */
+    Tally *applications;        /* application -> count */
+    Tally *fields;              /* fields present, like "url,referrer" */
+} SummaryPart;
+
+struct Summary {
+    SummaryPart *parts;
+    size_t nParts;
+    bool merged;                /* the parts are all added into part 0 */
+};
+
+Summary *Summary_new (size_t nParts) {
+    Summary *s = MY_MALLOC (sizeof (*s));
+    size_t i;
+
+    s->nParts = nParts;
+    s->merged = false;
+    s->parts = MY_MALLOC (nParts * sizeof (SummaryPart));
+    memset (s->parts, 0, nParts * sizeof (SummaryPart));
+
+    for (i = 0; i < nParts; i++) {
+        s->parts[i].domains = Tally_new ();
+        s->parts[i].applications = Tally_new ();
+        s->parts[i].fields = Tally_new ();
+    }
+
+    return s;
+}
+
+void Summary_free (Summary *s) {
+    size_t i;
+
+    for (i = 0; i < s->nParts; i++) {
+        Tally_free (s->parts[i].domains);
+        Tally_free (s->parts[i].applications);
+        Tally_free (s->parts[i].fields);
+    }
+
+    free (s->parts);
+    free (s);
+}
+
+void Summary_record (Summary *s, size_t part, const Attributes *attrs) {
+    SummaryPart *p = &s->parts[part];
+    StrBuf fields;
+    char buf[256];
+
+    p->nFiles++;
+
+    if (attrs->error != NULL) {
+        p->nErrors++;
+        return;
+    }
+
+    SB_init (&fields);
+    Attr_present (attrs, &fields);
+
+    const bool any = (fields.len > 0);
+    Tally_add (p->fields, (any ? fields.buf : NO_KEY), 1);
+    SB_cleanup (&fields);
+
+    if (! any) {
+        return;
+    }
+
+    p->nProvenance++;
+
+    const char *url = (attrs->url != NULL ? attrs->url : attrs->referrer);
+    const char *domain = NULL;
+    if (url != NULL) {
+        domain = Attr_domain (url, buf, sizeof (buf));
+    }
+
+    Tally_add (p->domains, (domain != NULL ? domain : NO_KEY), 1);
+    Tally_add (p->applications,
+               (attrs->application != NULL ? attrs->application : NO_KEY), 1);
+}
+
+static void print_table (StrBuf *out, const char *title, const Tally *t) {
+    const TallyEntry **sorted = Tally_sorted (t);
+    size_t i;
+
+    SB_printf (out, "\n%s:\n", title);
+
+    for (i = 0; sorted[i] != NULL; i++) {
+        SB_printf (out, "  %12llu  %s\n",
+                   (unsigned long long) sorted[i]->count, sorted[i]->key);
+    }
+
+    free (sorted);
+}
+
+static void print_object (StrBuf *out, const char *name, const Tally *t) {
+    const TallyEntry **sorted = Tally_sorted (t);
+    size_t i;
+
+    SB_printf (out, ",\"%s\":{", name);
+
+    for (i = 0; sorted[i] != NULL; i++) {
+        if (i > 0) {
+            SB_add_char (out, ',');
+        }
+        Attr_jsonString (out, sorted[i]->key);
+        SB_printf (out, ":%llu", (unsigned long long) sorted[i]->count);
+    }
+
+    SB_add_char (out, '}');
+    free (sorted);
+}
+
+void Summary_print (Summary *s, bool json, FILE *f) {
+    SummaryPart *total = &s->parts[0];
+    StrBuf out;
+    size_t i;
+
+    if (! s->merged) {
+        for (i = 1; i < s->nParts; i++) {
+            const SummaryPart *p = &s->parts[i];
+            total->nFiles += p->nFiles;
+            total->nProvenance += p->nProvenance;
+            total->nErrors += p->nErrors;
+            Tally_merge (total->domains, p->domains);
+            Tally_merge (total->applications, p->applications);
+            Tally_merge (total->fields, p->fields);
+        }
+        s->merged = true;
+    }
+
+    SB_init (&out);
+
+    if (json) {
+        SB_printf (&out, "{\"files\":%llu,\"provenance\":%llu,\"errors\":%llu",
+                   (unsigned long long) total->nFiles,
+                   (unsigned long long) total->nProvenance,
+                   (unsigned long long) total->nErrors);
+        print_object (&out, "domains", total->domains);
+        print_object (&out, "applications", total->applications);
+        print_object (&out, "fields", total->fields);
+        SB_add (&out, "}\n");
+    } else {
+        SB_printf (&out, "%-16s %12llu\n", "Files",
+                   (unsigned long long) total->nFiles);
+        SB_printf (&out, "%-16s %12llu\n", "With provenance",
+                   (unsigned long long) total->nProvenance);
+        SB_printf (&out, "%-16s %12llu\n", "Errors",
+                   (unsigned long long) total->nErrors);
+        print_table (&out, "Domains", total->domains);
+        print_table (&out, "Applications", total->applications);
+        print_table (&out, "Fields", total->fields);
+    }
+
+    if (out.len > 0) {
+        fwrite (out.buf, 1, out.len, f);
+    }
+
+    fflush (f);
+    SB_cleanup (&out);
+}
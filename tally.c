@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* An open-addressed hash table from strings to counts.  Memory is
+ * proportional to the number of distinct keys.
+ */
+
+#define MIN_CAP 64              /* must be a power of 2 */
+
+struct Tally {
+    TallyEntry *entries;        /* "capacity" slots; key is NULL if empty */
+    size_t size;                /* number of slots in use */
+    size_t capacity;            /* a power of 2, or 0 */
+};
+
+Tally *Tally_new (void) {
+    Tally *t = MY_MALLOC (sizeof (*t));
+
+    memset (t, 0, sizeof (*t));
+    return t;
+}
+
+void Tally_free (Tally *t) {
+    size_t i;
+
+    for (i = 0; i < t->capacity; i++) {
+        free (t->entries[i].key);
+    }
+
+    free (t->entries);
+    free (t);
+}
+
+static TallyEntry *find_slot (TallyEntry *entries,
+                              size_t capacity,
+                              const char *key) {
+    const size_t mask = capacity - 1;
+    size_t i = (size_t) hashString (key) & mask;
+
+    for ( ; ; i = (i + 1) & mask) {
+        TallyEntry *e = &entries[i];
+        if (e->key == NULL || 0 == strcmp (e->key, key)) {
+            return e;
+        }
+    }
+}
+
+static void grow (Tally *t) {
+    const size_t newCap = (t->capacity == 0 ? MIN_CAP : t->capacity * 2);
+    TallyEntry *newEntries = MY_MALLOC (newCap * sizeof (TallyEntry));
+    size_t i;
+
+    memset (newEntries, 0, newCap * sizeof (TallyEntry));
+
+    for (i = 0; i < t->capacity; i++) {
+        const TallyEntry *e = &t->entries[i];
+        if (e->key != NULL) {
+            *find_slot (newEntries, newCap, e->key) = *e;
+        }
+    }
+
+    free (t->entries);
+    t->entries = newEntries;
+    t->capacity = newCap;
+}
+
+void Tally_add (Tally *t, const char *key, uint64_t n) {
+    /* keep the load factor under 3/4 */
+    if (4 * (t->size + 1) > 3 * t->capacity) {
+        grow (t);
+    }
+
+    TallyEntry *e = find_slot (t->entries, t->capacity, key);
+    if (e->key == NULL) {
+        e->key = MY_STRDUP (key);
+        t->size++;
+    }
+
+    e->count += n;
+}
+
+void Tally_merge (Tally *dest, const Tally *src) {
+    size_t i;
+
+    for (i = 0; i < src->capacity; i++) {
+        const TallyEntry *e = &src->entries[i];
+        if (e->key != NULL) {
+            Tally_add (dest, e->key, e->count);
+        }
+    }
+}
+
+size_t Tally_size (const Tally *t) {
+    return t->size;
+}
+
+/* Biggest count first; ties are broken by key, so that the order
+ * doesn't depend on the layout of the hash table. */
+static int compare_entries (const void *a, const void *b) {
+    const TallyEntry *x = *(const TallyEntry *const *) a;
+    const TallyEntry *y = *(const TallyEntry *const *) b;
+
+    if (x->count > y->count) {
+        return -1;
+    } else if (x->count < y->count) {
+        return 1;
+    } else {
+        return strcmp (x->key, y->key);
+    }
+}
+
+const TallyEntry **Tally_sorted (const Tally *t) {
+    const TallyEntry **sorted = MY_MALLOC ((t->size + 1) * sizeof (sorted[0]));
+    size_t i, n = 0;
+
+    for (i = 0; i < t->capacity; i++) {
+        if (t->entries[i].key != NULL) {
+            sorted[n++] = &t->entries[i];
+        }
+    }
+
+    qsort (sorted, n, sizeof (sorted[0]), compare_entries);
+    sorted[n] = NULL;
+    return sorted;
+}
@@ -56,8 +56,7 @@ static void add_mode (HANDLE h, DWORD mode) {
         }
     }
 
-    r = malloc (sizeof (*r));
-    CHECK_NULL (r);
+    r = MY_MALLOC (sizeof (*r));
     r->h = h;
     r->mode = mode;
     r->next = oldModes;
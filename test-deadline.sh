@@ -0,0 +1,47 @@
+#!/bin/sh
+
+# Scans a tree with some big directories in slices of --deadline MS,
+# resuming from the checkpoint each time, and checks that the slices
+# add up to the same output as a single scan.  Run from the directory
+# containing the whence binary: ./test-deadline.sh [MS [OPTION ...]]
+# where the OPTIONs, such as --inode-order, are given to every slice.
+
+MS=${1:-30}
+[ $# -gt 0 ] && shift
+WHENCE=`pwd`/whence
+TMP=`mktemp -d` || exit $?
+trap 'rm -rf "$TMP"' EXIT
+
+mkdir "$TMP/tree"
+for d in big1 big2 small; do
+    mkdir "$TMP/tree/$d"
+done
+(cd "$TMP/tree/big1" && seq 1 5000 | xargs touch) || exit $?
+(cd "$TMP/tree/big2" && seq 1 5000 | xargs touch) || exit $?
+(cd "$TMP/tree/small" && seq 1 10 | xargs touch) || exit $?
+
+cd "$TMP" || exit $?
+"$WHENCE" -r --ndjson tree | sort > whole.nd
+
+"$WHENCE" -r --ndjson "$@" --checkpoint cp --deadline $MS tree \
+    > sliced.nd 2> /dev/null
+status=$?
+slices=1
+
+while [ $status = 3 ]; do
+    if [ $slices -ge 1000 ]; then
+        echo "FAIL: not done after $slices slices of $MS ms" >&2
+        exit 1
+    fi
+    "$WHENCE" -r --ndjson "$@" --checkpoint cp --resume --deadline $MS \
+        >> sliced.nd 2> /dev/null
+    status=$?
+    slices=`expr $slices + 1`
+done
+
+if sort sliced.nd | cmp -s - whole.nd; then
+    echo "PASS: $slices slices of $MS ms"
+else
+    echo "FAIL: the slices don't match a single scan" >&2
+    exit 1
+fi
@@ -0,0 +1,39 @@
+#!/bin/sh
+
+# Checks the domain which whence finds for some URLs, including ones
+# under internationalized public suffixes, which the URL has in
+# punycode.  Needs Linux (or FreeBSD) and python3, to set the
+# user.xdg.origin.url attribute.  Run from the directory containing
+# the whence binary: ./test-psl.sh
+
+WHENCE=`pwd`/whence
+TMP=`mktemp -d` || exit $?
+trap 'rm -rf "$TMP"' EXIT
+
+status=0
+
+# URL, then the domain expected
+while read url expected; do
+    f="$TMP/file"
+    rm -f "$f" && touch "$f" || exit $?
+    python3 -c 'import os, sys; os.setxattr (sys.argv[1],
+                "user.xdg.origin.url", sys.argv[2].encode ())' \
+        "$f" "$url" || exit $?
+
+    got=`"$WHENCE" --fields domain --format '%{domain}' "$f"`
+    if [ "$got" = "$expected" ]; then
+        echo "PASS: $url"
+    else
+        echo "FAIL: $url gave '$got', not '$expected'" >&2
+        status=1
+    fi
+done <<END
+https://www.example.com/ example.com
+https://a.b.example.co.uk/x example.co.uk
+https://xn--fiqs8s.xn--55qx5d.cn/ xn--fiqs8s.xn--55qx5d.cn
+https://www.xn--fiqs8s.xn--55qx5d.cn/ xn--fiqs8s.xn--55qx5d.cn
+https://www.example.xn--fiqs8s/ example.xn--fiqs8s
+https://XN--FIQS8S.XN--55QX5D.CN/ xn--fiqs8s.xn--55qx5d.cn
+END
+
+exit $status
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <ctype.h>
+
+/* --top counts the most common origin URLs, hosts, and referrers.
+ * Like --summary, each worker thread counts into a part of its own.
+ * Exact counts take memory for every distinct value; with --approx, a
+ * Sketch of a fixed size is used instead, and the counts come with
+ * bounds on how far they may be too high.
+ */
+
+/* How many values a sketch holds, for each one printed. */
+#define SKETCH_FACTOR 64
+#define MIN_SKETCH 4096
+
+enum { TOP_URL, TOP_HOST, TOP_REFERRER, N_TOP };
+
+static const char *const titles[N_TOP] = { "URLs", "Hosts", "Referrers" };
+static const char *const names[N_TOP] = { "urls", "hosts", "referrers" };
+
+typedef struct TopPart {
+    uint64_t nFiles;
+    uint64_t totals[N_TOP];     /* number of values counted */
+    Tally *exact[N_TOP];        /* without --approx */
+    Sketch *approx[N_TOP];      /* with --approx */
+} TopPart;
+
+struct Top {
+    TopPart *parts;
+    size_t nParts;
+    bool merged;                /* the parts are all added into part 0 */
+    size_t k;                   /* how many of each to print */
+    bool approx;
+};
+
+Top *Top_new (size_t nParts, size_t k, bool approx) {
+    Top *t = MY_MALLOC (sizeof (*t));
+    size_t capacity = MIN_SKETCH;
+    size_t i, j;
+
+    if (k > SIZE_MAX / SKETCH_FACTOR) {
+        capacity = k;
+    } else if (k * SKETCH_FACTOR > capacity) {
+        capacity = k * SKETCH_FACTOR;
+    }
+
+    t->nParts = nParts;
+    t->k = k;
+    t->approx = approx;
+    t->merged = false;
+    t->parts = MY_MALLOC (nParts * sizeof (TopPart));
+    memset (t->parts, 0, nParts * sizeof (TopPart));
+
+    for (i = 0; i < nParts; i++) {
+        for (j = 0; j < N_TOP; j++) {
+            if (approx) {
+                t->parts[i].approx[j] = Sketch_new (capacity);
+            } else {
+                t->parts[i].exact[j] = Tally_new ();
+            }
+        }
+    }
+
+    return t;
+}
+
+void Top_free (Top *t) {
+    size_t i, j;
+
+    for (i = 0; i < t->nParts; i++) {
+        for (j = 0; j < N_TOP; j++) {
+            if (t->approx) {
+                Sketch_free (t->parts[i].approx[j]);
+            } else {
+                Tally_free (t->parts[i].exact[j]);
+            }
+        }
+    }
+
+    free (t->parts);
+    free (t);
+}
+
+static void count (Top *t, TopPart *p, size_t which, const char *value) {
+    p->totals[which]++;
+    if (t->approx) {
+        Sketch_add (p->approx[which], value);
+    } else {
+        Tally_add (p->exact[which], value, 1);
+    }
+}
+
+void Top_record (Top *t, size_t part, const Attributes *attrs) {
+    TopPart *p = &t->parts[part];
+    const char *host;
+    size_t len, i;
+    char buf[256];
+
+    p->nFiles++;
+
+    if (attrs->url != NULL) {
+        count (t, p, TOP_URL, attrs->url);
+
+        if (Url_host (attrs->url, &host, &len) && len < sizeof (buf)) {
+            for (i = 0; i < len; i++) {
+                buf[i] = (char) tolower ((unsigned char) host[i]);
+            }
+            buf[len] = 0;
+            count (t, p, TOP_HOST, buf);
+        }
+    }
+
+    if (attrs->referrer != NULL) {
+        count (t, p, TOP_REFERRER, attrs->referrer);
+    }
+}
+
+/* The k biggest entries of a Tally, as SketchEntries with no error, so
+ * that exact and approximate counts can be printed the same way. */
+static SketchEntry *exact_entries (const Tally *tally, size_t k, size_t *n) {
+    const TallyEntry **sorted = Tally_sorted (tally);
+    SketchEntry *entries;
+    size_t i;
+
+    for (i = 0; i < k && sorted[i] != NULL; i++) {
+        /* count them */
+    }
+
+    *n = i;
+    entries = MY_MALLOC ((i + 1) * sizeof (SketchEntry));
+
+    for (i = 0; i < *n; i++) {
+        entries[i].key = sorted[i]->key;
+        entries[i].count = sorted[i]->count;
+        entries[i].error = 0;
+    }
+
+    free (sorted);
+    return entries;
+}
+
+static SketchEntry *approx_entries (const Sketch *sketch,
+                                    size_t k,
+                                    size_t *n) {
+    const SketchEntry **sorted = Sketch_sorted (sketch);
+    SketchEntry *entries;
+    size_t i;
+
+    for (i = 0; i < k && sorted[i] != NULL; i++) {
+        /* count them */
+    }
+
+    *n = i;
+    entries = MY_MALLOC ((i + 1) * sizeof (SketchEntry));
+
+    for (i = 0; i < *n; i++) {
+        entries[i] = *sorted[i];
+    }
+
+    free (sorted);
+    return entries;
+}
+
+static void print_table (StrBuf *out,
+                         const Top *t,
+                         size_t which,
+                         const SketchEntry *entries,
+                         size_t n,
+                         uint64_t maxError) {
+    const unsigned long long total = t->parts[0].totals[which];
+    size_t i;
+
+    if (t->approx) {
+        SB_printf (out, "\n%s (%llu in all; counts may be up to %llu "
+                   "too high):\n", titles[which], total,
+                   (unsigned long long) maxError);
+        SB_printf (out, "  %12s  %10s  %s\n", "count", "max error", "value");
+    } else {
+        SB_printf (out, "\n%s (%llu in all):\n", titles[which], total);
+    }
+
+    for (i = 0; i < n; i++) {
+        if (t->approx) {
+            SB_printf (out, "  %12llu  %10llu  %s\n",
+                       (unsigned long long) entries[i].count,
+                       (unsigned long long) entries[i].error, entries[i].key);
+        } else {
+            SB_printf (out, "  %12llu  %s\n",
+                       (unsigned long long) entries[i].count, entries[i].key);
+        }
+    }
+}
+
+static void print_object (StrBuf *out,
+                          const Top *t,
+                          size_t which,
+                          const SketchEntry *entries,
+                          size_t n,
+                          uint64_t maxError) {
+    size_t i;
+
+    SB_printf (out, ",\"%s\":{\"total\":%llu", names[which],
+               (unsigned long long) t->parts[0].totals[which]);
+    if (t->approx) {
+        SB_printf (out, ",\"maxError\":%llu", (unsigned long long) maxError);
+    }
+    SB_add (out, ",\"top\":[");
+
+    for (i = 0; i < n; i++) {
+        SB_add (out, (i > 0 ? ",{\"value\":" : "{\"value\":"));
+        Attr_jsonString (out, entries[i].key);
+        SB_printf (out, ",\"count\":%llu",
+                   (unsigned long long) entries[i].count);
+        if (t->approx) {
+            SB_printf (out, ",\"error\":%llu",
+                       (unsigned long long) entries[i].error);
+        }
+        SB_add_char (out, '}');
+    }
+
+    SB_add (out, "]}");
+}
+
+void Top_print (Top *t, bool json, FILE *f) {
+    TopPart *total = &t->parts[0];
+    StrBuf out;
+    size_t i, j;
+
+    if (! t->merged) {
+        for (i = 1; i < t->nParts; i++) {
+            const TopPart *p = &t->parts[i];
+            total->nFiles += p->nFiles;
+            for (j = 0; j < N_TOP; j++) {
+                total->totals[j] += p->totals[j];
+                if (t->approx) {
+                    Sketch_merge (total->approx[j], p->approx[j]);
+                } else {
+                    Tally_merge (total->exact[j], p->exact[j]);
+                }
+            }
+        }
+        t->merged = true;
+    }
+
+    SB_init (&out);
+
+    if (json) {
+        SB_printf (&out, "{\"files\":%llu,\"approximate\":%s",
+                   (unsigned long long) total->nFiles,
+                   (t->approx ? "true" : "false"));
+    } else {
+        SB_printf (&out, "%-16s %12llu\n", "Files",
+                   (unsigned long long) total->nFiles);
+    }
+
+    for (j = 0; j < N_TOP; j++) {
+        SketchEntry *entries;
+        uint64_t maxError = 0;
+        size_t n;
+
+        if (t->approx) {
+            entries = approx_entries (total->approx[j], t->k, &n);
+            maxError = Sketch_maxError (total->approx[j]);
+        } else {
+            entries = exact_entries (total->exact[j], t->k, &n);
+        }
+
+        if (json) {
+            print_object (&out, t, j, entries, n, maxError);
+        } else {
+            print_table (&out, t, j, entries, n, maxError);
+        }
+
+        free (entries);
+    }
+
+    if (json) {
+        SB_add (&out, "}\n");
+    }
+
+    if (out.len > 0) {
+        fwrite (out.buf, 1, out.len, f);
+    }
+
+    fflush (f);
+    SB_cleanup (&out);
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <string.h>
+
+/* Finds the host in "url" without copying anything.  The URLs we see
+ * come from browsers and mail clients, so they are already absolute
+ * and normalized; this only needs to be right for those, not for
+ * everything RFC 3986 allows.
+ */
+bool Url_host (const char *url, const char **host, size_t *len) {
+    const char *p = url;
+
+    /* scheme: ALPHA *( ALPHA / DIGIT / "+" / "-" / "." ) */
+    while ((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z') ||
+           (p > url && ((*p >= '0' && *p <= '9') ||
+                        *p == '+' || *p == '-' || *p == '.'))) {
+        p++;
+    }
+
+    if (p == url || p[0] != ':' || p[1] != '/' || p[2] != '/') {
+        return false;
+    }
+
+    p += 3;
+
+    /* The authority ends at the first "/", "?", or "#".  The host is
+     * what's left after removing "userinfo@" from the front, and
+     * ":port" from the back. */
+    const char *start = p;
+    const char *end = p + strcspn (p, "/?#");
+    const char *at = NULL;
+
+    for ( ; p < end; p++) {
+        if (*p == '@') {
+            at = p;
+        }
+    }
+
+    if (at != NULL) {
+        start = at + 1;
+    }
+
+    if (*start == '[') {
+        /* IPv6 literal; keep the brackets */
+        const char *close = memchr (start, ']', end - start);
+        if (close == NULL) {
+            return false;
+        }
+        end = close + 1;
+    } else {
+        const char *colon = memchr (start, ':', end - start);
+        if (colon != NULL) {
+            end = colon;
+        }
+    }
+
+    if (end == start) {
+        return false;
+    }
+
+    *host = start;
+    *len = end - start;
+    return true;
+}
+
+#define FNV_BASIS 2166136261U
+#define FNV_PRIME 16777619U
+
+/* Hosts are ASCII (IDNs are in punycode), so tolower() and its locale
+ * aren't needed. */
+static int lower (char c) {
+    return ((c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : (unsigned char) c);
+}
+
+/* Finds the rule for a suffix of a host (which isn't NUL terminated,
+ * and may not be in lower case), whose hash is "hash". */
+static const PslRule *find_rule (const char *s, size_t len, uint32_t hash) {
+    const size_t mask = pslTableSize - 1;
+    size_t i, j;
+
+    for (i = hash & mask; pslTable[i].name != NULL; i = (i + 1) & mask) {
+        const char *name = pslTable[i].name;
+
+        if (pslTable[i].hash != hash) {
+            continue;
+        }
+
+        for (j = 0; j < len && lower (s[j]) == (unsigned char) name[j]; j++) {
+            /* keep going */
+        }
+
+        if (j == len && name[j] == 0) {
+            return &pslTable[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Returns where the label which ends at "end" in "host" starts, and
+ * adds the bytes of the label (and the dot in front of it, if "dot")
+ * to "*hash", last to first. */
+static size_t label_start (const char *host, size_t end,
+                           bool dot, uint32_t *hash) {
+    uint32_t h = *hash;
+
+    if (dot) {
+        h = (h ^ '.') * FNV_PRIME;
+    }
+
+    while (end > 0 && host[end - 1] != '.') {
+        end--;
+        h = (h ^ (uint32_t) lower (host[end])) * FNV_PRIME;
+    }
+
+    *hash = h;
+    return end;
+}
+
+/* Since every parent of a rule is in pslTable too, the suffixes of the
+ * host can be looked up from the right, one more label at a time,
+ * stopping at the first which isn't there.  The longest rule which
+ * matches decides the public suffix, so it's the last one seen.  An
+ * exception (such as "!www.ck") belongs to a wildcard (such as "*.ck"),
+ * and nothing is longer than an exception.  If nothing matches, the
+ * rule is "*", so the public suffix is the last label.
+ */
+bool Url_domain (const char *host,
+                 size_t len,
+                 const char **domain,
+                 size_t *domainLen) {
+    uint32_t hash = FNV_BASIS;
+
+    while (len > 0 && host[len - 1] == '.') {
+        len--;
+    }
+
+    size_t start = label_start (host, len, false, &hash);
+
+    /* An IP address (with no TLD being all digits) is its own domain. */
+    if (len > 0 && (host[0] == '[' ||
+                    strspn (host + start, "0123456789") == len - start)) {
+        *domain = host;
+        *domainLen = len;
+        return true;
+    }
+
+    size_t parent = start;
+    size_t suffix = start;      /* where the public suffix starts */
+    bool wildcard = false;      /* the parent has a wildcard rule */
+
+    while (true) {
+        const PslRule *rule = find_rule (host + start, len - start, hash);
+
+        if (wildcard) {
+            suffix = start;
+        }
+
+        if (rule == NULL) {
+            break;
+        } else if (rule->flags & PSL_EXCEPTION) {
+            suffix = parent;
+            break;
+        } else if (rule->flags & PSL_RULE) {
+            suffix = start;
+        }
+
+        if (start == 0) {
+            break;
+        }
+
+        wildcard = ((rule->flags & PSL_WILDCARD) != 0);
+        parent = start;
+        start = label_start (host, start - 1, true, &hash);
+    }
+
+    if (suffix == 0) {
+        return false;           /* the whole host is a public suffix */
+    }
+
+    const size_t first = label_start (host, suffix - 1, true, &hash);
+    *domain = host + first;
+    *domainLen = len - first;
+    return true;
+}
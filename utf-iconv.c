@@ -29,6 +29,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <pthread.h>
 
 typedef enum Opened {
     Opened_NotTried,
@@ -44,6 +45,10 @@ typedef union TestEndian {
 static iconv_t conv_handle;     /* for converting utf-8 to utf-16 */
 static Opened conv_opened = Opened_NotTried;
 
+/* conv_handle carries conversion state, so only one thread may use it
+ * at a time. */
+static pthread_mutex_t conv_lock = PTHREAD_MUTEX_INITIALIZER;
+
 static const char *utf16_name (void) {
     TestEndian u;
 
@@ -79,19 +84,20 @@ static bool open_conv (void) {
 
 utf16 *utf8to16_len (const char *s, size_t len) {
     if (len == 0) {             /* special case for empty string */
-        utf16 *result = malloc (2);
-        CHECK_NULL (result);
+        utf16 *result = MY_MALLOC (2);
         *result = 0;
         return result;
     }
 
+    pthread_mutex_lock (&conv_lock);
+
     if (! open_conv()) {
+        pthread_mutex_unlock (&conv_lock);
         return NULL;
     }
 
     const size_t maxlen = 2 * (len + 1);
-    utf16 *result = (utf16 *) malloc (maxlen);
-    CHECK_NULL (result);
+    utf16 *result = (utf16 *) MY_MALLOC (maxlen);
 
     char *inbuf = (char *) s;   /* cast away const; should be safe */
     char *outbuf = (char *) result;
@@ -101,6 +107,8 @@ utf16 *utf8to16_len (const char *s, size_t len) {
     const size_t ret = iconv (conv_handle,
                               &inbuf, &inbytesleft,
                               &outbuf, &outbytesleft);
+    pthread_mutex_unlock (&conv_lock);
+
     if (ret == (size_t)(-1)) {
         free (result);
         return NULL;
@@ -115,8 +123,7 @@ utf16 *utf8to16_len (const char *s, size_t len) {
     /* NUL terminate the UTF-16 string */
     result[bytes_converted / 2] = 0;
     /* Shrink allocated buffer to size used */
-    result = (utf16 *) realloc (result, bytes_converted + 2);
-    CHECK_NULL (result);
+    result = (utf16 *) MY_REALLOC (result, bytes_converted + 2);
     return result;
 }
 
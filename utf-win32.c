@@ -50,15 +50,13 @@ char *utf16to8 (const utf16 *s) {
 
 utf16 *utf8to16_len (const char *s, size_t len) {
     if (len == 0) {             /* special case for empty string */
-        utf16 *result = malloc (2);
-        CHECK_NULL (result);
+        utf16 *result = MY_MALLOC (2);
         *result = 0;
         return result;
     }
 
     const size_t result_code_units = len + 2;
-    utf16 *result = (utf16 *) malloc (2 * result_code_units);
-    CHECK_NULL (result);
+    utf16 *result = (utf16 *) MY_MALLOC (2 * result_code_units);
     const int ret =
         MultiByteToWideChar (CP_UTF8, 0, s, len, result, result_code_units);
 
@@ -79,22 +77,19 @@ utf16 *utf8to16_len (const char *s, size_t len) {
 
     result[ret] = 0;            /* NUL terminate result */
     const size_t actual_code_units = ret + 1;
-    result = (utf16 *) realloc (result, 2 * actual_code_units);
-    CHECK_NULL (result);
+    result = (utf16 *) MY_REALLOC (result, 2 * actual_code_units);
     return result;
 }
 
 char *utf16to8_len (const utf16 *s, size_t len) {
     if (len == 0) {             /* special case for empty string */
-        char *result = malloc (1);
-        CHECK_NULL (result);
+        char *result = MY_MALLOC (1);
         *result = 0;
         return result;
     }
 
     const size_t result_bytes = len * 3 + 2;
-    char *result = malloc (result_bytes);
-    CHECK_NULL (result);
+    char *result = MY_MALLOC (result_bytes);
     const int ret = WideCharToMultiByte (CP_UTF8, 0, s, len,
                                          result, result_bytes, NULL, NULL);
 
@@ -115,8 +110,7 @@ char *utf16to8_len (const utf16 *s, size_t len) {
 
     result[ret] = 0;            /* NUL terminate result */
     const size_t actual_bytes = ret + 1;
-    result = realloc (result, actual_bytes);
-    CHECK_NULL (result);
+    result = MY_REALLOC (result, actual_bytes);
     return result;
 }
 
@@ -27,8 +27,9 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdarg.h>
+#include <errno.h>
 
-static const char *my_basename (const char *file) {
+const char *my_basename (const char *file) {
     const char *slash = strrchr (file, '/');
     if (slash) {
         return slash + 1;
@@ -67,10 +68,48 @@ char *my_strdup (const char *s, const char *file, long line) {
         oom (file, line);
     }
 
+    if (allocStatsEnabled) {
+        Alloc_note (file, strlen (ret) + 1, false);
+    }
+
+    return ret;
+}
+
+void *my_malloc (size_t size, const char *file, long line) {
+    void *ret = malloc (size);
+    if (ret == NULL) {
+        oom (file, line);
+    }
+
+    if (allocStatsEnabled) {
+        Alloc_note (file, size, false);
+    }
+
+    return ret;
+}
+
+void *my_realloc (void *ptr, size_t size, const char *file, long line) {
+    void *ret = realloc (ptr, size);
+    if (ret == NULL) {
+        oom (file, line);
+    }
+
+    if (allocStatsEnabled) {
+        Alloc_note (file, size, true);
+    }
+
     return ret;
 }
 
 void err_printf (const char *format, ...) {
+    /* Lock stderr so that messages from different scanning threads
+     * don't get mixed together. */
+#ifdef _WIN32
+    _lock_file (stderr);
+#else
+    flockfile (stderr);
+#endif
+
     setColor (stderr, stderrTerminal.supports_color, COLOR_RED);
 
     va_list va;
@@ -80,9 +119,15 @@ void err_printf (const char *format, ...) {
 
     setColor (stderr, stderrTerminal.supports_color, COLOR_OFF);
     fprintf (stderr, "\n");
+
+#ifdef _WIN32
+    _unlock_file (stderr);
+#else
+    funlockfile (stderr);
+#endif
 }
 
-size_t print_escaped_unicode (const char *s) {
+size_t print_escaped_unicode (StrBuf *out, const char *s) {
     const char *p;
 
     for (p = s; ((unsigned char) (*p)) >= 0x80; p++) {
@@ -96,17 +141,13 @@ size_t print_escaped_unicode (const char *s) {
         /* If the conversion to UTF-16 fails (e. g. invalid UTF-8)
          * then just print out the alleged UTF-8 as-is, and hope
          * that's okay. */
-        size_t i;
-
-        for (i = 0; i < len; i++) {
-            putchar (s[i]);
-        }
+        SB_add_len (out, s, len);
     } else {
         utf16 *pw;
 
         for (pw = wide; *pw != 0; pw++) {
             const unsigned int c = *pw;
-            printf ("\\u%04X", c & 0xffff);
+            SB_printf (out, "\\u%04X", c & 0xffff);
         }
 
         free (wide);
@@ -130,3 +171,77 @@ bool envNoColor (void) {
         return false;
     }
 }
+
+char *joinPath (const char *dir, const char *name) {
+    const size_t dirLen = strlen (dir);
+    const size_t nameLen = strlen (name);
+    char *path = MY_MALLOC (dirLen + nameLen + 2);
+    size_t len = dirLen;
+
+    memcpy (path, dir, dirLen);
+
+    if (dirLen == 0 || (dir[dirLen - 1] != '/'
+#ifdef _WIN32
+                        && dir[dirLen - 1] != '\\'
+#endif
+            )) {
+        path[len++] = '/';
+    }
+
+    memcpy (path + len, name, nameLen + 1);
+    return path;
+}
+
+uint64_t hashString (const char *s) {
+    uint64_t h = 0xcbf29ce484222325ULL; /* FNV-1a offset basis */
+
+    for ( ; *s != 0; s++) {
+        h ^= (unsigned char) *s;
+        h *= 0x100000001b3ULL;          /* FNV-1a prime */
+    }
+
+    return h;
+}
+
+ErrorCode saveFile (const char *fname,
+                    void (*writer) (FILE *f, const void *ctx),
+                    const void *ctx) {
+    ArrayList al;
+    char *errmsg = NULL;
+
+    AL_init (&al);
+    AL_add (&al, fname);
+    AL_add (&al, ".tmp");
+    char *tmpname = AL_join (&al);
+    AL_cleanup (&al);
+
+    FILE *f = openFile (tmpname, "wb");
+    if (f == NULL) {
+        err_printf ("%s: %s", tmpname, strerror (errno));
+        free (tmpname);
+        return EC_OTHER;
+    }
+
+    writer (f, ctx);
+
+    /* The new contents must be on disk before they replace the old,
+     * or a crash could leave neither. */
+    ErrorCode ec = syncStream (f, &errmsg);
+    if (fclose (f) != 0 && ec == EC_OK) {
+        errmsg = MY_STRDUP (strerror (errno));
+        ec = EC_OTHER;
+    }
+
+    if (ec == EC_OK) {
+        ec = replaceFile (tmpname, fname, &errmsg);
+    }
+
+    if (ec != EC_OK) {
+        err_printf ("%s: %s", tmpname, errmsg);
+        remove (tmpname);
+    }
+
+    free (errmsg);
+    free (tmpname);
+    return ec;
+}
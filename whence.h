@@ -113,17 +113,232 @@ typedef struct Attributes {
     char *application;
     MyDate date;
     char *zone;
+    char *same_as;              /* set by --dedup for repeated inodes */
     char *error;
 } Attributes;
 
-/* Style for printing attributes, passed to Attr_print(). */
+/* The fields of Attributes which can be selected with --fields, as
+ * bits in a mask.  (Same-As and Error are always printed.)  AF_DOMAIN
+ * isn't stored, but derived from the URL, and is only printed when
+ * asked for. */
+#define AF_URL          0x01
+#define AF_REFERRER     0x02
+#define AF_FROM         0x04
+#define AF_SUBJECT      0x08
+#define AF_MESSAGE_ID   0x10
+#define AF_APPLICATION  0x20
+#define AF_DATE         0x40
+#define AF_ZONE         0x80
+#define AF_DOMAIN       0x100
+#define AF_ALL          0x1ff
+#define AF_DEFAULT      (AF_ALL & ~AF_DOMAIN)
+
+/* An attribute which getAttributes() reads, and the AF_* bits of the
+ * fields it provides.  Lists of them end with a NULL name. */
+typedef struct AttrName {
+    const char *name;
+    uint32_t fields;
+} AttrName;
+
+/* Style for printing attributes, passed to Attr_print().
+ * AS_JSON is one member of the JSON object printed by --json;
+ * AS_NDJSON is one self-contained JSON object per line.
+ * AS_PATHS is just the path, followed by a NUL, for --has-provenance.
+ * AS_FORMAT is whatever the --format template says.
+ * AS_CSV and AS_TSV are one row per file, with fixed columns.
+ */
 typedef enum AttrStyle {
     AS_HUMAN,
     AS_HUMAN_COLOR,
-    AS_JSON_NOTLAST,
-    AS_JSON_LAST
+    AS_JSON,
+    AS_NDJSON,
+    AS_PATHS,
+    AS_FORMAT,
+    AS_CSV,
+    AS_TSV
 } AttrStyle;
 
+/* A growable string buffer.  "buf" is malloced, and is always kept
+ * NUL terminated (once anything has been added to it), although
+ * "len" does not count the NUL terminator.
+ */
+typedef struct StrBuf {
+    char *buf;                  /* malloced, or NULL if nothing added yet */
+    size_t len;                 /* number of bytes used, not counting NUL */
+    size_t capacity;            /* number of bytes allocated */
+} StrBuf;
+
+/* Type of a file, as far as the directory scanner is concerned. */
+typedef enum FileType {
+    FT_UNKNOWN,                 /* not known without calling stat() */
+    FT_FILE,                    /* regular file */
+    FT_DIR,                     /* directory */
+    FT_OTHER                    /* symbolic link, device, socket, etc. */
+} FileType;
+
+/* An entry returned by Dir_read().  "name" is owned by the DirReader,
+ * and is only valid until the next call to Dir_read() or Dir_close().
+ */
+typedef struct DirEntry {
+    const char *name;           /* UTF-8 name, without the directory */
+    uint64_t inode;             /* inode number, or 0 if not known */
+    FileType type;
+} DirEntry;
+
+/* An open directory.  The contents are platform-specific. */
+typedef struct DirReader DirReader;
+
+/* Information about a file, as returned by getFileInfo().  "device"
+ * and "inode" are 0 on platforms which do not have them.
+ */
+typedef struct FileInfo {
+    FileType type;
+    uint64_t device;
+    uint64_t inode;
+} FileInfo;
+
+/* A set of (device, inode) pairs.  The contents are private to
+ * inode-set.c. */
+typedef struct InodeSet InodeSet;
+
+/* Extra information about a file, passed to getAttributes() so that
+ * it can avoid unnecessary work.  The scanner fills this in from what
+ * it already knows about the file.
+ */
+typedef struct AttrQuery {
+    uint64_t device;            /* device the file is on, or 0 if unknown */
+    bool presenceOnly;          /* only check whether there are any */
+    uint32_t fields;            /* AF_* bits of the fields wanted */
+} AttrQuery;
+
+/* A count for each of a set of strings.  The contents are private to
+ * tally.c. */
+typedef struct Tally Tally;
+
+/* One string in a Tally, and its count. */
+typedef struct TallyEntry {
+    char *key;                  /* owned by the Tally */
+    uint64_t count;
+} TallyEntry;
+
+/* A fixed number of counts of the most frequent strings seen.  The
+ * contents are private to sketch.c. */
+typedef struct Sketch Sketch;
+
+/* One string in a Sketch, and its count, which is too high by at most
+ * "error". */
+typedef struct SketchEntry {
+    char *key;                  /* owned by the Sketch */
+    uint64_t count;
+    uint64_t error;
+} SketchEntry;
+
+/* The counts kept by --top.  The contents are private to top.c. */
+typedef struct Top Top;
+
+/* The counts kept by --summary.  The contents are private to
+ * summary.c. */
+typedef struct Summary Summary;
+
+/* The state of --sample.  The contents are private to sample.c. */
+typedef struct Sample Sample;
+
+/* Looks up attributes on a thread of its own, for --file-timeout.  The
+ * contents are private to prober.c. */
+typedef struct Prober Prober;
+
+/* A compiled --where predicate.  The contents are private to where.c. */
+typedef struct Where Where;
+
+/* A compiled --format template.  The contents are private to
+ * format.c. */
+typedef struct Format Format;
+
+/* A --blocklist of domains and URL prefixes.  The contents are private
+ * to blocklist.c. */
+typedef struct Blocklist Blocklist;
+
+/* A rule of the Public Suffix List, for Url_domain().  The name is in
+ * lower case, without any "*." or "!".  The hash is FNV-1a of the bytes
+ * of the name, from last to first.  The flags say which kinds of rule
+ * there are for the name; 0 means the name is only there because it is
+ * the parent of a rule. */
+typedef struct PslRule {
+    const char *name;           /* NULL for an empty slot */
+    uint32_t hash;
+    uint8_t flags;
+} PslRule;
+
+#define PSL_RULE        0x01    /* "example.com" is a public suffix */
+#define PSL_WILDCARD    0x02    /* so is "*.example.com" */
+#define PSL_EXCEPTION   0x04    /* but "!example.com" is not */
+
+/* The records collected by --sort path.  The contents are private to
+ * sort.c. */
+typedef struct Sorter Sorter;
+
+/* A piece of output, for writeGather(). */
+typedef struct OutPiece {
+    const char *buf;
+    size_t len;
+} OutPiece;
+
+/* A queue of jobs kept in a temporary file, for --max-memory.  The
+ * contents are private to spill.c. */
+typedef struct Spill Spill;
+
+/* A job which was still to be done when a checkpoint was taken:
+ * either a directory to scan, or a file named on the command line. */
+typedef struct FrontierJob {
+    char *path;                 /* malloced */
+    bool isDir;
+    uint64_t rootDevice;        /* device of the command-line argument */
+    uint64_t skip;              /* entries of the directory already done */
+} FrontierJob;
+
+/* The progress of a scan, as saved by --checkpoint.  Everything except
+ * the jobs in the frontier has already been written to stdout, which
+ * was "offset" bytes long at the time (if it was a regular file).
+ */
+typedef struct Checkpoint {
+    bool haveOffset;            /* was stdout a regular file? */
+    uint64_t offset;            /* size of stdout, if so */
+    uint64_t nDirs;             /* directories finished */
+    uint64_t nFiles;            /* files finished */
+    FrontierJob *jobs;          /* malloced array of the frontier */
+    size_t nJobs;
+    size_t capacity;
+} Checkpoint;
+
+/* Options which control scanFiles(). */
+typedef struct ScanOptions {
+    AttrStyle style;            /* how to print the results */
+    bool recursive;             /* descend into directories */
+    bool inodeOrder;            /* process directory entries by inode */
+    bool xdev;                  /* don't descend into other filesystems */
+    bool dedup;                 /* read each inode only once */
+    uint32_t shardIndex;        /* only process files in this shard... */
+    uint32_t shardCount;        /* ...of this many (0 means no sharding) */
+    Sample *sample;             /* for --sample, or NULL */
+    bool changedOnly;           /* only files with ctime >= changedSince */
+    int64_t changedSince;       /* nanoseconds since 1970 */
+    const char *checkpoint;     /* file for --checkpoint, or NULL */
+    const Checkpoint *resume;   /* for --resume, or NULL */
+    size_t maxMemory;           /* --max-memory in bytes, or 0 for none */
+    uint32_t fileTimeout;       /* --file-timeout in ms, or 0 for none */
+    int64_t deadline;           /* --deadline (ns since 1970), or 0 */
+    bool background;            /* --background: throttle by I/O pressure */
+    bool presenceOnly;          /* --has-provenance: don't read values */
+    uint32_t fields;            /* AF_* bits selected by --fields */
+    const Where *where;         /* --where predicate, or NULL */
+    const Format *format;       /* template for AS_FORMAT, or NULL */
+    const Blocklist *blocklist; /* --blocklist, or NULL */
+    FILE *blocklistOut;         /* where --blocklist matches are written */
+    Summary *summary;           /* --summary, instead of printing files */
+    Top *top;                   /* --top, instead of printing files */
+    int threads;                /* number of scanning threads */
+} ScanOptions;
+
 /* Only used on MacOS.  Connection to a SQLite3 database.
  * "db" is actually a "sqlite3 *", but we cast it to void
  * to avoid having to include sqlite3.h from whence.h.
@@ -187,6 +402,13 @@ typedef struct Terminal {
  */
 #define MY_STRDUP(x) my_strdup ((x), __FILE__, __LINE__)
 
+/* Likewise, MY_MALLOC() and MY_REALLOC() combine malloc() and realloc()
+ * with CHECK_NULL().  Going through these (rather than calling malloc()
+ * directly) also lets the allocation be counted for --alloc-stats.
+ */
+#define MY_MALLOC(n) my_malloc ((n), __FILE__, __LINE__)
+#define MY_REALLOC(p, n) my_realloc ((p), (n), __FILE__, __LINE__)
+
 /* getattr.c or windows.c ------------------------------------------------ */
 
 /* Get the attribute "attr" from the file named "fname".  New memory is
@@ -201,12 +423,36 @@ typedef struct Terminal {
  * A NUL byte is stored after the result, to make it easier to deal
  * with if it is a string.  The NUL byte is not considered part of the
  * attribute, and is not counted in the length.
+ *
+ * On UNIX, if the filesystem turns out not to support extended
+ * attributes at all, query->device is remembered, so that
+ * xattrsUnsupported() will return true for other files on that device.
  */
 ErrorCode getAttribute (const char *fname,
                         const char *attr,
+                        const AttrQuery *query,
                         char **result,
                         size_t *length);
 
+/* Returns true if a previous call to getAttribute() found that the
+ * device query->device does not support extended attributes, in which
+ * case there is no point in asking for any.  Always returns false on
+ * Windows, or if the device is not known.
+ */
+bool xattrsUnsupported (const AttrQuery *query);
+
+/* Checks whether "fname" has any of the attributes (or on Windows,
+ * alternate data streams) in "names" which provide one of the fields
+ * in query->fields, without reading any of them: on UNIX, with one
+ * listxattr().  Returns EC_OK if it has at least one, EC_NOATTR if it
+ * has none, or some other code, with a newly allocated message in
+ * "*errmsg", on error.
+ */
+ErrorCode probeAttributes (const char *fname,
+                           const AttrName *names,
+                           const AttrQuery *query,
+                           char **errmsg);
+
 /* Returns a malloced string which must be freed by the caller.
  * On UNIX, "fname" is returned unchanged and "drives" is unused, so
  * fixFilename() is basically a glorified strdup().
@@ -254,6 +500,11 @@ char *fixFilename (const char *fname, int32_t *drives);
  */
 void oom (const char *file, long line);
 
+/* Returns the part of "file" after the last slash.  Used to shorten
+ * __FILE__ in error messages and reports.
+ */
+const char *my_basename (const char *file);
+
 /* Combines two error codes.  Generally the higher-numbered error is
  * given preference, except that EC_OK is preferred over EC_NOATTR.
  */
@@ -264,6 +515,12 @@ ErrorCode combineErrors (ErrorCode ec1, ErrorCode ec2);
  */
 char *my_strdup (const char *s, const char *file, long line);
 
+/* Call malloc() or realloc(), and then die if NULL is returned.
+ * Used by MY_MALLOC() and MY_REALLOC() macros.
+ */
+void *my_malloc (size_t size, const char *file, long line);
+void *my_realloc (void *ptr, size_t size, const char *file, long line);
+
 /* Format the given arguments, printf-style, and print them to stderr.
  * If stderrTerminal.supports_color is true, send ANSI escapes so that
  * the message is printed in red.  err_printf() prints a newline after
@@ -278,15 +535,15 @@ void err_printf (const char *fmt, ...)
 
 /* Starting at "s", count the number of bytes with the hi bit set.
  * This represents one or more non-ASCII Unicode characters encoded
- * in UTF-8.  Converts these character(s) to UTF-16, and prints one
- * or more JSON-style "\uXXXX" escape sequences to stdout, representing
+ * in UTF-8.  Converts these character(s) to UTF-16, and appends one
+ * or more JSON-style "\uXXXX" escape sequences to "out", representing
  * these UTF-16 code points.
  *
  * Returns the number of bytes processed.  (i. e. advancing s by the
  * return value will make s point at the the next byte that does not
  * have the hi bit set.)
  */
-size_t print_escaped_unicode (const char *s);
+size_t print_escaped_unicode (StrBuf *out, const char *s);
 
 /* Possibly prints an ANSI escape code to the stream "f", which will
  * set the text color to "color", which is one of the "COLOR_*" defines
@@ -297,12 +554,54 @@ size_t print_escaped_unicode (const char *s);
  */
 void setColor (FILE *f, bool useColor, int color);
 
+/* Replaces the contents of the file "fname" with whatever "writer"
+ * writes to "f" (passing "ctx" along).  The new contents are written
+ * to a temporary file, which is synced to disk and then renamed over
+ * "fname", so "fname" always holds either the old contents or the new.
+ * Errors are printed, and EC_OTHER is returned.
+ */
+ErrorCode saveFile (const char *fname,
+                    void (*writer) (FILE *f, const void *ctx),
+                    const void *ctx);
+
+/* Returns a malloced string of "name" appended to the directory
+ * "dir", with a slash between them if "dir" doesn't end in one. */
+char *joinPath (const char *dir, const char *name);
+
+/* Returns a 64-bit FNV-1a hash of the string "s".  This is stable
+ * across runs, platforms, and versions of whence, so it is suitable for
+ * things like dividing files between several machines.
+ */
+uint64_t hashString (const char *s);
+
 /* Returns true if the environment variable NO_COLOR is set to a
  * non-empty value.  This is used by detectConsole().
  * See https://no-color.org/
  */
 bool envNoColor (void);
 
+/* alloc-stats.c --------------------------------------------------------- */
+
+/* Set by the --alloc-stats option.  When true, my_malloc(), my_realloc(),
+ * and my_strdup() record each allocation by source file, and
+ * Alloc_report() can be called before exiting to print a summary.
+ */
+extern bool allocStatsEnabled;
+
+/* Records an allocation of "size" bytes made from source file "file"
+ * (as given by __FILE__).  "isRealloc" distinguishes buffer growth
+ * from fresh allocations.  Only called if allocStatsEnabled is true.
+ */
+void Alloc_note (const char *file, size_t size, bool isRealloc);
+
+/* Prints the number of allocations and bytes allocated, per source file
+ * and per subsystem, to stderr.  Frees are not tracked, so the bytes
+ * are a total, not a live count.  The maximum resident set size of
+ * the process (which is not the peak of the heap) is printed as well,
+ * where the platform makes it available.
+ */
+void Alloc_report (void);
+
 /* array-list.c ---------------------------------------------------------- */
 
 /* Initializes an ArrayList structure, such that it contains the empty list. */
@@ -328,6 +627,47 @@ void AL_clear (ArrayList *al);
  * also frees the "strings" array itself. */
 void AL_cleanup (ArrayList *al);
 
+/* str-buf.c ------------------------------------------------------------- */
+
+/* Initializes a StrBuf structure, such that it contains the empty string. */
+void SB_init (StrBuf *sb);
+
+/* Makes sure there is room for "extra" more bytes (plus a NUL terminator)
+ * without reallocating. */
+void SB_reserve (StrBuf *sb, size_t extra);
+
+/* Appends "len" bytes starting at "s". */
+void SB_add_len (StrBuf *sb, const char *s, size_t len);
+
+/* Appends the NUL-terminated string "s". */
+void SB_add (StrBuf *sb, const char *s);
+
+/* Appends the single character "c". */
+void SB_add_char (StrBuf *sb, char c);
+
+/* Formats the given arguments, printf-style, and appends the result. */
+void SB_printf (StrBuf *sb, const char *fmt, ...)
+#ifdef __GNUC__
+    __attribute__ ((format (printf, 2, 3)))
+#endif
+    ;
+
+/* Like setColor(), but appends the escape code to "sb" instead of
+ * printing it. */
+void SB_color (StrBuf *sb, bool useColor, int color);
+
+/* Reads one line from "f" into "sb", replacing what was there before.
+ * The newline (and a preceding carriage return) is not included.
+ * Returns false if there was nothing left to read.
+ */
+bool SB_getline (StrBuf *sb, FILE *f);
+
+/* Sets the length of the StrBuf to 0, but keeps the memory. */
+void SB_clear (StrBuf *sb);
+
+/* Frees all memory used by the StrBuf, and reinitializes it. */
+void SB_cleanup (StrBuf *sb);
+
 /* props.c --------------------------------------------------------------- */
 
 /* MacOS only.  Given a binary property list specified by "data" and
@@ -372,11 +712,57 @@ void Attr_init (Attributes *attrs);
 
 /* Print the given Attributes structure in the given style.
  * "fname" is the name of the file that the attributes belong to.
- * For JSON styles, prints everything to stdout.
- * For "human" styles, prints error messages to stderr, and everything
- * else to stdout.
+ * Only the fields whose AF_* bits are in "fields" are printed.
+ * For JSON, CSV, and TSV styles, appends everything to "out".
+ * For other styles, prints error messages to stderr, and appends
+ * everything else to "out".
+ *
+ * For AS_JSON, the comma or newline that follows the record is not
+ * printed; that is up to the caller.  (See Output_separator().)
+ * "format" is only used for AS_FORMAT.
+ */
+void Attr_print (const Attributes *attrs,
+                 const char *fname,
+                 AttrStyle style,
+                 uint32_t fields,
+                 const Format *format,
+                 StrBuf *out);
+
+/* For AS_CSV and AS_TSV, appends the header row, naming the columns
+ * which Attr_print() prints for "fields", to "out".  Appends nothing
+ * for other styles. */
+void Attr_header (AttrStyle style, uint32_t fields, StrBuf *out);
+
+/* Parses the comma-separated list of field names given to --fields,
+ * such as "url,referrer", into a mask of AF_* bits.  The names are
+ * those used in JSON output.  Returns false if a name is unknown.
+ */
+bool Attr_parseFields (const char *s, uint32_t *fields);
+
+/* Writes the registrable domain of "url" (see Url_domain()), in lower
+ * case, to "buf", which is "size" bytes long, and returns "buf".
+ * Returns NULL if there isn't one, or it doesn't fit.
+ */
+const char *Attr_domain (const char *url, char *buf, size_t size);
+
+/* Appends the names of the fields present in "attrs" (as accepted by
+ * --fields, and leaving out the derived "domain") to "out", separated
+ * by commas, such as "url,referrer".  Appends nothing if there are
+ * none.
  */
-void Attr_print (const Attributes *attrs, const char *fname, AttrStyle style);
+void Attr_present (const Attributes *attrs, StrBuf *out);
+
+/* Appends "s" to "out" as a JSON string, in double quotes. */
+void Attr_jsonString (StrBuf *out, const char *s);
+
+/* Appends "s" to "out" as a field of a CSV file, as in RFC 4180: in
+ * double quotes (with quotes doubled) if it contains a quote, "delim",
+ * or a line break, or else as it is. */
+void Attr_csvString (StrBuf *out, const char *s, char delim);
+
+/* Moves each field of "src" which "dest" doesn't have into "dest", and
+ * frees whatever is left in "src". */
+void Attr_merge (Attributes *dest, Attributes *src);
 
 /* Frees all of the strings contained in the Attributes structure. */
 void Attr_cleanup (Attributes *attrs);
@@ -384,12 +770,17 @@ void Attr_cleanup (Attributes *attrs);
 /* xdg.c, macos.c, or windows.c ------------------------------------------ */
 
 /* Gets the attributes of the file named "fname", and stores them in
- * "*dest".  "cache" is used to keep track of things between calls.
+ * "*dest".  "query" gives whatever else is known about the file, and
+ * which fields are wanted; others may be left out.  If
+ * query->presenceOnly is set, nothing is read or stored except an
+ * error message; the return value just says whether there are any.
+ * "cache" is used to keep track of things between calls.
  * "cache" should have been initialized with Cache_init() before the
  * first call to getAttributes(), and should be cleaned up with
  * Cache_cleanup() after the last call to getAttributes().
  */
 ErrorCode getAttributes (const char *fname,
+                         const AttrQuery *query,
                          Attributes *dest,
                          Cache *cache);
 
@@ -402,6 +793,7 @@ ErrorCode getAttributes (const char *fname,
  * MacOS will get both the MacOS attributes and the XDG attributes.
  */
 ErrorCode getAttributes_xdg (const char *fname,
+                             const AttrQuery *query,
                              Attributes *dest);
 
 /* xdg.c, database.c, or registry.c -------------------------------------- */
@@ -412,6 +804,647 @@ void Cache_init (Cache *cache);
 /* Frees all of the resources referenced by a Cache structure. */
 void Cache_cleanup (Cache *cache);
 
+/* scan.c ---------------------------------------------------------------- */
+
+/* Gets and prints the attributes of the "nFiles" files named in
+ * "files", using opts->threads threads.  If opts->recursive is true,
+ * any directories are scanned recursively, and the attributes of the
+ * regular files found are printed.  (Symbolic links found inside
+ * directories are not followed, and if opts->xdev is true, neither are
+ * mount points.)  Otherwise, directories are treated like any other
+ * file.
+ *
+ * If opts->shardCount is nonzero, only files whose path hashes (see
+ * hashString()) to opts->shardIndex modulo opts->shardCount are
+ * processed, although directories are still read in full.
+ *
+ * If opts->changedOnly is true, files whose ctime (see getChangeTime())
+ * is before opts->changedSince are skipped.
+ *
+ * If opts->sample is not NULL, only the files chosen by it are
+ * processed, and the results are recorded in it for Sample_report().
+ *
+ * If opts->checkpoint is not NULL, the progress of the scan is saved
+ * there every so often, and when the scan is done.  In that case, the
+ * records for each directory are written all at once, when the
+ * directory is finished.  If opts->resume is not NULL, the scan starts
+ * from the frontier in it, rather than from "files".
+ *
+ * With one thread, files are printed in the order given, and the
+ * contents of a directory are printed in the order read from the
+ * directory (or in order of inode number, if opts->inodeOrder is
+ * true).  With more than one thread, the order is unspecified.
+ *
+ * Returns the combination (see combineErrors()) of the error codes
+ * of all the files processed.
+ */
+ErrorCode scanFiles (const ScanOptions *opts,
+                     char *const *files,
+                     size_t nFiles);
+
+/* checkpoint.c ---------------------------------------------------------- */
+
+/* Initializes an empty Checkpoint. */
+void Checkpoint_init (Checkpoint *cp);
+
+/* Frees the frontier, and reinitializes the Checkpoint. */
+void Checkpoint_cleanup (Checkpoint *cp);
+
+/* Adds a copy of "path" to the frontier.  For a directory which was
+ * cut short, "skip" is the number of its entries already done. */
+void Checkpoint_add (Checkpoint *cp,
+                     const char *path,
+                     bool isDir,
+                     uint64_t rootDevice,
+                     uint64_t skip);
+
+/* Writes "cp" to "fname".  The file is replaced atomically, so if
+ * something goes wrong, the previous checkpoint is still there.  Errors
+ * are printed, and EC_OTHER is returned.
+ */
+ErrorCode Checkpoint_save (const Checkpoint *cp, const char *fname);
+
+/* Reads "cp" (which need not be initialized) from "fname".  Errors are
+ * printed, and some code other than EC_OK is returned.
+ */
+ErrorCode Checkpoint_load (Checkpoint *cp, const char *fname);
+
+/* sort.c ---------------------------------------------------------------- */
+
+/* Creates an empty Sorter, which keeps up to about "runSize" bytes of
+ * records in memory, and writes any more to temporary files. */
+Sorter *Sorter_new (size_t runSize);
+
+/* Adds the NDJSON records in the "len" bytes at "records", each ending
+ * with a newline. */
+void Sorter_add (Sorter *s, const char *records, size_t len);
+
+/* Writes all the records added to "out", in order of path, and then of
+ * the bytes of the record.  Errors are printed, and EC_OTHER is
+ * returned. */
+ErrorCode Sorter_finish (Sorter *s, FILE *out);
+
+/* Closes (and so deletes) the temporary files, and frees "s". */
+void Sorter_free (Sorter *s);
+
+/* spill.c --------------------------------------------------------------- */
+
+/* Creates an empty Spill.  The temporary file is not created until
+ * the first job is pushed. */
+Spill *Spill_new (void);
+
+/* Closes (and so deletes) the temporary file, and frees "sp". */
+void Spill_free (Spill *sp);
+
+/* Appends a copy of "job" to the queue.  Returns false if the job could
+ * not be written to disk, in which case the caller should keep it in
+ * memory instead.  A warning is printed the first time this happens,
+ * and every push after that fails too.  Thread-safe.
+ */
+bool Spill_push (Spill *sp, const FrontierJob *job);
+
+/* Removes the oldest job from the queue into "job", whose path is
+ * malloced.  Returns false if the queue is empty.  Thread-safe.
+ */
+bool Spill_pop (Spill *sp, FrontierJob *job);
+
+/* Returns the number of jobs in the queue.  Thread-safe. */
+size_t Spill_count (Spill *sp);
+
+/* Adds every job in the queue to the frontier of "cp", oldest first,
+ * without removing them.  Thread-safe. */
+void Spill_snapshot (Spill *sp, Checkpoint *cp);
+
+/* prober.c -------------------------------------------------------------- */
+
+/* Starts a thread for looking up attributes. */
+Prober *Prober_new (void);
+
+/* Stops the thread, and frees "pr".  Must not be called after
+ * Prober_get() has returned false. */
+void Prober_free (Prober *pr);
+
+/* Calls getAttributes() for "path" and "query" on the thread, and
+ * waits for it until "limit" (in nanoseconds since 1970, as returned by
+ * currentTime()).  If it returns in time, writes the attributes to
+ * "*dest" and the error code to "*ec", and returns true.  Otherwise,
+ * returns false, and "pr" is abandoned: it frees itself whenever the
+ * lookup returns, and must not be used again.
+ */
+bool Prober_get (Prober *pr,
+                 const char *path,
+                 const AttrQuery *query,
+                 int64_t limit,
+                 Attributes *dest,
+                 ErrorCode *ec);
+
+/* stamp.c --------------------------------------------------------------- */
+
+/* Parses a time given to --changed-since, into nanoseconds since 1970.
+ * Accepts "@SECONDS" (a UNIX time), or an ISO 8601 date and optional
+ * time, such as "2020-06-07", "2020-06-07T11:30", or
+ * "2020-06-07T18:30:18.5Z".  Without a "Z" or an offset such as
+ * "-07:00", the time is taken to be local time.
+ */
+bool Stamp_parse (const char *s, int64_t *nanos);
+
+/* Reads the time from the stamp file "fname".  Returns EC_NOFILE,
+ * quietly, if the file does not exist.  Other errors are printed, and
+ * EC_OTHER is returned.
+ */
+ErrorCode Stamp_read (const char *fname, int64_t *nanos);
+
+/* Replaces the stamp file "fname" with one holding the time "nanos".
+ * Errors are printed, and EC_OTHER is returned. */
+ErrorCode Stamp_write (const char *fname, int64_t nanos);
+
+/* du.c ------------------------------------------------------------------ */
+
+/* Implements "whence du".  For each directory under each of the "nDirs"
+ * directories in "dirs", prints the number of files under it with
+ * provenance, their total size, and their most common origin domains,
+ * as a tab-separated row or (if "json") as an NDJSON record.  A
+ * directory is printed after everything under it, and only if it is at
+ * most "maxDepth" levels below the directory named.  Errors are printed
+ * as they happen.  Returns the combination of the errors, or EC_OK.
+ */
+ErrorCode duFiles (char *const *dirs,
+                   size_t nDirs,
+                   unsigned long maxDepth,
+                   bool json);
+
+/* merge.c --------------------------------------------------------------- */
+
+/* Implements "whence merge".  Merges the "nFiles" NDJSON files named
+ * in "files" (where "-" means stdin), each of which must already be
+ * sorted by path, and writes the merged records to stdout.  Returns
+ * EC_OTHER if an input could not be read, was not valid NDJSON, or was
+ * not sorted.
+ */
+ErrorCode mergeFiles (char *const *files, size_t nFiles);
+
+/* Merges the "nRuns" temporary files in "runs" (each positioned at its
+ * start) written by sort.c, each of which is sorted by path, and then
+ * by the bytes of the record, and writes the records to "out" in the
+ * same order.  Returns EC_OTHER if a run could not be read.  The runs
+ * are not closed.
+ */
+ErrorCode mergeRuns (FILE *const *runs, size_t nRuns, FILE *out);
+
+/* Implements "whence diff".  Reads the NDJSON files "oldFile" and
+ * "newFile" (either of which may be "-" for stdin), which must each be
+ * sorted by path, side by side, and prints each path which is only in
+ * "newFile" (added), only in "oldFile" (removed), or in both but with
+ * different attributes (changed), in order of path, as text or (if
+ * "json") as NDJSON.  Returns EC_OK if there were no differences,
+ * EC_NOATTR if there were some, or EC_OTHER on error, as with
+ * mergeFiles().
+ */
+ErrorCode diffFiles (const char *oldFile, const char *newFile, bool json);
+
+/* ndjson.c -------------------------------------------------------------- */
+
+/* Decodes the JSON string which starts at "p" (which must point at the
+ * opening double quote), and appends it to "out" as UTF-8.  Returns a
+ * pointer just past the closing double quote, or NULL if the string is
+ * not valid JSON.
+ */
+const char *Json_string (const char *p, StrBuf *out);
+
+/* Decodes the "path" member of a record printed by --ndjson into "path"
+ * (replacing what was there before).  It is found quickly when it is the
+ * first member, as --ndjson always prints it, but may be anywhere.
+ * Returns false if "line" has no string "path" member.
+ */
+bool Json_path (const char *line, StrBuf *path);
+
+/* Splits the record "line" printed by --ndjson into its members, and
+ * replaces the contents of "fields" with their names (decoded) and
+ * values (as they appear in the line), alternately.  Returns false if
+ * "line" is not a flat JSON object.
+ */
+bool Json_fields (const char *line, ArrayList *fields);
+
+/* sample.c -------------------------------------------------------------- */
+
+/* Creates the state for "--sample RATE", where 0 < RATE <= 1 is the
+ * fraction of files to choose. */
+Sample *Sample_newRate (double rate);
+
+/* Creates the state for "--sample COUNT", which chooses COUNT files. */
+Sample *Sample_newCount (size_t count);
+
+/* Frees the Sample. */
+void Sample_free (Sample *s);
+
+/* Counts the file "path" as part of the population, and returns true
+ * if its attributes should be read now.  With a COUNT, always returns
+ * false, and keeps "path" if it might be chosen.  May be called from
+ * any thread.
+ */
+bool Sample_offer (Sample *s, const char *path);
+
+/* With a COUNT, returns the malloced array of chosen paths, sorted,
+ * and writes its length to "*n".  The caller must free the array and
+ * the paths.  With a RATE, returns an empty array.
+ */
+char **Sample_take (Sample *s, size_t *n);
+
+/* Records the result of reading the attributes of a chosen file.
+ * May be called from any thread. */
+void Sample_record (Sample *s, const Attributes *attrs, ErrorCode ec);
+
+/* Prints to stderr the estimated fraction of files with provenance,
+ * and the top domains, with 95% confidence intervals. */
+void Sample_report (Sample *s);
+
+/* sketch.c -------------------------------------------------------------- */
+
+/* Creates a new, empty Sketch, which counts at most "capacity" strings
+ * at once. */
+Sketch *Sketch_new (size_t capacity);
+
+/* Frees the Sketch and all the keys in it. */
+void Sketch_free (Sketch *s);
+
+/* Counts one more "key" (which is copied). */
+void Sketch_add (Sketch *s, const char *key);
+
+/* Adds the counts in "src" to "dest", keeping the biggest. */
+void Sketch_merge (Sketch *dest, const Sketch *src);
+
+/* Returns the most that any count in the Sketch can be too high by. */
+uint64_t Sketch_maxError (const Sketch *s);
+
+/* Returns a malloced, NULL-terminated array of the entries in the
+ * Sketch, biggest count first.  The caller must free the array (but not
+ * the entries, which still belong to the Sketch).
+ */
+const SketchEntry **Sketch_sorted (const Sketch *s);
+
+/* summary.c ------------------------------------------------------------- */
+
+/* Creates the counts for --summary, in "nParts" parts, one for each
+ * thread which will call Summary_record(). */
+Summary *Summary_new (size_t nParts);
+
+/* Frees the Summary. */
+void Summary_free (Summary *s);
+
+/* Counts a file with the attributes "attrs" (or whose attributes
+ * couldn't be read, if attrs->error is set) in part "part", which only
+ * one thread may use at a time. */
+void Summary_record (Summary *s, size_t part, const Attributes *attrs);
+
+/* Adds up the parts, and prints the counts of files by domain,
+ * application, and which fields they have, as a table or (if "json")
+ * as a single line of JSON, to "f". */
+void Summary_print (Summary *s, bool json, FILE *f);
+
+/* top.c ----------------------------------------------------------------- */
+
+/* Creates the counts for --top, which prints the "k" most common
+ * origin URLs, hosts, and referrers, in "nParts" parts, one for each
+ * thread which will call Top_record().  If "approx", a fixed amount of
+ * memory is used, and the counts are estimates.
+ */
+Top *Top_new (size_t nParts, size_t k, bool approx);
+
+/* Frees the Top. */
+void Top_free (Top *t);
+
+/* Counts the values in "attrs" in part "part", which only one thread
+ * may use at a time. */
+void Top_record (Top *t, size_t part, const Attributes *attrs);
+
+/* Adds up the parts, and prints the most common values (with bounds on
+ * their errors, if approximate), as tables or (if "json") as a single
+ * line of JSON, to "f". */
+void Top_print (Top *t, bool json, FILE *f);
+
+/* tally.c --------------------------------------------------------------- */
+
+/* Creates a new, empty Tally. */
+Tally *Tally_new (void);
+
+/* Frees the Tally and all the keys in it. */
+void Tally_free (Tally *t);
+
+/* Adds "n" to the count for "key" (which is copied). */
+void Tally_add (Tally *t, const char *key, uint64_t n);
+
+/* Adds all the counts in "src" to "dest". */
+void Tally_merge (Tally *dest, const Tally *src);
+
+/* Returns the number of distinct keys in the Tally. */
+size_t Tally_size (const Tally *t);
+
+/* Returns a malloced, NULL-terminated array of the entries in the
+ * Tally, biggest count first.  The caller must free the array (but not
+ * the entries, which still belong to the Tally).
+ */
+const TallyEntry **Tally_sorted (const Tally *t);
+
+/* url.c ----------------------------------------------------------------- */
+
+/* Finds the host part of the absolute URL "url" (such as "example.com"
+ * in "https://user@example.com:8080/x").  On success, writes a pointer
+ * into "url" to "*host", and the length of the host to "*len", and
+ * returns true.  Nothing is allocated.
+ */
+bool Url_host (const char *url, const char **host, size_t *len);
+
+/* Finds the registrable domain (the public suffix, and one more label)
+ * at the end of "host", which is "len" bytes long, so for
+ * "downloads.example.co.uk" it is "example.co.uk".  On success, writes
+ * a pointer into "host" to "*domain", and the length of the domain to
+ * "*domainLen", and returns true.  Returns false if "host" is itself a
+ * public suffix.  An IP address is its own domain.  Nothing is
+ * allocated.
+ */
+bool Url_domain (const char *host,
+                 size_t len,
+                 const char **domain,
+                 size_t *domainLen);
+
+/* public-suffix.c (generated by regenerate-psl.sh) ---------------------- */
+
+/* The Public Suffix List, as a hash table with linear probing, which
+ * always has some empty slots. */
+extern const PslRule pslTable[];
+
+/* The number of slots in pslTable, which is a power of 2. */
+extern const size_t pslTableSize;
+
+/* where.c --------------------------------------------------------------- */
+
+/* Compiles the --where predicate "s".  If it isn't valid, prints an
+ * error and returns NULL. */
+Where *Where_compile (const char *s);
+
+/* Returns the AF_* bits of the fields which the predicate tests, which
+ * are the only ones Where_match() needs to have read. */
+uint32_t Where_fields (const Where *w);
+
+/* Returns whether "attrs" satisfy the predicate.  May be called from
+ * any thread. */
+bool Where_match (const Where *w, const Attributes *attrs);
+
+/* Frees the predicate.  Does nothing if "w" is NULL. */
+void Where_free (Where *w);
+
+/* format.c -------------------------------------------------------------- */
+
+/* The values which a --format template can print.  Format_run() is
+ * given an array of FV_NVALUES of them, in this order. */
+enum {
+    FV_PATH,
+    FV_URL,
+    FV_DOMAIN,
+    FV_REFERRER,
+    FV_FROM,
+    FV_SUBJECT,
+    FV_MESSAGE_ID,
+    FV_APPLICATION,
+    FV_DATE,
+    FV_ZONE,
+    FV_SAME_AS,
+    FV_NVALUES
+};
+
+/* Compiles the --format template "s", such as '%p\t%{url:json}\n'.
+ * If it isn't valid, prints an error and returns NULL. */
+Format *Format_compile (const char *s);
+
+/* Returns the AF_* bits of the fields which the template prints. */
+uint32_t Format_fields (const Format *f);
+
+/* Appends the record whose values are "values" (FV_NVALUES of them,
+ * each of which may be NULL if missing) to "out", as the template
+ * says.  May be called from any thread. */
+void Format_run (const Format *f, const char *const *values, StrBuf *out);
+
+/* Frees the template.  Does nothing if "f" is NULL. */
+void Format_free (Format *f);
+
+/* blocklist.c ----------------------------------------------------------- */
+
+/* Loads the blocklist "fname", which is either a list of domains and
+ * URL prefixes, one per line, or a file written by Blocklist_compile(),
+ * which is mapped into memory rather than read.  Errors are printed,
+ * and NULL is returned.
+ */
+Blocklist *Blocklist_load (const char *fname);
+
+/* Reads the list "in", and writes it to "out" in the form which
+ * Blocklist_load() can map straight into memory, for "whence
+ * compile-blocklist".  Errors are printed.
+ */
+ErrorCode Blocklist_compile (const char *in, const char *out);
+
+/* Checks the URL, Referrer, and From of "attrs" against the blocklist,
+ * and for each one which is blocked, appends an NDJSON record to
+ * "out".  Returns the number of matches.  May be called from any
+ * thread.
+ */
+size_t Blocklist_check (const Blocklist *bl,
+                        const char *path,
+                        const Attributes *attrs,
+                        StrBuf *out);
+
+/* Frees the blocklist.  Does nothing if "bl" is NULL. */
+void Blocklist_free (Blocklist *bl);
+
+/* inode-set.c ----------------------------------------------------------- */
+
+/* Creates a new, empty InodeSet. */
+InodeSet *InodeSet_new (void);
+
+/* Frees the InodeSet and all the paths in it. */
+void InodeSet_free (InodeSet *set);
+
+/* Adds (device, inode) to the set, if it isn't there already, and
+ * returns true if it was added.  Either way, writes to "*firstPath"
+ * the path that was given when (device, inode) was first added.
+ * That string is owned by the set, and remains valid until the set
+ * is freed.  May be called from any thread.
+ */
+bool InodeSet_add (InodeSet *set,
+                   uint64_t device,
+                   uint64_t inode,
+                   const char *path,
+                   const char **firstPath);
+
+/* output.c -------------------------------------------------------------- */
+
+/* Prints whatever needs to come before the first record of the
+ * given style (the opening brace for AS_JSON).  Unless "queueLimit" is
+ * 0 or stdout is a terminal, also starts a thread to write the records,
+ * so that Output_write() only has to wait when "queueLimit" bytes are
+ * already waiting to be written.
+ */
+void Output_begin (AttrStyle style, size_t queueLimit);
+
+/* For --sort path.  Rather than being written as they come, the
+ * records are collected in a Sorter with runs of "runSize" bytes, and
+ * written in order by Output_end().  Only for AS_NDJSON, and must be
+ * called before Output_begin().
+ */
+void Output_sortByPath (size_t runSize);
+
+/* Returns the string which must be placed between two records which
+ * are written in the same call to Output_write(). */
+const char *Output_separator (void);
+
+/* Writes a buffer of one or more complete records, separated by
+ * Output_separator(), to stdout (or queues it to be written), and
+ * clears the buffer.  May be called from any thread.
+ */
+void Output_write (StrBuf *records);
+
+/* Waits for the queued records to be written (or with
+ * Output_sortByPath(), writes them all), prints whatever needs to come
+ * after the last record, and flushes stdout.  Returns EC_OTHER if the
+ * sorted records couldn't be written, and EC_OK otherwise.
+ */
+ErrorCode Output_end (void);
+
+/* Waits for the queued records to be written, and flushes stdout.  If
+ * it is a regular file, writes its size to "*offset" and returns true.
+ */
+bool Output_sync (uint64_t *offset);
+
+/* For --resume.  If stdout is a regular file, cuts off anything
+ * written after the checkpoint "cp" was taken, so that no record is
+ * printed twice.  Returns EC_OTHER if stdout is too short to hold
+ * the output of the scan so far.
+ */
+ErrorCode Output_resume (const Checkpoint *cp);
+
+/* os-unix.c or os-win32.c ----------------------------------------------- */
+
+/* Opens the directory "path" for reading with Dir_read().  On success,
+ * writes the new DirReader to "*dr" and returns EC_OK.  Otherwise,
+ * writes a newly allocated error message to "*errmsg", which must be
+ * freed by the caller, and returns some other code.
+ */
+ErrorCode Dir_open (const char *path, DirReader **dr, char **errmsg);
+
+/* Reads the next entry from the directory, skipping "." and "..".
+ * Returns false when there are no more entries (or an error occurred,
+ * which is reported by Dir_close()).
+ */
+bool Dir_read (DirReader *dr, DirEntry *ent);
+
+/* Returns the device that the directory is on, or 0 if unknown. */
+uint64_t Dir_device (DirReader *dr);
+
+/* Closes the directory and frees the DirReader.  If an error occurred
+ * while reading the directory, writes a newly allocated error message
+ * to "*errmsg" and returns a code other than EC_OK.
+ */
+ErrorCode Dir_close (DirReader *dr, char **errmsg);
+
+/* Gets the type, device, and inode of the file "path".  If
+ * "followLinks" is false, a symbolic link is reported as FT_OTHER
+ * rather than as the file it points to.  On error, writes a newly
+ * allocated error message to "*errmsg", and returns a code other
+ * than EC_OK.
+ */
+ErrorCode getFileInfo (const char *path,
+                       bool followLinks,
+                       FileInfo *info,
+                       char **errmsg);
+
+/* Gets the time the status of "path" last changed (its ctime), in
+ * nanoseconds since 1970, without following symbolic links.  Setting
+ * an extended attribute changes the ctime.  On Linux, attributes cached
+ * by a network filesystem are accepted, rather than asking the server.
+ * On error, writes a newly allocated error message to "*errmsg", and
+ * returns a code other than EC_OK.
+ */
+ErrorCode getChangeTime (const char *path, int64_t *nanos, char **errmsg);
+
+/* Gets the size in bytes of "path", without following symbolic links.
+ * On Linux, a size cached by a network filesystem is accepted.  On
+ * error, writes a newly allocated error message to "*errmsg", and
+ * returns a code other than EC_OK.
+ */
+ErrorCode getFileSize (const char *path, uint64_t *size, char **errmsg);
+
+/* Returns the current time, in nanoseconds since 1970. */
+int64_t currentTime (void);
+
+/* Like fopen(), but "path" is always UTF-8, even on Windows. */
+FILE *openFile (const char *path, const char *mode);
+
+/* If "f" is a regular file, writes its size to "*size" and returns
+ * true.  Otherwise (if it is a pipe or a terminal) returns false. */
+bool streamSize (FILE *f, uint64_t *size);
+
+/* Truncates the regular file "f" to "size" bytes, and moves to the
+ * new end of it.  On error, writes a newly allocated error message to
+ * "*errmsg", and returns EC_OTHER.
+ */
+ErrorCode truncateStream (FILE *f, uint64_t size, char **errmsg);
+
+/* Flushes "f", and then waits until its contents are on disk.  On
+ * error, writes a newly allocated error message to "*errmsg", and
+ * returns EC_OTHER.
+ */
+ErrorCode syncStream (FILE *f, char **errmsg);
+
+/* Atomically replaces the file "to" with the file "from".  On error,
+ * writes a newly allocated error message to "*errmsg", and returns
+ * EC_OTHER.
+ */
+ErrorCode replaceFile (const char *from, const char *to, char **errmsg);
+
+/* Maps the whole file "path" into memory, read-only, and writes its
+ * address to "*data" (or NULL, if it is empty) and its size to
+ * "*size".  The mapping must be released with unmapFile().  On error,
+ * writes a newly allocated error message to "*errmsg", and returns a
+ * code other than EC_OK.
+ */
+ErrorCode mapFile (const char *path,
+                   const void **data,
+                   size_t *size,
+                   char **errmsg);
+
+/* Releases a mapping made by mapFile(). */
+void unmapFile (const void *data, size_t size);
+
+/* Creates a temporary file, open for reading and writing, which is
+ * deleted when it is closed (or when whence exits).  On UNIX, it is
+ * created in $TMPDIR, or /tmp.  Returns NULL on failure.
+ */
+FILE *tempFile (void);
+
+/* Like fseek() to "offset" from the start of "f", but works with
+ * offsets beyond 2 GiB everywhere.  Returns false on failure. */
+bool seekFile (FILE *f, uint64_t offset);
+
+/* Flushes "f", and then writes the "n" pieces to it, in order, with as
+ * few system calls as possible (using writev() on UNIX).  Returns false
+ * if there was an error.
+ */
+bool writeGather (FILE *f, const OutPiece *pieces, size_t n);
+
+/* Lowers the priority of the process (and threads it creates later)
+ * as far as it can go for the CPU and for I/O: SCHED_IDLE and the idle
+ * I/O class on Linux.  Returns false if that couldn't all be done.
+ */
+bool enterBackground (void);
+
+/* Writes the percentage of the last 10 seconds in which some task was
+ * stalled waiting for I/O to "*percent", and returns true.  Returns
+ * false if this isn't known (only Linux has /proc/pressure/io).
+ */
+bool ioPressure (double *percent);
+
+/* Returns the number of CPUs currently online (at least 1). */
+int numberOfCPUs (void);
+
 /* term-unix.c or term-win32.c ------------------------------------------- */
 
 /* Information about whether stdout is a terminal. */
@@ -0,0 +1,466 @@
+/*
+ * Copyright (c) 2020 Patrick Pelletier
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "whence.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/* --where predicates, such as
+ *
+ *     url.host ~ "*.example.com" && !referrer
+ *
+ * are compiled once into a little program, which is then run on the
+ * Attributes of each file.  The grammar is:
+ *
+ *     or      := and { "||" and }
+ *     and     := unary { "&&" unary }
+ *     unary   := "!" unary | "(" or ")" | test
+ *     test    := field [ ( "==" | "!=" | "~" | "!~" ) string ]
+ *     field   := name [ ".host" ]
+ *
+ * where "name" is one of the names accepted by --fields, a bare field
+ * tests whether it is present, "~" matches a pattern with "*" and "?",
+ * and a string is in double quotes, with "\" escaping " and \.  A
+ * field which is absent is not equal to anything, and doesn't match
+ * any pattern.  ".host" is the host of a URL, and "domain" is its
+ * registrable domain; both are compared without regard to case.
+ *
+ * Since "&&" and "||" are compiled into jumps, the program never needs
+ * more than one value at a time, so there is no stack.
+ */
+
+typedef enum WhereOp {
+    W_HAS,                      /* value = field is present */
+    W_EQUAL,                    /* value = field equals string */
+    W_GLOB,                     /* value = field matches pattern */
+    W_NOT,                      /* value = !value */
+    W_AND,                      /* if !value, jump to target */
+    W_OR                        /* if value, jump to target */
+} WhereOp;
+
+typedef struct Instr {
+    uint8_t op;                 /* WhereOp */
+    bool host;                  /* use just the host of the URL */
+    uint32_t field;             /* AF_* bit */
+    uint32_t arg;               /* index of string, or jump target */
+} Instr;
+
+struct Where {
+    Instr *code;
+    size_t len;
+    size_t capacity;
+    ArrayList strings;
+    uint32_t fields;            /* AF_* bits of the fields tested */
+};
+
+typedef enum Token {
+    T_END,
+    T_NAME,
+    T_STRING,
+    T_EQUAL,
+    T_NOT_EQUAL,
+    T_MATCH,
+    T_NOT_MATCH,
+    T_NOT,
+    T_AND,
+    T_OR,
+    T_LPAREN,
+    T_RPAREN,
+    T_ERROR
+} Token;
+
+typedef struct Parser {
+    const char *src;
+    const char *p;              /* just past the current token */
+    const char *start;          /* start of the current token */
+    Token tok;
+    StrBuf text;                /* name or (unescaped) string */
+    bool failed;
+    Where *w;
+} Parser;
+
+static void next (Parser *ps) {
+    const char *p = ps->p;
+
+    while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r') {
+        p++;
+    }
+
+    ps->start = p;
+    SB_clear (&ps->text);
+    SB_add (&ps->text, "");
+
+    if (*p == 0) {
+        ps->tok = T_END;
+    } else if (isalnum ((unsigned char) *p) || *p == '_') {
+        while (isalnum ((unsigned char) *p) ||
+               *p == '_' || *p == '-' || *p == '.') {
+            SB_add_char (&ps->text, *p++);
+        }
+        ps->tok = T_NAME;
+    } else if (*p == '"') {
+        for (p++; *p != '"'; p++) {
+            if (*p == 0) {
+                ps->p = p;
+                ps->tok = T_ERROR;
+                return;
+            } else if (*p == '\\' && (p[1] == '"' || p[1] == '\\')) {
+                p++;
+            }
+            SB_add_char (&ps->text, *p);
+        }
+        p++;
+        ps->tok = T_STRING;
+    } else if (p[0] == '=' && p[1] == '=') {
+        p += 2;
+        ps->tok = T_EQUAL;
+    } else if (p[0] == '!' && p[1] == '=') {
+        p += 2;
+        ps->tok = T_NOT_EQUAL;
+    } else if (p[0] == '!' && p[1] == '~') {
+        p += 2;
+        ps->tok = T_NOT_MATCH;
+    } else if (p[0] == '&' && p[1] == '&') {
+        p += 2;
+        ps->tok = T_AND;
+    } else if (p[0] == '|' && p[1] == '|') {
+        p += 2;
+        ps->tok = T_OR;
+    } else if (*p == '~') {
+        p++;
+        ps->tok = T_MATCH;
+    } else if (*p == '!') {
+        p++;
+        ps->tok = T_NOT;
+    } else if (*p == '(') {
+        p++;
+        ps->tok = T_LPAREN;
+    } else if (*p == ')') {
+        p++;
+        ps->tok = T_RPAREN;
+    } else {
+        ps->tok = T_ERROR;
+    }
+
+    ps->p = p;
+}
+
+/* Prints an error about the current token, unless one has already been
+ * printed, since everything after the first one is just confusion. */
+static void fail (Parser *ps, const char *what) {
+    if (! ps->failed) {
+        if (ps->tok == T_END) {
+            err_printf (CMD_NAME ": --where: %s at end of '%s'",
+                        what, ps->src);
+        } else {
+            err_printf (CMD_NAME ": --where: %s at character %lu of '%s'",
+                        what, (unsigned long) (ps->start - ps->src + 1),
+                        ps->src);
+        }
+        ps->failed = true;
+    }
+}
+
+static size_t emit (Where *w, WhereOp op, uint32_t field, bool host,
+                    uint32_t arg) {
+    if (w->len == w->capacity) {
+        w->capacity = (w->capacity == 0 ? 16 : w->capacity * 2);
+        w->code = MY_REALLOC (w->code, w->capacity * sizeof (Instr));
+    }
+
+    Instr *in = &w->code[w->len];
+    in->op = (uint8_t) op;
+    in->host = host;
+    in->field = field;
+    in->arg = arg;
+    return w->len++;
+}
+
+static void parse_or (Parser *ps);
+
+static void parse_test (Parser *ps) {
+    if (ps->tok != T_NAME) {
+        fail (ps, "expected a field name");
+        return;
+    }
+
+    char *name = ps->text.buf;
+    const size_t nameLen = ps->text.len;
+    bool host = false;
+    uint32_t field = 0;
+
+    if (nameLen > 5 && 0 == strcmp (name + nameLen - 5, ".host")) {
+        name[nameLen - 5] = 0;
+        host = true;
+    }
+
+    if (! Attr_parseFields (name, &field)) {
+        fail (ps, "unknown field");
+        return;
+    } else if (host && field != AF_URL && field != AF_REFERRER) {
+        fail (ps, "only url and referrer have a .host");
+        return;
+    }
+
+    ps->w->fields |= field;
+    next (ps);
+
+    const Token op = ps->tok;
+    if (op != T_EQUAL && op != T_NOT_EQUAL &&
+        op != T_MATCH && op != T_NOT_MATCH) {
+        emit (ps->w, W_HAS, field, host, 0);
+        return;
+    } else if (field == AF_DATE) {
+        fail (ps, "date can only be tested for presence");
+        return;
+    }
+
+    next (ps);
+    if (ps->tok != T_STRING) {
+        fail (ps, "expected a string in double quotes");
+        return;
+    }
+
+    AL_add (&ps->w->strings, ps->text.buf);
+    emit (ps->w, (op == T_EQUAL || op == T_NOT_EQUAL) ? W_EQUAL : W_GLOB,
+          field, host, (uint32_t) (ps->w->strings.size - 1));
+    if (op == T_NOT_EQUAL || op == T_NOT_MATCH) {
+        emit (ps->w, W_NOT, 0, false, 0);
+    }
+
+    next (ps);
+}
+
+static void parse_unary (Parser *ps) {
+    if (ps->tok == T_NOT) {
+        next (ps);
+        parse_unary (ps);
+        emit (ps->w, W_NOT, 0, false, 0);
+    } else if (ps->tok == T_LPAREN) {
+        next (ps);
+        parse_or (ps);
+        if (ps->tok != T_RPAREN) {
+            fail (ps, "expected ')'");
+            return;
+        }
+        next (ps);
+    } else {
+        parse_test (ps);
+    }
+}
+
+/* Parses a chain of operands joined by "&&" (or "||"), each of which
+ * jumps to the end of the chain as soon as the answer is known. */
+static void parse_chain (Parser *ps, Token tok, WhereOp op,
+                         void (*parse_operand) (Parser *)) {
+    const size_t first = ps->w->len;
+
+    parse_operand (ps);
+    while (ps->tok == tok && ! ps->failed) {
+        emit (ps->w, op, 0, false, 0);
+        next (ps);
+        parse_operand (ps);
+    }
+
+    /* fill in the jumps, now that the end is known */
+    size_t i;
+    for (i = first; i < ps->w->len; i++) {
+        if (ps->w->code[i].op == op && ps->w->code[i].arg == 0) {
+            ps->w->code[i].arg = (uint32_t) ps->w->len;
+        }
+    }
+}
+
+static void parse_and (Parser *ps) {
+    parse_chain (ps, T_AND, W_AND, parse_unary);
+}
+
+static void parse_or (Parser *ps) {
+    parse_chain (ps, T_OR, W_OR, parse_and);
+}
+
+Where *Where_compile (const char *s) {
+    Parser ps;
+    Where *w = MY_MALLOC (sizeof (*w));
+
+    memset (w, 0, sizeof (*w));
+    AL_init (&w->strings);
+
+    memset (&ps, 0, sizeof (ps));
+    ps.src = ps.p = s;
+    ps.w = w;
+    SB_init (&ps.text);
+
+    next (&ps);
+    parse_or (&ps);
+    if (ps.tok != T_END) {
+        fail (&ps, (ps.tok == T_ERROR ? "syntax error" : "unexpected token"));
+    }
+
+    SB_cleanup (&ps.text);
+
+    if (ps.failed) {
+        Where_free (w);
+        return NULL;
+    }
+
+    return w;
+}
+
+uint32_t Where_fields (const Where *w) {
+    return w->fields;
+}
+
+void Where_free (Where *w) {
+    if (w != NULL) {
+        free (w->code);
+        AL_cleanup (&w->strings);
+        free (w);
+    }
+}
+
+/* Returns the value of the field, or NULL if it isn't present.  The
+ * date is only ever tested for presence, so any non-NULL will do. */
+static const char *get_field (const Attributes *attrs, uint32_t field) {
+    switch (field) {
+    case AF_URL:         return attrs->url;
+    case AF_REFERRER:    return attrs->referrer;
+    case AF_FROM:        return attrs->from;
+    case AF_SUBJECT:     return attrs->subject;
+    case AF_MESSAGE_ID:  return attrs->message_id;
+    case AF_APPLICATION: return attrs->application;
+    case AF_DATE:        return attrs->date.secondsValid ? "" : NULL;
+    case AF_ZONE:        return attrs->zone;
+    case AF_DOMAIN:      return attrs->url;  /* Where_match() finds it */
+    default:             return NULL;
+    }
+}
+
+static bool same_char (char c1, char c2, bool nocase) {
+    if (nocase) {
+        return tolower ((unsigned char) c1) == tolower ((unsigned char) c2);
+    } else {
+        return c1 == c2;
+    }
+}
+
+static bool equal (const char *pat, const char *s, size_t len, bool nocase) {
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        if (! same_char (pat[i], s[i], nocase)) {
+            return false;
+        }
+    }
+
+    return pat[len] == 0;
+}
+
+/* Matches "s" (of length "len") against "pat", where "*" matches any
+ * run of characters and "?" any one character.  When a "*" is followed
+ * by a mismatch, only the most recent "*" needs to be retried with a
+ * longer run, so this takes linear space and no recursion. */
+static bool glob (const char *pat, const char *s, size_t len, bool nocase) {
+    const char *star = NULL;    /* just past the most recent "*" */
+    size_t retry = 0;           /* where in "s" that "*" is to resume */
+    size_t i = 0;
+
+    while (i < len) {
+        if (*pat == '*') {
+            star = ++pat;
+            retry = i;
+        } else if (*pat != 0 &&
+                   (*pat == '?' || same_char (*pat, s[i], nocase))) {
+            pat++;
+            i++;
+        } else if (star != NULL) {
+            pat = star;
+            i = ++retry;
+        } else {
+            return false;
+        }
+    }
+
+    while (*pat == '*') {
+        pat++;
+    }
+
+    return *pat == 0;
+}
+
+bool Where_match (const Where *w, const Attributes *attrs) {
+    bool value = false;
+    size_t pc = 0;
+
+    while (pc < w->len) {
+        const Instr *in = &w->code[pc++];
+        const char *s = NULL;
+        size_t len = 0;
+        const bool nocase = (in->host || in->field == AF_DOMAIN);
+
+        switch ((WhereOp) in->op) {
+        case W_HAS:
+        case W_EQUAL:
+        case W_GLOB:
+            s = get_field (attrs, in->field);
+            if (s != NULL) {
+                len = strlen (s);
+                if ((in->host || in->field == AF_DOMAIN) &&
+                    ! Url_host (s, &s, &len)) {
+                    s = NULL;
+                } else if (in->field == AF_DOMAIN &&
+                           ! Url_domain (s, len, &s, &len)) {
+                    s = NULL;
+                }
+            }
+
+            if (s == NULL) {
+                value = false;
+            } else if (in->op == W_HAS) {
+                value = true;
+            } else if (in->op == W_EQUAL) {
+                value = equal (w->strings.strings[in->arg], s, len, nocase);
+            } else {
+                value = glob (w->strings.strings[in->arg], s, len, nocase);
+            }
+            break;
+        case W_NOT:
+            value = ! value;
+            break;
+        case W_AND:
+            if (! value) {
+                pc = in->arg;
+            }
+            break;
+        case W_OR:
+            if (value) {
+                pc = in->arg;
+            }
+            break;
+        }
+    }
+
+    return value;
+}
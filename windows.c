@@ -36,6 +36,7 @@
 
 ErrorCode getAttribute (const char *fname,
                         const char *attr,
+                        const AttrQuery *query,
                         char **result,
                         size_t *length) {
     ArrayList al;
@@ -110,6 +111,57 @@ ErrorCode getAttribute (const char *fname,
     return ec;
 }
 
+ErrorCode probeAttributes (const char *fname,
+                           const AttrName *names,
+                           const AttrQuery *query,
+                           char **errmsg) {
+    ErrorCode ec = EC_NOATTR;
+    ArrayList al;
+    size_t i;
+
+    *errmsg = NULL;
+    AL_init (&al);
+
+    for (i = 0; names[i].name != NULL && ec == EC_NOATTR; i++) {
+        if ((names[i].fields & query->fields) == 0) {
+            continue;
+        }
+
+        AL_add (&al, fname);
+        AL_add (&al, ":");
+        AL_add (&al, names[i].name);
+        AL_add (&al, ":$DATA");
+
+        char *streamName = AL_join (&al);
+        utf16 *wStreamName = utf8to16_nofail (streamName);
+        AL_clear (&al);
+
+        if (GetFileAttributesW (wStreamName) != INVALID_FILE_ATTRIBUTES) {
+            ec = EC_OK;
+        } else {
+            /* as in getAttribute(), see whether the file itself is there */
+            utf16 *wfname = utf8to16_nofail (fname);
+
+            if (GetFileAttributesW (wfname) == INVALID_FILE_ATTRIBUTES) {
+                const DWORD err = GetLastError ();
+                ec = (err == ERROR_FILE_NOT_FOUND ||
+                      err == ERROR_PATH_NOT_FOUND ? EC_NOFILE : EC_OTHER);
+                *errmsg = MY_STRDUP (ec == EC_NOFILE ?
+                                     "No such file or directory" :
+                                     "Could not get file attributes");
+            }
+
+            free (wfname);
+        }
+
+        free (wStreamName);
+        free (streamName);
+    }
+
+    AL_cleanup (&al);
+    return ec;
+}
+
 static int handleKey (const char *key,
                       const char *value,
                       Attributes *dest,
@@ -158,13 +210,24 @@ static int parseZoneIdentifier (const char *zi,
 }
 
 ErrorCode getAttributes (const char *fname,
+                         const AttrQuery *query,
                          Attributes *dest,
                          ZoneCache *zc) {
+    static const AttrName names[] = {
+        { "Zone.Identifier", AF_URL | AF_REFERRER | AF_ZONE },
+        { NULL,              0                              }
+    };
     char *result = NULL;
     size_t length = 0;
 
+    if (query->presenceOnly) {
+        return probeAttributes (fname, names, query, &dest->error);
+    } else if ((query->fields & names[0].fields) == 0) {
+        return EC_NOATTR;
+    }
+
     const ErrorCode ec =
-        getAttribute (fname, "Zone.Identifier", &result, &length);
+        getAttribute (fname, names[0].name, query, &result, &length);
     if (ec > EC_NOATTR && dest->error == NULL) {
         dest->error = result;
         return ec;
@@ -178,6 +241,12 @@ ErrorCode getAttributes (const char *fname,
     return (numAttrs == 0 ? EC_NOATTR : EC_OK);
 }
 
+/* On Windows, there is only one stream per file to look for, so there
+ * is nothing to be saved by remembering which devices lack support. */
+bool xattrsUnsupported (const AttrQuery *query) {
+    return false;
+}
+
 static bool haveDrive (char drive, int32_t *drives) {
     const int n = drive - 'A';
 
@@ -217,8 +286,7 @@ char *fixFilename (const char *fname, int32_t *drives) {
 
     /* Problem #2 */
     if (isalnum(s[0]) && s[1] == 0) {
-        s = realloc (s, 4);
-        CHECK_NULL (s);
+        s = MY_REALLOC (s, 4);
         s[0] = '.';
         s[1] = '/';
         s[2] = fname[0];
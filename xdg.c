@@ -33,12 +33,26 @@
 
 static ErrorCode handle_attribute (const char *fname,
                                    const char *aname,
+                                   uint32_t bit,
+                                   const AttrQuery *query,
                                    char **dest,
                                    char **error) {
     char *result = NULL;
     size_t length = 0;
 
-    const ErrorCode ec = getAttribute (fname, aname, &result, &length);
+    /* If an earlier attribute (of this file or another one) showed that
+     * the filesystem doesn't do extended attributes, don't bother. */
+    if (xattrsUnsupported (query)) {
+        return EC_NOATTR;
+    }
+
+    /* Likewise if the field it goes in wasn't asked for by --fields. */
+    if ((query->fields & bit) == 0) {
+        return EC_NOATTR;
+    }
+
+    const ErrorCode ec =
+        getAttribute (fname, aname, query, &result, &length);
     if (ec == EC_OK && *dest == NULL) {
         *dest = result;
     } else if (ec > EC_NOATTR && *error == NULL) {
@@ -50,30 +64,51 @@ static ErrorCode handle_attribute (const char *fname,
     return ec;
 }
 
-#define ATTR(s, f) \
-    handle_attribute (fname, (s), &dest->f, &dest->error)
+#ifndef __APPLE__
+/* the attributes read below, for --has-provenance */
+static const AttrName xdgNames[] = {
+    { "user.xdg.origin.url",              AF_URL         },
+    { "user.xdg.referrer.url",            AF_REFERRER    },
+    { "user.xdg.origin.email.from",       AF_FROM        },
+    { "user.xdg.origin.email.subject",    AF_SUBJECT     },
+    { "user.xdg.origin.email.message-id", AF_MESSAGE_ID  },
+    { "user.xdg.publisher",               AF_APPLICATION },
+    { NULL,                               0              }
+};
+#endif
 
-#define A1(s, f) ErrorCode ec = ATTR(s, f)
-#define AN(s, f) ec = combineErrors (ec, ATTR(s, f))
+#define ATTR(s, f, bit) \
+    handle_attribute (fname, (s), (bit), query, &dest->f, &dest->error)
+
+#define A1(s, f, bit) ErrorCode ec = ATTR(s, f, bit)
+#define AN(s, f, bit) ec = combineErrors (ec, ATTR(s, f, bit))
 
 /* On MacOS, the getAttributes() in osx.c calls getAttributes_xdg(), so
  * that both MacOS and XDG attributes are supported.
  */
 #ifdef __APPLE__
 ErrorCode getAttributes_xdg (const char *fname,
+                             const AttrQuery *query,
                              Attributes *dest)
 #else
 ErrorCode getAttributes (const char *fname,
+                         const AttrQuery *query,
                          Attributes *dest,
                          Cache *cache)
 #endif
 {
-    A1("user.xdg.origin.url", url);
-    AN("user.xdg.referrer.url", referrer);
-    AN("user.xdg.origin.email.from", from);
-    AN("user.xdg.origin.email.subject", subject);
-    AN("user.xdg.origin.email.message-id", message_id);
-    AN("user.xdg.publisher", application);
+#ifndef __APPLE__
+    if (query->presenceOnly) {
+        return probeAttributes (fname, xdgNames, query, &dest->error);
+    }
+#endif
+
+    A1("user.xdg.origin.url", url, AF_URL);
+    AN("user.xdg.referrer.url", referrer, AF_REFERRER);
+    AN("user.xdg.origin.email.from", from, AF_FROM);
+    AN("user.xdg.origin.email.subject", subject, AF_SUBJECT);
+    AN("user.xdg.origin.email.message-id", message_id, AF_MESSAGE_ID);
+    AN("user.xdg.publisher", application, AF_APPLICATION);
 
     return ec;
 }